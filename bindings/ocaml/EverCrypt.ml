@@ -27,6 +27,7 @@ module Error = struct
     | AuthenticationFailure
     | InvalidIVLength
     | DecodeError
+    | MaximumLengthExceeded
   type 'a result =
     | Success of 'a
     | Error of error_code
@@ -37,6 +38,7 @@ module Error = struct
       | 3 -> AuthenticationFailure
       | 4 -> InvalidIVLength
       | 5 -> DecodeError
+      | 6 -> MaximumLengthExceeded
       | _ -> failwith "Impossible"
     in
     Error err
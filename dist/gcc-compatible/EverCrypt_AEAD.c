@@ -25,12 +25,33 @@
 #include "EverCrypt_AEAD.h"
 
 #include "internal/Vale.h"
+#include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Krmllib.h"
+#include "Hacl_Streaming_Poly1305_32.h"
+#include "Hacl_Streaming_Poly1305_128.h"
+#include "Hacl_Streaming_Poly1305_256.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_AES_CTR32_BitSlice.h"
+#include "Hacl_AES_CTR32_BitSlice_Vec128.h"
+#include "Hacl_AES_CTR32_BitSlice_Vec256.h"
+#include "Hacl_Gf128_CT64.h"
+#include "Lib_Memzero0.h"
+#if HACL_CAN_COMPILE_PCLMUL
+#include "Hacl_Gf128_NI.h"
+#endif
+#if HACL_CAN_COMPILE_VAES
+#include "Hacl_AES_GCM_VAES.h"
+#endif
 
 typedef struct EverCrypt_AEAD_state_s_s
 {
   Spec_Cipher_Expansion_impl impl;
   uint8_t *ek;
+  /* For the Vale AES-GCM: ek goes on with the 256 bytes of powers of H of
+     Hacl_AES_GCM_VAES, which then does the encryption and decryption */
+  bool vaes;
 }
 EverCrypt_AEAD_state_s;
 
@@ -57,6 +78,14 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -77,6 +106,215 @@ create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   return EverCrypt_Error_Success;
 }
 
+/* The portable AES-GCM, for CPUs without the AES-NI, PCLMULQDQ and MOVBE that
+   the Vale code needs: bitsliced AES, and GHASH on PCLMULQDQ when only AES-NI is
+   missing, in constant time on 64-bit words otherwise. Its expanded key is the
+   8 * (nr + 1) words of Hacl_AES_CTR32_BitSlice, then the hash key H. It is not
+   verified, and only used after EverCrypt_AutoConfig2_enable_bitsliced_aes. */
+
+static bool is_bitslice(Spec_Cipher_Expansion_impl i)
+{
+  return i == Spec_Cipher_Expansion_Hacl_AES128 || i == Spec_Cipher_Expansion_Hacl_AES256;
+}
+
+static uint32_t bitslice_rounds(Spec_Cipher_Expansion_impl i)
+{
+  if (i == Spec_Cipher_Expansion_Hacl_AES128)
+  {
+    return (uint32_t)10U;
+  }
+  return (uint32_t)14U;
+}
+
+static uint8_t *bitslice_hkey(uint32_t nr, uint8_t *ek)
+{
+  return ek + (nr + (uint32_t)1U) * (uint32_t)64U;
+}
+
+static bool has_ghash_ni()
+{
+  #if HACL_CAN_COMPILE_PCLMUL
+  return EverCrypt_AutoConfig2_has_pclmulqdq() && EverCrypt_AutoConfig2_has_sse();
+  #else
+  return false;
+  #endif
+}
+
+static bool has_vaes()
+{
+  #if HACL_CAN_COMPILE_VAES
+  return
+    EverCrypt_AutoConfig2_has_vaes()
+    && EverCrypt_AutoConfig2_has_vpclmulqdq()
+    && EverCrypt_AutoConfig2_has_avx512();
+  #else
+  return false;
+  #endif
+}
+
+static void
+ctr_bitslice(
+  uint32_t nr,
+  uint8_t *ek,
+  uint8_t *n,
+  uint32_t ctr,
+  uint32_t len,
+  uint8_t *in,
+  uint8_t *out
+)
+{
+  uint64_t *skey = (uint64_t *)ek;
+  #if HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    Hacl_AES_CTR32_BitSlice_Vec256_encrypt(nr, len, out, in, skey, n, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (EverCrypt_AutoConfig2_has_vec128())
+  {
+    Hacl_AES_CTR32_BitSlice_Vec128_encrypt(nr, len, out, in, skey, n, ctr);
+    return;
+  }
+  #endif
+  Hacl_AES_CTR32_BitSlice_encrypt(nr, len, out, in, skey, n, ctr);
+}
+
+static void expand_bitslice(uint32_t nr, uint8_t *ek, uint8_t *k)
+{
+  uint8_t zeros[16U] = { 0U };
+  uint8_t *h = bitslice_hkey(nr, ek);
+  Hacl_AES_CTR32_BitSlice_key_expansion(nr, (uint64_t *)ek, k);
+  ctr_bitslice(nr, ek, zeros, (uint32_t)0U, (uint32_t)16U, zeros, h);
+}
+
+/* GHASH of ad and text, each padded with zeros to a multiple of 16 bytes, then of
+   their lengths in bits. */
+static void
+gcm_ghash(uint8_t *tag, uint8_t *h, uint32_t ad_len, uint8_t *ad, uint32_t len, uint8_t *text)
+{
+  uint8_t lens[16U] = { 0U };
+  store64_be(lens, (uint64_t)ad_len * (uint64_t)8U);
+  store64_be(lens + (uint32_t)8U, (uint64_t)len * (uint64_t)8U);
+  #if HACL_CAN_COMPILE_PCLMUL
+  if (has_ghash_ni())
+  {
+    Lib_IntVector_Intrinsics_vec128 ctx[5U];
+    Hacl_Gf128_NI_gcm_init(ctx, h);
+    Hacl_Gf128_NI_gcm_update_blocks(ctx, ad_len, ad);
+    Hacl_Gf128_NI_gcm_update_blocks(ctx, len, text);
+    Hacl_Gf128_NI_gcm_update_blocks(ctx, (uint32_t)16U, lens);
+    Hacl_Gf128_NI_gcm_emit(tag, ctx);
+    return;
+  }
+  #endif
+  uint64_t ctx[8U] = { 0U };
+  Hacl_Gf128_CT64_gcm_init(ctx, h);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, ad_len, ad);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, len, text);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, (uint32_t)16U, lens);
+  Hacl_Gf128_CT64_gcm_emit(tag, ctx);
+}
+
+/* The first counter block J0: iv || 1 for a 96-bit iv, a GHASH of iv otherwise. */
+static void gcm_j0(uint8_t *j0, uint8_t *h, uint8_t *iv, uint32_t iv_len)
+{
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(j0, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(j0 + (uint32_t)12U, (uint32_t)1U);
+    return;
+  }
+  gcm_ghash(j0, h, (uint32_t)0U, iv, iv_len, iv);
+}
+
+static EverCrypt_Error_error_code
+encrypt_gcm_bitslice(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint32_t nr = bitslice_rounds(s->impl);
+  uint8_t *h = bitslice_hkey(nr, s->ek);
+  uint8_t j0[16U] = { 0U };
+  gcm_j0(j0, h, iv, iv_len);
+  uint32_t ctr = load32_be(j0 + (uint32_t)12U);
+  ctr_bitslice(nr, s->ek, j0, ctr + (uint32_t)1U, plain_len, plain, cipher);
+  gcm_ghash(tag, h, ad_len, ad, plain_len, cipher);
+  ctr_bitslice(nr, s->ek, j0, ctr, (uint32_t)16U, tag, tag);
+  return EverCrypt_Error_Success;
+}
+
+/* Unlike the Vale code, checks the tag before decrypting anything. */
+static EverCrypt_Error_error_code
+decrypt_gcm_bitslice(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint32_t nr = bitslice_rounds(s->impl);
+  uint8_t *h = bitslice_hkey(nr, s->ek);
+  uint8_t j0[16U] = { 0U };
+  uint8_t computed[16U] = { 0U };
+  gcm_j0(j0, h, iv, iv_len);
+  uint32_t ctr = load32_be(j0 + (uint32_t)12U);
+  gcm_ghash(computed, h, ad_len, ad, cipher_len, cipher);
+  ctr_bitslice(nr, s->ek, j0, ctr, (uint32_t)16U, computed, computed);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res != (uint8_t)255U)
+  {
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  ctr_bitslice(nr, s->ek, j0, ctr + (uint32_t)1U, cipher_len, cipher, dst);
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+create_in_gcm_bitslice(Spec_Cipher_Expansion_impl i, EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  if (!EverCrypt_AutoConfig2_wants_bitsliced_aes())
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t nr = bitslice_rounds(i);
+  uint8_t
+  *ek = KRML_HOST_CALLOC((nr + (uint32_t)1U) * (uint32_t)64U + (uint32_t)16U, sizeof (uint8_t));
+  expand_bitslice(nr, ek, k);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = i, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
 static EverCrypt_Error_error_code
 create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
 {
@@ -88,19 +326,32 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   #if HACL_CAN_COMPILE_VALE
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)480U, sizeof (uint8_t));
+    bool vaes = has_vaes();
+    uint32_t ek_len = (uint32_t)480U;
+    if (vaes)
+    {
+      ek_len = (uint32_t)736U;
+    }
+    uint8_t *ek = KRML_HOST_CALLOC(ek_len, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b);
     uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    #if HACL_CAN_COMPILE_VAES
+    if (vaes)
+    {
+      Hacl_AES_GCM_VAES_init(ek + (uint32_t)480U, (uint32_t)10U, keys_b);
+    }
+    #endif
     KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
     EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
+    p[0U] =
+      ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek, .vaes = vaes });
     *dst = p;
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  return create_in_gcm_bitslice(Spec_Cipher_Expansion_Hacl_AES128, dst, k);
 }
 
 static EverCrypt_Error_error_code
@@ -114,19 +365,32 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   #if HACL_CAN_COMPILE_VALE
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)544U, sizeof (uint8_t));
+    bool vaes = has_vaes();
+    uint32_t ek_len = (uint32_t)544U;
+    if (vaes)
+    {
+      ek_len = (uint32_t)800U;
+    }
+    uint8_t *ek = KRML_HOST_CALLOC(ek_len, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b);
     uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    #if HACL_CAN_COMPILE_VAES
+    if (vaes)
+    {
+      Hacl_AES_GCM_VAES_init(ek + (uint32_t)544U, (uint32_t)14U, keys_b);
+    }
+    #endif
     KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
     EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
+    p[0U] =
+      ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek, .vaes = vaes });
     *dst = p;
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  return create_in_gcm_bitslice(Spec_Cipher_Expansion_Hacl_AES256, dst, k);
 }
 
 EverCrypt_Error_error_code
@@ -177,6 +441,23 @@ encrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
+  #if HACL_CAN_COMPILE_VAES
+  if (scrut.vaes)
+  {
+    Hacl_AES_GCM_VAES_encrypt((uint32_t)10U,
+      ek,
+      ek + (uint32_t)480U,
+      iv,
+      iv_len,
+      ad,
+      ad_len,
+      plain_len,
+      plain,
+      cipher,
+      tag);
+    return EverCrypt_Error_Success;
+  }
+  #endif
   uint8_t *scratch_b = ek + (uint32_t)304U;
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
@@ -301,6 +582,23 @@ encrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
+  #if HACL_CAN_COMPILE_VAES
+  if (scrut.vaes)
+  {
+    Hacl_AES_GCM_VAES_encrypt((uint32_t)14U,
+      ek,
+      ek + (uint32_t)544U,
+      iv,
+      iv_len,
+      ad,
+      ad_len,
+      plain_len,
+      plain,
+      cipher,
+      tag);
+    return EverCrypt_Error_Success;
+  }
+  #endif
   uint8_t *scratch_b = ek + (uint32_t)368U;
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
@@ -431,6 +729,11 @@ EverCrypt_AEAD_encrypt(
       {
         return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return encrypt_gcm_bitslice(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         if (iv_len != (uint32_t)12U)
@@ -448,89 +751,412 @@ EverCrypt_AEAD_encrypt(
   }
 }
 
-/*
-WARNING: this function doesn't perform any dynamic
-  hardware check. You MUST make sure your hardware supports the
-  implementation of AESGCM. Besides, this function was not designed
-  for cross-compilation: if you compile it on a system which doesn't
-  support Vale, it will compile it to a function which makes the
-  program exit.
-*/
 EverCrypt_Error_error_code
-EverCrypt_AEAD_encrypt_expand_aes128_gcm_no_check(
-  uint8_t *k,
-  uint8_t *iv,
+EverCrypt_AEAD_encrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t num,
+  uint8_t **iv,
   uint32_t iv_len,
-  uint8_t *ad,
-  uint32_t ad_len,
-  uint8_t *plain,
-  uint32_t plain_len,
-  uint8_t *cipher,
-  uint8_t *tag
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag
 )
 {
-  #if HACL_CAN_COMPILE_VALE
-  uint8_t ek[480U] = { 0U };
-  uint8_t *keys_b0 = ek;
-  uint8_t *hkeys_b0 = ek + (uint32_t)176U;
-  uint64_t scrut0 = aes128_key_expansion(k, keys_b0);
-  uint64_t scrut1 = aes128_keyhash_init(keys_b0, hkeys_b0);
-  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek };
-  EverCrypt_AEAD_state_s *s = &p;
-  EverCrypt_Error_error_code r;
   if (s == NULL)
   {
-    r = EverCrypt_Error_InvalidKey;
+    return EverCrypt_Error_InvalidKey;
   }
-  else if (iv_len == (uint32_t)0U)
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
   {
-    r = EverCrypt_Error_InvalidIVLength;
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        for (uint32_t j = (uint32_t)0U; j < num; j++)
+        {
+          encrypt_aes128_gcm(s,
+            iv[j],
+            iv_len,
+            ad[j],
+            ad_len[j],
+            plain[j],
+            plain_len[j],
+            cipher[j],
+            tag[j]);
+        }
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        for (uint32_t j = (uint32_t)0U; j < num; j++)
+        {
+          encrypt_aes256_gcm(s,
+            iv[j],
+            iv_len,
+            ad[j],
+            ad_len[j],
+            plain[j],
+            plain_len[j],
+            cipher[j],
+            tag[j]);
+        }
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        for (uint32_t j = (uint32_t)0U; j < num; j++)
+        {
+          encrypt_gcm_bitslice(s,
+            iv[j],
+            iv_len,
+            ad[j],
+            ad_len[j],
+            plain[j],
+            plain_len[j],
+            cipher[j],
+            tag[j]);
+        }
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        #if HACL_CAN_COMPILE_VEC256
+        if (EverCrypt_AutoConfig2_has_vec256())
+        {
+          Hacl_Chacha20Poly1305_256_aead_encrypt_batch(ek,
+            num,
+            iv,
+            ad_len,
+            ad,
+            plain_len,
+            plain,
+            cipher,
+            tag);
+          return EverCrypt_Error_Success;
+        }
+        #endif
+        for (uint32_t j = (uint32_t)0U; j < num; j++)
+        {
+          EverCrypt_Chacha20Poly1305_aead_encrypt(ek,
+            iv[j],
+            ad_len[j],
+            ad[j],
+            plain_len[j],
+            plain[j],
+            cipher[j],
+            tag[j]);
+        }
+        return EverCrypt_Error_Success;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
   }
-  else
+}
+
+static uint64_t total_len(uint32_t num, uint32_t *len)
+{
+  uint64_t total = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
   {
-    EverCrypt_AEAD_state_s scrut = *s;
-    uint8_t *ek0 = scrut.ek;
-    uint8_t *scratch_b = ek0 + (uint32_t)304U;
-    uint8_t *ek1 = ek0;
-    uint8_t *keys_b = ek1;
-    uint8_t *hkeys_b = ek1 + (uint32_t)176U;
-    uint8_t tmp_iv[16U] = { 0U };
-    uint32_t len = iv_len / (uint32_t)16U;
-    uint32_t bytes_len = len * (uint32_t)16U;
-    uint8_t *iv_b = iv;
-    memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (uint8_t));
-    uint64_t
-    uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
-    uint8_t *inout_b = scratch_b;
-    uint8_t *abytes_b = scratch_b + (uint32_t)16U;
-    uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
-    uint32_t plain_len_ = (uint32_t)(uint64_t)plain_len / (uint32_t)16U * (uint32_t)16U;
-    uint32_t auth_len_ = (uint32_t)(uint64_t)ad_len / (uint32_t)16U * (uint32_t)16U;
-    uint8_t *plain_b_ = plain;
-    uint8_t *out_b_ = cipher;
-    uint8_t *auth_b_ = ad;
-    memcpy(inout_b,
-      plain + plain_len_,
-      (uint32_t)(uint64_t)plain_len % (uint32_t)16U * sizeof (uint8_t));
-    memcpy(abytes_b,
-      ad + auth_len_,
-      (uint32_t)(uint64_t)ad_len % (uint32_t)16U * sizeof (uint8_t));
-    uint64_t len128x6 = (uint64_t)plain_len / (uint64_t)96U * (uint64_t)96U;
-    if (len128x6 / (uint64_t)16U >= (uint64_t)18U)
-    {
-      uint64_t len128_num = (uint64_t)plain_len / (uint64_t)16U * (uint64_t)16U - len128x6;
-      uint8_t *in128x6_b = plain_b_;
-      uint8_t *out128x6_b = out_b_;
-      uint8_t *in128_b = plain_b_ + (uint32_t)len128x6;
-      uint8_t *out128_b = out_b_ + (uint32_t)len128x6;
-      uint64_t auth_num = (uint64_t)ad_len / (uint64_t)16U;
-      uint64_t len128x6_ = len128x6 / (uint64_t)16U;
-      uint64_t len128_num_ = len128_num / (uint64_t)16U;
-      uint64_t
-      scrut2 =
-        gcm128_encrypt_opt(auth_b_,
-          (uint64_t)ad_len,
-          auth_num,
+    total = total + (uint64_t)len[i];
+  }
+  return total;
+}
+
+/* The Vale AES-GCM code only takes contiguous buffers: a list of segments is
+   gathered into a fresh buffer, unless it is a single segment already. An empty list
+   gathers to NULL, and so does one whose buffer could not be allocated; see
+   gather_failed. */
+static uint8_t *gather(uint32_t num, uint32_t *len, uint8_t **seg, uint32_t total)
+{
+  if (num == (uint32_t)1U)
+  {
+    return seg[0U];
+  }
+  if (total == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), total);
+  uint8_t *buf = KRML_HOST_MALLOC(total * sizeof (uint8_t));
+  if (buf == NULL)
+  {
+    return NULL;
+  }
+  uint32_t off = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    memcpy(buf + off, seg[i], len[i] * sizeof (uint8_t));
+    off = off + len[i];
+  }
+  return buf;
+}
+
+static bool gather_failed(uint32_t num, uint32_t total, uint8_t *buf)
+{
+  return num != (uint32_t)1U && total != (uint32_t)0U && buf == NULL;
+}
+
+static void scatter(uint32_t num, uint32_t *len, uint8_t **seg, uint8_t *buf)
+{
+  if (num == (uint32_t)1U || buf == NULL)
+  {
+    return;
+  }
+  uint32_t off = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    memcpy(seg[i], buf + off, len[i] * sizeof (uint8_t));
+    off = off + len[i];
+  }
+  KRML_HOST_FREE(buf);
+}
+
+static void release(uint32_t num, uint8_t *buf)
+{
+  if (num != (uint32_t)1U)
+  {
+    KRML_HOST_FREE(buf);
+  }
+}
+
+static EverCrypt_Error_error_code
+encrypt_gcm_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_num,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t plain_num,
+  uint32_t *plain_len,
+  uint8_t **plain,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+)
+{
+  uint64_t ad_total64 = total_len(ad_num, ad_len);
+  uint64_t len64 = total_len(plain_num, plain_len);
+  if (ad_total64 > (uint64_t)0xffffffffU || len64 > (uint64_t)0xffffffffU)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint32_t ad_total = (uint32_t)ad_total64;
+  uint32_t len = (uint32_t)len64;
+  uint8_t *ad1 = gather(ad_num, ad_len, ad, ad_total);
+  uint8_t *plain1 = gather(plain_num, plain_len, plain, len);
+  uint8_t *cipher1 = gather(cipher_num, cipher_len, cipher, len);
+  if
+  (
+    gather_failed(ad_num, ad_total, ad1)
+    || gather_failed(plain_num, len, plain1)
+    || gather_failed(cipher_num, len, cipher1)
+  )
+  {
+    release(cipher_num, cipher1);
+    release(plain_num, plain1);
+    release(ad_num, ad1);
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_encrypt(s, iv, iv_len, ad1, ad_total, plain1, len, cipher1, tag);
+  scatter(cipher_num, cipher_len, cipher, cipher1);
+  release(plain_num, plain1);
+  release(ad_num, ad1);
+  return r;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_num,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t plain_num,
+  uint32_t *plain_len,
+  uint8_t **plain,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (total_len(plain_num, plain_len) != total_len(cipher_num, cipher_len))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        return
+          encrypt_gcm_iov(s,
+            iv,
+            iv_len,
+            ad_num,
+            ad_len,
+            ad,
+            plain_num,
+            plain_len,
+            plain,
+            cipher_num,
+            cipher_len,
+            cipher,
+            tag);
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        EverCrypt_Chacha20Poly1305_aead_encrypt_iov(ek,
+          iv,
+          ad_num,
+          ad_len,
+          ad,
+          plain_num,
+          plain_len,
+          plain,
+          cipher_num,
+          cipher_len,
+          cipher,
+          tag);
+        return EverCrypt_Error_Success;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/*
+WARNING: this function doesn't perform any dynamic
+  hardware check. You MUST make sure your hardware supports the
+  implementation of AESGCM. Besides, this function was not designed
+  for cross-compilation: if you compile it on a system which doesn't
+  support Vale, it will compile it to a function which makes the
+  program exit.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_aes128_gcm_no_check(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t ek[480U] = { 0U };
+  uint8_t *keys_b0 = ek;
+  uint8_t *hkeys_b0 = ek + (uint32_t)176U;
+  uint64_t scrut0 = aes128_key_expansion(k, keys_b0);
+  uint64_t scrut1 = aes128_keyhash_init(keys_b0, hkeys_b0);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek };
+  EverCrypt_AEAD_state_s *s = &p;
+  EverCrypt_Error_error_code r;
+  if (s == NULL)
+  {
+    r = EverCrypt_Error_InvalidKey;
+  }
+  else if (iv_len == (uint32_t)0U)
+  {
+    r = EverCrypt_Error_InvalidIVLength;
+  }
+  else
+  {
+    EverCrypt_AEAD_state_s scrut = *s;
+    uint8_t *ek0 = scrut.ek;
+    uint8_t *scratch_b = ek0 + (uint32_t)304U;
+    uint8_t *ek1 = ek0;
+    uint8_t *keys_b = ek1;
+    uint8_t *hkeys_b = ek1 + (uint32_t)176U;
+    uint8_t tmp_iv[16U] = { 0U };
+    uint32_t len = iv_len / (uint32_t)16U;
+    uint32_t bytes_len = len * (uint32_t)16U;
+    uint8_t *iv_b = iv;
+    memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (uint8_t));
+    uint64_t
+    uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+    uint8_t *inout_b = scratch_b;
+    uint8_t *abytes_b = scratch_b + (uint32_t)16U;
+    uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
+    uint32_t plain_len_ = (uint32_t)(uint64_t)plain_len / (uint32_t)16U * (uint32_t)16U;
+    uint32_t auth_len_ = (uint32_t)(uint64_t)ad_len / (uint32_t)16U * (uint32_t)16U;
+    uint8_t *plain_b_ = plain;
+    uint8_t *out_b_ = cipher;
+    uint8_t *auth_b_ = ad;
+    memcpy(inout_b,
+      plain + plain_len_,
+      (uint32_t)(uint64_t)plain_len % (uint32_t)16U * sizeof (uint8_t));
+    memcpy(abytes_b,
+      ad + auth_len_,
+      (uint32_t)(uint64_t)ad_len % (uint32_t)16U * sizeof (uint8_t));
+    uint64_t len128x6 = (uint64_t)plain_len / (uint64_t)96U * (uint64_t)96U;
+    if (len128x6 / (uint64_t)16U >= (uint64_t)18U)
+    {
+      uint64_t len128_num = (uint64_t)plain_len / (uint64_t)16U * (uint64_t)16U - len128x6;
+      uint8_t *in128x6_b = plain_b_;
+      uint8_t *out128x6_b = out_b_;
+      uint8_t *in128_b = plain_b_ + (uint32_t)len128x6;
+      uint8_t *out128_b = out_b_ + (uint32_t)len128x6;
+      uint64_t auth_num = (uint64_t)ad_len / (uint64_t)16U;
+      uint64_t len128x6_ = len128x6 / (uint64_t)16U;
+      uint64_t len128_num_ = len128_num / (uint64_t)16U;
+      uint64_t
+      scrut2 =
+        gcm128_encrypt_opt(auth_b_,
+          (uint64_t)ad_len,
+          auth_num,
           keys_b,
           tmp_iv,
           hkeys_b,
@@ -872,7 +1498,16 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (!EverCrypt_AutoConfig2_wants_bitsliced_aes())
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint64_t ek[90U] = { 0U };
+  expand_bitslice((uint32_t)10U, (uint8_t *)ek, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = (uint8_t *)ek };
+  EverCrypt_Error_error_code r = encrypt_gcm_bitslice(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ek, (uint32_t)90U * sizeof (ek[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -1011,7 +1646,16 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (!EverCrypt_AutoConfig2_wants_bitsliced_aes())
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint64_t ek[122U] = { 0U };
+  expand_bitslice((uint32_t)14U, (uint8_t *)ek, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = (uint8_t *)ek };
+  EverCrypt_Error_error_code r = encrypt_gcm_bitslice(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ek, (uint32_t)122U * sizeof (ek[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -1124,6 +1768,29 @@ decrypt_aes128_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
+  #if HACL_CAN_COMPILE_VAES
+  if (scrut.vaes)
+  {
+    uint32_t
+    r =
+      Hacl_AES_GCM_VAES_decrypt((uint32_t)10U,
+        ek,
+        ek + (uint32_t)480U,
+        iv,
+        iv_len,
+        ad,
+        ad_len,
+        cipher_len,
+        cipher,
+        dst,
+        tag);
+    if (r == (uint32_t)0U)
+    {
+      return EverCrypt_Error_Success;
+    }
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  #endif
   uint8_t *scratch_b = ek + (uint32_t)304U;
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
@@ -1224,6 +1891,7 @@ decrypt_aes128_gcm(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
   #else
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
@@ -1258,6 +1926,29 @@ decrypt_aes256_gcm(
   }
   EverCrypt_AEAD_state_s scrut = *s;
   uint8_t *ek = scrut.ek;
+  #if HACL_CAN_COMPILE_VAES
+  if (scrut.vaes)
+  {
+    uint32_t
+    r =
+      Hacl_AES_GCM_VAES_decrypt((uint32_t)14U,
+        ek,
+        ek + (uint32_t)544U,
+        iv,
+        iv_len,
+        ad,
+        ad_len,
+        cipher_len,
+        cipher,
+        dst,
+        tag);
+    if (r == (uint32_t)0U)
+    {
+      return EverCrypt_Error_Success;
+    }
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  #endif
   uint8_t *scratch_b = ek + (uint32_t)368U;
   uint8_t *ek1 = ek;
   uint8_t *keys_b = ek1;
@@ -1358,6 +2049,7 @@ decrypt_aes256_gcm(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
   #else
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
@@ -1429,6 +2121,11 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return decrypt_gcm_bitslice(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
@@ -1441,70 +2138,303 @@ EverCrypt_AEAD_decrypt(
   }
 }
 
-/*
-WARNING: this function doesn't perform any dynamic
-  hardware check. You MUST make sure your hardware supports the
-  implementation of AESGCM. Besides, this function was not designed
-  for cross-compilation: if you compile it on a system which doesn't
-  support Vale, it will compile it to a function which makes the
-  program exit.
-*/
 EverCrypt_Error_error_code
-EverCrypt_AEAD_decrypt_expand_aes128_gcm_no_check(
-  uint8_t *k,
-  uint8_t *iv,
+EverCrypt_AEAD_decrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t num,
+  uint8_t **iv,
   uint32_t iv_len,
-  uint8_t *ad,
-  uint32_t ad_len,
-  uint8_t *cipher,
-  uint32_t cipher_len,
-  uint8_t *tag,
-  uint8_t *dst
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **cipher,
+  uint32_t *cipher_len,
+  uint8_t **tag,
+  uint8_t **dst,
+  EverCrypt_Error_error_code *res
 )
 {
-  #if HACL_CAN_COMPILE_VALE
-  uint8_t ek[480U] = { 0U };
-  uint8_t *keys_b0 = ek;
-  uint8_t *hkeys_b0 = ek + (uint32_t)176U;
-  uint64_t scrut = aes128_key_expansion(k, keys_b0);
-  uint64_t scrut0 = aes128_keyhash_init(keys_b0, hkeys_b0);
-  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek };
-  EverCrypt_AEAD_state_s *s = &p;
+  EverCrypt_Error_error_code check = EverCrypt_Error_Success;
   if (s == NULL)
   {
-    return EverCrypt_Error_InvalidKey;
+    check = EverCrypt_Error_InvalidKey;
   }
-  if (iv_len == (uint32_t)0U)
+  else if (iv_len == (uint32_t)0U)
   {
-    return EverCrypt_Error_InvalidIVLength;
+    check = EverCrypt_Error_InvalidIVLength;
   }
-  EverCrypt_AEAD_state_s scrut1 = *s;
-  uint8_t *ek0 = scrut1.ek;
-  uint8_t *scratch_b = ek0 + (uint32_t)304U;
-  uint8_t *ek1 = ek0;
-  uint8_t *keys_b = ek1;
-  uint8_t *hkeys_b = ek1 + (uint32_t)176U;
-  uint8_t tmp_iv[16U] = { 0U };
-  uint32_t len = iv_len / (uint32_t)16U;
-  uint32_t bytes_len = len * (uint32_t)16U;
-  uint8_t *iv_b = iv;
-  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (uint8_t));
-  uint64_t
-  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
-  uint8_t *inout_b = scratch_b;
-  uint8_t *abytes_b = scratch_b + (uint32_t)16U;
-  uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
-  uint32_t cipher_len_ = (uint32_t)(uint64_t)cipher_len / (uint32_t)16U * (uint32_t)16U;
-  uint32_t auth_len_ = (uint32_t)(uint64_t)ad_len / (uint32_t)16U * (uint32_t)16U;
-  uint8_t *cipher_b_ = cipher;
-  uint8_t *out_b_ = dst;
-  uint8_t *auth_b_ = ad;
-  memcpy(inout_b,
-    cipher + cipher_len_,
-    (uint32_t)(uint64_t)cipher_len % (uint32_t)16U * sizeof (uint8_t));
-  memcpy(abytes_b,
-    ad + auth_len_,
-    (uint32_t)(uint64_t)ad_len % (uint32_t)16U * sizeof (uint8_t));
+  else if (s->impl == Spec_Cipher_Expansion_Hacl_CHACHA20 && iv_len != (uint32_t)12U)
+  {
+    check = EverCrypt_Error_InvalidIVLength;
+  }
+  if (check != EverCrypt_Error_Success)
+  {
+    for (uint32_t j = (uint32_t)0U; j < num; j++)
+    {
+      res[j] = check;
+    }
+    return check;
+  }
+  EverCrypt_Error_error_code r = EverCrypt_Error_Success;
+  #if HACL_CAN_COMPILE_VEC256
+  if (s->impl == Spec_Cipher_Expansion_Hacl_CHACHA20 && EverCrypt_AutoConfig2_has_vec256())
+  {
+    uint32_t r32[64U] = { 0U };
+    for (uint32_t start = (uint32_t)0U; start < num; start = start + (uint32_t)64U)
+    {
+      uint32_t n = num - start < (uint32_t)64U ? num - start : (uint32_t)64U;
+      Hacl_Chacha20Poly1305_256_aead_decrypt_batch(s->ek,
+        n,
+        iv + start,
+        ad_len + start,
+        ad + start,
+        cipher_len + start,
+        dst + start,
+        cipher + start,
+        tag + start,
+        r32);
+      for (uint32_t j = (uint32_t)0U; j < n; j++)
+      {
+        if (r32[j] == (uint32_t)0U)
+        {
+          res[start + j] = EverCrypt_Error_Success;
+        }
+        else
+        {
+          res[start + j] = EverCrypt_Error_AuthenticationFailure;
+          r = EverCrypt_Error_AuthenticationFailure;
+        }
+      }
+    }
+    return r;
+  }
+  #endif
+  for (uint32_t j = (uint32_t)0U; j < num; j++)
+  {
+    res[j] =
+      EverCrypt_AEAD_decrypt(s,
+        iv[j],
+        iv_len,
+        ad[j],
+        ad_len[j],
+        cipher[j],
+        cipher_len[j],
+        tag[j],
+        dst[j]);
+    if (res[j] != EverCrypt_Error_Success)
+    {
+      r = EverCrypt_Error_AuthenticationFailure;
+    }
+  }
+  return r;
+}
+
+static EverCrypt_Error_error_code
+decrypt_gcm_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_num,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag,
+  uint32_t dst_num,
+  uint32_t *dst_len,
+  uint8_t **dst
+)
+{
+  uint64_t ad_total64 = total_len(ad_num, ad_len);
+  uint64_t len64 = total_len(cipher_num, cipher_len);
+  if (ad_total64 > (uint64_t)0xffffffffU || len64 > (uint64_t)0xffffffffU)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint32_t ad_total = (uint32_t)ad_total64;
+  uint32_t len = (uint32_t)len64;
+  uint8_t *ad1 = gather(ad_num, ad_len, ad, ad_total);
+  uint8_t *cipher1 = gather(cipher_num, cipher_len, cipher, len);
+  uint8_t *dst1 = gather(dst_num, dst_len, dst, len);
+  if
+  (
+    gather_failed(ad_num, ad_total, ad1)
+    || gather_failed(cipher_num, len, cipher1)
+    || gather_failed(dst_num, len, dst1)
+  )
+  {
+    release(dst_num, dst1);
+    release(cipher_num, cipher1);
+    release(ad_num, ad1);
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_decrypt(s, iv, iv_len, ad1, ad_total, cipher1, len, tag, dst1);
+  if (r == EverCrypt_Error_Success)
+  {
+    scatter(dst_num, dst_len, dst, dst1);
+  }
+  else
+  {
+    release(dst_num, dst1);
+  }
+  release(cipher_num, cipher1);
+  release(ad_num, ad1);
+  return r;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_num,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag,
+  uint32_t dst_num,
+  uint32_t *dst_len,
+  uint8_t **dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (total_len(cipher_num, cipher_len) != total_len(dst_num, dst_len))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl i = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Cipher_Expansion_Vale_AES256:
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        return
+          decrypt_gcm_iov(s,
+            iv,
+            iv_len,
+            ad_num,
+            ad_len,
+            ad,
+            cipher_num,
+            cipher_len,
+            cipher,
+            tag,
+            dst_num,
+            dst_len,
+            dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        if (iv_len != (uint32_t)12U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        uint32_t
+        r =
+          EverCrypt_Chacha20Poly1305_aead_decrypt_iov(ek,
+            iv,
+            ad_num,
+            ad_len,
+            ad,
+            dst_num,
+            dst_len,
+            dst,
+            cipher_num,
+            cipher_len,
+            cipher,
+            tag);
+        if (r == (uint32_t)0U)
+        {
+          return EverCrypt_Error_Success;
+        }
+        return EverCrypt_Error_AuthenticationFailure;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/*
+WARNING: this function doesn't perform any dynamic
+  hardware check. You MUST make sure your hardware supports the
+  implementation of AESGCM. Besides, this function was not designed
+  for cross-compilation: if you compile it on a system which doesn't
+  support Vale, it will compile it to a function which makes the
+  program exit.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_aes128_gcm_no_check(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t ek[480U] = { 0U };
+  uint8_t *keys_b0 = ek;
+  uint8_t *hkeys_b0 = ek + (uint32_t)176U;
+  uint64_t scrut = aes128_key_expansion(k, keys_b0);
+  uint64_t scrut0 = aes128_keyhash_init(keys_b0, hkeys_b0);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek };
+  EverCrypt_AEAD_state_s *s = &p;
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut1 = *s;
+  uint8_t *ek0 = scrut1.ek;
+  uint8_t *scratch_b = ek0 + (uint32_t)304U;
+  uint8_t *ek1 = ek0;
+  uint8_t *keys_b = ek1;
+  uint8_t *hkeys_b = ek1 + (uint32_t)176U;
+  uint8_t tmp_iv[16U] = { 0U };
+  uint32_t len = iv_len / (uint32_t)16U;
+  uint32_t bytes_len = len * (uint32_t)16U;
+  uint8_t *iv_b = iv;
+  memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (uint8_t));
+  uint64_t
+  uu____0 = compute_iv_stdcall(iv_b, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+  uint8_t *inout_b = scratch_b;
+  uint8_t *abytes_b = scratch_b + (uint32_t)16U;
+  uint8_t *scratch_b1 = scratch_b + (uint32_t)32U;
+  uint32_t cipher_len_ = (uint32_t)(uint64_t)cipher_len / (uint32_t)16U * (uint32_t)16U;
+  uint32_t auth_len_ = (uint32_t)(uint64_t)ad_len / (uint32_t)16U * (uint32_t)16U;
+  uint8_t *cipher_b_ = cipher;
+  uint8_t *out_b_ = dst;
+  uint8_t *auth_b_ = ad;
+  memcpy(inout_b,
+    cipher + cipher_len_,
+    (uint32_t)(uint64_t)cipher_len % (uint32_t)16U * sizeof (uint8_t));
+  memcpy(abytes_b,
+    ad + auth_len_,
+    (uint32_t)(uint64_t)ad_len % (uint32_t)16U * sizeof (uint8_t));
   uint64_t len128x6 = (uint64_t)cipher_len / (uint64_t)96U * (uint64_t)96U;
   uint64_t c;
   if (len128x6 / (uint64_t)16U >= (uint64_t)6U)
@@ -1580,6 +2510,7 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm_no_check(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
   #else
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
@@ -1729,6 +2660,7 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm_no_check(
   {
     return EverCrypt_Error_Success;
   }
+  memset(dst, 0U, cipher_len * sizeof (uint8_t));
   return EverCrypt_Error_AuthenticationFailure;
   #else
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
@@ -1881,12 +2813,22 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
       }
       else
       {
+        memset(dst, 0U, cipher_len * sizeof (uint8_t));
         return EverCrypt_Error_AuthenticationFailure;
       }
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (!EverCrypt_AutoConfig2_wants_bitsliced_aes())
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint64_t ek[90U] = { 0U };
+  expand_bitslice((uint32_t)10U, (uint8_t *)ek, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = (uint8_t *)ek };
+  EverCrypt_Error_error_code r = decrypt_gcm_bitslice(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ek, (uint32_t)90U * sizeof (ek[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -2031,12 +2973,22 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
       }
       else
       {
+        memset(dst, 0U, cipher_len * sizeof (uint8_t));
         return EverCrypt_Error_AuthenticationFailure;
       }
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (!EverCrypt_AutoConfig2_wants_bitsliced_aes())
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint64_t ek[122U] = { 0U };
+  expand_bitslice((uint32_t)14U, (uint8_t *)ek, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = (uint8_t *)ek };
+  EverCrypt_Error_error_code r = decrypt_gcm_bitslice(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ek, (uint32_t)122U * sizeof (ek[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -2132,3 +3084,587 @@ void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s)
   KRML_HOST_FREE(s);
 }
 
+
+typedef struct EverCrypt_AEAD_Incremental_state_s_s
+{
+  EverCrypt_AEAD_state_s *s;
+  /* 0: no message started, 1: taking additional data, 2: encrypting, 3: decrypting */
+  uint8_t phase;
+  uint64_t ad_len;
+  uint64_t len;
+  /* The Chacha20 nonce, or J0 for AES-GCM: in the byte order of gctr_bytes for the
+     Vale code, as is for the bitsliced one */
+  uint8_t nonce[16U];
+  /* Keystream of the block at len, while len is not a multiple of the block size */
+  uint8_t ks[64U];
+  /* GHASH input waiting for a full block */
+  uint8_t block[16U];
+  uint32_t block_used;
+  Hacl_Streaming_Poly1305_32_poly1305_32_state *mac32;
+  Hacl_Streaming_Poly1305_128_poly1305_128_state *mac128;
+  Hacl_Streaming_Poly1305_256_poly1305_256_state *mac256;
+  bool ghash_ni;
+  #if HACL_CAN_COMPILE_PCLMUL
+  Lib_IntVector_Intrinsics_vec128 ghash[5U];
+  #endif
+  uint64_t ghash_ct[8U];
+}
+EverCrypt_AEAD_Incremental_state_s;
+
+static bool is_chacha(EverCrypt_AEAD_Incremental_state_s *st)
+{
+  return st->s->impl == Spec_Cipher_Expansion_Hacl_CHACHA20;
+}
+
+static uint32_t block_len(EverCrypt_AEAD_Incremental_state_s *st)
+{
+  if (is_chacha(st))
+  {
+    return (uint32_t)64U;
+  }
+  return (uint32_t)16U;
+}
+
+/* The counter of J0. */
+static uint32_t j0_ctr(EverCrypt_AEAD_Incremental_state_s *st)
+{
+  if (is_bitslice(st->s->impl))
+  {
+    return load32_be(st->nonce + (uint32_t)12U);
+  }
+  return load32_le(st->nonce);
+}
+
+/* AES-CTR from counter ctr over len bytes, a multiple of 16, with the other 96 bits of
+   the counter block taken from nonce. */
+static void
+gcm_ctr(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *nonce,
+  uint32_t ctr,
+  uint32_t len,
+  uint8_t *in,
+  uint8_t *out
+)
+{
+  if (is_bitslice(s->impl))
+  {
+    ctr_bitslice(bitslice_rounds(s->impl), s->ek, nonce, ctr, len, in, out);
+    return;
+  }
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t ctr_block[16U] = { 0U };
+  uint8_t inout_b[16U] = { 0U };
+  memcpy(ctr_block, nonce, (uint32_t)16U * sizeof (uint8_t));
+  store32_le(ctr_block, ctr);
+  if (s->impl == Spec_Cipher_Expansion_Vale_AES128)
+  {
+    uint64_t
+    scrut =
+      gctr128_bytes(in,
+        (uint64_t)len,
+        out,
+        inout_b,
+        s->ek,
+        ctr_block,
+        (uint64_t)(len / (uint32_t)16U));
+  }
+  else
+  {
+    uint64_t
+    scrut =
+      gctr256_bytes(in,
+        (uint64_t)len,
+        out,
+        inout_b,
+        s->ek,
+        ctr_block,
+        (uint64_t)(len / (uint32_t)16U));
+  }
+  #endif
+}
+
+/* Encrypts len bytes, a multiple of the block size, at position st->len. */
+static void
+cipher_blocks(EverCrypt_AEAD_Incremental_state_s *st, uint32_t len, uint8_t *in, uint8_t *out)
+{
+  if (is_chacha(st))
+  {
+    uint32_t ctr = (uint32_t)(st->len / (uint64_t)64U) + (uint32_t)1U;
+    #if HACL_CAN_COMPILE_VEC256
+    if (st->mac256 != NULL)
+    {
+      Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, out, in, st->s->ek, st->nonce, ctr);
+      return;
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC128
+    if (st->mac128 != NULL)
+    {
+      Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, out, in, st->s->ek, st->nonce, ctr);
+      return;
+    }
+    #endif
+    Hacl_Chacha20_chacha20_encrypt(len, out, in, st->s->ek, st->nonce, ctr);
+    return;
+  }
+  uint32_t ctr = j0_ctr(st) + (uint32_t)1U + (uint32_t)(st->len / (uint64_t)16U);
+  gcm_ctr(st->s, st->nonce, ctr, len, in, out);
+}
+
+static void ghash_update(EverCrypt_AEAD_Incremental_state_s *st, uint32_t len, uint8_t *data)
+{
+  #if HACL_CAN_COMPILE_PCLMUL
+  if (st->ghash_ni)
+  {
+    Hacl_Gf128_NI_gcm_update_blocks(st->ghash, len, data);
+    return;
+  }
+  #endif
+  Hacl_Gf128_CT64_gcm_update_blocks(st->ghash_ct, len, data);
+}
+
+static void mac_update(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *data, uint32_t len)
+{
+  if (is_chacha(st))
+  {
+    #if HACL_CAN_COMPILE_VEC256
+    if (st->mac256 != NULL)
+    {
+      Hacl_Streaming_Poly1305_256_update(st->mac256, data, len);
+      return;
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC128
+    if (st->mac128 != NULL)
+    {
+      Hacl_Streaming_Poly1305_128_update(st->mac128, data, len);
+      return;
+    }
+    #endif
+    Hacl_Streaming_Poly1305_32_update(st->mac32, data, len);
+    return;
+  }
+  uint32_t n = (uint32_t)0U;
+  if (st->block_used > (uint32_t)0U)
+  {
+    n = (uint32_t)16U - st->block_used;
+    if (len < n)
+    {
+      n = len;
+    }
+    memcpy(st->block + st->block_used, data, n * sizeof (uint8_t));
+    st->block_used = st->block_used + n;
+    if (st->block_used == (uint32_t)16U)
+    {
+      ghash_update(st, (uint32_t)16U, st->block);
+      st->block_used = (uint32_t)0U;
+    }
+  }
+  uint32_t full = (len - n) / (uint32_t)16U * (uint32_t)16U;
+  ghash_update(st, full, data + n);
+  uint32_t rem = len - n - full;
+  memcpy(st->block + st->block_used, data + n + full, rem * sizeof (uint8_t));
+  st->block_used = st->block_used + rem;
+}
+
+/* Zeros up to the next multiple of 16 after len bytes of MAC input. */
+static void mac_pad(EverCrypt_AEAD_Incremental_state_s *st, uint64_t len)
+{
+  uint8_t zeros[16U] = { 0U };
+  uint32_t rem = (uint32_t)(len % (uint64_t)16U);
+  if (rem != (uint32_t)0U)
+  {
+    mac_update(st, zeros, (uint32_t)16U - rem);
+  }
+}
+
+static void mac_finish(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *tag)
+{
+  uint8_t len_block[16U] = { 0U };
+  mac_pad(st, st->len);
+  if (is_chacha(st))
+  {
+    store64_le(len_block, st->ad_len);
+    store64_le(len_block + (uint32_t)8U, st->len);
+    mac_update(st, len_block, (uint32_t)16U);
+    #if HACL_CAN_COMPILE_VEC256
+    if (st->mac256 != NULL)
+    {
+      Hacl_Streaming_Poly1305_256_finish(st->mac256, tag);
+      return;
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC128
+    if (st->mac128 != NULL)
+    {
+      Hacl_Streaming_Poly1305_128_finish(st->mac128, tag);
+      return;
+    }
+    #endif
+    Hacl_Streaming_Poly1305_32_finish(st->mac32, tag);
+    return;
+  }
+  uint8_t ek0[16U] = { 0U };
+  store64_be(len_block, st->ad_len * (uint64_t)8U);
+  store64_be(len_block + (uint32_t)8U, st->len * (uint64_t)8U);
+  mac_update(st, len_block, (uint32_t)16U);
+  #if HACL_CAN_COMPILE_PCLMUL
+  if (st->ghash_ni)
+  {
+    Hacl_Gf128_NI_gcm_emit(tag, st->ghash);
+  }
+  #endif
+  if (!st->ghash_ni)
+  {
+    Hacl_Gf128_CT64_gcm_emit(tag, st->ghash_ct);
+  }
+  gcm_ctr(st->s, st->nonce, j0_ctr(st), (uint32_t)16U, ek0, ek0);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    tag[i] = tag[i] ^ ek0[i];
+  }
+}
+
+/* Longest message the block counter allows. */
+static uint64_t max_len(EverCrypt_AEAD_Incremental_state_s *st)
+{
+  if (is_chacha(st))
+  {
+    return (uint64_t)274877906880U;
+  }
+  return (uint64_t)68719476704U;
+}
+
+/* XORs len bytes of in with ks into out, within the current block. The MAC takes the
+   ciphertext: the input when decrypting, so that in may be equal to out. */
+static void
+xor_text(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint32_t len,
+  uint8_t *in,
+  uint8_t *out,
+  uint8_t *ks,
+  bool decrypt
+)
+{
+  if (decrypt)
+  {
+    mac_update(st, in, len);
+  }
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    out[i] = in[i] ^ ks[i];
+  }
+  if (!decrypt)
+  {
+    mac_update(st, out, len);
+  }
+  st->len = st->len + (uint64_t)len;
+}
+
+static EverCrypt_Error_error_code
+update_text(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *in,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t phase
+)
+{
+  if (st == NULL || !(st->phase == (uint8_t)1U || st->phase == phase))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  if ((uint64_t)len > max_len(st) - st->len)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  if (st->phase == (uint8_t)1U)
+  {
+    mac_pad(st, st->ad_len);
+    st->phase = phase;
+  }
+  bool decrypt = phase == (uint8_t)3U;
+  uint32_t bl = block_len(st);
+  uint32_t used = (uint32_t)(st->len % (uint64_t)bl);
+  uint32_t n = (uint32_t)0U;
+  if (used != (uint32_t)0U)
+  {
+    n = bl - used;
+    if (len < n)
+    {
+      n = len;
+    }
+    xor_text(st, n, in, out, st->ks + used, decrypt);
+  }
+  uint32_t full = (len - n) / bl * bl;
+  if (full != (uint32_t)0U)
+  {
+    if (decrypt)
+    {
+      mac_update(st, in + n, full);
+    }
+    cipher_blocks(st, full, in + n, out + n);
+    if (!decrypt)
+    {
+      mac_update(st, out + n, full);
+    }
+    st->len = st->len + (uint64_t)full;
+  }
+  uint32_t rem = len - n - full;
+  if (rem != (uint32_t)0U)
+  {
+    memset(st->ks, 0U, bl * sizeof (uint8_t));
+    cipher_blocks(st, bl, st->ks, st->ks);
+    xor_text(st, rem, in + n + full, out + n + full, st->ks, decrypt);
+  }
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+finish(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *tag, uint8_t phase)
+{
+  if (st == NULL || !(st->phase == (uint8_t)1U || st->phase == phase))
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  if (st->phase == (uint8_t)1U)
+  {
+    mac_pad(st, st->ad_len);
+  }
+  mac_finish(st, tag);
+  st->phase = (uint8_t)0U;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_create_in(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_Incremental_state_s **dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_Incremental_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_Incremental_state_s
+  *st = KRML_HOST_CALLOC((uint32_t)1U, sizeof (EverCrypt_AEAD_Incremental_state_s));
+  st->s = s;
+  if (is_chacha(st))
+  {
+    uint8_t zeros[32U] = { 0U };
+    bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+    bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+    #if HACL_CAN_COMPILE_VEC256
+    if (vec256)
+    {
+      st->mac256 = Hacl_Streaming_Poly1305_256_create_in(zeros);
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC128
+    if (st->mac256 == NULL && vec128)
+    {
+      st->mac128 = Hacl_Streaming_Poly1305_128_create_in(zeros);
+    }
+    #endif
+    if (st->mac256 == NULL && st->mac128 == NULL)
+    {
+      st->mac32 = Hacl_Streaming_Poly1305_32_create_in(zeros);
+    }
+  }
+  else
+  {
+    uint8_t h[16U] = { 0U };
+    gcm_ctr(s, h, (uint32_t)0U, (uint32_t)16U, h, h);
+    st->ghash_ni = has_ghash_ni();
+    #if HACL_CAN_COMPILE_PCLMUL
+    if (st->ghash_ni)
+    {
+      Hacl_Gf128_NI_gcm_init(st->ghash, h);
+    }
+    #endif
+    Hacl_Gf128_CT64_gcm_init(st->ghash_ct, h);
+    Lib_Memzero0_memzero(h, (uint32_t)16U * sizeof (h[0U]));
+  }
+  dst[0U] = st;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_init(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  if (st == NULL)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  if (is_chacha(st))
+  {
+    if (iv_len != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint8_t block0[64U] = { 0U };
+    memcpy(st->nonce, iv, (uint32_t)12U * sizeof (uint8_t));
+    Hacl_Chacha20_chacha20_encrypt((uint32_t)64U, block0, block0, st->s->ek, st->nonce, (uint32_t)0U);
+    #if HACL_CAN_COMPILE_VEC256
+    if (st->mac256 != NULL)
+    {
+      Hacl_Streaming_Poly1305_256_init(block0, st->mac256);
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC128
+    if (st->mac128 != NULL)
+    {
+      Hacl_Streaming_Poly1305_128_init(block0, st->mac128);
+    }
+    #endif
+    if (st->mac32 != NULL)
+    {
+      Hacl_Streaming_Poly1305_32_init(block0, st->mac32);
+    }
+    Lib_Memzero0_memzero(block0, (uint32_t)64U * sizeof (block0[0U]));
+  }
+  else
+  {
+    if (iv_len == (uint32_t)0U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    if (is_bitslice(st->s->impl))
+    {
+      uint32_t nr = bitslice_rounds(st->s->impl);
+      gcm_j0(st->nonce, bitslice_hkey(nr, st->s->ek), iv, iv_len);
+    }
+    #if HACL_CAN_COMPILE_VALE
+    else
+    {
+      uint8_t *hkeys_b = st->s->ek + (uint32_t)176U;
+      if (st->s->impl == Spec_Cipher_Expansion_Vale_AES256)
+      {
+        hkeys_b = st->s->ek + (uint32_t)240U;
+      }
+      uint8_t tmp_iv[16U] = { 0U };
+      uint32_t len = iv_len / (uint32_t)16U;
+      uint32_t bytes_len = len * (uint32_t)16U;
+      memcpy(tmp_iv, iv + bytes_len, iv_len % (uint32_t)16U * sizeof (uint8_t));
+      uint64_t
+      uu____0 = compute_iv_stdcall(iv, (uint64_t)iv_len, (uint64_t)len, tmp_iv, tmp_iv, hkeys_b);
+      memcpy(st->nonce, tmp_iv, (uint32_t)16U * sizeof (uint8_t));
+    }
+    #endif
+    #if HACL_CAN_COMPILE_PCLMUL
+    st->ghash[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+    #endif
+    st->ghash_ct[0U] = (uint64_t)0U;
+    st->ghash_ct[1U] = (uint64_t)0U;
+  }
+  st->ad_len = (uint64_t)0U;
+  st->len = (uint64_t)0U;
+  st->block_used = (uint32_t)0U;
+  st->phase = (uint8_t)1U;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_update_ad(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *ad,
+  uint32_t ad_len
+)
+{
+  if (st == NULL || st->phase != (uint8_t)1U)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  uint64_t max_ad = (uint64_t)0xffffffffffffffffU;
+  if (!is_chacha(st))
+  {
+    max_ad = (uint64_t)0x1fffffffffffffffU;
+  }
+  if ((uint64_t)ad_len > max_ad - st->ad_len)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  mac_update(st, ad, ad_len);
+  st->ad_len = st->ad_len + (uint64_t)ad_len;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher
+)
+{
+  return update_text(st, plain, plain_len, cipher, (uint8_t)2U);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_finish(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *tag)
+{
+  return finish(st, tag, (uint8_t)2U);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *dst
+)
+{
+  return update_text(st, cipher, cipher_len, dst, (uint8_t)3U);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_finish(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *tag)
+{
+  uint8_t computed[16U] = { 0U };
+  EverCrypt_Error_error_code r = finish(st, computed, (uint8_t)3U);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed[i], tag[i]);
+    res = uu____0 & res;
+  }
+  Lib_Memzero0_memzero(computed, (uint32_t)16U * sizeof (computed[0U]));
+  if (res == (uint8_t)255U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+void EverCrypt_AEAD_Incremental_free(EverCrypt_AEAD_Incremental_state_s *st)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (st->mac256 != NULL)
+  {
+    Hacl_Streaming_Poly1305_256_free(st->mac256);
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (st->mac128 != NULL)
+  {
+    Hacl_Streaming_Poly1305_128_free(st->mac128);
+  }
+  #endif
+  if (st->mac32 != NULL)
+  {
+    Hacl_Streaming_Poly1305_32_free(st->mac32);
+  }
+  Lib_Memzero0_memzero(st, sizeof (EverCrypt_AEAD_Incremental_state_s));
+  KRML_HOST_FREE(st);
+}
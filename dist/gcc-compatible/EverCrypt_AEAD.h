@@ -47,9 +47,25 @@ bool EverCrypt_AEAD_uu___is_Ek(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s pro
 
 Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s);
 
+/*
+  AES-GCM uses the Vale code when the CPU has AES-NI, PCLMULQDQ, AVX, SSE and
+  MOVBE. Otherwise it returns EverCrypt_Error_UnsupportedAlgorithm, unless the
+  caller has opted into the unverified, constant-time bitsliced AES with
+  EverCrypt_AutoConfig2_enable_bitsliced_aes; that one runs on 256- or 128-bit
+  vectors when it can, and on any CPU.
+  With VAES, VPCLMULQDQ and AVX-512 on top, at the time the state is created, the
+  one-shot, batch and iov functions go through Hacl_AES_GCM_VAES instead, sixteen
+  blocks at a time on 512-bit vectors.
+*/
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
+/*
+  cipher may be plain itself, to encrypt in place, but must not otherwise overlap
+  it. This holds for every encryption and decryption function of this module: per
+  packet for the batch functions, and for the iov functions when the input and
+  output segments are the same.
+*/
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt(
   EverCrypt_AEAD_state_s *s,
@@ -63,6 +79,58 @@ EverCrypt_AEAD_encrypt(
   uint8_t *tag
 );
 
+/*
+  Encrypt num packets under s, as EverCrypt_AEAD_encrypt would one at a time:
+  packet i has iv[i] (all of length iv_len), ad_len[i] bytes of ad[i] and
+  plain_len[i] bytes of plain[i], and gets cipher[i] and tag[i]. With
+  Chacha20-Poly1305 on AVX2, packets of up to 1280 bytes share the ChaCha20 and
+  Poly1305 vector lanes; other packets, and AES-GCM, go one at a time but without
+  the per-call dispatch. Returns InvalidKey or InvalidIVLength, before writing
+  anything, on the same conditions as EverCrypt_AEAD_encrypt.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t num,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag
+);
+
+/*
+  Encrypt as EverCrypt_AEAD_encrypt does, with the additional data, the plaintext
+  and the ciphertext each given as a list of segments: ad is the concatenation of
+  the ad_num segments ad[i] of ad_len[i] bytes, and so on. The plaintext and
+  ciphertext segments may be cut at different places but must add up to the same
+  length, or DecodeError is returned before anything is written. Chacha20-Poly1305
+  reads and writes the segments in place; AES-GCM, whose code only takes
+  contiguous buffers, copies every list of more than one segment. For AES-GCM the
+  additional data and the plaintext must each add up to at most 2^32 - 1 bytes;
+  otherwise, or when a copy cannot be allocated, MaximumLengthExceeded is returned
+  before anything is written.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_num,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t plain_num,
+  uint32_t *plain_len,
+  uint8_t **plain,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+);
+
 /*
 WARNING: this function doesn't perform any dynamic
   hardware check. You MUST make sure your hardware supports the
@@ -158,6 +226,12 @@ EverCrypt_AEAD_encrypt_expand(
   uint8_t *tag
 );
 
+/*
+  dst may be cipher itself. On AuthenticationFailure, dst holds no plaintext:
+  Chacha20-Poly1305 and the bitsliced AES-GCM check the tag before decrypting and
+  leave dst untouched, while the Vale and VAES AES-GCM, which decrypt as they
+  authenticate, zero it.
+*/
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -171,6 +245,52 @@ EverCrypt_AEAD_decrypt(
   uint8_t *dst
 );
 
+/*
+  Decrypt num packets under s, as EverCrypt_AEAD_decrypt would one at a time,
+  with res[i] the result for packet i. Returns Success if every packet
+  authenticates, AuthenticationFailure if some packet does not (the others are
+  still decrypted), and InvalidKey or InvalidIVLength, also stored in every
+  res[i], if nothing could be decrypted.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t num,
+  uint8_t **iv,
+  uint32_t iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **cipher,
+  uint32_t *cipher_len,
+  uint8_t **tag,
+  uint8_t **dst,
+  EverCrypt_Error_error_code *res
+);
+
+/*
+  Decrypt as EverCrypt_AEAD_decrypt does, from the cipher_num segments of cipher
+  into the dst_num segments of dst, with the additional data also in segments; see
+  EverCrypt_AEAD_encrypt_iov. Returns DecodeError if the two lists of segments do
+  not add up to the same length, and for AES-GCM MaximumLengthExceeded under the
+  same conditions as EverCrypt_AEAD_encrypt_iov.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t ad_num,
+  uint32_t *ad_len,
+  uint8_t **ad,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag,
+  uint32_t dst_num,
+  uint32_t *dst_len,
+  uint8_t **dst
+);
+
 /*
 WARNING: this function doesn't perform any dynamic
   hardware check. You MUST make sure your hardware supports the
@@ -268,6 +388,84 @@ EverCrypt_AEAD_decrypt_expand(
 
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s);
 
+/*
+  Incremental AEAD: the additional data, then the plaintext (or ciphertext), are
+  fed in chunks of any size, and the tag is produced (or checked) at the end, in
+  constant memory. The output matches EverCrypt_AEAD_encrypt over the
+  concatenation of the chunks.
+
+  A state is created for a key state s, which must outlive it, and may be reused
+  for several messages: each starts with _init and ends with _encrypt_finish or
+  _decrypt_finish. Calls out of that order, and messages longer than the
+  algorithm allows (2^38 - 64 bytes for Chacha20-Poly1305, 2^36 - 32 for AES-GCM),
+  return DecodeError without processing anything.
+*/
+typedef struct EverCrypt_AEAD_Incremental_state_s_s EverCrypt_AEAD_Incremental_state_s;
+
+/*
+  Returns InvalidKey if s is NULL.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_create_in(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_Incremental_state_s **dst
+);
+
+/*
+  Start a message under iv; iv_len is checked as in EverCrypt_AEAD_encrypt.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_init(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+/*
+  Add ad_len bytes of additional data; only before the first text update.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_update_ad(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *ad,
+  uint32_t ad_len
+);
+
+/*
+  Encrypt plain_len bytes of plain into cipher, which may be equal to plain.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_finish(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *tag);
+
+/*
+  Decrypt cipher_len bytes of cipher into dst, which may be equal to cipher.
+  The plaintext is released before the tag is checked: callers must not act on
+  it until _decrypt_finish has returned Success.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *st,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *dst
+);
+
+/*
+  Returns AuthenticationFailure if tag is not the tag of the message.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_finish(EverCrypt_AEAD_Incremental_state_s *st, uint8_t *tag);
+
+void EverCrypt_AEAD_Incremental_free(EverCrypt_AEAD_Incremental_state_s *st);
+
 #if defined(__cplusplus)
 }
 #endif
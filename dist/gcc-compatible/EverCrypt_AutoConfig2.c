@@ -48,6 +48,10 @@ static bool cpu_has_rdrand[1U] = { false };
 
 static bool cpu_has_avx512[1U] = { false };
 
+static bool cpu_has_vaes[1U] = { false };
+
+static bool cpu_has_vpclmulqdq[1U] = { false };
+
 static bool user_wants_hacl[1U] = { true };
 
 static bool user_wants_vale[1U] = { true };
@@ -56,6 +60,8 @@ static bool user_wants_openssl[1U] = { true };
 
 static bool user_wants_bcrypt[1U] = { false };
 
+static bool user_wants_bitsliced_aes[1U] = { false };
+
 bool EverCrypt_AutoConfig2_has_shaext()
 {
   return cpu_has_shaext[0U];
@@ -111,6 +117,16 @@ bool EverCrypt_AutoConfig2_has_avx512()
   return cpu_has_avx512[0U];
 }
 
+bool EverCrypt_AutoConfig2_has_vaes()
+{
+  return cpu_has_vaes[0U];
+}
+
+bool EverCrypt_AutoConfig2_has_vpclmulqdq()
+{
+  return cpu_has_vpclmulqdq[0U];
+}
+
 KRML_DEPRECATED("")
 
 bool EverCrypt_AutoConfig2_wants_vale()
@@ -133,6 +149,11 @@ bool EverCrypt_AutoConfig2_wants_bcrypt()
   return user_wants_bcrypt[0U];
 }
 
+bool EverCrypt_AutoConfig2_wants_bitsliced_aes()
+{
+  return user_wants_bitsliced_aes[0U];
+}
+
 void EverCrypt_AutoConfig2_recall()
 {
 
@@ -216,6 +237,20 @@ void EverCrypt_AutoConfig2_init()
       }
     }
   }
+  uint64_t scrut11 = check_vaes_vpclmulqdq();
+  if (scrut11 != (uint64_t)0U)
+  {
+    uint64_t scrut12 = check_osxsave();
+    if (scrut12 != (uint64_t)0U)
+    {
+      uint64_t scrut13 = check_avx_xcr0();
+      if (scrut13 != (uint64_t)0U)
+      {
+        cpu_has_vaes[0U] = true;
+        cpu_has_vpclmulqdq[0U] = true;
+      }
+    }
+  }
   #endif
   user_wants_hacl[0U] = true;
   user_wants_vale[0U] = true;
@@ -278,6 +313,16 @@ void EverCrypt_AutoConfig2_disable_avx512()
   cpu_has_avx512[0U] = false;
 }
 
+void EverCrypt_AutoConfig2_disable_vaes()
+{
+  cpu_has_vaes[0U] = false;
+}
+
+void EverCrypt_AutoConfig2_disable_vpclmulqdq()
+{
+  cpu_has_vpclmulqdq[0U] = false;
+}
+
 void EverCrypt_AutoConfig2_disable_vale()
 {
   user_wants_vale[0U] = false;
@@ -298,6 +343,11 @@ void EverCrypt_AutoConfig2_disable_bcrypt()
   user_wants_bcrypt[0U] = false;
 }
 
+void EverCrypt_AutoConfig2_enable_bitsliced_aes()
+{
+  user_wants_bitsliced_aes[0U] = true;
+}
+
 bool EverCrypt_AutoConfig2_has_vec128()
 {
   bool avx = EverCrypt_AutoConfig2_has_avx();
@@ -312,3 +362,10 @@ bool EverCrypt_AutoConfig2_has_vec256()
   return avx2 || other;
 }
 
+bool EverCrypt_AutoConfig2_has_vec512()
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  return avx2 && avx512;
+}
+
@@ -60,6 +60,10 @@ bool EverCrypt_AutoConfig2_has_rdrand();
 
 bool EverCrypt_AutoConfig2_has_avx512();
 
+bool EverCrypt_AutoConfig2_has_vaes();
+
+bool EverCrypt_AutoConfig2_has_vpclmulqdq();
+
 KRML_DEPRECATED("")
 
 bool EverCrypt_AutoConfig2_wants_vale();
@@ -70,6 +74,8 @@ bool EverCrypt_AutoConfig2_wants_openssl();
 
 bool EverCrypt_AutoConfig2_wants_bcrypt();
 
+bool EverCrypt_AutoConfig2_wants_bitsliced_aes();
+
 void EverCrypt_AutoConfig2_recall();
 
 void EverCrypt_AutoConfig2_init();
@@ -98,6 +104,10 @@ void EverCrypt_AutoConfig2_disable_rdrand();
 
 void EverCrypt_AutoConfig2_disable_avx512();
 
+void EverCrypt_AutoConfig2_disable_vaes();
+
+void EverCrypt_AutoConfig2_disable_vpclmulqdq();
+
 void EverCrypt_AutoConfig2_disable_vale();
 
 void EverCrypt_AutoConfig2_disable_hacl();
@@ -106,10 +116,24 @@ void EverCrypt_AutoConfig2_disable_openssl();
 
 void EverCrypt_AutoConfig2_disable_bcrypt();
 
+/*
+  Let EverCrypt_AEAD fall back to the bitsliced AES-GCM on CPUs without the
+  instructions the Vale AES-GCM needs. That implementation is not verified, so
+  it is off by default and AES-GCM is then UnsupportedAlgorithm on those CPUs.
+*/
+void EverCrypt_AutoConfig2_enable_bitsliced_aes();
+
 bool EverCrypt_AutoConfig2_has_vec128();
 
+/*
+  Whether the 256-bit vector code can run on this CPU. Hacl_ functions with a leading
+  [bool vec256] argument, and the *_vec256 variants of the Frodo KEMs, never query the
+  CPU themselves: callers pass, or check, this value. The results are the same either way.
+*/
 bool EverCrypt_AutoConfig2_has_vec256();
 
+bool EverCrypt_AutoConfig2_has_vec512();
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,282 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_CTR_DRBG.h"
+
+#include "internal/Vale.h"
+
+uint32_t EverCrypt_CTR_DRBG_reseed_interval = (uint32_t)1048576U;
+
+uint32_t EverCrypt_CTR_DRBG_max_output_length = (uint32_t)65536U;
+
+uint32_t EverCrypt_CTR_DRBG_seed_length = (uint32_t)48U;
+
+typedef struct EverCrypt_CTR_DRBG_state_s_s
+{
+  uint8_t *xkey;
+  uint8_t *v;
+  uint32_t reseed_counter;
+}
+EverCrypt_CTR_DRBG_state_s;
+
+/* len bytes of AES_Key(V + 1) || AES_Key(V + 2) || ..., leaving V at the last counter
+   used. gctr256_bytes only increments the low 32 bits of its counter block, so calls
+   are split where those would wrap around. */
+static void keystream(EverCrypt_CTR_DRBG_state_s *st, uint8_t *output, uint32_t len)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint32_t blocks = len / (uint32_t)16U;
+  uint32_t rem = len % (uint32_t)16U;
+  FStar_UInt128_uint128 c = load128_be(st->v);
+  uint8_t ctr_block[16U] = { 0U };
+  uint8_t inout_b[16U] = { 0U };
+  memset(output, 0U, len * sizeof (uint8_t));
+  uint32_t done = (uint32_t)0U;
+  while (done < blocks)
+  {
+    c = FStar_UInt128_add_mod(c, FStar_UInt128_uint64_to_uint128((uint64_t)1U));
+    uint64_t lo = FStar_UInt128_uint128_to_uint64(c) & (uint64_t)0xffffffffU;
+    uint64_t room = (uint64_t)0x100000000U - lo;
+    uint32_t chunk = blocks - done;
+    if (room < (uint64_t)chunk)
+    {
+      chunk = (uint32_t)room;
+    }
+    uint8_t *out = output + (uint32_t)16U * done;
+    store128_le(ctr_block, c);
+    uint64_t
+    scrut =
+      gctr256_bytes(out,
+        (uint64_t)((uint32_t)16U * chunk),
+        out,
+        inout_b,
+        st->xkey,
+        ctr_block,
+        (uint64_t)chunk);
+    c =
+      FStar_UInt128_add_mod(c,
+        FStar_UInt128_uint64_to_uint128((uint64_t)(chunk - (uint32_t)1U)));
+    done = done + chunk;
+  }
+  if (rem != (uint32_t)0U)
+  {
+    uint8_t last[16U] = { 0U };
+    c = FStar_UInt128_add_mod(c, FStar_UInt128_uint64_to_uint128((uint64_t)1U));
+    store128_le(ctr_block, c);
+    uint64_t
+    scrut =
+      gctr256_bytes(last,
+        (uint64_t)16U,
+        last,
+        inout_b,
+        st->xkey,
+        ctr_block,
+        (uint64_t)1U);
+    memcpy(output + (uint32_t)16U * blocks, last, rem * sizeof (uint8_t));
+    Lib_Memzero0_memzero(last, (uint32_t)16U * sizeof (last[0U]));
+  }
+  store128_be(st->v, c);
+  #endif
+}
+
+static void set_key(EverCrypt_CTR_DRBG_state_s *st, uint8_t *key)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint64_t scrut = aes256_key_expansion(key, st->xkey);
+  #endif
+}
+
+/* CTR_DRBG_Update: (Key, V) = leftmost 48 bytes of the keystream, xor provided_data. */
+static void update(EverCrypt_CTR_DRBG_state_s *st, uint8_t *provided_data)
+{
+  uint8_t temp[48U] = { 0U };
+  keystream(st, temp, (uint32_t)48U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)48U; i++)
+  {
+    temp[i] = temp[i] ^ provided_data[i];
+  }
+  set_key(st, temp);
+  memcpy(st->v, temp + (uint32_t)32U, (uint32_t)16U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(temp, (uint32_t)48U * sizeof (temp[0U]));
+}
+
+EverCrypt_CTR_DRBG_state_s *EverCrypt_CTR_DRBG_create()
+{
+  #if HACL_CAN_COMPILE_VALE
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  if (has_aesni && has_avx && has_sse)
+  {
+    EverCrypt_CTR_DRBG_state_s
+    *st = (EverCrypt_CTR_DRBG_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_DRBG_state_s));
+    st->xkey = (uint8_t *)KRML_HOST_CALLOC((uint32_t)240U, sizeof (uint8_t));
+    st->v = (uint8_t *)KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+    st->reseed_counter = (uint32_t)1U;
+    return st;
+  }
+  #endif
+  return NULL;
+}
+
+bool
+EverCrypt_CTR_DRBG_instantiate_with_entropy(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if (personalization_string_len > (uint32_t)48U)
+  {
+    return false;
+  }
+  uint8_t seed_material[48U] = { 0U };
+  uint8_t zero[32U] = { 0U };
+  memcpy(seed_material,
+    personalization_string,
+    personalization_string_len * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)48U; i++)
+  {
+    seed_material[i] = seed_material[i] ^ entropy_input[i];
+  }
+  set_key(st, zero);
+  memset(st->v, 0U, (uint32_t)16U * sizeof (uint8_t));
+  update(st, seed_material);
+  st->reseed_counter = (uint32_t)1U;
+  Lib_Memzero0_memzero(seed_material, (uint32_t)48U * sizeof (seed_material[0U]));
+  return true;
+}
+
+bool
+EverCrypt_CTR_DRBG_instantiate(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  uint8_t entropy_input[48U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy_input, (uint32_t)48U))
+  {
+    return false;
+  }
+  bool
+  ok =
+    EverCrypt_CTR_DRBG_instantiate_with_entropy(st,
+      entropy_input,
+      personalization_string,
+      personalization_string_len);
+  Lib_Memzero0_memzero(entropy_input, (uint32_t)48U * sizeof (entropy_input[0U]));
+  return ok;
+}
+
+bool
+EverCrypt_CTR_DRBG_reseed_with_entropy(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > (uint32_t)48U)
+  {
+    return false;
+  }
+  uint8_t seed_material[48U] = { 0U };
+  memcpy(seed_material, additional_input, additional_input_len * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)48U; i++)
+  {
+    seed_material[i] = seed_material[i] ^ entropy_input[i];
+  }
+  update(st, seed_material);
+  st->reseed_counter = (uint32_t)1U;
+  Lib_Memzero0_memzero(seed_material, (uint32_t)48U * sizeof (seed_material[0U]));
+  return true;
+}
+
+bool
+EverCrypt_CTR_DRBG_reseed(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  uint8_t entropy_input[48U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy_input, (uint32_t)48U))
+  {
+    return false;
+  }
+  bool
+  ok =
+    EverCrypt_CTR_DRBG_reseed_with_entropy(st,
+      entropy_input,
+      additional_input,
+      additional_input_len);
+  Lib_Memzero0_memzero(entropy_input, (uint32_t)48U * sizeof (entropy_input[0U]));
+  return ok;
+}
+
+bool
+EverCrypt_CTR_DRBG_generate(
+  uint8_t *output,
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (n > EverCrypt_CTR_DRBG_max_output_length || additional_input_len > (uint32_t)48U)
+  {
+    return false;
+  }
+  uint8_t ai[48U] = { 0U };
+  if (st->reseed_counter > EverCrypt_CTR_DRBG_reseed_interval)
+  {
+    /* The additional input goes into the reseed and is not used again. */
+    if (!EverCrypt_CTR_DRBG_reseed(st, additional_input, additional_input_len))
+    {
+      return false;
+    }
+  }
+  else if (additional_input_len != (uint32_t)0U)
+  {
+    memcpy(ai, additional_input, additional_input_len * sizeof (uint8_t));
+    update(st, ai);
+  }
+  keystream(st, output, n);
+  update(st, ai);
+  st->reseed_counter = st->reseed_counter + (uint32_t)1U;
+  Lib_Memzero0_memzero(ai, (uint32_t)48U * sizeof (ai[0U]));
+  return true;
+}
+
+void EverCrypt_CTR_DRBG_uninstantiate(EverCrypt_CTR_DRBG_state_s *st)
+{
+  Lib_Memzero0_memzero(st->xkey, (uint32_t)240U * sizeof (st->xkey[0U]));
+  Lib_Memzero0_memzero(st->v, (uint32_t)16U * sizeof (st->v[0U]));
+  KRML_HOST_FREE(st->xkey);
+  KRML_HOST_FREE(st->v);
+  KRML_HOST_FREE(st);
+}
+
@@ -0,0 +1,127 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_CTR_DRBG_H
+#define __EverCrypt_CTR_DRBG_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_RandomBuffer_System.h"
+#include "Lib_Memzero0.h"
+#include "Hacl_Krmllib.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  CTR_DRBG (NIST SP 800-90A, section 10.2.1) with AES-256 and no derivation function:
+  seedlen is 48 bytes, the entropy input is 48 bytes of full entropy, and
+  personalization strings and additional inputs are at most 48 bytes, zero-padded. The
+  counter is the whole 128-bit block (ctr_len = blocklen).
+
+  The block cipher is the Vale AES-NI code (aes256_key_expansion and gctr256_bytes),
+  so the DRBG is only available when EverCrypt_AutoConfig2 reports AES-NI, AVX and SSE;
+  EverCrypt_CTR_DRBG_create returns NULL otherwise, and callers fall back to
+  EverCrypt_DRBG.
+
+  Unlike EverCrypt_DRBG_generate, generate does not reseed on every call: the state
+  reseeds itself from the system once EverCrypt_CTR_DRBG_reseed_interval requests have
+  been served. A state is not thread-safe.
+*/
+typedef struct EverCrypt_CTR_DRBG_state_s_s EverCrypt_CTR_DRBG_state_s;
+
+extern uint32_t EverCrypt_CTR_DRBG_reseed_interval;
+
+extern uint32_t EverCrypt_CTR_DRBG_max_output_length;
+
+extern uint32_t EverCrypt_CTR_DRBG_seed_length;
+
+EverCrypt_CTR_DRBG_state_s *EverCrypt_CTR_DRBG_create();
+
+/*
+  Instantiate from a given 48-byte entropy input; for known-answer tests and for
+  callers with their own entropy source. Returns false if the personalization string
+  is longer than 48 bytes.
+*/
+bool
+EverCrypt_CTR_DRBG_instantiate_with_entropy(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+/*
+  Instantiate from 48 bytes read with Lib_RandomBuffer_System_randombytes.
+*/
+bool
+EverCrypt_CTR_DRBG_instantiate(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+bool
+EverCrypt_CTR_DRBG_reseed_with_entropy(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+bool
+EverCrypt_CTR_DRBG_reseed(
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+/*
+  Write n <= EverCrypt_CTR_DRBG_max_output_length bytes to output. Returns false if n or
+  additional_input_len is out of range, or if a due reseed could not get entropy.
+*/
+bool
+EverCrypt_CTR_DRBG_generate(
+  uint8_t *output,
+  EverCrypt_CTR_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+void EverCrypt_CTR_DRBG_uninstantiate(EverCrypt_CTR_DRBG_state_s *st);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_CTR_DRBG_H_DEFINED
+#endif
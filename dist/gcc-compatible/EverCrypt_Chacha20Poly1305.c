@@ -90,3 +90,137 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   return Hacl_Chacha20Poly1305_32_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
 }
 
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_Chacha20Poly1305_256_aead_encrypt_iov(k,
+      n,
+      aad_num,
+      aadlen,
+      aad,
+      m_num,
+      mlen,
+      m,
+      cipher_num,
+      cipher_len,
+      cipher,
+      tag);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    Hacl_Chacha20Poly1305_128_aead_encrypt_iov(k,
+      n,
+      aad_num,
+      aadlen,
+      aad,
+      m_num,
+      mlen,
+      m,
+      cipher_num,
+      cipher_len,
+      cipher,
+      tag);
+    return;
+  }
+  #endif
+  Hacl_Chacha20Poly1305_32_aead_encrypt_iov(k,
+    n,
+    aad_num,
+    aadlen,
+    aad,
+    m_num,
+    mlen,
+    m,
+    cipher_num,
+    cipher_len,
+    cipher,
+    tag);
+}
+
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    return Hacl_Chacha20Poly1305_256_aead_decrypt_iov(k,
+      n,
+      aad_num,
+      aadlen,
+      aad,
+      m_num,
+      mlen,
+      m,
+      cipher_num,
+      cipher_len,
+      cipher,
+      tag);
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    return Hacl_Chacha20Poly1305_128_aead_decrypt_iov(k,
+      n,
+      aad_num,
+      aadlen,
+      aad,
+      m_num,
+      mlen,
+      m,
+      cipher_num,
+      cipher_len,
+      cipher,
+      tag);
+  }
+  #endif
+  return Hacl_Chacha20Poly1305_32_aead_decrypt_iov(k,
+    n,
+    aad_num,
+    aadlen,
+    aad,
+    m_num,
+    mlen,
+    m,
+    cipher_num,
+    cipher_len,
+    cipher,
+    tag);
+}
+
@@ -65,6 +65,48 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 );
 
+/*
+  Encrypt with the aad, the plaintext and the ciphertext each given as a list of
+  segments, as Hacl_Chacha20Poly1305_256_aead_encrypt_iov describes, on the
+  widest implementation the CPU supports.
+*/
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+);
+
+/*
+  Decrypt from and into lists of segments, as
+  Hacl_Chacha20Poly1305_256_aead_decrypt_iov describes, on the widest
+  implementation the CPU supports.
+*/
+uint32_t
+EverCrypt_Chacha20Poly1305_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *tag
+);
+
 #if defined(__cplusplus)
 }
 #endif
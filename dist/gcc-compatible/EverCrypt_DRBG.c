@@ -24,6 +24,10 @@
 
 #include "EverCrypt_DRBG.h"
 
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
 
 
 uint32_t EverCrypt_DRBG_reseed_interval = (uint32_t)1024U;
@@ -2004,3 +2008,454 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
   KRML_HOST_EXIT(255U);
 }
 
+typedef struct EverCrypt_DRBG_shard_s_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  EverCrypt_HMAC_key_s *k;
+  uint8_t *v;
+  uint32_t reseed_counter;
+  uint8_t *buf;
+  uint32_t buf_len;
+  uint32_t buf_pos;
+  uint32_t pid;
+}
+EverCrypt_DRBG_shard_s;
+
+typedef struct EverCrypt_DRBG_sharded_s_s
+{
+  uint32_t n_shards;
+  EverCrypt_DRBG_shard_s **shards;
+}
+EverCrypt_DRBG_sharded_s;
+
+static bool is_supported_alg(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return true;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return true;
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+/* The HMAC_DRBG_Update function: K = HMAC(K, V || 0x00 || data), V = HMAC(K, V), then
+   again with 0x01 when data is not empty. */
+static void shard_update(EverCrypt_DRBG_shard_s *st, uint32_t len, uint8_t *data)
+{
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(st->alg);
+  uint8_t *v = st->v;
+  uint32_t input_len = hlen + (uint32_t)1U + len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
+  uint8_t input[input_len];
+  memset(input, 0U, input_len * sizeof (uint8_t));
+  uint8_t k_[64U] = { 0U };
+  if (len != (uint32_t)0U)
+  {
+    memcpy(input + hlen + (uint32_t)1U, data, len * sizeof (uint8_t));
+  }
+  uint32_t rounds;
+  if (len == (uint32_t)0U)
+  {
+    rounds = (uint32_t)1U;
+  }
+  else
+  {
+    rounds = (uint32_t)2U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < rounds; i++)
+  {
+    memcpy(input, v, hlen * sizeof (uint8_t));
+    input[hlen] = (uint8_t)i;
+    EverCrypt_HMAC_compute_with_key(st->k, k_, input, input_len);
+    EverCrypt_HMAC_key_init(st->k, k_, hlen);
+    EverCrypt_HMAC_compute_with_key(st->k, v, v, hlen);
+  }
+  Lib_Memzero0_memzero(input, input_len * sizeof (input[0U]));
+  Lib_Memzero0_memzero(k_, (uint32_t)64U * sizeof (k_[0U]));
+}
+
+static void discard_buffer(EverCrypt_DRBG_shard_s *st)
+{
+  Lib_Memzero0_memzero(st->buf, st->buf_len * sizeof (st->buf[0U]));
+  st->buf_pos = st->buf_len;
+}
+
+EverCrypt_DRBG_shard_s
+*EverCrypt_DRBG_shard_create_in(Spec_Hash_Definitions_hash_alg a, uint32_t buf_len)
+{
+  if
+  (
+    !is_supported_alg(a)
+    || buf_len == (uint32_t)0U
+    || buf_len > EverCrypt_DRBG_max_output_length
+  )
+  {
+    return NULL;
+  }
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(a);
+  uint8_t zero[64U] = { 0U };
+  EverCrypt_DRBG_shard_s
+  *st = (EverCrypt_DRBG_shard_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_shard_s));
+  st->alg = a;
+  st->k = EverCrypt_HMAC_key_create_in(a, zero, hlen);
+  st->v = (uint8_t *)KRML_HOST_CALLOC(hlen, sizeof (uint8_t));
+  st->reseed_counter = (uint32_t)1U;
+  st->buf = (uint8_t *)KRML_HOST_CALLOC(buf_len, sizeof (uint8_t));
+  st->buf_len = buf_len;
+  st->buf_pos = buf_len;
+  st->pid = Lib_RandomBuffer_System_process_id();
+  return st;
+}
+
+void
+EverCrypt_DRBG_shard_instantiate(
+  EverCrypt_DRBG_shard_s *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t nonce_len,
+  uint8_t *nonce,
+  uint32_t personalization_string_len,
+  uint8_t *personalization_string
+)
+{
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(st->alg);
+  uint8_t zero[64U] = { 0U };
+  uint32_t len = entropy_input_len + nonce_len + personalization_string_len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t seed_material[len];
+  memset(seed_material, 0U, len * sizeof (uint8_t));
+  memcpy(seed_material, entropy_input, entropy_input_len * sizeof (uint8_t));
+  memcpy(seed_material + entropy_input_len, nonce, nonce_len * sizeof (uint8_t));
+  memcpy(seed_material + entropy_input_len + nonce_len,
+    personalization_string,
+    personalization_string_len * sizeof (uint8_t));
+  EverCrypt_HMAC_key_init(st->k, zero, hlen);
+  memset(st->v, (uint8_t)1U, hlen * sizeof (uint8_t));
+  shard_update(st, len, seed_material);
+  st->reseed_counter = (uint32_t)1U;
+  st->pid = Lib_RandomBuffer_System_process_id();
+  discard_buffer(st);
+  Lib_Memzero0_memzero(seed_material, len * sizeof (seed_material[0U]));
+}
+
+void
+EverCrypt_DRBG_shard_reseed(
+  EverCrypt_DRBG_shard_s *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t additional_input_len,
+  uint8_t *additional_input
+)
+{
+  uint32_t len = entropy_input_len + additional_input_len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t seed_material[len];
+  memset(seed_material, 0U, len * sizeof (uint8_t));
+  memcpy(seed_material, entropy_input, entropy_input_len * sizeof (uint8_t));
+  memcpy(seed_material + entropy_input_len,
+    additional_input,
+    additional_input_len * sizeof (uint8_t));
+  shard_update(st, len, seed_material);
+  st->reseed_counter = (uint32_t)1U;
+  st->pid = Lib_RandomBuffer_System_process_id();
+  discard_buffer(st);
+  Lib_Memzero0_memzero(seed_material, len * sizeof (seed_material[0U]));
+}
+
+/* One generate request of buf_len bytes into the buffer, reseeding first if needed. */
+static bool refill(EverCrypt_DRBG_shard_s *st)
+{
+  if (st->reseed_counter > EverCrypt_DRBG_reseed_interval)
+  {
+    uint32_t entropy_input_len = EverCrypt_DRBG_min_length(st->alg);
+    uint8_t entropy_input[32U] = { 0U };
+    if (!Lib_RandomBuffer_System_randombytes(entropy_input, entropy_input_len))
+    {
+      return false;
+    }
+    EverCrypt_DRBG_shard_reseed(st, entropy_input_len, entropy_input, (uint32_t)0U, NULL);
+    Lib_Memzero0_memzero(entropy_input, (uint32_t)32U * sizeof (entropy_input[0U]));
+  }
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(st->alg);
+  uint8_t *v = st->v;
+  for (uint32_t i = (uint32_t)0U; i < st->buf_len; i = i + hlen)
+  {
+    EverCrypt_HMAC_compute_with_key(st->k, v, v, hlen);
+    uint32_t len = hlen;
+    if (st->buf_len - i < hlen)
+    {
+      len = st->buf_len - i;
+    }
+    memcpy(st->buf + i, v, len * sizeof (uint8_t));
+  }
+  shard_update(st, (uint32_t)0U, NULL);
+  st->reseed_counter = st->reseed_counter + (uint32_t)1U;
+  st->buf_pos = (uint32_t)0U;
+  return true;
+}
+
+bool EverCrypt_DRBG_shard_generate(uint8_t *output, EverCrypt_DRBG_shard_s *st, uint32_t n)
+{
+  if (st->pid != Lib_RandomBuffer_System_process_id())
+  {
+    /* A copy made by fork: the parent would hand out the same buffered bytes and step
+       the same K and V, so the child drops its buffer and reseeds before any output. */
+    discard_buffer(st);
+    st->reseed_counter = EverCrypt_DRBG_reseed_interval + (uint32_t)1U;
+  }
+  uint32_t done = (uint32_t)0U;
+  while (done < n)
+  {
+    if (st->buf_pos == st->buf_len)
+    {
+      if (!refill(st))
+      {
+        return false;
+      }
+    }
+    uint32_t len = st->buf_len - st->buf_pos;
+    if (n - done < len)
+    {
+      len = n - done;
+    }
+    memcpy(output + done, st->buf + st->buf_pos, len * sizeof (uint8_t));
+    Lib_Memzero0_memzero(st->buf + st->buf_pos, len * sizeof (st->buf[0U]));
+    st->buf_pos = st->buf_pos + len;
+    done = done + len;
+  }
+  return true;
+}
+
+void EverCrypt_DRBG_shard_free(EverCrypt_DRBG_shard_s *st)
+{
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(st->alg);
+  Lib_Memzero0_memzero(st->v, hlen * sizeof (st->v[0U]));
+  Lib_Memzero0_memzero(st->buf, st->buf_len * sizeof (st->buf[0U]));
+  EverCrypt_HMAC_key_free(st->k);
+  KRML_HOST_FREE(st->v);
+  KRML_HOST_FREE(st->buf);
+  KRML_HOST_FREE(st);
+}
+
+EverCrypt_DRBG_sharded_s
+*EverCrypt_DRBG_sharded_create(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n_shards,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if
+  (
+    !is_supported_alg(a)
+    || n_shards == (uint32_t)0U
+    ||
+      personalization_string_len
+      > EverCrypt_DRBG_max_personalization_string_length - (uint32_t)4U
+  )
+  {
+    return NULL;
+  }
+  uint32_t entropy_input_len = EverCrypt_DRBG_min_length(a);
+  uint32_t nonce_len = EverCrypt_DRBG_min_length(a) / (uint32_t)2U;
+  uint32_t min_entropy = entropy_input_len + nonce_len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), n_shards * min_entropy);
+  uint8_t *entropy = (uint8_t *)KRML_HOST_CALLOC(n_shards * min_entropy, sizeof (uint8_t));
+  if (!Lib_RandomBuffer_System_randombytes(entropy, n_shards * min_entropy))
+  {
+    KRML_HOST_FREE(entropy);
+    return NULL;
+  }
+  uint32_t pers_len = personalization_string_len + (uint32_t)4U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), pers_len);
+  uint8_t pers[pers_len];
+  memset(pers, 0U, pers_len * sizeof (uint8_t));
+  memcpy(pers, personalization_string, personalization_string_len * sizeof (uint8_t));
+  EverCrypt_DRBG_shard_s
+  **shards =
+    (EverCrypt_DRBG_shard_s **)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_shard_s *) * n_shards);
+  for (uint32_t i = (uint32_t)0U; i < n_shards; i++)
+  {
+    uint8_t *e = entropy + i * min_entropy;
+    store32_le(pers + personalization_string_len, i);
+    shards[i] = EverCrypt_DRBG_shard_create_in(a, (uint32_t)1024U);
+    EverCrypt_DRBG_shard_instantiate(shards[i],
+      entropy_input_len,
+      e,
+      nonce_len,
+      e + entropy_input_len,
+      pers_len,
+      pers);
+  }
+  Lib_Memzero0_memzero(entropy, n_shards * min_entropy * sizeof (entropy[0U]));
+  KRML_HOST_FREE(entropy);
+  EverCrypt_DRBG_sharded_s
+  *st = (EverCrypt_DRBG_sharded_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_sharded_s));
+  st->n_shards = n_shards;
+  st->shards = shards;
+  return st;
+}
+
+bool
+EverCrypt_DRBG_sharded_generate(
+  uint8_t *output,
+  EverCrypt_DRBG_sharded_s *st,
+  uint32_t shard,
+  uint32_t n
+)
+{
+  if (shard >= st->n_shards)
+  {
+    return false;
+  }
+  return EverCrypt_DRBG_shard_generate(output, st->shards[shard], n);
+}
+
+void EverCrypt_DRBG_sharded_free(EverCrypt_DRBG_sharded_s *st)
+{
+  for (uint32_t i = (uint32_t)0U; i < st->n_shards; i++)
+  {
+    EverCrypt_DRBG_shard_free(st->shards[i]);
+  }
+  KRML_HOST_FREE(st->shards);
+  KRML_HOST_FREE(st);
+}
+
+
+#if (defined(_WIN32) || defined(_WIN64))
+#define RANDOM_THREAD_LOCAL __declspec(thread)
+#else
+#define RANDOM_THREAD_LOCAL __thread
+#endif
+
+typedef struct random_state_s
+{
+  uint8_t key[32U];
+  uint8_t buf[1024U];
+  uint32_t avail;
+  uint32_t since_reseed;
+  uint32_t pid;
+  bool seeded;
+}
+random_state;
+
+static RANDOM_THREAD_LOCAL random_state random_st;
+
+/* Overwrites out[0..len) with the ChaCha20 keystream for key, with an all-zero nonce
+   and counter; every key is used for exactly one call. */
+static void random_keystream(uint32_t len, uint8_t *out, uint8_t *key)
+{
+  uint8_t n[12U] = { 0U };
+  memset(out, 0U, len * sizeof (uint8_t));
+  #if HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, out, out, key, n, (uint32_t)0U);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (EverCrypt_AutoConfig2_has_vec128())
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, out, out, key, n, (uint32_t)0U);
+    return;
+  }
+  #endif
+  Hacl_Chacha20_chacha20_encrypt(len, out, out, key, n, (uint32_t)0U);
+}
+
+static void random_reseed(random_state *st)
+{
+  uint8_t seed[32U] = { 0U };
+  Lib_RandomBuffer_System_crypto_random(seed, (uint32_t)32U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    st->key[i] = st->key[i] ^ seed[i];
+  }
+  Lib_Memzero0_memzero(seed, (uint32_t)32U * sizeof (seed[0U]));
+  st->since_reseed = (uint32_t)0U;
+  st->seeded = true;
+}
+
+static void random_refill(random_state *st)
+{
+  if (!st->seeded || st->since_reseed >= (uint32_t)1048576U)
+  {
+    random_reseed(st);
+  }
+  random_keystream((uint32_t)1024U, st->buf, st->key);
+  memcpy(st->key, st->buf, (uint32_t)32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(st->buf, (uint32_t)32U * sizeof (st->buf[0U]));
+  st->avail = (uint32_t)992U;
+}
+
+static void random_take(random_state *st, uint8_t *output, uint32_t n)
+{
+  uint32_t done = (uint32_t)0U;
+  while (done < n)
+  {
+    if (st->avail == (uint32_t)0U)
+    {
+      random_refill(st);
+    }
+    uint32_t len = st->avail;
+    if (n - done < len)
+    {
+      len = n - done;
+    }
+    uint8_t *src = st->buf + (uint32_t)1024U - st->avail;
+    memcpy(output + done, src, len * sizeof (uint8_t));
+    Lib_Memzero0_memzero(src, len * sizeof (src[0U]));
+    st->avail = st->avail - len;
+    st->since_reseed = st->since_reseed + len;
+    done = done + len;
+  }
+}
+
+void EverCrypt_DRBG_buffered_random(uint8_t *output, uint32_t n)
+{
+  random_state *st = &random_st;
+  uint32_t pid = Lib_RandomBuffer_System_process_id();
+  if (st->pid != pid)
+  {
+    /* First use in this thread, or a copy of the forking thread's state in the child
+       of a fork: wipe it, so that the next refill reseeds. */
+    Lib_Memzero0_memzero(st, sizeof (random_state));
+    st->pid = pid;
+  }
+  if (n < (uint32_t)1024U)
+  {
+    random_take(st, output, n);
+    return;
+  }
+  /* Large requests are written directly under a one-time key drawn from the buffer. */
+  uint8_t key[32U] = { 0U };
+  random_take(st, key, (uint32_t)32U);
+  random_keystream(n, output, key);
+  Lib_Memzero0_memzero(key, (uint32_t)32U * sizeof (key[0U]));
+  if (n < (uint32_t)1048576U)
+  {
+    st->since_reseed = st->since_reseed + n;
+  }
+  else
+  {
+    st->since_reseed = (uint32_t)1048576U;
+  }
+}
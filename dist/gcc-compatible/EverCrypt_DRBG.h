@@ -216,6 +216,119 @@ EverCrypt_DRBG_generate(
 
 void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st);
 
+/*
+  A buffered HMAC-DRBG (NIST SP 800-90A) for SHA1 and SHA2_256/384/512. The key K is
+  held as a precomputed EverCrypt_HMAC_key_s, re-keyed in place whenever K changes, so
+  that the V = HMAC(K, V) steps start from cached midstates instead of hashing the
+  padded key each time.
+
+  Output is produced buf_len bytes at a time, each refill being one HMAC-DRBG generate
+  request without additional input, and handed out from the buffer; bytes are erased
+  from the buffer as they are returned. A shard reseeds itself from
+  Lib_RandomBuffer_System_randombytes once its reseed counter exceeds
+  EverCrypt_DRBG_reseed_interval.
+
+  A shard records the process identifier when it is created, instantiated or reseeded.
+  When it is used from another process, that is in the child of a fork, it drops its
+  buffered output and reseeds from the system before generating anything.
+
+  A shard is not thread-safe: each thread uses its own.
+*/
+typedef struct EverCrypt_DRBG_shard_s_s EverCrypt_DRBG_shard_s;
+
+/*
+  Allocate a shard for `a` that refills buf_len bytes at a time, with
+  0 < buf_len <= EverCrypt_DRBG_max_output_length; returns NULL otherwise, or when `a`
+  is not supported. The shard must be instantiated before use.
+*/
+EverCrypt_DRBG_shard_s
+*EverCrypt_DRBG_shard_create_in(Spec_Hash_Definitions_hash_alg a, uint32_t buf_len);
+
+/*
+  Instantiate with the given entropy input, nonce and personalization string, as
+  Hacl_HMAC_DRBG_instantiate. Any buffered output is discarded.
+*/
+void
+EverCrypt_DRBG_shard_instantiate(
+  EverCrypt_DRBG_shard_s *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t nonce_len,
+  uint8_t *nonce,
+  uint32_t personalization_string_len,
+  uint8_t *personalization_string
+);
+
+/*
+  Reseed with the given entropy input and additional input, as Hacl_HMAC_DRBG_reseed.
+  Any buffered output is discarded.
+*/
+void
+EverCrypt_DRBG_shard_reseed(
+  EverCrypt_DRBG_shard_s *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t additional_input_len,
+  uint8_t *additional_input
+);
+
+/*
+  Write n bytes of output. Returns false if an automatic reseed, including the one
+  after a fork, could not get entropy from the system; output is then only partially
+  written.
+*/
+bool EverCrypt_DRBG_shard_generate(uint8_t *output, EverCrypt_DRBG_shard_s *st, uint32_t n);
+
+void EverCrypt_DRBG_shard_free(EverCrypt_DRBG_shard_s *st);
+
+/*
+  A set of shards for lock-free use from several threads: thread i draws from shard i
+  and no two threads use the same shard at the same time. The entropy of all shards is
+  read with a single call to Lib_RandomBuffer_System_randombytes at creation, and the
+  personalization string of shard i is personalization_string || LE32(i).
+*/
+typedef struct EverCrypt_DRBG_sharded_s_s EverCrypt_DRBG_sharded_s;
+
+/*
+  Returns NULL if `a` is not supported, n_shards is 0, the personalization string is
+  longer than EverCrypt_DRBG_max_personalization_string_length - 4, or the system could
+  not provide entropy.
+*/
+EverCrypt_DRBG_sharded_s
+*EverCrypt_DRBG_sharded_create(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n_shards,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+/*
+  As EverCrypt_DRBG_shard_generate on shard `shard`; returns false if shard >= n_shards.
+*/
+bool
+EverCrypt_DRBG_sharded_generate(
+  uint8_t *output,
+  EverCrypt_DRBG_sharded_s *st,
+  uint32_t shard,
+  uint32_t n
+);
+
+void EverCrypt_DRBG_sharded_free(EverCrypt_DRBG_sharded_s *st);
+
+/*
+  Write n bytes from a per-thread ChaCha20 generator with fast key erasure: each refill
+  runs ChaCha20 once under the current key, the first 32 bytes of keystream replace that
+  key and the rest is handed out, each byte being wiped as it leaves the buffer. Requests
+  of 1024 bytes or more are written directly under a one-time key drawn from the buffer.
+
+  The generator mixes 32 bytes from Lib_RandomBuffer_System_crypto_random into its key on
+  first use in each thread and after every MiB of output, so that small requests do not
+  make a system call. It records the process identifier when it starts and wipes its
+  state when called from another process, so that the child of a fork reseeds instead of
+  repeating the bytes of its parent. Never fails.
+*/
+void EverCrypt_DRBG_buffered_random(uint8_t *output, uint32_t n);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -524,3 +524,122 @@ EverCrypt_HKDF_hkdf_extract(
   EverCrypt_HKDF_extract(a, prk, salt, saltlen, ikm, ikmlen);
 }
 
+
+EverCrypt_HMAC_key_s
+*EverCrypt_HKDF_extract_to_key(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint8_t *ikm,
+  uint32_t ikmlen
+)
+{
+  uint8_t prk[64U] = { 0U };
+  uint32_t prklen = EverCrypt_Hash_Incremental_hash_len(a);
+  EverCrypt_HKDF_extract(a, prk, salt, saltlen, ikm, ikmlen);
+  EverCrypt_HMAC_key_s *k = EverCrypt_HMAC_key_create_in(a, prk, prklen);
+  Lib_Memzero0_memzero(prk, (uint32_t)64U * sizeof (prk[0U]));
+  return k;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HKDF_expand_with_key(
+  EverCrypt_HMAC_key_s *prk,
+  uint8_t *okm,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  uint32_t tlen = EverCrypt_Hash_Incremental_hash_len(prk->alg);
+  /* The block counter is a single byte, and T(i-1) || info || i must fit in a uint32_t. */
+  if
+  (
+    len > (uint32_t)255U * tlen
+    || infolen > (uint32_t)0xffffffffU - tlen - (uint32_t)1U
+  )
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint32_t n = len / tlen;
+  uint8_t *output = okm;
+  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
+  uint8_t text[tlen + infolen + (uint32_t)1U];
+  memset(text, 0U, (tlen + infolen + (uint32_t)1U) * sizeof (uint8_t));
+  uint8_t *text0 = text + tlen;
+  uint8_t *tag = text;
+  uint8_t *ctr = text + tlen + infolen;
+  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    ctr[0U] = (uint8_t)(i + (uint32_t)1U);
+    if (i == (uint32_t)0U)
+    {
+      EverCrypt_HMAC_compute_with_key(prk, tag, text0, infolen + (uint32_t)1U);
+    }
+    else
+    {
+      EverCrypt_HMAC_compute_with_key(prk, tag, text, tlen + infolen + (uint32_t)1U);
+    }
+    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
+  }
+  if (n * tlen < len)
+  {
+    ctr[0U] = (uint8_t)(n + (uint32_t)1U);
+    if (n == (uint32_t)0U)
+    {
+      EverCrypt_HMAC_compute_with_key(prk, tag, text0, infolen + (uint32_t)1U);
+    }
+    else
+    {
+      EverCrypt_HMAC_compute_with_key(prk, tag, text, tlen + infolen + (uint32_t)1U);
+    }
+    uint8_t *block = okm + n * tlen;
+    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(tag, tlen * sizeof (tag[0U]));
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HKDF_expand_label_many(
+  EverCrypt_HMAC_key_s *prk,
+  uint32_t n,
+  uint8_t **okm,
+  uint32_t *okm_len,
+  uint8_t **label,
+  uint32_t *label_len,
+  uint8_t **context,
+  uint32_t *context_len
+)
+{
+  /* struct { uint16 length; opaque label<7..255>; opaque context<0..255>; } HkdfLabel; */
+  uint32_t tlen = EverCrypt_Hash_Incremental_hash_len(prk->alg);
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    if
+    (
+      label_len[i] > (uint32_t)249U
+      || context_len[i] > (uint32_t)255U
+      || okm_len[i] > (uint32_t)0xffffU
+      || okm_len[i] > (uint32_t)255U * tlen
+    )
+    {
+      return EverCrypt_Error_MaximumLengthExceeded;
+    }
+  }
+  uint8_t info[514U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint32_t ll = label_len[i];
+    uint32_t cl = context_len[i];
+    store16_be(info, (uint16_t)okm_len[i]);
+    info[2U] = (uint8_t)((uint32_t)6U + ll);
+    memcpy(info + (uint32_t)3U, "tls13 ", (uint32_t)6U * sizeof (uint8_t));
+    memcpy(info + (uint32_t)9U, label[i], ll * sizeof (uint8_t));
+    info[(uint32_t)9U + ll] = (uint8_t)cl;
+    memcpy(info + (uint32_t)10U + ll, context[i], cl * sizeof (uint8_t));
+    EverCrypt_HKDF_expand_with_key(prk, okm[i], info, (uint32_t)10U + ll + cl, okm_len[i]);
+  }
+  return EverCrypt_Error_Success;
+}
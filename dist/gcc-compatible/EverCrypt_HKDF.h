@@ -37,6 +37,7 @@ extern "C" {
 
 #include "Hacl_Spec.h"
 #include "EverCrypt_HMAC.h"
+#include "EverCrypt_Error.h"
 #include "evercrypt_targetconfig.h"
 #include "libintvector.h"
 void
@@ -174,6 +175,55 @@ EverCrypt_HKDF_extract(
   uint32_t ikmlen
 );
 
+/*
+  Extract a PRK and return it as a precomputed HMAC key, ready for repeated expansions with
+  EverCrypt_HKDF_expand_with_key. Free it with EverCrypt_HMAC_key_free.
+*/
+EverCrypt_HMAC_key_s
+*EverCrypt_HKDF_extract_to_key(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint8_t *ikm,
+  uint32_t ikmlen
+);
+
+/*
+  Same result as EverCrypt_HKDF_expand on the PRK `prk` was created from, without hashing
+  the padded PRK again for every output block.
+
+  Returns EverCrypt_Error_MaximumLengthExceeded, writing nothing, if `len` is more than 255
+  times the hash length.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HKDF_expand_with_key(
+  EverCrypt_HMAC_key_s *prk,
+  uint8_t *okm,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+);
+
+/*
+  TLS 1.3 HKDF-Expand-Label (RFC 8446, section 7.1) for `n` outputs under the same secret:
+  okm[i] = HKDF-Expand-Label(prk, label[i], context[i], okm_len[i]). Labels are given
+  without the "tls13 " prefix and must be at most 249 bytes long; contexts at most 255.
+
+  Returns EverCrypt_Error_MaximumLengthExceeded, writing nothing, if any label or context is
+  too long or any okm_len[i] is more than 255 times the hash length.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HKDF_expand_label_many(
+  EverCrypt_HMAC_key_s *prk,
+  uint32_t n,
+  uint8_t **okm,
+  uint32_t *okm_len,
+  uint8_t **label,
+  uint32_t *label_len,
+  uint8_t **context,
+  uint32_t *context_len
+);
+
 KRML_DEPRECATED("expand")
 
 void
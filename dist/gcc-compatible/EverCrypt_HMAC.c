@@ -24,10 +24,14 @@
 
 #include "EverCrypt_HMAC.h"
 
+#include "internal/EverCrypt_Hash.h"
 #include "internal/Hacl_Hash_SHA2.h"
 #include "internal/Hacl_Hash_SHA1.h"
 #include "internal/Hacl_Hash_Blake2.h"
 #include "internal/Hacl_HMAC.h"
+#include "Hacl_HMAC_Vec256.h"
+#include "Hacl_HMAC_Blake2s_128.h"
+#include "Hacl_HMAC_Blake2b_256.h"
 
 void
 EverCrypt_HMAC_compute_sha1(
@@ -392,6 +396,14 @@ EverCrypt_HMAC_compute_blake2s(
   uint32_t data_len
 )
 {
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    Hacl_HMAC_Blake2s_128_compute_blake2s_128(dst, key, key_len, data, data_len);
+    return;
+  }
+  #endif
   uint32_t l = (uint32_t)64U;
   KRML_CHECK_SIZE(sizeof (uint8_t), l);
   uint8_t key_block[l];
@@ -576,6 +588,14 @@ EverCrypt_HMAC_compute_blake2b(
   uint32_t data_len
 )
 {
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_HMAC_Blake2b_256_compute_blake2b_256(dst, key, key_len, data, data_len);
+    return;
+  }
+  #endif
   uint32_t l = (uint32_t)128U;
   KRML_CHECK_SIZE(sizeof (uint8_t), l);
   uint8_t key_block[l];
@@ -853,3 +873,358 @@ EverCrypt_HMAC_compute(
   }
 }
 
+
+/* Stack storage large enough for any of the hash states HMAC supports. */
+typedef union
+{
+  uint64_t case_u64[16U];
+  Lib_IntVector_Intrinsics_vec128 case_vec128[4U];
+  Lib_IntVector_Intrinsics_vec256 case_vec256[4U];
+}
+hash_storage;
+
+static EverCrypt_Hash_state_s
+state_in_storage(EverCrypt_Hash_state_s_tags tag, hash_storage *st)
+{
+  EverCrypt_Hash_state_s s;
+  s.tag = tag;
+  switch (tag)
+  {
+    case EverCrypt_Hash_SHA1_s:
+      {
+        s.case_SHA1_s = (uint32_t *)st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_SHA2_224_s:
+      {
+        s.case_SHA2_224_s = (uint32_t *)st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_SHA2_256_s:
+      {
+        s.case_SHA2_256_s = (uint32_t *)st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_SHA2_384_s:
+      {
+        s.case_SHA2_384_s = st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_SHA2_512_s:
+      {
+        s.case_SHA2_512_s = st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_Blake2S_s:
+      {
+        s.case_Blake2S_s = (uint32_t *)st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_Blake2B_s:
+      {
+        s.case_Blake2B_s = st->case_u64;
+        break;
+      }
+    case EverCrypt_Hash_Blake2S_128_s:
+      {
+        s.case_Blake2S_128_s = st->case_vec128;
+        break;
+      }
+    case EverCrypt_Hash_Blake2B_256_s:
+      {
+        s.case_Blake2B_256_s = st->case_vec256;
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  return s;
+}
+
+static void
+init_padded(
+  EverCrypt_Hash_state_s *s,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key_block,
+  uint8_t pad
+)
+{
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), l);
+  uint8_t block[l];
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    block[i] = pad ^ key_block[i];
+  }
+  EverCrypt_Hash_init(s);
+  EverCrypt_Hash_update_multi2(s, (uint64_t)0U, block, l);
+  Lib_Memzero0_memzero(block, l * sizeof (block[0U]));
+}
+
+static void
+init_key_block(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key_block,
+  uint8_t *key,
+  uint32_t keylen
+)
+{
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  memset(key_block, 0U, l * sizeof (uint8_t));
+  if (keylen <= l)
+  {
+    memcpy(key_block, key, keylen * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, key_block, key, keylen);
+  }
+}
+
+EverCrypt_HMAC_key_s
+*EverCrypt_HMAC_key_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t keylen)
+{
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  uint8_t *key_block = (uint8_t *)KRML_HOST_CALLOC(l, sizeof (uint8_t));
+  init_key_block(a, key_block, key, keylen);
+  EverCrypt_Hash_state_s *inner = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_state_s *outer = EverCrypt_Hash_create_in(a);
+  init_padded(inner, a, key_block, (uint8_t)0x36U);
+  init_padded(outer, a, key_block, (uint8_t)0x5cU);
+  EverCrypt_HMAC_key_s k = { .alg = a, .key_block = key_block, .inner = inner, .outer = outer };
+  EverCrypt_HMAC_key_s
+  *p = (EverCrypt_HMAC_key_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_key_s));
+  p[0U] = k;
+  return p;
+}
+
+void EverCrypt_HMAC_key_init(EverCrypt_HMAC_key_s *k, uint8_t *key, uint32_t keylen)
+{
+  Spec_Hash_Definitions_hash_alg a = k->alg;
+  init_key_block(a, k->key_block, key, keylen);
+  init_padded(k->inner, a, k->key_block, (uint8_t)0x36U);
+  init_padded(k->outer, a, k->key_block, (uint8_t)0x5cU);
+}
+
+/* mac = H(key ^ opad || hash1), starting from the outer midstate of k. */
+static void finish_outer(EverCrypt_HMAC_key_s *k, uint8_t *hash1, uint8_t *mac)
+{
+  Spec_Hash_Definitions_hash_alg a = k->alg;
+  hash_storage st;
+  EverCrypt_Hash_state_s s = state_in_storage(k->outer->tag, &st);
+  EverCrypt_Hash_copy(k->outer, &s);
+  EverCrypt_Hash_update_last2(&s,
+    (uint64_t)EverCrypt_Hash_Incremental_block_len(a),
+    hash1,
+    EverCrypt_Hash_Incremental_hash_len(a));
+  EverCrypt_Hash_finish(&s, mac);
+  Lib_Memzero0_memzero(&st, (uint32_t)1U * sizeof (st));
+}
+
+void
+EverCrypt_HMAC_compute_with_key(
+  EverCrypt_HMAC_key_s *k,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t datalen
+)
+{
+  Spec_Hash_Definitions_hash_alg a = k->alg;
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(a);
+  if (datalen == (uint32_t)0U)
+  {
+    /* Blake2 cannot finish on an empty last block once a block has been absorbed; this is
+    the only input where the midstates are of no use. */
+    EverCrypt_HMAC_compute(a, mac, k->key_block, l, data, datalen);
+    return;
+  }
+  /* The last chunk handed to update_last2 holds between 1 and l bytes. */
+  uint32_t n_blocks = (datalen - (uint32_t)1U) / l;
+  uint32_t rem = datalen - n_blocks * l;
+  hash_storage st;
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_state_s s = state_in_storage(k->inner->tag, &st);
+  EverCrypt_Hash_copy(k->inner, &s);
+  EverCrypt_Hash_update_multi2(&s, (uint64_t)l, data, n_blocks * l);
+  EverCrypt_Hash_update_last2(&s,
+    (uint64_t)l + (uint64_t)(n_blocks * l),
+    data + n_blocks * l,
+    rem);
+  EverCrypt_Hash_finish(&s, hash1);
+  Lib_Memzero0_memzero(&st, (uint32_t)1U * sizeof (st));
+  finish_outer(k, hash1, mac);
+  Lib_Memzero0_memzero(hash1, (uint32_t)64U * sizeof (hash1[0U]));
+}
+
+void EverCrypt_HMAC_key_free(EverCrypt_HMAC_key_s *k)
+{
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(k->alg);
+  Lib_Memzero0_memzero(k->key_block, l * sizeof (k->key_block[0U]));
+  KRML_HOST_FREE(k->key_block);
+  EverCrypt_Hash_free(k->inner);
+  EverCrypt_Hash_free(k->outer);
+  KRML_HOST_FREE(k);
+}
+
+EverCrypt_HMAC_state_s
+*EverCrypt_HMAC_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t keylen)
+{
+  EverCrypt_HMAC_key_s *k = EverCrypt_HMAC_key_create_in(a, key, keylen);
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+  *hash = EverCrypt_Hash_Incremental_create_in(a);
+  EverCrypt_HMAC_state_s s = { .key = k, .hash = hash };
+  EverCrypt_HMAC_state_s
+  *p = (EverCrypt_HMAC_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_state_s));
+  p[0U] = s;
+  EverCrypt_HMAC_init(p);
+  return p;
+}
+
+void EverCrypt_HMAC_init(EverCrypt_HMAC_state_s *s)
+{
+  EverCrypt_HMAC_key_s *k = s->key;
+  uint32_t l = EverCrypt_Hash_Incremental_block_len(k->alg);
+  KRML_CHECK_SIZE(sizeof (uint8_t), l);
+  uint8_t ipad[l];
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    ipad[i] = (uint8_t)0x36U ^ k->key_block[i];
+  }
+  /* The pad block goes through the buffer rather than starting from k->inner: the streaming
+  state always holds back its last block, which Blake2 needs to finish an empty message. */
+  EverCrypt_Hash_Incremental_init(s->hash);
+  EverCrypt_Hash_Incremental_update(s->hash, ipad, l);
+  Lib_Memzero0_memzero(ipad, l * sizeof (ipad[0U]));
+}
+
+void EverCrypt_HMAC_update(EverCrypt_HMAC_state_s *s, uint8_t *data, uint32_t len)
+{
+  EverCrypt_Hash_Incremental_update(s->hash, data, len);
+}
+
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state_s *s, uint8_t *mac)
+{
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_Incremental_finish(s->hash, hash1);
+  finish_outer(s->key, hash1, mac);
+  Lib_Memzero0_memzero(hash1, (uint32_t)64U * sizeof (hash1[0U]));
+}
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_s *s)
+{
+  EverCrypt_Hash_Incremental_free(s->hash);
+  EverCrypt_HMAC_key_free(s->key);
+  KRML_HOST_FREE(s);
+}
+
+/* Runs the multi-lane kernel over groups of `lanes` MACs; the last, partial group leaves
+its spare lanes unused. */
+static void
+compute_many_lanes(
+  uint32_t lanes,
+  void
+  (*kernel)(uint8_t **x0, uint8_t **x1, uint32_t *x2, uint8_t **x3, uint32_t *x4),
+  uint32_t n,
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+)
+{
+  uint32_t full = n / lanes * lanes;
+  for (uint32_t i = (uint32_t)0U; i < full; i = i + lanes)
+  {
+    kernel(dst + i, key + i, key_len + i, data + i, data_len + i);
+  }
+  if (full < n)
+  {
+    uint8_t *d[8U] = { 0U };
+    uint8_t *k[8U] = { 0U };
+    uint32_t kl[8U] = { 0U };
+    uint8_t *m[8U] = { 0U };
+    uint32_t ml[8U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < n - full; i++)
+    {
+      d[i] = dst[full + i];
+      k[i] = key[full + i];
+      kl[i] = key_len[full + i];
+      m[i] = data[full + i];
+      ml[i] = data_len[full + i];
+    }
+    kernel(d, k, kl, m, ml);
+  }
+}
+
+void
+EverCrypt_HMAC_compute_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+        bool has_sse = EverCrypt_AutoConfig2_has_sse();
+        #if HACL_CAN_COMPILE_VALE
+        if (has_shaext && has_sse)
+        {
+          /* One MAC at a time on SHA-NI beats the 8-lane AVX2 kernel */
+          break;
+        }
+        #endif
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          compute_many_lanes((uint32_t)8U,
+            Hacl_HMAC_Vec256_compute_sha2_256_8,
+            n,
+            dst,
+            key,
+            key_len,
+            data,
+            data_len);
+          return;
+        }
+        #endif
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          compute_many_lanes((uint32_t)4U,
+            Hacl_HMAC_Vec256_compute_sha2_512_4,
+            n,
+            dst,
+            key,
+            key_len,
+            data,
+            data_len);
+          return;
+        }
+        #endif
+        break;
+      }
+    default:
+      {
+        break;
+      }
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_HMAC_compute(a, dst[i], key[i], key_len[i], data[i], data_len[i]);
+  }
+}
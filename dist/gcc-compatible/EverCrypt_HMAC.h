@@ -35,6 +35,7 @@ extern "C" {
 #include "krml/internal/target.h"
 
 
+#include "Lib_Memzero0.h"
 #include "Hacl_Spec.h"
 #include "Hacl_Krmllib.h"
 #include "Hacl_Impl_Blake2_Constants.h"
@@ -111,6 +112,99 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/*
+  A precomputed HMAC key: the hash states after absorbing key ^ ipad and key ^ opad.
+  Each MAC computed with it starts from copies of these two states, which saves the two
+  compression function calls over the padded key that EverCrypt_HMAC_compute performs
+  on every call. The key is only read after creation, so it may be shared between threads.
+*/
+typedef struct EverCrypt_HMAC_key_s_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  uint8_t *key_block;
+  EverCrypt_Hash_state_s *inner;
+  EverCrypt_Hash_state_s *outer;
+}
+EverCrypt_HMAC_key_s;
+
+/*
+  Allocate a precomputed key for `a`, which must satisfy EverCrypt_HMAC_is_supported_alg.
+  Free it with EverCrypt_HMAC_key_free.
+*/
+EverCrypt_HMAC_key_s
+*EverCrypt_HMAC_key_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t keylen);
+
+/*
+  Same result as EverCrypt_HMAC_compute(k->alg, mac, key, keylen, data, datalen).
+*/
+void
+EverCrypt_HMAC_compute_with_key(
+  EverCrypt_HMAC_key_s *k,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t datalen
+);
+
+/*
+  Replace the key of `k` in place, without allocating: afterwards `k` is as if freshly
+  created with `key` for the same algorithm. Callers must not use `k` concurrently.
+*/
+void EverCrypt_HMAC_key_init(EverCrypt_HMAC_key_s *k, uint8_t *key, uint32_t keylen);
+
+void EverCrypt_HMAC_key_free(EverCrypt_HMAC_key_s *k);
+
+/*
+  Streaming HMAC over EverCrypt_Hash_Incremental, for messages that are not available in
+  one contiguous buffer. The state owns a precomputed key for the outer hash.
+*/
+typedef struct EverCrypt_HMAC_state_s_s
+{
+  EverCrypt_HMAC_key_s *key;
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *hash;
+}
+EverCrypt_HMAC_state_s;
+
+/*
+  Allocate a streaming state for `a`, which must satisfy EverCrypt_HMAC_is_supported_alg,
+  ready to absorb a first message.
+*/
+EverCrypt_HMAC_state_s
+*EverCrypt_HMAC_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t keylen);
+
+/*
+  Restart the state on a new message under the same key.
+*/
+void EverCrypt_HMAC_init(EverCrypt_HMAC_state_s *s);
+
+/*
+  The total message length is bounded as for EverCrypt_Hash_Incremental_update.
+*/
+void EverCrypt_HMAC_update(EverCrypt_HMAC_state_s *s, uint8_t *data, uint32_t len);
+
+/*
+  Write the MAC of everything absorbed since the last init. The state is left unchanged,
+  so more data may follow.
+*/
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state_s *s, uint8_t *mac);
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_s *s);
+
+/*
+  n independent MACs: dst[i] = HMAC-a(key[i], data[i]). HMAC-SHA2-256 and HMAC-SHA2-512 go
+  through the multi-lane kernels of Hacl_HMAC_Vec256 when the CPU supports them (and, for
+  SHA2-256, lacks SHA-NI); everything else is computed one MAC at a time.
+*/
+void
+EverCrypt_HMAC_compute_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+);
+
 #if defined(__cplusplus)
 }
 #endif
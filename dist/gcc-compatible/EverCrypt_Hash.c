@@ -22,13 +22,18 @@
  */
 
 
-#include "EverCrypt_Hash.h"
+#include "internal/EverCrypt_Hash.h"
 
 #include "internal/Vale.h"
 #include "internal/Hacl_Hash_SHA2.h"
 #include "internal/Hacl_Hash_SHA1.h"
 #include "internal/Hacl_Hash_MD5.h"
+#include "internal/Hacl_Hash_Blake2s_128.h"
+#include "internal/Hacl_Hash_Blake2b_256.h"
 #include "internal/Hacl_Hash_Blake2.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_Streaming_SHA3.h"
+#include "Lib_SHA1_Shaext.h"
 
 C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
 {
@@ -66,6 +71,30 @@ C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
       {
         return "Blake2B";
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return "SHA3_256";
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return "SHA3_224";
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return "SHA3_384";
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return "SHA3_512";
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        return "Shake128";
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        return "Shake256";
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -178,6 +207,84 @@ EverCrypt_Hash_uu___is_Blake2B_s(
   return false;
 }
 
+bool
+EverCrypt_Hash_uu___is_Blake2S_128_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+bool
+EverCrypt_Hash_uu___is_Blake2B_256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_224_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_384_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_512_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return true;
+  }
+  return false;
+}
+
 Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -213,6 +320,30 @@ Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_
   {
     return Spec_Hash_Definitions_Blake2B;
   }
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    return Spec_Hash_Definitions_Blake2S;
+  }
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    return Spec_Hash_Definitions_Blake2B;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return Spec_Hash_Definitions_SHA3_224;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return Spec_Hash_Definitions_SHA3_256;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return Spec_Hash_Definitions_SHA3_384;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return Spec_Hash_Definitions_SHA3_512;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -267,16 +398,82 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg
       }
     case Spec_Hash_Definitions_Blake2S:
       {
+        bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+        #if HACL_CAN_COMPILE_VEC128
+        if (vec128)
+        {
+          Lib_IntVector_Intrinsics_vec128
+          *buf =
+            (Lib_IntVector_Intrinsics_vec128 *)KRML_ALIGNED_MALLOC(16,
+              sizeof (Lib_IntVector_Intrinsics_vec128) * (uint32_t)4U);
+          memset(buf, 0U, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec128));
+          s =
+            (
+              (EverCrypt_Hash_state_s){
+                .tag = EverCrypt_Hash_Blake2S_128_s,
+                { .case_Blake2S_128_s = buf }
+              }
+            );
+          break;
+        }
+        #endif
         uint32_t *buf = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint32_t));
         s = ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2S_s, { .case_Blake2S_s = buf } });
         break;
       }
     case Spec_Hash_Definitions_Blake2B:
       {
+        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          Lib_IntVector_Intrinsics_vec256
+          *buf =
+            (Lib_IntVector_Intrinsics_vec256 *)KRML_ALIGNED_MALLOC(32,
+              sizeof (Lib_IntVector_Intrinsics_vec256) * (uint32_t)4U);
+          memset(buf, 0U, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec256));
+          s =
+            (
+              (EverCrypt_Hash_state_s){
+                .tag = EverCrypt_Hash_Blake2B_256_s,
+                { .case_Blake2B_256_s = buf }
+              }
+            );
+          break;
+        }
+        #endif
         uint64_t *buf = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint64_t));
         s = ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = buf } });
         break;
       }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf } });
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -405,6 +602,46 @@ void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s)
     FStar_UInt128_uint128 uu____1 = FStar_UInt128_uint64_to_uint128((uint64_t)0U);
     return;
   }
+  #if HACL_CAN_COMPILE_VEC128
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    Lib_IntVector_Intrinsics_vec128 *p1 = scrut.case_Blake2S_128_s;
+    Hacl_Blake2s_128_blake2s_init(p1, (uint32_t)0U, (uint32_t)32U);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    Lib_IntVector_Intrinsics_vec256 *p1 = scrut.case_Blake2B_256_s;
+    Hacl_Blake2b_256_blake2b_init(p1, (uint32_t)0U, (uint32_t)64U);
+    return;
+  }
+  #endif
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -448,6 +685,20 @@ void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n)
   Hacl_Hash_SHA2_update_multi_256(s, blocks, n);
 }
 
+static void update_multi_sha1(uint32_t *s, uint8_t *blocks, uint32_t n)
+{
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if HACL_CAN_COMPILE_SHAEXT
+  if (has_shaext && has_sse)
+  {
+    Lib_SHA1_Shaext_update_multi(s, blocks, n);
+    return;
+  }
+  #endif
+  Hacl_Hash_SHA1_legacy_update_multi(s, blocks, n);
+}
+
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -460,7 +711,7 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
   if (scrut.tag == EverCrypt_Hash_SHA1_s)
   {
     uint32_t *p1 = scrut.case_SHA1_s;
-    Hacl_Hash_Core_SHA1_legacy_update(p1, block);
+    update_multi_sha1(p1, block, (uint32_t)1U);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_SHA2_224_s)
@@ -503,6 +754,52 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
         block);
     return;
   }
+  #if HACL_CAN_COMPILE_VEC128
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    Lib_IntVector_Intrinsics_vec128 *p1 = scrut.case_Blake2S_128_s;
+    uint64_t
+    uu____2 = Hacl_Hash_Blake2s_128_update_multi_blake2s_128(p1, prevlen, block, (uint32_t)1U);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    Lib_IntVector_Intrinsics_vec256 *p1 = scrut.case_Blake2B_256_s;
+    FStar_UInt128_uint128
+    uu____3 =
+      Hacl_Hash_Blake2b_256_update_multi_blake2b_256(p1,
+        FStar_UInt128_uint64_to_uint128(prevlen),
+        block,
+        (uint32_t)1U);
+    return;
+  }
+  #endif
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)144U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)136U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)104U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)72U, block, p1);
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -537,7 +834,7 @@ EverCrypt_Hash_update_multi2(
   {
     uint32_t *p1 = scrut.case_SHA1_s;
     uint32_t n = len / (uint32_t)64U;
-    Hacl_Hash_SHA1_legacy_update_multi(p1, blocks, n);
+    update_multi_sha1(p1, blocks, n);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_SHA2_224_s)
@@ -587,6 +884,69 @@ EverCrypt_Hash_update_multi2(
         n);
     return;
   }
+  #if HACL_CAN_COMPILE_VEC128
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    Lib_IntVector_Intrinsics_vec128 *p1 = scrut.case_Blake2S_128_s;
+    uint32_t n = len / (uint32_t)64U;
+    uint64_t uu____2 = Hacl_Hash_Blake2s_128_update_multi_blake2s_128(p1, prevlen, blocks, n);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    Lib_IntVector_Intrinsics_vec256 *p1 = scrut.case_Blake2B_256_s;
+    uint32_t n = len / (uint32_t)128U;
+    FStar_UInt128_uint128
+    uu____3 =
+      Hacl_Hash_Blake2b_256_update_multi_blake2b_256(p1,
+        FStar_UInt128_uint64_to_uint128(prevlen),
+        blocks,
+        n);
+    return;
+  }
+  #endif
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    uint32_t n = len / (uint32_t)144U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)144U, blocks + i * (uint32_t)144U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    uint32_t n = len / (uint32_t)136U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)136U, blocks + i * (uint32_t)136U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    uint32_t n = len / (uint32_t)104U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)104U, blocks + i * (uint32_t)104U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    uint32_t n = len / (uint32_t)72U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)72U, blocks + i * (uint32_t)72U, p1);
+    }
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -633,6 +993,23 @@ EverCrypt_Hash_update_last_256(
   EverCrypt_Hash_update_multi_256(s, tmp, tmp_len / (uint32_t)64U);
 }
 
+static void
+update_last_sha1(
+  uint32_t *s,
+  uint64_t prev_len,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  uint32_t blocks_n = input_len / (uint32_t)64U;
+  uint32_t blocks_len = blocks_n * (uint32_t)64U;
+  uint8_t *blocks = input;
+  uint32_t rest_len = input_len - blocks_len;
+  uint8_t *rest = input + blocks_len;
+  update_multi_sha1(s, blocks, blocks_n);
+  Hacl_Hash_SHA1_legacy_update_last(s, prev_len + (uint64_t)blocks_len, rest, rest_len);
+}
+
 void
 EverCrypt_Hash_update_last2(
   EverCrypt_Hash_state_s *s,
@@ -651,7 +1028,7 @@ EverCrypt_Hash_update_last2(
   if (scrut.tag == EverCrypt_Hash_SHA1_s)
   {
     uint32_t *p1 = scrut.case_SHA1_s;
-    Hacl_Hash_SHA1_legacy_update_last(p1, prev_len, last, last_len);
+    update_last_sha1(p1, prev_len, last, last_len);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_SHA2_224_s)
@@ -696,6 +1073,53 @@ EverCrypt_Hash_update_last2(
         last_len);
     return;
   }
+  #if HACL_CAN_COMPILE_VEC128
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    Lib_IntVector_Intrinsics_vec128 *p1 = scrut.case_Blake2S_128_s;
+    uint64_t
+    x = Hacl_Hash_Blake2s_128_update_last_blake2s_128(p1, prev_len, prev_len, last, last_len);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    Lib_IntVector_Intrinsics_vec256 *p1 = scrut.case_Blake2B_256_s;
+    FStar_UInt128_uint128
+    x =
+      Hacl_Hash_Blake2b_256_update_last_blake2b_256(p1,
+        FStar_UInt128_uint64_to_uint128(prev_len),
+        FStar_UInt128_uint64_to_uint128(prev_len),
+        last,
+        last_len);
+    return;
+  }
+  #endif
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)144U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)136U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)104U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)72U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -751,6 +1175,26 @@ void EverCrypt_Hash_update_last(EverCrypt_Hash_state_s *s, uint8_t *last, uint64
         sw = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw = (uint32_t)72U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -815,6 +1259,48 @@ void EverCrypt_Hash_finish(EverCrypt_Hash_state_s *s, uint8_t *dst)
       dst);
     return;
   }
+  #if HACL_CAN_COMPILE_VEC128
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    Lib_IntVector_Intrinsics_vec128 *p1 = scrut.case_Blake2S_128_s;
+    Hacl_Hash_Blake2s_128_finish_blake2s_128(p1, (uint64_t)0U, dst);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    Lib_IntVector_Intrinsics_vec256 *p1 = scrut.case_Blake2B_256_s;
+    Hacl_Hash_Blake2b_256_finish_blake2b_256(p1,
+      FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+      dst);
+    return;
+  }
+  #endif
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)144U, (uint32_t)28U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)136U, (uint32_t)32U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)104U, (uint32_t)48U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)72U, (uint32_t)64U, dst);
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -865,6 +1351,36 @@ void EverCrypt_Hash_free(EverCrypt_Hash_state_s *s)
     uint64_t *p1 = scrut.case_Blake2B_s;
     KRML_HOST_FREE(p1);
   }
+  else if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    Lib_IntVector_Intrinsics_vec128 *p1 = scrut.case_Blake2S_128_s;
+    KRML_ALIGNED_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    Lib_IntVector_Intrinsics_vec256 *p1 = scrut.case_Blake2B_256_s;
+    KRML_ALIGNED_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    KRML_HOST_FREE(p1);
+  }
   else
   {
     KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
@@ -876,135 +1392,273 @@ void EverCrypt_Hash_free(EverCrypt_Hash_state_s *s)
   KRML_HOST_FREE(s);
 }
 
+/*
+  create_in picks the scalar or the vector Blake2 state from the CPU features at
+  the time of the call, so two states of the same algorithm may not share a
+  layout if AutoConfig2 changed in between. Both layouts hold the same 16 words
+  in the same order (one row per vector, lane i being word i of the row), and
+  copy into each other as such. Returns false if the two tags are not such a
+  pair.
+*/
+static bool
+copy_blake2_across(EverCrypt_Hash_state_s s_src, EverCrypt_Hash_state_s s_dst)
+{
+  if (s_src.tag == EverCrypt_Hash_Blake2S_s && s_dst.tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    memcpy(s_dst.case_Blake2S_128_s, s_src.case_Blake2S_s, (uint32_t)16U * sizeof (uint32_t));
+    return true;
+  }
+  if (s_src.tag == EverCrypt_Hash_Blake2S_128_s && s_dst.tag == EverCrypt_Hash_Blake2S_s)
+  {
+    memcpy(s_dst.case_Blake2S_s, s_src.case_Blake2S_128_s, (uint32_t)16U * sizeof (uint32_t));
+    return true;
+  }
+  if (s_src.tag == EverCrypt_Hash_Blake2B_s && s_dst.tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    memcpy(s_dst.case_Blake2B_256_s, s_src.case_Blake2B_s, (uint32_t)16U * sizeof (uint64_t));
+    return true;
+  }
+  if (s_src.tag == EverCrypt_Hash_Blake2B_256_s && s_dst.tag == EverCrypt_Hash_Blake2B_s)
+  {
+    memcpy(s_dst.case_Blake2B_s, s_src.case_Blake2B_256_s, (uint32_t)16U * sizeof (uint64_t));
+    return true;
+  }
+  return false;
+}
+
 void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *s_dst)
 {
+  if (copy_blake2_across(*s_src, *s_dst))
+  {
+    return;
+  }
   EverCrypt_Hash_state_s scrut = *s_src;
   if (scrut.tag == EverCrypt_Hash_MD5_s)
   {
     uint32_t *p_src = scrut.case_MD5_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
     uint32_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_MD5_s)
+    if (x1.tag == EverCrypt_Hash_MD5_s)
+    {
+      p_dst = x1.case_MD5_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)4U * sizeof (uint32_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA1_s)
+  {
+    uint32_t *p_src = scrut.case_SHA1_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint32_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA1_s)
+    {
+      p_dst = x1.case_SHA1_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)5U * sizeof (uint32_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA2_224_s)
+  {
+    uint32_t *p_src = scrut.case_SHA2_224_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint32_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA2_224_s)
+    {
+      p_dst = x1.case_SHA2_224_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint32_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA2_256_s)
+  {
+    uint32_t *p_src = scrut.case_SHA2_256_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint32_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA2_256_s)
+    {
+      p_dst = x1.case_SHA2_256_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint32_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA2_384_s)
+  {
+    uint64_t *p_src = scrut.case_SHA2_384_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA2_384_s)
+    {
+      p_dst = x1.case_SHA2_384_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA2_512_s)
+  {
+    uint64_t *p_src = scrut.case_SHA2_512_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA2_512_s)
+    {
+      p_dst = x1.case_SHA2_512_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Blake2S_s)
+  {
+    uint32_t *p_src = scrut.case_Blake2S_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint32_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_Blake2S_s)
     {
-      p_dst = x1.case_MD5_s;
+      p_dst = x1.case_Blake2S_s;
     }
     else
     {
       p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)4U * sizeof (uint32_t));
+    memcpy(p_dst, p_src, (uint32_t)16U * sizeof (uint32_t));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_SHA1_s)
+  if (scrut.tag == EverCrypt_Hash_Blake2B_s)
   {
-    uint32_t *p_src = scrut.case_SHA1_s;
+    uint64_t *p_src = scrut.case_Blake2B_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
-    uint32_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_SHA1_s)
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_Blake2B_s)
     {
-      p_dst = x1.case_SHA1_s;
+      p_dst = x1.case_Blake2B_s;
     }
     else
     {
-      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)5U * sizeof (uint32_t));
+    memcpy(p_dst, p_src, (uint32_t)16U * sizeof (uint64_t));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_SHA2_224_s)
+  if (scrut.tag == EverCrypt_Hash_Blake2S_128_s)
   {
-    uint32_t *p_src = scrut.case_SHA2_224_s;
+    Lib_IntVector_Intrinsics_vec128 *p_src = scrut.case_Blake2S_128_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
-    uint32_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_SHA2_224_s)
+    Lib_IntVector_Intrinsics_vec128 *p_dst;
+    if (x1.tag == EverCrypt_Hash_Blake2S_128_s)
     {
-      p_dst = x1.case_SHA2_224_s;
+      p_dst = x1.case_Blake2S_128_s;
     }
     else
     {
-      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+      p_dst =
+        KRML_EABORT(Lib_IntVector_Intrinsics_vec128 *,
+          "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint32_t));
+    memcpy(p_dst, p_src, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec128));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_SHA2_256_s)
+  if (scrut.tag == EverCrypt_Hash_Blake2B_256_s)
   {
-    uint32_t *p_src = scrut.case_SHA2_256_s;
+    Lib_IntVector_Intrinsics_vec256 *p_src = scrut.case_Blake2B_256_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
-    uint32_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_SHA2_256_s)
+    Lib_IntVector_Intrinsics_vec256 *p_dst;
+    if (x1.tag == EverCrypt_Hash_Blake2B_256_s)
     {
-      p_dst = x1.case_SHA2_256_s;
+      p_dst = x1.case_Blake2B_256_s;
     }
     else
     {
-      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+      p_dst =
+        KRML_EABORT(Lib_IntVector_Intrinsics_vec256 *,
+          "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint32_t));
+    memcpy(p_dst, p_src, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec256));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_SHA2_384_s)
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
   {
-    uint64_t *p_src = scrut.case_SHA2_384_s;
+    uint64_t *p_src = scrut.case_SHA3_224_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
     uint64_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_SHA2_384_s)
+    if (x1.tag == EverCrypt_Hash_SHA3_224_s)
     {
-      p_dst = x1.case_SHA2_384_s;
+      p_dst = x1.case_SHA3_224_s;
     }
     else
     {
       p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint64_t));
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_SHA2_512_s)
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
   {
-    uint64_t *p_src = scrut.case_SHA2_512_s;
+    uint64_t *p_src = scrut.case_SHA3_256_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
     uint64_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_SHA2_512_s)
+    if (x1.tag == EverCrypt_Hash_SHA3_256_s)
     {
-      p_dst = x1.case_SHA2_512_s;
+      p_dst = x1.case_SHA3_256_s;
     }
     else
     {
       p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)8U * sizeof (uint64_t));
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_Blake2S_s)
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
   {
-    uint32_t *p_src = scrut.case_Blake2S_s;
+    uint64_t *p_src = scrut.case_SHA3_384_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
-    uint32_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_Blake2S_s)
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_384_s)
     {
-      p_dst = x1.case_Blake2S_s;
+      p_dst = x1.case_SHA3_384_s;
     }
     else
     {
-      p_dst = KRML_EABORT(uint32_t *, "unreachable (pattern matches are exhaustive in F*)");
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)16U * sizeof (uint32_t));
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
     return;
   }
-  if (scrut.tag == EverCrypt_Hash_Blake2B_s)
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
   {
-    uint64_t *p_src = scrut.case_Blake2B_s;
+    uint64_t *p_src = scrut.case_SHA3_512_s;
     EverCrypt_Hash_state_s x1 = *s_dst;
     uint64_t *p_dst;
-    if (x1.tag == EverCrypt_Hash_Blake2B_s)
+    if (x1.tag == EverCrypt_Hash_SHA3_512_s)
     {
-      p_dst = x1.case_Blake2B_s;
+      p_dst = x1.case_SHA3_512_s;
     }
     else
     {
       p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
     }
-    memcpy(p_dst, p_src, (uint32_t)16U * sizeof (uint64_t));
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
     return;
   }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
@@ -1014,6 +1668,34 @@ void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *
   KRML_HOST_EXIT(255U);
 }
 
+static void hash_sha1(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint32_t
+  scrut[5U] =
+    {
+      (uint32_t)0x67452301U, (uint32_t)0xefcdab89U, (uint32_t)0x98badcfeU, (uint32_t)0x10325476U,
+      (uint32_t)0xc3d2e1f0U
+    };
+  uint32_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)64U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)64U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
+  uint32_t blocks_len = blocks_n1 * (uint32_t)64U;
+  uint8_t *blocks = input;
+  uint32_t rest_len = input_len - blocks_len;
+  uint8_t *rest = input + blocks_len;
+  update_multi_sha1(s, blocks, blocks_n1);
+  update_last_sha1(s, (uint64_t)blocks_len, rest, rest_len);
+  Hacl_Hash_Core_SHA1_legacy_finish(s, dst);
+}
+
 void EverCrypt_Hash_hash_256(uint8_t *input, uint32_t input_len, uint8_t *dst)
 {
   uint32_t
@@ -1097,7 +1779,7 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_SHA1:
       {
-        Hacl_Hash_SHA1_legacy_hash(input, len, dst);
+        hash_sha1(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_SHA2_224:
@@ -1122,14 +1804,50 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_Blake2S:
       {
+        bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+        #if HACL_CAN_COMPILE_VEC128
+        if (vec128)
+        {
+          Hacl_Hash_Blake2s_128_hash_blake2s_128(input, len, dst);
+          return;
+        }
+        #endif
         Hacl_Hash_Blake2_hash_blake2s_32(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_Blake2B:
       {
+        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          Hacl_Hash_Blake2b_256_hash_blake2b_256(input, len, dst);
+          return;
+        }
+        #endif
         Hacl_Hash_Blake2_hash_blake2b_32(input, len, dst);
         break;
       }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        Hacl_SHA3_sha3_224(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        Hacl_SHA3_sha3_256(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        Hacl_SHA3_sha3_384(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        Hacl_SHA3_sha3_512(len, input, dst);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1174,6 +1892,22 @@ uint32_t EverCrypt_Hash_Incremental_hash_len(Spec_Hash_Definitions_hash_alg a)
       {
         return (uint32_t)64U;
       }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)28U;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)48U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)64U;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1218,6 +1952,22 @@ uint32_t EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_hash_alg a)
       {
         return (uint32_t)128U;
       }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)144U;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)136U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)104U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)72U;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1849,8 +2599,24 @@ EverCrypt_Hash_Incremental_finish_blake2s(
   }
   uint8_t *buf_1 = buf_;
   uint32_t buf[16U] = { 0U };
-  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_Blake2S_s, { .case_Blake2S_s = buf } };
-  EverCrypt_Hash_state_s tmp_block_state = s;
+  Lib_IntVector_Intrinsics_vec128 buf_vec[4U];
+  memset(buf_vec, 0U, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  EverCrypt_Hash_state_s tmp_block_state;
+  if (block_state->tag == EverCrypt_Hash_Blake2S_128_s)
+  {
+    tmp_block_state =
+      (
+        (EverCrypt_Hash_state_s){
+          .tag = EverCrypt_Hash_Blake2S_128_s,
+          { .case_Blake2S_128_s = buf_vec }
+        }
+      );
+  }
+  else
+  {
+    tmp_block_state =
+      ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2S_s, { .case_Blake2S_s = buf } });
+  }
   EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
@@ -1905,8 +2671,24 @@ EverCrypt_Hash_Incremental_finish_blake2b(
   }
   uint8_t *buf_1 = buf_;
   uint64_t buf[16U] = { 0U };
-  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = buf } };
-  EverCrypt_Hash_state_s tmp_block_state = s;
+  Lib_IntVector_Intrinsics_vec256 buf_vec[4U];
+  memset(buf_vec, 0U, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  EverCrypt_Hash_state_s tmp_block_state;
+  if (block_state->tag == EverCrypt_Hash_Blake2B_256_s)
+  {
+    tmp_block_state =
+      (
+        (EverCrypt_Hash_state_s){
+          .tag = EverCrypt_Hash_Blake2B_256_s,
+          { .case_Blake2B_256_s = buf_vec }
+        }
+      );
+  }
+  else
+  {
+    tmp_block_state =
+      ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = buf } });
+  }
   EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
@@ -1932,6 +2714,154 @@ EverCrypt_Hash_Incremental_finish_blake2b(
   EverCrypt_Hash_finish(&tmp_block_state, dst);
 }
 
+static void
+finish_sha3_224(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+static void
+finish_sha3_256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+static void
+finish_sha3_384(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+static void
+finish_sha3_512(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
 Spec_Hash_Definitions_hash_alg
 EverCrypt_Hash_Incremental_alg_of_state(
   Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s
@@ -1991,6 +2921,26 @@ EverCrypt_Hash_Incremental_finish(
         EverCrypt_Hash_Incremental_finish_blake2b(s, dst);
         break;
       }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        finish_sha3_224(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        finish_sha3_256(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        finish_sha3_384(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        finish_sha3_512(s, dst);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -0,0 +1,204 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_HashMany.h"
+
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_SHA2_Vec128.h"
+#include "Hacl_Streaming_SHA2_Vec256.h"
+#include "Hacl_SHA2_Vec512.h"
+
+static void
+hash_many_sha2_4(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  uint32_t i = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_VEC128
+  while (i + (uint32_t)4U <= n)
+  {
+    uint32_t len = input_len[i];
+    if
+    (
+      input_len[i + (uint32_t)1U]
+      == len
+      && input_len[i + (uint32_t)2U] == len
+      && input_len[i + (uint32_t)3U] == len
+    )
+    {
+      if (a == Spec_Hash_Definitions_SHA2_224)
+      {
+        Hacl_SHA2_Vec128_sha224_4(dst[i],
+          dst[i + (uint32_t)1U],
+          dst[i + (uint32_t)2U],
+          dst[i + (uint32_t)3U],
+          len,
+          input[i],
+          input[i + (uint32_t)1U],
+          input[i + (uint32_t)2U],
+          input[i + (uint32_t)3U]);
+      }
+      else
+      {
+        Hacl_SHA2_Vec128_sha256_4(dst[i],
+          dst[i + (uint32_t)1U],
+          dst[i + (uint32_t)2U],
+          dst[i + (uint32_t)3U],
+          len,
+          input[i],
+          input[i + (uint32_t)1U],
+          input[i + (uint32_t)2U],
+          input[i + (uint32_t)3U]);
+      }
+      i = i + (uint32_t)4U;
+    }
+    else
+    {
+      EverCrypt_Hash_hash(a, dst[i], input[i], len);
+      i++;
+    }
+  }
+  #endif
+  for (uint32_t j = i; j < n; j++)
+  {
+    EverCrypt_Hash_hash(a, dst[j], input[j], input_len[j]);
+  }
+}
+
+void
+EverCrypt_HashMany_hash(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA2_224:
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        bool vec512 = EverCrypt_AutoConfig2_has_vec512();
+        bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+        bool has_sse = EverCrypt_AutoConfig2_has_sse();
+        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+        bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+        #if HACL_CAN_COMPILE_VEC512
+        if (vec512)
+        {
+          if (a == Spec_Hash_Definitions_SHA2_224)
+          {
+            Hacl_SHA2_Vec512_hash_many_224(n, dst, input_len, input);
+          }
+          else
+          {
+            Hacl_SHA2_Vec512_hash_many_256(n, dst, input_len, input);
+          }
+          return;
+        }
+        #endif
+        #if HACL_CAN_COMPILE_VALE
+        if (has_shaext && has_sse)
+        {
+          /* One message at a time on SHA-NI beats the 8-lane AVX2 kernel */
+          for (uint32_t i = (uint32_t)0U; i < n; i++)
+          {
+            EverCrypt_Hash_hash(a, dst[i], input[i], input_len[i]);
+          }
+          return;
+        }
+        #endif
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          if (a == Spec_Hash_Definitions_SHA2_224)
+          {
+            Hacl_Streaming_SHA2_Vec256_hash_many_224(n, dst, input_len, input);
+          }
+          else
+          {
+            Hacl_Streaming_SHA2_Vec256_hash_many_256(n, dst, input_len, input);
+          }
+          return;
+        }
+        #endif
+        if (vec128)
+        {
+          hash_many_sha2_4(a, n, dst, input_len, input);
+          return;
+        }
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        bool vec512 = EverCrypt_AutoConfig2_has_vec512();
+        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+        #if HACL_CAN_COMPILE_VEC512
+        if (vec512)
+        {
+          if (a == Spec_Hash_Definitions_SHA2_384)
+          {
+            Hacl_SHA2_Vec512_hash_many_384(n, dst, input_len, input);
+          }
+          else
+          {
+            Hacl_SHA2_Vec512_hash_many_512(n, dst, input_len, input);
+          }
+          return;
+        }
+        #endif
+        #if HACL_CAN_COMPILE_VEC256
+        if (vec256)
+        {
+          if (a == Spec_Hash_Definitions_SHA2_384)
+          {
+            Hacl_Streaming_SHA2_Vec256_hash_many_384(n, dst, input_len, input);
+          }
+          else
+          {
+            Hacl_Streaming_SHA2_Vec256_hash_many_512(n, dst, input_len, input);
+          }
+          return;
+        }
+        #endif
+        break;
+      }
+    default:
+      {
+        break;
+      }
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_Hash_hash(a, dst[i], input[i], input_len[i]);
+  }
+}
+
@@ -0,0 +1,62 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_HashMany_H
+#define __EverCrypt_HashMany_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_Spec.h"
+#include "evercrypt_targetconfig.h"
+/*
+  Hash n messages of arbitrary lengths: dst[i] receives the digest of input[i],
+  of length input_len[i]. For SHA2, messages are spread over the widest
+  multi-lane kernel the CPU supports (16/8 lanes on AVX-512, 8/4 lanes on AVX2,
+  runs of four equal-length messages on 128-bit vectors), except that SHA-256
+  and SHA-224 go one message at a time through SHA-NI when it is available and
+  AVX-512 is not. Other algorithms hash each message in turn.
+*/
+void
+EverCrypt_HashMany_hash(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_HashMany_H_DEFINED
+#endif
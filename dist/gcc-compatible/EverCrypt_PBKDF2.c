@@ -0,0 +1,388 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_PBKDF2.h"
+
+#include "internal/EverCrypt_Hash.h"
+#include "Hacl_PBKDF2_Vec256.h"
+#include "Hacl_PBKDF2_Vec512.h"
+
+/* U_2 .. U_c for one output block, one SHA2-256 compression per hash, on the midstates of k.
+   t holds U_1 on entry and T = U_1 ^ ... ^ U_c on exit. */
+static void iterate_sha2_256(EverCrypt_HMAC_key_s *k, uint32_t c, uint8_t *t)
+{
+  uint32_t *inner = k->inner->case_SHA2_256_s;
+  uint32_t *outer = k->outer->case_SHA2_256_s;
+  uint8_t block[64U] = { 0U };
+  uint32_t s[8U] = { 0U };
+  memcpy(block, t, (uint32_t)32U * sizeof (uint8_t));
+  block[32U] = (uint8_t)0x80U;
+  store64_be(block + (uint32_t)56U, (uint64_t)768U);
+  for (uint32_t j = (uint32_t)1U; j < c; j++)
+  {
+    memcpy(s, inner, (uint32_t)8U * sizeof (uint32_t));
+    EverCrypt_Hash_update_multi_256(s, block, (uint32_t)1U);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      store32_be(block + i * (uint32_t)4U, s[i]);
+    }
+    memcpy(s, outer, (uint32_t)8U * sizeof (uint32_t));
+    EverCrypt_Hash_update_multi_256(s, block, (uint32_t)1U);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      store32_be(block + i * (uint32_t)4U, s[i]);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+    {
+      t[i] = t[i] ^ block[i];
+    }
+  }
+  Lib_Memzero0_memzero(block, (uint32_t)64U * sizeof (block[0U]));
+  Lib_Memzero0_memzero(s, (uint32_t)8U * sizeof (s[0U]));
+}
+
+static void iterate_sha2_512(EverCrypt_HMAC_key_s *k, uint32_t c, uint8_t *t)
+{
+  uint64_t *inner = k->inner->case_SHA2_512_s;
+  uint64_t *outer = k->outer->case_SHA2_512_s;
+  uint8_t block[128U] = { 0U };
+  uint64_t s[8U] = { 0U };
+  memcpy(block, t, (uint32_t)64U * sizeof (uint8_t));
+  block[64U] = (uint8_t)0x80U;
+  store64_be(block + (uint32_t)120U, (uint64_t)1536U);
+  for (uint32_t j = (uint32_t)1U; j < c; j++)
+  {
+    memcpy(s, inner, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_SHA2_update_multi_512(s, block, (uint32_t)1U);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      store64_be(block + i * (uint32_t)8U, s[i]);
+    }
+    memcpy(s, outer, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_SHA2_update_multi_512(s, block, (uint32_t)1U);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      store64_be(block + i * (uint32_t)8U, s[i]);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+    {
+      t[i] = t[i] ^ block[i];
+    }
+  }
+  Lib_Memzero0_memzero(block, (uint32_t)128U * sizeof (block[0U]));
+  Lib_Memzero0_memzero(s, (uint32_t)8U * sizeof (s[0U]));
+}
+
+/* Any other hash: U_j = HMAC(k, U_{j - 1}) through the generic midstate code. */
+static void iterate_generic(EverCrypt_HMAC_key_s *k, uint32_t c, uint8_t *t)
+{
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(k->alg);
+  uint8_t u[64U] = { 0U };
+  memcpy(u, t, hlen * sizeof (uint8_t));
+  for (uint32_t j = (uint32_t)1U; j < c; j++)
+  {
+    EverCrypt_HMAC_compute_with_key(k, u, u, hlen);
+    for (uint32_t i = (uint32_t)0U; i < hlen; i++)
+    {
+      t[i] = t[i] ^ u[i];
+    }
+  }
+  Lib_Memzero0_memzero(u, (uint32_t)64U * sizeof (u[0U]));
+}
+
+#if HACL_CAN_COMPILE_VEC256 || HACL_CAN_COMPILE_VEC512
+/* Output block b (of l per password) uses keys[b / l]. Groups of `lanes` blocks go through
+   the vectorized loop; the spare lanes of the last group run on zero states and are
+   dropped. */
+static void
+iterate_sha2_256_lanes(
+  uint32_t lanes,
+  void (*kernel)(uint32_t x0, uint32_t *x1, uint32_t *x2, uint32_t *x3),
+  EverCrypt_HMAC_key_s **keys,
+  uint32_t l,
+  uint32_t n_blocks,
+  uint32_t c,
+  uint8_t *t
+)
+{
+  uint32_t inner[128U] = { 0U };
+  uint32_t outer[128U] = { 0U };
+  uint32_t u[128U] = { 0U };
+  for (uint32_t g = (uint32_t)0U; g < n_blocks; g = g + lanes)
+  {
+    uint32_t m = n_blocks - g < lanes ? n_blocks - g : lanes;
+    for (uint32_t j = (uint32_t)0U; j < m; j++)
+    {
+      EverCrypt_HMAC_key_s *k = keys[(g + j) / l];
+      uint8_t *tj = t + (g + j) * (uint32_t)32U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+      {
+        inner[i * lanes + j] = k->inner->case_SHA2_256_s[i];
+        outer[i * lanes + j] = k->outer->case_SHA2_256_s[i];
+        u[i * lanes + j] = load32_be(tj + i * (uint32_t)4U);
+      }
+    }
+    kernel(c, inner, outer, u);
+    for (uint32_t j = (uint32_t)0U; j < m; j++)
+    {
+      uint8_t *tj = t + (g + j) * (uint32_t)32U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+      {
+        store32_be(tj + i * (uint32_t)4U, u[i * lanes + j]);
+      }
+    }
+  }
+  Lib_Memzero0_memzero(inner, (uint32_t)128U * sizeof (inner[0U]));
+  Lib_Memzero0_memzero(outer, (uint32_t)128U * sizeof (outer[0U]));
+  Lib_Memzero0_memzero(u, (uint32_t)128U * sizeof (u[0U]));
+}
+
+static void
+iterate_sha2_512_lanes(
+  uint32_t lanes,
+  void (*kernel)(uint32_t x0, uint64_t *x1, uint64_t *x2, uint64_t *x3),
+  EverCrypt_HMAC_key_s **keys,
+  uint32_t l,
+  uint32_t n_blocks,
+  uint32_t c,
+  uint8_t *t
+)
+{
+  uint64_t inner[64U] = { 0U };
+  uint64_t outer[64U] = { 0U };
+  uint64_t u[64U] = { 0U };
+  for (uint32_t g = (uint32_t)0U; g < n_blocks; g = g + lanes)
+  {
+    uint32_t m = n_blocks - g < lanes ? n_blocks - g : lanes;
+    for (uint32_t j = (uint32_t)0U; j < m; j++)
+    {
+      EverCrypt_HMAC_key_s *k = keys[(g + j) / l];
+      uint8_t *tj = t + (g + j) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+      {
+        inner[i * lanes + j] = k->inner->case_SHA2_512_s[i];
+        outer[i * lanes + j] = k->outer->case_SHA2_512_s[i];
+        u[i * lanes + j] = load64_be(tj + i * (uint32_t)8U);
+      }
+    }
+    kernel(c, inner, outer, u);
+    for (uint32_t j = (uint32_t)0U; j < m; j++)
+    {
+      uint8_t *tj = t + (g + j) * (uint32_t)64U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+      {
+        store64_be(tj + i * (uint32_t)8U, u[i * lanes + j]);
+      }
+    }
+  }
+  Lib_Memzero0_memzero(inner, (uint32_t)64U * sizeof (inner[0U]));
+  Lib_Memzero0_memzero(outer, (uint32_t)64U * sizeof (outer[0U]));
+  Lib_Memzero0_memzero(u, (uint32_t)64U * sizeof (u[0U]));
+}
+#endif
+
+static void
+iterate_blocks(
+  Spec_Hash_Definitions_hash_alg a,
+  EverCrypt_HMAC_key_s **keys,
+  uint32_t l,
+  uint32_t n_blocks,
+  uint32_t c,
+  uint8_t *t
+)
+{
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(a);
+  bool vec512 = EverCrypt_AutoConfig2_has_vec512();
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  if (a == Spec_Hash_Definitions_SHA2_256)
+  {
+    #if HACL_CAN_COMPILE_VEC512
+    if (vec512)
+    {
+      iterate_sha2_256_lanes((uint32_t)16U,
+        Hacl_PBKDF2_Vec512_iterate_sha2_256_16,
+        keys,
+        l,
+        n_blocks,
+        c,
+        t);
+      return;
+    }
+    #endif
+    /* One block at a time on SHA-NI beats the 8-lane AVX2 kernel */
+    #if HACL_CAN_COMPILE_VEC256
+    if (vec256 && !(has_shaext && has_sse))
+    {
+      iterate_sha2_256_lanes((uint32_t)8U,
+        Hacl_PBKDF2_Vec256_iterate_sha2_256_8,
+        keys,
+        l,
+        n_blocks,
+        c,
+        t);
+      return;
+    }
+    #endif
+  }
+  if (a == Spec_Hash_Definitions_SHA2_512)
+  {
+    #if HACL_CAN_COMPILE_VEC512
+    if (vec512)
+    {
+      iterate_sha2_512_lanes((uint32_t)8U,
+        Hacl_PBKDF2_Vec512_iterate_sha2_512_8,
+        keys,
+        l,
+        n_blocks,
+        c,
+        t);
+      return;
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC256
+    if (vec256)
+    {
+      iterate_sha2_512_lanes((uint32_t)4U,
+        Hacl_PBKDF2_Vec256_iterate_sha2_512_4,
+        keys,
+        l,
+        n_blocks,
+        c,
+        t);
+      return;
+    }
+    #endif
+  }
+  for (uint32_t b = (uint32_t)0U; b < n_blocks; b++)
+  {
+    EverCrypt_HMAC_key_s *k = keys[b / l];
+    uint8_t *tb = t + b * hlen;
+    switch (a)
+    {
+      case Spec_Hash_Definitions_SHA2_256:
+        {
+          iterate_sha2_256(k, c, tb);
+          break;
+        }
+      case Spec_Hash_Definitions_SHA2_512:
+        {
+          iterate_sha2_512(k, c, tb);
+          break;
+        }
+      default:
+        {
+          iterate_generic(k, c, tb);
+        }
+    }
+  }
+}
+
+void
+EverCrypt_PBKDF2_compute_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dk,
+  uint8_t **password,
+  uint32_t *passwordlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t c,
+  uint32_t dklen
+)
+{
+  if (n == (uint32_t)0U || dklen == (uint32_t)0U)
+  {
+    return;
+  }
+  uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(a);
+  uint32_t l = (dklen - (uint32_t)1U) / hlen + (uint32_t)1U;
+  /* The output blocks of all the passwords live in one buffer indexed by uint32_t. */
+  if ((uint64_t)n * (uint64_t)l > (uint64_t)0xffffffffU / (uint64_t)hlen)
+  {
+    KRML_HOST_EPRINTF("Maximum allocatable size exceeded, aborting before overflow at %s:%d\n",
+      __FILE__,
+      __LINE__);
+    KRML_HOST_EXIT(253U);
+  }
+  uint32_t n_blocks = n * l;
+  EverCrypt_HMAC_key_s
+  **keys = (EverCrypt_HMAC_key_s **)KRML_HOST_CALLOC(n, sizeof (EverCrypt_HMAC_key_s *));
+  uint8_t *t = (uint8_t *)KRML_HOST_CALLOC(n_blocks * hlen, sizeof (uint8_t));
+  /* U_1 = HMAC(P, S || INT(i)) for every block. */
+  for (uint32_t p = (uint32_t)0U; p < n; p++)
+  {
+    keys[p] = EverCrypt_HMAC_key_create_in(a, password[p], passwordlen[p]);
+    KRML_CHECK_SIZE(sizeof (uint8_t), saltlen[p] + (uint32_t)4U);
+    uint8_t text[saltlen[p] + (uint32_t)4U];
+    memcpy(text, salt[p], saltlen[p] * sizeof (uint8_t));
+    for (uint32_t b = (uint32_t)0U; b < l; b++)
+    {
+      store32_be(text + saltlen[p], b + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_key(keys[p],
+        t + (p * l + b) * hlen,
+        text,
+        saltlen[p] + (uint32_t)4U);
+    }
+  }
+  iterate_blocks(a, keys, l, n_blocks, c, t);
+  for (uint32_t p = (uint32_t)0U; p < n; p++)
+  {
+    memcpy(dk[p], t + p * l * hlen, dklen * sizeof (uint8_t));
+    EverCrypt_HMAC_key_free(keys[p]);
+  }
+  Lib_Memzero0_memzero(t, (uint64_t)(n_blocks * hlen) * sizeof (t[0U]));
+  KRML_HOST_FREE(t);
+  KRML_HOST_FREE(keys);
+}
+
+void
+EverCrypt_PBKDF2_compute(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t passwordlen,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint32_t c,
+  uint32_t dklen
+)
+{
+  uint8_t *dks[1U] = { dk };
+  uint8_t *passwords[1U] = { password };
+  uint32_t passwordlens[1U] = { passwordlen };
+  uint8_t *salts[1U] = { salt };
+  uint32_t saltlens[1U] = { saltlen };
+  EverCrypt_PBKDF2_compute_many(a,
+    (uint32_t)1U,
+    dks,
+    passwords,
+    passwordlens,
+    salts,
+    saltlens,
+    c,
+    dklen);
+}
+
@@ -0,0 +1,89 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_PBKDF2_H
+#define __EverCrypt_PBKDF2_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "Hacl_Spec.h"
+#include "EverCrypt_HMAC.h"
+#include "evercrypt_targetconfig.h"
+/*
+  PBKDF2 (RFC 8018, section 5.2) with HMAC-a as the pseudorandom function: writes dklen bytes
+  derived from the password and salt with c >= 1 iterations to dk. `a` must satisfy
+  EverCrypt_HMAC_is_supported_alg.
+*/
+void
+EverCrypt_PBKDF2_compute(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *dk,
+  uint8_t *password,
+  uint32_t passwordlen,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint32_t c,
+  uint32_t dklen
+);
+
+/*
+  n derivations with the same iteration count and output length:
+  dk[i] = PBKDF2-HMAC-a(password[i], salt[i], c, dklen).
+
+  All the output blocks of all the passwords are computed side by side: with SHA2-256 and
+  SHA2-512, the iterations run on the multi-lane kernels of Hacl_PBKDF2_Vec512 (16 and 8
+  lanes) or Hacl_PBKDF2_Vec256 (8 and 4 lanes) when the CPU supports them. SHA2-256 prefers
+  one block at a time on SHA-NI over the 8-lane AVX2 kernel.
+
+  The n outputs, each rounded up to a whole number of hash blocks, must fit in 2^32 - 1
+  bytes together; the function aborts otherwise.
+*/
+void
+EverCrypt_PBKDF2_compute_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dk,
+  uint8_t **password,
+  uint32_t *passwordlen,
+  uint8_t **salt,
+  uint32_t *saltlen,
+  uint32_t c,
+  uint32_t dklen
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_PBKDF2_H_DEFINED
+#endif
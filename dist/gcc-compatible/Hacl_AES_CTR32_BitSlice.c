@@ -0,0 +1,415 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_AES_CTR32_BitSlice.h"
+
+/* The constant-time AES of BearSSL's aes_ct64. Four blocks are spread over eight
+   64-bit words: the two interleaved halves of block i go to q[i] and q[i + 4],
+   then the orthogonalization gathers bit j of every byte into q[j]. A round is
+   then a fixed sequence of logical operations and shifts on q, with no table
+   lookup and no secret-dependent branch. */
+
+static inline void swap_n(uint64_t *x, uint64_t *y, uint64_t cl, uint64_t ch, uint32_t s)
+{
+  uint64_t a = x[0U];
+  uint64_t b = y[0U];
+  x[0U] = (a & cl) | (b & cl) << s;
+  y[0U] = (a & ch) >> s | (b & ch);
+}
+
+static void ortho(uint64_t *q)
+{
+  swap_n(q, q + (uint32_t)1U, (uint64_t)0x5555555555555555U, (uint64_t)0xAAAAAAAAAAAAAAAAU, (uint32_t)1U);
+  swap_n(q + (uint32_t)2U, q + (uint32_t)3U, (uint64_t)0x5555555555555555U, (uint64_t)0xAAAAAAAAAAAAAAAAU, (uint32_t)1U);
+  swap_n(q + (uint32_t)4U, q + (uint32_t)5U, (uint64_t)0x5555555555555555U, (uint64_t)0xAAAAAAAAAAAAAAAAU, (uint32_t)1U);
+  swap_n(q + (uint32_t)6U, q + (uint32_t)7U, (uint64_t)0x5555555555555555U, (uint64_t)0xAAAAAAAAAAAAAAAAU, (uint32_t)1U);
+  swap_n(q, q + (uint32_t)2U, (uint64_t)0x3333333333333333U, (uint64_t)0xCCCCCCCCCCCCCCCCU, (uint32_t)2U);
+  swap_n(q + (uint32_t)1U, q + (uint32_t)3U, (uint64_t)0x3333333333333333U, (uint64_t)0xCCCCCCCCCCCCCCCCU, (uint32_t)2U);
+  swap_n(q + (uint32_t)4U, q + (uint32_t)6U, (uint64_t)0x3333333333333333U, (uint64_t)0xCCCCCCCCCCCCCCCCU, (uint32_t)2U);
+  swap_n(q + (uint32_t)5U, q + (uint32_t)7U, (uint64_t)0x3333333333333333U, (uint64_t)0xCCCCCCCCCCCCCCCCU, (uint32_t)2U);
+  swap_n(q, q + (uint32_t)4U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint64_t)0xF0F0F0F0F0F0F0F0U, (uint32_t)4U);
+  swap_n(q + (uint32_t)1U, q + (uint32_t)5U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint64_t)0xF0F0F0F0F0F0F0F0U, (uint32_t)4U);
+  swap_n(q + (uint32_t)2U, q + (uint32_t)6U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint64_t)0xF0F0F0F0F0F0F0F0U, (uint32_t)4U);
+  swap_n(q + (uint32_t)3U, q + (uint32_t)7U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint64_t)0xF0F0F0F0F0F0F0F0U, (uint32_t)4U);
+}
+
+/* The four little-endian words of a block, as two words of interleaved 16-bit
+   halves. */
+static inline void interleave_in(uint64_t *q0, uint64_t *q1, uint32_t *w)
+{
+  uint64_t x0 = (uint64_t)w[0U];
+  uint64_t x1 = (uint64_t)w[1U];
+  uint64_t x2 = (uint64_t)w[2U];
+  uint64_t x3 = (uint64_t)w[3U];
+  x0 = (x0 | x0 << (uint32_t)16U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x1 = (x1 | x1 << (uint32_t)16U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x2 = (x2 | x2 << (uint32_t)16U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x3 = (x3 | x3 << (uint32_t)16U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x0 = (x0 | x0 << (uint32_t)8U) & (uint64_t)0x00FF00FF00FF00FFU;
+  x1 = (x1 | x1 << (uint32_t)8U) & (uint64_t)0x00FF00FF00FF00FFU;
+  x2 = (x2 | x2 << (uint32_t)8U) & (uint64_t)0x00FF00FF00FF00FFU;
+  x3 = (x3 | x3 << (uint32_t)8U) & (uint64_t)0x00FF00FF00FF00FFU;
+  q0[0U] = x0 | x2 << (uint32_t)8U;
+  q1[0U] = x1 | x3 << (uint32_t)8U;
+}
+
+static inline void interleave_out(uint32_t *w, uint64_t q0, uint64_t q1)
+{
+  uint64_t x0 = q0 & (uint64_t)0x00FF00FF00FF00FFU;
+  uint64_t x1 = q1 & (uint64_t)0x00FF00FF00FF00FFU;
+  uint64_t x2 = q0 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU;
+  uint64_t x3 = q1 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU;
+  x0 = (x0 | x0 >> (uint32_t)8U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x1 = (x1 | x1 >> (uint32_t)8U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x2 = (x2 | x2 >> (uint32_t)8U) & (uint64_t)0x0000FFFF0000FFFFU;
+  x3 = (x3 | x3 >> (uint32_t)8U) & (uint64_t)0x0000FFFF0000FFFFU;
+  w[0U] = (uint32_t)x0 | (uint32_t)(x0 >> (uint32_t)16U);
+  w[1U] = (uint32_t)x1 | (uint32_t)(x1 >> (uint32_t)16U);
+  w[2U] = (uint32_t)x2 | (uint32_t)(x2 >> (uint32_t)16U);
+  w[3U] = (uint32_t)x3 | (uint32_t)(x3 >> (uint32_t)16U);
+}
+
+/* SubBytes, with the circuit of Boyar and Peralta. */
+static void sub_bytes(uint64_t *q)
+{
+  uint64_t x0 = q[7U];
+  uint64_t x1 = q[6U];
+  uint64_t x2 = q[5U];
+  uint64_t x3 = q[4U];
+  uint64_t x4 = q[3U];
+  uint64_t x5 = q[2U];
+  uint64_t x6 = q[1U];
+  uint64_t x7 = q[0U];
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+  q[7U] = s0;
+  q[6U] = s1;
+  q[5U] = s2;
+  q[4U] = s3;
+  q[3U] = s4;
+  q[2U] = s5;
+  q[1U] = s6;
+  q[0U] = s7;
+}
+
+static void shift_rows(uint64_t *q)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t x = q[i];
+    q[i] =
+      (x & (uint64_t)0x000000000000FFFFU)
+      | (x & (uint64_t)0x00000000FFF00000U) >> (uint32_t)4U
+      | (x & (uint64_t)0x00000000000F0000U) << (uint32_t)12U
+      | (x & (uint64_t)0x0000FF0000000000U) >> (uint32_t)8U
+      | (x & (uint64_t)0x000000FF00000000U) << (uint32_t)8U
+      | (x & (uint64_t)0xF000000000000000U) >> (uint32_t)12U
+      | (x & (uint64_t)0x0FFF000000000000U) << (uint32_t)4U;
+  }
+}
+
+static inline uint64_t rotr16(uint64_t x)
+{
+  return x >> (uint32_t)16U | x << (uint32_t)48U;
+}
+
+static inline uint64_t rotr32(uint64_t x)
+{
+  return x >> (uint32_t)32U | x << (uint32_t)32U;
+}
+
+static void mix_columns(uint64_t *q)
+{
+  uint64_t q0 = q[0U];
+  uint64_t q1 = q[1U];
+  uint64_t q2 = q[2U];
+  uint64_t q3 = q[3U];
+  uint64_t q4 = q[4U];
+  uint64_t q5 = q[5U];
+  uint64_t q6 = q[6U];
+  uint64_t q7 = q[7U];
+  uint64_t r0 = rotr16(q0);
+  uint64_t r1 = rotr16(q1);
+  uint64_t r2 = rotr16(q2);
+  uint64_t r3 = rotr16(q3);
+  uint64_t r4 = rotr16(q4);
+  uint64_t r5 = rotr16(q5);
+  uint64_t r6 = rotr16(q6);
+  uint64_t r7 = rotr16(q7);
+  q[0U] = q7 ^ r7 ^ r0 ^ rotr32(q0 ^ r0);
+  q[1U] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32(q1 ^ r1);
+  q[2U] = q1 ^ r1 ^ r2 ^ rotr32(q2 ^ r2);
+  q[3U] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32(q3 ^ r3);
+  q[4U] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32(q4 ^ r4);
+  q[5U] = q4 ^ r4 ^ r5 ^ rotr32(q5 ^ r5);
+  q[6U] = q5 ^ r5 ^ r6 ^ rotr32(q6 ^ r6);
+  q[7U] = q6 ^ r6 ^ r7 ^ rotr32(q7 ^ r7);
+}
+
+static inline void add_round_key(uint64_t *q, uint64_t *k)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    q[i] = q[i] ^ k[i];
+}
+
+static void encrypt_rounds(uint32_t nr, uint64_t *skey, uint64_t *q)
+{
+  add_round_key(q, skey);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    sub_bytes(q);
+    shift_rows(q);
+    mix_columns(q);
+    add_round_key(q, skey + i * (uint32_t)8U);
+  }
+  sub_bytes(q);
+  shift_rows(q);
+  add_round_key(q, skey + nr * (uint32_t)8U);
+}
+
+static uint32_t sub_word(uint32_t x)
+{
+  uint64_t q[8U] = { 0U };
+  q[0U] = (uint64_t)x;
+  ortho(q);
+  sub_bytes(q);
+  ortho(q);
+  return (uint32_t)q[0U];
+}
+
+static const
+uint8_t
+rcon[10U] =
+  {
+    (uint8_t)0x01U, (uint8_t)0x02U, (uint8_t)0x04U, (uint8_t)0x08U, (uint8_t)0x10U,
+    (uint8_t)0x20U, (uint8_t)0x40U, (uint8_t)0x80U, (uint8_t)0x1bU, (uint8_t)0x36U
+  };
+
+void Hacl_AES_CTR32_BitSlice_key_expansion(uint32_t nr, uint64_t *skey, uint8_t *key)
+{
+  uint32_t nk = nr - (uint32_t)6U;
+  uint32_t nw = (nr + (uint32_t)1U) * (uint32_t)4U;
+  uint32_t w[60U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < nk; i++)
+    w[i] = load32_le(key + i * (uint32_t)4U);
+  uint32_t tmp = w[nk - (uint32_t)1U];
+  for (uint32_t i = nk; i < nw; i++)
+  {
+    uint32_t j = i % nk;
+    if (j == (uint32_t)0U)
+    {
+      tmp = sub_word(tmp << (uint32_t)24U | tmp >> (uint32_t)8U) ^ (uint32_t)rcon[i / nk - (uint32_t)1U];
+    }
+    else if (nk > (uint32_t)6U && j == (uint32_t)4U)
+    {
+      tmp = sub_word(tmp);
+    }
+    tmp = tmp ^ w[i - nk];
+    w[i] = tmp;
+  }
+  /* Every block of a bitsliced state gets the same round key: the key is spread
+     over q[0] and q[4], copied to the three other blocks, and orthogonalized. */
+  for (uint32_t r = (uint32_t)0U; r <= nr; r++)
+  {
+    uint64_t *q = skey + r * (uint32_t)8U;
+    interleave_in(q, q + (uint32_t)4U, w + r * (uint32_t)4U);
+    q[1U] = q[0U];
+    q[2U] = q[0U];
+    q[3U] = q[0U];
+    q[5U] = q[4U];
+    q[6U] = q[4U];
+    q[7U] = q[4U];
+    ortho(q);
+  }
+  Lib_Memzero0_memzero(w, (uint32_t)60U * sizeof (w[0U]));
+}
+
+void Hacl_Impl_AES_CTR32_BitSlice_load_ctr(uint64_t *q, uint8_t *n, uint32_t ctr)
+{
+  uint32_t w[4U] = { 0U };
+  w[0U] = load32_le(n);
+  w[1U] = load32_le(n + (uint32_t)4U);
+  w[2U] = load32_le(n + (uint32_t)8U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t c[4U] = { 0U };
+    store32_be(c, ctr + i);
+    w[3U] = load32_le(c);
+    interleave_in(q + i, q + i + (uint32_t)4U, w);
+  }
+}
+
+void
+Hacl_Impl_AES_CTR32_BitSlice_xor_blocks(uint32_t len, uint8_t *out, uint8_t *text, uint64_t *q)
+{
+  uint8_t ks[64U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t w[4U] = { 0U };
+    interleave_out(w, q[i], q[i + (uint32_t)4U]);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+      store32_le(ks + i * (uint32_t)16U + j * (uint32_t)4U, w[j]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+    out[i] = text[i] ^ ks[i];
+}
+
+void
+Hacl_AES_CTR32_BitSlice_encrypt(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint64_t *skey,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  uint32_t nb = len / (uint32_t)64U + (uint32_t)(len % (uint32_t)64U != (uint32_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint64_t q[8U] = { 0U };
+    uint32_t off = i * (uint32_t)64U;
+    uint32_t l = len - off < (uint32_t)64U ? len - off : (uint32_t)64U;
+    Hacl_Impl_AES_CTR32_BitSlice_load_ctr(q, n, ctr + i * (uint32_t)4U);
+    ortho(q);
+    encrypt_rounds(nr, skey, q);
+    ortho(q);
+    Hacl_Impl_AES_CTR32_BitSlice_xor_blocks(l, out + off, text + off, q);
+  }
+}
@@ -0,0 +1,71 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_AES_CTR32_BitSlice_H
+#define __Hacl_AES_CTR32_BitSlice_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "evercrypt_targetconfig.h"
+/*
+  AES in counter mode, bitsliced over 64-bit words: no table lookup and no
+  secret-dependent branch or memory access, on any CPU. nr is the number of
+  rounds: 10, 12 or 14 for 16-, 24- and 32-byte keys.
+*/
+
+/*
+  Expand key into the 8 * (nr + 1) words of skey.
+*/
+void Hacl_AES_CTR32_BitSlice_key_expansion(uint32_t nr, uint64_t *skey, uint8_t *key);
+
+/*
+  Xor len bytes of text with the key stream of the 16-byte counter blocks
+  n || ctr, n || ctr + 1, ..., n 12 bytes long and the counter big-endian and
+  wrapping around at 2^32, into out. out may be equal to text.
+*/
+void
+Hacl_AES_CTR32_BitSlice_encrypt(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint64_t *skey,
+  uint8_t *n,
+  uint32_t ctr
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_CTR32_BitSlice_H_DEFINED
+#endif
@@ -0,0 +1,423 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_AES_CTR32_BitSlice_Vec256.h"
+
+#include "internal/Hacl_AES_CTR32_BitSlice.h"
+
+/* The bitsliced AES of Hacl_AES_CTR32_BitSlice, with each 64-bit lane of a
+   256-bit vector carrying its own state of four blocks: a round encrypts 16
+   blocks at once. The words are spread over the lanes and gathered back in
+   scalar code; everything else runs on vectors. */
+
+static inline void
+swap_n(
+  Lib_IntVector_Intrinsics_vec256 *x,
+  Lib_IntVector_Intrinsics_vec256 *y,
+  uint64_t cl,
+  uint64_t ch,
+  uint32_t s
+)
+{
+  Lib_IntVector_Intrinsics_vec256 a = x[0U];
+  Lib_IntVector_Intrinsics_vec256 b = y[0U];
+  Lib_IntVector_Intrinsics_vec256 ml = Lib_IntVector_Intrinsics_vec256_load64(cl);
+  Lib_IntVector_Intrinsics_vec256 mh = Lib_IntVector_Intrinsics_vec256_load64(ch);
+  x[0U] =
+    Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(a, ml),
+      Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(b, ml), s));
+  y[0U] =
+    Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(Lib_IntVector_Intrinsics_vec256_and(a, mh), s),
+      Lib_IntVector_Intrinsics_vec256_and(b, mh));
+}
+
+static void ortho(Lib_IntVector_Intrinsics_vec256 *q)
+{
+  swap_n(q,
+    q + (uint32_t)1U,
+    (uint64_t)0x5555555555555555U,
+    (uint64_t)0xAAAAAAAAAAAAAAAAU,
+    (uint32_t)1U);
+  swap_n(q + (uint32_t)2U,
+    q + (uint32_t)3U,
+    (uint64_t)0x5555555555555555U,
+    (uint64_t)0xAAAAAAAAAAAAAAAAU,
+    (uint32_t)1U);
+  swap_n(q + (uint32_t)4U,
+    q + (uint32_t)5U,
+    (uint64_t)0x5555555555555555U,
+    (uint64_t)0xAAAAAAAAAAAAAAAAU,
+    (uint32_t)1U);
+  swap_n(q + (uint32_t)6U,
+    q + (uint32_t)7U,
+    (uint64_t)0x5555555555555555U,
+    (uint64_t)0xAAAAAAAAAAAAAAAAU,
+    (uint32_t)1U);
+  swap_n(q,
+    q + (uint32_t)2U,
+    (uint64_t)0x3333333333333333U,
+    (uint64_t)0xCCCCCCCCCCCCCCCCU,
+    (uint32_t)2U);
+  swap_n(q + (uint32_t)1U,
+    q + (uint32_t)3U,
+    (uint64_t)0x3333333333333333U,
+    (uint64_t)0xCCCCCCCCCCCCCCCCU,
+    (uint32_t)2U);
+  swap_n(q + (uint32_t)4U,
+    q + (uint32_t)6U,
+    (uint64_t)0x3333333333333333U,
+    (uint64_t)0xCCCCCCCCCCCCCCCCU,
+    (uint32_t)2U);
+  swap_n(q + (uint32_t)5U,
+    q + (uint32_t)7U,
+    (uint64_t)0x3333333333333333U,
+    (uint64_t)0xCCCCCCCCCCCCCCCCU,
+    (uint32_t)2U);
+  swap_n(q,
+    q + (uint32_t)4U,
+    (uint64_t)0x0F0F0F0F0F0F0F0FU,
+    (uint64_t)0xF0F0F0F0F0F0F0F0U,
+    (uint32_t)4U);
+  swap_n(q + (uint32_t)1U,
+    q + (uint32_t)5U,
+    (uint64_t)0x0F0F0F0F0F0F0F0FU,
+    (uint64_t)0xF0F0F0F0F0F0F0F0U,
+    (uint32_t)4U);
+  swap_n(q + (uint32_t)2U,
+    q + (uint32_t)6U,
+    (uint64_t)0x0F0F0F0F0F0F0F0FU,
+    (uint64_t)0xF0F0F0F0F0F0F0F0U,
+    (uint32_t)4U);
+  swap_n(q + (uint32_t)3U,
+    q + (uint32_t)7U,
+    (uint64_t)0x0F0F0F0F0F0F0F0FU,
+    (uint64_t)0xF0F0F0F0F0F0F0F0U,
+    (uint32_t)4U);
+}
+
+static void sub_bytes(Lib_IntVector_Intrinsics_vec256 *q)
+{
+  Lib_IntVector_Intrinsics_vec256 x0 = q[7U];
+  Lib_IntVector_Intrinsics_vec256 x1 = q[6U];
+  Lib_IntVector_Intrinsics_vec256 x2 = q[5U];
+  Lib_IntVector_Intrinsics_vec256 x3 = q[4U];
+  Lib_IntVector_Intrinsics_vec256 x4 = q[3U];
+  Lib_IntVector_Intrinsics_vec256 x5 = q[2U];
+  Lib_IntVector_Intrinsics_vec256 x6 = q[1U];
+  Lib_IntVector_Intrinsics_vec256 x7 = q[0U];
+  Lib_IntVector_Intrinsics_vec256 y14 = Lib_IntVector_Intrinsics_vec256_xor(x3, x5);
+  Lib_IntVector_Intrinsics_vec256 y13 = Lib_IntVector_Intrinsics_vec256_xor(x0, x6);
+  Lib_IntVector_Intrinsics_vec256 y9 = Lib_IntVector_Intrinsics_vec256_xor(x0, x3);
+  Lib_IntVector_Intrinsics_vec256 y8 = Lib_IntVector_Intrinsics_vec256_xor(x0, x5);
+  Lib_IntVector_Intrinsics_vec256 t0 = Lib_IntVector_Intrinsics_vec256_xor(x1, x2);
+  Lib_IntVector_Intrinsics_vec256 y1 = Lib_IntVector_Intrinsics_vec256_xor(t0, x7);
+  Lib_IntVector_Intrinsics_vec256 y4 = Lib_IntVector_Intrinsics_vec256_xor(y1, x3);
+  Lib_IntVector_Intrinsics_vec256 y12 = Lib_IntVector_Intrinsics_vec256_xor(y13, y14);
+  Lib_IntVector_Intrinsics_vec256 y2 = Lib_IntVector_Intrinsics_vec256_xor(y1, x0);
+  Lib_IntVector_Intrinsics_vec256 y5 = Lib_IntVector_Intrinsics_vec256_xor(y1, x6);
+  Lib_IntVector_Intrinsics_vec256 y3 = Lib_IntVector_Intrinsics_vec256_xor(y5, y8);
+  Lib_IntVector_Intrinsics_vec256 t1 = Lib_IntVector_Intrinsics_vec256_xor(x4, y12);
+  Lib_IntVector_Intrinsics_vec256 y15 = Lib_IntVector_Intrinsics_vec256_xor(t1, x5);
+  Lib_IntVector_Intrinsics_vec256 y20 = Lib_IntVector_Intrinsics_vec256_xor(t1, x1);
+  Lib_IntVector_Intrinsics_vec256 y6 = Lib_IntVector_Intrinsics_vec256_xor(y15, x7);
+  Lib_IntVector_Intrinsics_vec256 y10 = Lib_IntVector_Intrinsics_vec256_xor(y15, t0);
+  Lib_IntVector_Intrinsics_vec256 y11 = Lib_IntVector_Intrinsics_vec256_xor(y20, y9);
+  Lib_IntVector_Intrinsics_vec256 y7 = Lib_IntVector_Intrinsics_vec256_xor(x7, y11);
+  Lib_IntVector_Intrinsics_vec256 y17 = Lib_IntVector_Intrinsics_vec256_xor(y10, y11);
+  Lib_IntVector_Intrinsics_vec256 y19 = Lib_IntVector_Intrinsics_vec256_xor(y10, y8);
+  Lib_IntVector_Intrinsics_vec256 y16 = Lib_IntVector_Intrinsics_vec256_xor(t0, y11);
+  Lib_IntVector_Intrinsics_vec256 y21 = Lib_IntVector_Intrinsics_vec256_xor(y13, y16);
+  Lib_IntVector_Intrinsics_vec256 y18 = Lib_IntVector_Intrinsics_vec256_xor(x0, y16);
+  Lib_IntVector_Intrinsics_vec256 t2 = Lib_IntVector_Intrinsics_vec256_and(y12, y15);
+  Lib_IntVector_Intrinsics_vec256 t3 = Lib_IntVector_Intrinsics_vec256_and(y3, y6);
+  Lib_IntVector_Intrinsics_vec256 t4 = Lib_IntVector_Intrinsics_vec256_xor(t3, t2);
+  Lib_IntVector_Intrinsics_vec256 t5 = Lib_IntVector_Intrinsics_vec256_and(y4, x7);
+  Lib_IntVector_Intrinsics_vec256 t6 = Lib_IntVector_Intrinsics_vec256_xor(t5, t2);
+  Lib_IntVector_Intrinsics_vec256 t7 = Lib_IntVector_Intrinsics_vec256_and(y13, y16);
+  Lib_IntVector_Intrinsics_vec256 t8 = Lib_IntVector_Intrinsics_vec256_and(y5, y1);
+  Lib_IntVector_Intrinsics_vec256 t9 = Lib_IntVector_Intrinsics_vec256_xor(t8, t7);
+  Lib_IntVector_Intrinsics_vec256 t10 = Lib_IntVector_Intrinsics_vec256_and(y2, y7);
+  Lib_IntVector_Intrinsics_vec256 t11 = Lib_IntVector_Intrinsics_vec256_xor(t10, t7);
+  Lib_IntVector_Intrinsics_vec256 t12 = Lib_IntVector_Intrinsics_vec256_and(y9, y11);
+  Lib_IntVector_Intrinsics_vec256 t13 = Lib_IntVector_Intrinsics_vec256_and(y14, y17);
+  Lib_IntVector_Intrinsics_vec256 t14 = Lib_IntVector_Intrinsics_vec256_xor(t13, t12);
+  Lib_IntVector_Intrinsics_vec256 t15 = Lib_IntVector_Intrinsics_vec256_and(y8, y10);
+  Lib_IntVector_Intrinsics_vec256 t16 = Lib_IntVector_Intrinsics_vec256_xor(t15, t12);
+  Lib_IntVector_Intrinsics_vec256 t17 = Lib_IntVector_Intrinsics_vec256_xor(t4, t14);
+  Lib_IntVector_Intrinsics_vec256 t18 = Lib_IntVector_Intrinsics_vec256_xor(t6, t16);
+  Lib_IntVector_Intrinsics_vec256 t19 = Lib_IntVector_Intrinsics_vec256_xor(t9, t14);
+  Lib_IntVector_Intrinsics_vec256 t20 = Lib_IntVector_Intrinsics_vec256_xor(t11, t16);
+  Lib_IntVector_Intrinsics_vec256 t21 = Lib_IntVector_Intrinsics_vec256_xor(t17, y20);
+  Lib_IntVector_Intrinsics_vec256 t22 = Lib_IntVector_Intrinsics_vec256_xor(t18, y19);
+  Lib_IntVector_Intrinsics_vec256 t23 = Lib_IntVector_Intrinsics_vec256_xor(t19, y21);
+  Lib_IntVector_Intrinsics_vec256 t24 = Lib_IntVector_Intrinsics_vec256_xor(t20, y18);
+  Lib_IntVector_Intrinsics_vec256 t25 = Lib_IntVector_Intrinsics_vec256_xor(t21, t22);
+  Lib_IntVector_Intrinsics_vec256 t26 = Lib_IntVector_Intrinsics_vec256_and(t21, t23);
+  Lib_IntVector_Intrinsics_vec256 t27 = Lib_IntVector_Intrinsics_vec256_xor(t24, t26);
+  Lib_IntVector_Intrinsics_vec256 t28 = Lib_IntVector_Intrinsics_vec256_and(t25, t27);
+  Lib_IntVector_Intrinsics_vec256 t29 = Lib_IntVector_Intrinsics_vec256_xor(t28, t22);
+  Lib_IntVector_Intrinsics_vec256 t30 = Lib_IntVector_Intrinsics_vec256_xor(t23, t24);
+  Lib_IntVector_Intrinsics_vec256 t31 = Lib_IntVector_Intrinsics_vec256_xor(t22, t26);
+  Lib_IntVector_Intrinsics_vec256 t32 = Lib_IntVector_Intrinsics_vec256_and(t31, t30);
+  Lib_IntVector_Intrinsics_vec256 t33 = Lib_IntVector_Intrinsics_vec256_xor(t32, t24);
+  Lib_IntVector_Intrinsics_vec256 t34 = Lib_IntVector_Intrinsics_vec256_xor(t23, t33);
+  Lib_IntVector_Intrinsics_vec256 t35 = Lib_IntVector_Intrinsics_vec256_xor(t27, t33);
+  Lib_IntVector_Intrinsics_vec256 t36 = Lib_IntVector_Intrinsics_vec256_and(t24, t35);
+  Lib_IntVector_Intrinsics_vec256 t37 = Lib_IntVector_Intrinsics_vec256_xor(t36, t34);
+  Lib_IntVector_Intrinsics_vec256 t38 = Lib_IntVector_Intrinsics_vec256_xor(t27, t36);
+  Lib_IntVector_Intrinsics_vec256 t39 = Lib_IntVector_Intrinsics_vec256_and(t29, t38);
+  Lib_IntVector_Intrinsics_vec256 t40 = Lib_IntVector_Intrinsics_vec256_xor(t25, t39);
+  Lib_IntVector_Intrinsics_vec256 t41 = Lib_IntVector_Intrinsics_vec256_xor(t40, t37);
+  Lib_IntVector_Intrinsics_vec256 t42 = Lib_IntVector_Intrinsics_vec256_xor(t29, t33);
+  Lib_IntVector_Intrinsics_vec256 t43 = Lib_IntVector_Intrinsics_vec256_xor(t29, t40);
+  Lib_IntVector_Intrinsics_vec256 t44 = Lib_IntVector_Intrinsics_vec256_xor(t33, t37);
+  Lib_IntVector_Intrinsics_vec256 t45 = Lib_IntVector_Intrinsics_vec256_xor(t42, t41);
+  Lib_IntVector_Intrinsics_vec256 z0 = Lib_IntVector_Intrinsics_vec256_and(t44, y15);
+  Lib_IntVector_Intrinsics_vec256 z1 = Lib_IntVector_Intrinsics_vec256_and(t37, y6);
+  Lib_IntVector_Intrinsics_vec256 z2 = Lib_IntVector_Intrinsics_vec256_and(t33, x7);
+  Lib_IntVector_Intrinsics_vec256 z3 = Lib_IntVector_Intrinsics_vec256_and(t43, y16);
+  Lib_IntVector_Intrinsics_vec256 z4 = Lib_IntVector_Intrinsics_vec256_and(t40, y1);
+  Lib_IntVector_Intrinsics_vec256 z5 = Lib_IntVector_Intrinsics_vec256_and(t29, y7);
+  Lib_IntVector_Intrinsics_vec256 z6 = Lib_IntVector_Intrinsics_vec256_and(t42, y11);
+  Lib_IntVector_Intrinsics_vec256 z7 = Lib_IntVector_Intrinsics_vec256_and(t45, y17);
+  Lib_IntVector_Intrinsics_vec256 z8 = Lib_IntVector_Intrinsics_vec256_and(t41, y10);
+  Lib_IntVector_Intrinsics_vec256 z9 = Lib_IntVector_Intrinsics_vec256_and(t44, y12);
+  Lib_IntVector_Intrinsics_vec256 z10 = Lib_IntVector_Intrinsics_vec256_and(t37, y3);
+  Lib_IntVector_Intrinsics_vec256 z11 = Lib_IntVector_Intrinsics_vec256_and(t33, y4);
+  Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_and(t43, y13);
+  Lib_IntVector_Intrinsics_vec256 z13 = Lib_IntVector_Intrinsics_vec256_and(t40, y5);
+  Lib_IntVector_Intrinsics_vec256 z14 = Lib_IntVector_Intrinsics_vec256_and(t29, y2);
+  Lib_IntVector_Intrinsics_vec256 z15 = Lib_IntVector_Intrinsics_vec256_and(t42, y9);
+  Lib_IntVector_Intrinsics_vec256 z16 = Lib_IntVector_Intrinsics_vec256_and(t45, y14);
+  Lib_IntVector_Intrinsics_vec256 z17 = Lib_IntVector_Intrinsics_vec256_and(t41, y8);
+  Lib_IntVector_Intrinsics_vec256 t46 = Lib_IntVector_Intrinsics_vec256_xor(z15, z16);
+  Lib_IntVector_Intrinsics_vec256 t47 = Lib_IntVector_Intrinsics_vec256_xor(z10, z11);
+  Lib_IntVector_Intrinsics_vec256 t48 = Lib_IntVector_Intrinsics_vec256_xor(z5, z13);
+  Lib_IntVector_Intrinsics_vec256 t49 = Lib_IntVector_Intrinsics_vec256_xor(z9, z10);
+  Lib_IntVector_Intrinsics_vec256 t50 = Lib_IntVector_Intrinsics_vec256_xor(z2, z12);
+  Lib_IntVector_Intrinsics_vec256 t51 = Lib_IntVector_Intrinsics_vec256_xor(z2, z5);
+  Lib_IntVector_Intrinsics_vec256 t52 = Lib_IntVector_Intrinsics_vec256_xor(z7, z8);
+  Lib_IntVector_Intrinsics_vec256 t53 = Lib_IntVector_Intrinsics_vec256_xor(z0, z3);
+  Lib_IntVector_Intrinsics_vec256 t54 = Lib_IntVector_Intrinsics_vec256_xor(z6, z7);
+  Lib_IntVector_Intrinsics_vec256 t55 = Lib_IntVector_Intrinsics_vec256_xor(z16, z17);
+  Lib_IntVector_Intrinsics_vec256 t56 = Lib_IntVector_Intrinsics_vec256_xor(z12, t48);
+  Lib_IntVector_Intrinsics_vec256 t57 = Lib_IntVector_Intrinsics_vec256_xor(t50, t53);
+  Lib_IntVector_Intrinsics_vec256 t58 = Lib_IntVector_Intrinsics_vec256_xor(z4, t46);
+  Lib_IntVector_Intrinsics_vec256 t59 = Lib_IntVector_Intrinsics_vec256_xor(z3, t54);
+  Lib_IntVector_Intrinsics_vec256 t60 = Lib_IntVector_Intrinsics_vec256_xor(t46, t57);
+  Lib_IntVector_Intrinsics_vec256 t61 = Lib_IntVector_Intrinsics_vec256_xor(z14, t57);
+  Lib_IntVector_Intrinsics_vec256 t62 = Lib_IntVector_Intrinsics_vec256_xor(t52, t58);
+  Lib_IntVector_Intrinsics_vec256 t63 = Lib_IntVector_Intrinsics_vec256_xor(t49, t58);
+  Lib_IntVector_Intrinsics_vec256 t64 = Lib_IntVector_Intrinsics_vec256_xor(z4, t59);
+  Lib_IntVector_Intrinsics_vec256 t65 = Lib_IntVector_Intrinsics_vec256_xor(t61, t62);
+  Lib_IntVector_Intrinsics_vec256 t66 = Lib_IntVector_Intrinsics_vec256_xor(z1, t63);
+  Lib_IntVector_Intrinsics_vec256 s0 = Lib_IntVector_Intrinsics_vec256_xor(t59, t63);
+  Lib_IntVector_Intrinsics_vec256 s6 = Lib_IntVector_Intrinsics_vec256_xor(t56, Lib_IntVector_Intrinsics_vec256_lognot(t62));
+  Lib_IntVector_Intrinsics_vec256 s7 = Lib_IntVector_Intrinsics_vec256_xor(t48, Lib_IntVector_Intrinsics_vec256_lognot(t60));
+  Lib_IntVector_Intrinsics_vec256 t67 = Lib_IntVector_Intrinsics_vec256_xor(t64, t65);
+  Lib_IntVector_Intrinsics_vec256 s3 = Lib_IntVector_Intrinsics_vec256_xor(t53, t66);
+  Lib_IntVector_Intrinsics_vec256 s4 = Lib_IntVector_Intrinsics_vec256_xor(t51, t66);
+  Lib_IntVector_Intrinsics_vec256 s5 = Lib_IntVector_Intrinsics_vec256_xor(t47, t65);
+  Lib_IntVector_Intrinsics_vec256 s1 = Lib_IntVector_Intrinsics_vec256_xor(t64, Lib_IntVector_Intrinsics_vec256_lognot(s3));
+  Lib_IntVector_Intrinsics_vec256 s2 = Lib_IntVector_Intrinsics_vec256_xor(t55, Lib_IntVector_Intrinsics_vec256_lognot(t67));
+  q[7U] = s0;
+  q[6U] = s1;
+  q[5U] = s2;
+  q[4U] = s3;
+  q[3U] = s4;
+  q[2U] = s5;
+  q[1U] = s6;
+  q[0U] = s7;
+}
+
+static void shift_rows(Lib_IntVector_Intrinsics_vec256 *q)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 x = q[i];
+    Lib_IntVector_Intrinsics_vec256
+    x0 = Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x000000000000FFFFU));
+    Lib_IntVector_Intrinsics_vec256
+    x1 = Lib_IntVector_Intrinsics_vec256_shift_right64(Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x00000000FFF00000U)), (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256
+    x2 = Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x00000000000F0000U)), (uint32_t)12U);
+    Lib_IntVector_Intrinsics_vec256
+    x3 = Lib_IntVector_Intrinsics_vec256_shift_right64(Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x0000FF0000000000U)), (uint32_t)8U);
+    Lib_IntVector_Intrinsics_vec256
+    x4 = Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x000000FF00000000U)), (uint32_t)8U);
+    Lib_IntVector_Intrinsics_vec256
+    x5 = Lib_IntVector_Intrinsics_vec256_shift_right64(Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0xF000000000000000U)), (uint32_t)12U);
+    Lib_IntVector_Intrinsics_vec256
+    x6 = Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(x, Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x0FFF000000000000U)), (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256 r = x0;
+    r = Lib_IntVector_Intrinsics_vec256_or(r, x1);
+    r = Lib_IntVector_Intrinsics_vec256_or(r, x2);
+    r = Lib_IntVector_Intrinsics_vec256_or(r, x3);
+    r = Lib_IntVector_Intrinsics_vec256_or(r, x4);
+    r = Lib_IntVector_Intrinsics_vec256_or(r, x5);
+    r = Lib_IntVector_Intrinsics_vec256_or(r, x6);
+    q[i] = r;
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec256 rotr16(Lib_IntVector_Intrinsics_vec256 x)
+{
+  return Lib_IntVector_Intrinsics_vec256_rotate_right64(x, (uint32_t)16U);
+}
+
+static inline Lib_IntVector_Intrinsics_vec256 rotr32(Lib_IntVector_Intrinsics_vec256 x)
+{
+  return Lib_IntVector_Intrinsics_vec256_rotate_right64(x, (uint32_t)32U);
+}
+
+static void mix_columns(Lib_IntVector_Intrinsics_vec256 *q)
+{
+  Lib_IntVector_Intrinsics_vec256 q0 = q[0U];
+  Lib_IntVector_Intrinsics_vec256 q1 = q[1U];
+  Lib_IntVector_Intrinsics_vec256 q2 = q[2U];
+  Lib_IntVector_Intrinsics_vec256 q3 = q[3U];
+  Lib_IntVector_Intrinsics_vec256 q4 = q[4U];
+  Lib_IntVector_Intrinsics_vec256 q5 = q[5U];
+  Lib_IntVector_Intrinsics_vec256 q6 = q[6U];
+  Lib_IntVector_Intrinsics_vec256 q7 = q[7U];
+  Lib_IntVector_Intrinsics_vec256 r0 = rotr16(q0);
+  Lib_IntVector_Intrinsics_vec256 r1 = rotr16(q1);
+  Lib_IntVector_Intrinsics_vec256 r2 = rotr16(q2);
+  Lib_IntVector_Intrinsics_vec256 r3 = rotr16(q3);
+  Lib_IntVector_Intrinsics_vec256 r4 = rotr16(q4);
+  Lib_IntVector_Intrinsics_vec256 r5 = rotr16(q5);
+  Lib_IntVector_Intrinsics_vec256 r6 = rotr16(q6);
+  Lib_IntVector_Intrinsics_vec256 r7 = rotr16(q7);
+  q[0U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q7, r7), r0), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q0, r0)));
+  q[1U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q0, r0), q7), r7), r1), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q1, r1)));
+  q[2U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q1, r1), r2), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q2, r2)));
+  q[3U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q2, r2), q7), r7), r3), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q3, r3)));
+  q[4U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q3, r3), q7), r7), r4), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q4, r4)));
+  q[5U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q4, r4), r5), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q5, r5)));
+  q[6U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q5, r5), r6), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q6, r6)));
+  q[7U] = Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_xor(q6, r6), r7), rotr32(Lib_IntVector_Intrinsics_vec256_xor(q7, r7)));
+}
+
+static inline void add_round_key(Lib_IntVector_Intrinsics_vec256 *q, uint64_t *k)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    q[i] = Lib_IntVector_Intrinsics_vec256_xor(q[i], Lib_IntVector_Intrinsics_vec256_load64(k[i]));
+}
+
+static void encrypt_rounds(uint32_t nr, uint64_t *skey, Lib_IntVector_Intrinsics_vec256 *q)
+{
+  add_round_key(q, skey);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    sub_bytes(q);
+    shift_rows(q);
+    mix_columns(q);
+    add_round_key(q, skey + i * (uint32_t)8U);
+  }
+  sub_bytes(q);
+  shift_rows(q);
+  add_round_key(q, skey + nr * (uint32_t)8U);
+}
+
+/* The first len bytes, at most 256, of the 16 blocks from counter ctr. */
+static void
+encrypt_chunk(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint64_t *skey,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  uint64_t qs[32U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256 q[8U];
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+    Hacl_Impl_AES_CTR32_BitSlice_load_ctr(qs + l * (uint32_t)8U, n, ctr + l * (uint32_t)4U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    q[i] = Lib_IntVector_Intrinsics_vec256_load64s(qs[i], qs[(uint32_t)8U + i], qs[(uint32_t)16U + i], qs[(uint32_t)24U + i]);
+  ortho(q);
+  encrypt_rounds(nr, skey, q);
+  ortho(q);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    qs[i] = Lib_IntVector_Intrinsics_vec256_extract64(q[i], (uint32_t)0U);
+    qs[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec256_extract64(q[i], (uint32_t)1U);
+    qs[(uint32_t)16U + i] = Lib_IntVector_Intrinsics_vec256_extract64(q[i], (uint32_t)2U);
+    qs[(uint32_t)24U + i] = Lib_IntVector_Intrinsics_vec256_extract64(q[i], (uint32_t)3U);
+  }
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+  {
+    uint32_t off = l * (uint32_t)64U;
+    if (off < len)
+    {
+      uint32_t ll = len - off < (uint32_t)64U ? len - off : (uint32_t)64U;
+      Hacl_Impl_AES_CTR32_BitSlice_xor_blocks(ll, out + off, text + off, qs + l * (uint32_t)8U);
+    }
+  }
+}
+
+void
+Hacl_AES_CTR32_BitSlice_Vec256_encrypt(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint64_t *skey,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  uint32_t nb = len / (uint32_t)256U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint32_t off = i * (uint32_t)256U;
+    encrypt_chunk(nr,
+      (uint32_t)256U,
+      out + off,
+      text + off,
+      skey,
+      n,
+      ctr + i * (uint32_t)16U);
+  }
+  uint32_t rem = len % (uint32_t)256U;
+  uint32_t off = nb * (uint32_t)256U;
+  /* Four blocks or fewer are cheaper on the scalar code. */
+  if (rem > (uint32_t)64U)
+  {
+    encrypt_chunk(nr, rem, out + off, text + off, skey, n, ctr + nb * (uint32_t)16U);
+  }
+  else if (rem > (uint32_t)0U)
+  {
+    Hacl_AES_CTR32_BitSlice_encrypt(nr,
+      rem,
+      out + off,
+      text + off,
+      skey,
+      n,
+      ctr + nb * (uint32_t)16U);
+  }
+}
@@ -0,0 +1,510 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_VAES.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include <wmmintrin.h>
+
+/* As in Hacl_Gf128_NI, GHASH works on blocks with their bytes reversed. */
+
+static inline void
+clmul_wide(
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y,
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo0 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x00U);
+  Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x10U);
+  Lib_IntVector_Intrinsics_vec128 m2 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x01U);
+  Lib_IntVector_Intrinsics_vec128 hi0 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x11U);
+  Lib_IntVector_Intrinsics_vec128 m = Lib_IntVector_Intrinsics_vec128_xor(m1, m2);
+  lo[0U] = Lib_IntVector_Intrinsics_vec128_xor(lo0, Lib_IntVector_Intrinsics_vec128_shift_left(m, (uint32_t)64U));
+  hi[0U] = Lib_IntVector_Intrinsics_vec128_xor(hi0, Lib_IntVector_Intrinsics_vec128_shift_right(m, (uint32_t)64U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_reduce(Lib_IntVector_Intrinsics_vec128 lo, Lib_IntVector_Intrinsics_vec128 hi)
+{
+  Lib_IntVector_Intrinsics_vec128 lo_c = Lib_IntVector_Intrinsics_vec128_shift_right32(lo, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 hi_c = Lib_IntVector_Intrinsics_vec128_shift_right32(hi, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 lo1 = Lib_IntVector_Intrinsics_vec128_shift_left32(lo, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 hi1 = Lib_IntVector_Intrinsics_vec128_shift_left32(hi, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 top = Lib_IntVector_Intrinsics_vec128_shift_right(lo_c, (uint32_t)96U);
+  lo1 = Lib_IntVector_Intrinsics_vec128_or(lo1, Lib_IntVector_Intrinsics_vec128_shift_left(lo_c, (uint32_t)32U));
+  hi1 = Lib_IntVector_Intrinsics_vec128_or(hi1, Lib_IntVector_Intrinsics_vec128_shift_left(hi_c, (uint32_t)32U));
+  hi1 = Lib_IntVector_Intrinsics_vec128_or(hi1, top);
+  Lib_IntVector_Intrinsics_vec128
+  a =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(lo1,
+          (uint32_t)31U),
+        Lib_IntVector_Intrinsics_vec128_shift_left32(lo1, (uint32_t)30U)),
+      Lib_IntVector_Intrinsics_vec128_shift_left32(lo1, (uint32_t)25U));
+  Lib_IntVector_Intrinsics_vec128 a_hi = Lib_IntVector_Intrinsics_vec128_shift_right(a, (uint32_t)32U);
+  lo1 = Lib_IntVector_Intrinsics_vec128_xor(lo1, Lib_IntVector_Intrinsics_vec128_shift_left(a, (uint32_t)96U));
+  Lib_IntVector_Intrinsics_vec128
+  b =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(lo1,
+          (uint32_t)1U),
+        Lib_IntVector_Intrinsics_vec128_shift_right32(lo1, (uint32_t)2U)),
+      Lib_IntVector_Intrinsics_vec128_shift_right32(lo1, (uint32_t)7U));
+  b = Lib_IntVector_Intrinsics_vec128_xor(b, a_hi);
+  lo1 = Lib_IntVector_Intrinsics_vec128_xor(lo1, b);
+  return Lib_IntVector_Intrinsics_vec128_xor(hi1, lo1);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_mul(Lib_IntVector_Intrinsics_vec128 x, Lib_IntVector_Intrinsics_vec128 y)
+{
+  Lib_IntVector_Intrinsics_vec128 lo;
+  Lib_IntVector_Intrinsics_vec128 hi;
+  clmul_wide(x, y, &lo, &hi);
+  return gf128_reduce(lo, hi);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128 fold(Lib_IntVector_Intrinsics_vec512 x)
+{
+  Lib_IntVector_Intrinsics_vec128
+  x01 =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec512_extract128(x, 0),
+      Lib_IntVector_Intrinsics_vec512_extract128(x, 1));
+  Lib_IntVector_Intrinsics_vec128
+  x23 =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec512_extract128(x, 2),
+      Lib_IntVector_Intrinsics_vec512_extract128(x, 3));
+  return Lib_IntVector_Intrinsics_vec128_xor(x01, x23);
+}
+
+/* x is sixteen blocks, the first one with the accumulator already added, and h
+   holds H^16 .. H: the sum of their products, with a single reduction. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash16(Lib_IntVector_Intrinsics_vec512 *h, Lib_IntVector_Intrinsics_vec512 *x)
+{
+  Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 hi = Lib_IntVector_Intrinsics_vec512_zero;
+  Lib_IntVector_Intrinsics_vec512 m = Lib_IntVector_Intrinsics_vec512_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    lo =
+      Lib_IntVector_Intrinsics_vec512_xor(lo,
+        Lib_IntVector_Intrinsics_vec512_clmul(x[i], h[i], (uint8_t)0x00U));
+    hi =
+      Lib_IntVector_Intrinsics_vec512_xor(hi,
+        Lib_IntVector_Intrinsics_vec512_clmul(x[i], h[i], (uint8_t)0x11U));
+    m =
+      Lib_IntVector_Intrinsics_vec512_xor(m,
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_clmul(x[i],
+            h[i],
+            (uint8_t)0x10U),
+          Lib_IntVector_Intrinsics_vec512_clmul(x[i], h[i], (uint8_t)0x01U)));
+  }
+  Lib_IntVector_Intrinsics_vec128 m1 = fold(m);
+  Lib_IntVector_Intrinsics_vec128
+  lo1 =
+    Lib_IntVector_Intrinsics_vec128_xor(fold(lo),
+      Lib_IntVector_Intrinsics_vec128_shift_left(m1, (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  hi1 =
+    Lib_IntVector_Intrinsics_vec128_xor(fold(hi),
+      Lib_IntVector_Intrinsics_vec128_shift_right(m1, (uint32_t)64U));
+  return gf128_reduce(lo1, hi1);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+absorb16(Lib_IntVector_Intrinsics_vec512 *h, Lib_IntVector_Intrinsics_vec128 acc, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec512 x[4U];
+  x[0U] =
+    Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_load_be128(b),
+      Lib_IntVector_Intrinsics_vec512_insert128(Lib_IntVector_Intrinsics_vec512_zero, acc, 0));
+  x[1U] = Lib_IntVector_Intrinsics_vec512_load_be128(b + (uint32_t)64U);
+  x[2U] = Lib_IntVector_Intrinsics_vec512_load_be128(b + (uint32_t)128U);
+  x[3U] = Lib_IntVector_Intrinsics_vec512_load_be128(b + (uint32_t)192U);
+  return ghash16(h, x);
+}
+
+/* The last len < 256 bytes, zero-padded to a block and right-aligned in sixteen
+   blocks so that they meet the right powers of H. */
+static Lib_IntVector_Intrinsics_vec128
+absorb_last(
+  Lib_IntVector_Intrinsics_vec512 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  uint8_t buf[256U] = { 0U };
+  uint8_t a[16U] = { 0U };
+  uint32_t nb = len / (uint32_t)16U + (uint32_t)(len % (uint32_t)16U != (uint32_t)0U);
+  uint8_t *first = buf + ((uint32_t)16U - nb) * (uint32_t)16U;
+  memcpy(first, text, len * sizeof (uint8_t));
+  Lib_IntVector_Intrinsics_vec128_store_be(a, acc);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    first[i] = first[i] ^ a[i];
+  }
+  Lib_IntVector_Intrinsics_vec128 r = absorb16(h, Lib_IntVector_Intrinsics_vec128_zero, buf);
+  Lib_Memzero0_memzero(buf, (uint32_t)256U * sizeof (buf[0U]));
+  return r;
+}
+
+static Lib_IntVector_Intrinsics_vec128
+ghash(
+  Lib_IntVector_Intrinsics_vec512 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  uint32_t nb = len / (uint32_t)256U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    acc = absorb16(h, acc, text + i * (uint32_t)256U);
+  }
+  uint32_t rem = len % (uint32_t)256U;
+  if (rem > (uint32_t)0U)
+  {
+    acc = absorb_last(h, acc, rem, text + nb * (uint32_t)256U);
+  }
+  return acc;
+}
+
+static Lib_IntVector_Intrinsics_vec128
+absorb_lengths(
+  Lib_IntVector_Intrinsics_vec512 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t ad_len,
+  uint32_t len
+)
+{
+  uint8_t b[16U] = { 0U };
+  store64_be(b, (uint64_t)ad_len * (uint64_t)8U);
+  store64_be(b + (uint32_t)8U, (uint64_t)len * (uint64_t)8U);
+  Lib_IntVector_Intrinsics_vec128
+  x = Lib_IntVector_Intrinsics_vec128_xor(acc, Lib_IntVector_Intrinsics_vec128_load_be(b));
+  return gf128_mul(x, Lib_IntVector_Intrinsics_vec512_extract128(h[3U], 3));
+}
+
+static void
+load_keys(uint32_t nr, Lib_IntVector_Intrinsics_vec512 *rk, uint8_t *keys)
+{
+  for (uint32_t i = (uint32_t)0U; i <= nr; i++)
+  {
+    rk[i] =
+      Lib_IntVector_Intrinsics_vec512_load128(Lib_IntVector_Intrinsics_vec128_load32_le(keys
+          + i * (uint32_t)16U));
+  }
+}
+
+static inline void aes_enc4(uint32_t nr, Lib_IntVector_Intrinsics_vec512 *rk, Lib_IntVector_Intrinsics_vec512 *st)
+{
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    st[j] = Lib_IntVector_Intrinsics_vec512_xor(st[j], rk[0U]);
+  }
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      st[j] = Lib_IntVector_Intrinsics_vec512_aes_enc(st[j], rk[i]);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    st[j] = Lib_IntVector_Intrinsics_vec512_aes_enc_last(st[j], rk[nr]);
+  }
+}
+
+/* The keystream of the sixteen blocks from ctr on. Counters are kept with their
+   bytes reversed, so that the big-endian 32-bit counter of each block is the
+   lowest 32-bit word of its lane and wraps around as in GCM. */
+static inline void
+keystream16(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec512 *rk,
+  Lib_IntVector_Intrinsics_vec512 *ctr,
+  Lib_IntVector_Intrinsics_vec512 *st
+)
+{
+  Lib_IntVector_Intrinsics_vec512
+  four =
+    Lib_IntVector_Intrinsics_vec512_load32s((uint32_t)4U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)0U);
+  Lib_IntVector_Intrinsics_vec512 c = ctr[0U];
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    st[j] = Lib_IntVector_Intrinsics_vec512_reverse_bytes128(c);
+    c = Lib_IntVector_Intrinsics_vec512_add32(c, four);
+  }
+  ctr[0U] = c;
+  aes_enc4(nr, rk, st);
+}
+
+static inline void
+xor16(uint8_t *out, uint8_t *text, Lib_IntVector_Intrinsics_vec512 *st)
+{
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec512
+    x = Lib_IntVector_Intrinsics_vec512_load32_le(text + j * (uint32_t)64U);
+    Lib_IntVector_Intrinsics_vec512_store32_le(out + j * (uint32_t)64U,
+      Lib_IntVector_Intrinsics_vec512_xor(x, st[j]));
+  }
+}
+
+static void
+ctr_last(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec512 *rk,
+  Lib_IntVector_Intrinsics_vec512 *ctr,
+  uint32_t len,
+  uint8_t *text,
+  uint8_t *out
+)
+{
+  uint8_t buf[256U] = { 0U };
+  Lib_IntVector_Intrinsics_vec512 st[4U];
+  memcpy(buf, text, len * sizeof (uint8_t));
+  keystream16(nr, rk, ctr, st);
+  xor16(buf, buf, st);
+  memcpy(out, buf, len * sizeof (uint8_t));
+  Lib_Memzero0_memzero(buf, (uint32_t)256U * sizeof (buf[0U]));
+}
+
+/* Loads the round keys and the powers of H, writes AES_K(J0) to ek_j0 for the tag,
+   and returns the counter of the first block of text, inc32(J0), in every lane,
+   plus 0, 1, 2 and 3. */
+static Lib_IntVector_Intrinsics_vec512
+setup(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec512 *rk,
+  Lib_IntVector_Intrinsics_vec512 *h,
+  uint8_t *ek_j0,
+  uint8_t *keys,
+  uint8_t *hkeys,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  uint8_t j0[16U] = { 0U };
+  load_keys(nr, rk, keys);
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    h[j] = Lib_IntVector_Intrinsics_vec512_load32_le(hkeys + j * (uint32_t)64U);
+  }
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(j0, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(j0 + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    Lib_IntVector_Intrinsics_vec128
+    acc = ghash(h, Lib_IntVector_Intrinsics_vec128_zero, iv_len, iv);
+    Lib_IntVector_Intrinsics_vec128_store_be(j0, absorb_lengths(h, acc, (uint32_t)0U, iv_len));
+  }
+  Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(j0);
+  x = Lib_IntVector_Intrinsics_vec128_xor(x, Lib_IntVector_Intrinsics_vec512_extract128(rk[0U], 0));
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    x = Lib_IntVector_Intrinsics_ni_aes_enc(x, Lib_IntVector_Intrinsics_vec512_extract128(rk[i], 0));
+  }
+  x = Lib_IntVector_Intrinsics_ni_aes_enc_last(x, Lib_IntVector_Intrinsics_vec512_extract128(rk[nr], 0));
+  Lib_IntVector_Intrinsics_vec128_store32_le(ek_j0, x);
+  Lib_IntVector_Intrinsics_vec512
+  c = Lib_IntVector_Intrinsics_vec512_load128(Lib_IntVector_Intrinsics_vec128_load_be(j0));
+  return
+    Lib_IntVector_Intrinsics_vec512_add32(c,
+      Lib_IntVector_Intrinsics_vec512_load32s((uint32_t)1U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)2U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)3U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U));
+}
+
+static void
+compute_tag(
+  uint8_t *tag,
+  uint8_t *ek_j0,
+  Lib_IntVector_Intrinsics_vec512 *h,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t ad_len,
+  uint32_t len
+)
+{
+  Lib_IntVector_Intrinsics_vec128_store_be(tag, absorb_lengths(h, acc, ad_len, len));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    tag[i] = tag[i] ^ ek_j0[i];
+  }
+}
+
+void Hacl_AES_GCM_VAES_init(uint8_t *hkeys, uint32_t nr, uint8_t *keys)
+{
+  uint8_t b[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load32_le(keys);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    x = Lib_IntVector_Intrinsics_ni_aes_enc(x,
+        Lib_IntVector_Intrinsics_vec128_load32_le(keys + i * (uint32_t)16U));
+  }
+  x =
+    Lib_IntVector_Intrinsics_ni_aes_enc_last(x,
+      Lib_IntVector_Intrinsics_vec128_load32_le(keys + nr * (uint32_t)16U));
+  Lib_IntVector_Intrinsics_vec128_store32_le(b, x);
+  Lib_IntVector_Intrinsics_vec128 h1 = Lib_IntVector_Intrinsics_vec128_load_be(b);
+  Lib_IntVector_Intrinsics_vec128 hi = h1;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store32_le(hkeys + ((uint32_t)15U - i) * (uint32_t)16U, hi);
+    hi = gf128_mul(hi, h1);
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)16U * sizeof (b[0U]));
+}
+
+void
+Hacl_AES_GCM_VAES_encrypt(
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *hkeys,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint32_t len,
+  uint8_t *text,
+  uint8_t *out,
+  uint8_t *tag
+)
+{
+  Lib_IntVector_Intrinsics_vec512 rk[15U];
+  Lib_IntVector_Intrinsics_vec512 h[4U];
+  Lib_IntVector_Intrinsics_vec512 st[4U];
+  uint8_t ek_j0[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec512 ctr = setup(nr, rk, h, ek_j0, keys, hkeys, iv, iv_len);
+  Lib_IntVector_Intrinsics_vec128 acc = ghash(h, Lib_IntVector_Intrinsics_vec128_zero, ad_len, ad);
+  uint32_t nb = len / (uint32_t)256U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    keystream16(nr, rk, &ctr, st);
+    /* The ciphertext of the previous iteration is hashed while the AES rounds of
+       this one are in flight. */
+    if (i > (uint32_t)0U)
+    {
+      acc = absorb16(h, acc, out + (i - (uint32_t)1U) * (uint32_t)256U);
+    }
+    xor16(out + i * (uint32_t)256U, text + i * (uint32_t)256U, st);
+  }
+  if (nb > (uint32_t)0U)
+  {
+    acc = absorb16(h, acc, out + (nb - (uint32_t)1U) * (uint32_t)256U);
+  }
+  uint32_t rem = len % (uint32_t)256U;
+  if (rem > (uint32_t)0U)
+  {
+    ctr_last(nr, rk, &ctr, rem, text + nb * (uint32_t)256U, out + nb * (uint32_t)256U);
+    acc = absorb_last(h, acc, rem, out + nb * (uint32_t)256U);
+  }
+  compute_tag(tag, ek_j0, h, acc, ad_len, len);
+  Lib_Memzero0_memzero(ek_j0, (uint32_t)16U * sizeof (ek_j0[0U]));
+}
+
+uint32_t
+Hacl_AES_GCM_VAES_decrypt(
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *hkeys,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint32_t len,
+  uint8_t *text,
+  uint8_t *out,
+  uint8_t *tag
+)
+{
+  Lib_IntVector_Intrinsics_vec512 rk[15U];
+  Lib_IntVector_Intrinsics_vec512 h[4U];
+  Lib_IntVector_Intrinsics_vec512 st[4U];
+  uint8_t ek_j0[16U] = { 0U };
+  uint8_t computed[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec512 ctr = setup(nr, rk, h, ek_j0, keys, hkeys, iv, iv_len);
+  Lib_IntVector_Intrinsics_vec128 acc = ghash(h, Lib_IntVector_Intrinsics_vec128_zero, ad_len, ad);
+  uint32_t nb = len / (uint32_t)256U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    keystream16(nr, rk, &ctr, st);
+    /* Hashed before it is overwritten, for in-place decryption. */
+    acc = absorb16(h, acc, text + i * (uint32_t)256U);
+    xor16(out + i * (uint32_t)256U, text + i * (uint32_t)256U, st);
+  }
+  uint32_t rem = len % (uint32_t)256U;
+  if (rem > (uint32_t)0U)
+  {
+    acc = absorb_last(h, acc, rem, text + nb * (uint32_t)256U);
+    ctr_last(nr, rk, &ctr, rem, text + nb * (uint32_t)256U, out + nb * (uint32_t)256U);
+  }
+  compute_tag(computed, ek_j0, h, acc, ad_len, len);
+  Lib_Memzero0_memzero(ek_j0, (uint32_t)16U * sizeof (ek_j0[0U]));
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    return (uint32_t)0U;
+  }
+  memset(out, 0U, len * sizeof (uint8_t));
+  return (uint32_t)1U;
+}
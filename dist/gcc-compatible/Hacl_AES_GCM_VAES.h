@@ -0,0 +1,95 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_GCM_VAES_H
+#define __Hacl_AES_GCM_VAES_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "Hacl_Krmllib.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  AES-GCM on 512-bit vectors with VAES and VPCLMULQDQ: sixteen blocks per
+  iteration, four per instruction, with one GHASH reduction per sixteen blocks.
+
+  keys are the nr + 1 round keys of AES-128 (nr = 10) or AES-256 (nr = 14), in the
+  byte order of the AES-NI instructions, as the Vale key expansion lays them out.
+  hkeys are 256 bytes of powers of the hash key, filled in by init.
+*/
+
+void Hacl_AES_GCM_VAES_init(uint8_t *hkeys, uint32_t nr, uint8_t *keys);
+
+/*
+  iv may have any non-zero length; out may be text itself.
+*/
+void
+Hacl_AES_GCM_VAES_encrypt(
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *hkeys,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint32_t len,
+  uint8_t *text,
+  uint8_t *out,
+  uint8_t *tag
+);
+
+/*
+  Returns 0 if tag is valid and 1 otherwise, in which case out is zeroed: the
+  ciphertext is authenticated and decrypted in a single pass.
+*/
+uint32_t
+Hacl_AES_GCM_VAES_decrypt(
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *hkeys,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint32_t len,
+  uint8_t *text,
+  uint8_t *out,
+  uint8_t *tag
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_GCM_VAES_H_DEFINED
+#endif
@@ -0,0 +1,499 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Argon2id.h"
+
+
+
+static void blake2b(bool vec256, uint32_t nn, uint8_t *output, uint32_t ll, uint8_t *d)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_Blake2b_256_blake2b(nn, output, ll, d, (uint32_t)0U, NULL);
+    return;
+  }
+  #endif
+  Hacl_Blake2b_32_blake2b(nn, output, ll, d, (uint32_t)0U, NULL);
+}
+
+/* The variable-length hash H' of RFC 9106, section 3.3, for inputs of at most one block. */
+static void
+blake2b_long(bool vec256, uint32_t outLen, uint8_t *output, uint32_t inLen, uint8_t *input)
+{
+  uint8_t buf[1028U] = { 0U };
+  store32_le(buf, outLen);
+  memcpy(buf + (uint32_t)4U, input, inLen * sizeof (uint8_t));
+  if (outLen <= (uint32_t)64U)
+  {
+    blake2b(vec256, outLen, output, inLen + (uint32_t)4U, buf);
+  }
+  else
+  {
+    uint32_t r = (outLen - (uint32_t)1U) / (uint32_t)32U - (uint32_t)1U;
+    uint8_t v[64U] = { 0U };
+    uint8_t v1[64U] = { 0U };
+    blake2b(vec256, (uint32_t)64U, v, inLen + (uint32_t)4U, buf);
+    memcpy(output, v, (uint32_t)32U * sizeof (uint8_t));
+    for (uint32_t i = (uint32_t)1U; i < r; i++)
+    {
+      memcpy(v1, v, (uint32_t)64U * sizeof (uint8_t));
+      blake2b(vec256, (uint32_t)64U, v, (uint32_t)64U, v1);
+      memcpy(output + (uint32_t)32U * i, v, (uint32_t)32U * sizeof (uint8_t));
+    }
+    blake2b(vec256, outLen - (uint32_t)32U * r, output + (uint32_t)32U * r, (uint32_t)64U, v);
+    Lib_Memzero0_memzero(v, (uint32_t)64U * sizeof (v[0U]));
+    Lib_Memzero0_memzero(v1, (uint32_t)64U * sizeof (v1[0U]));
+  }
+  Lib_Memzero0_memzero(buf, (uint32_t)1028U * sizeof (buf[0U]));
+}
+
+static inline uint64_t rotr64(uint64_t x, uint32_t n)
+{
+  return x >> n | x << ((uint32_t)64U - n);
+}
+
+static inline uint64_t blamka(uint64_t x, uint64_t y)
+{
+  return x + y + (uint64_t)2U * ((uint64_t)(uint32_t)x * (uint64_t)(uint32_t)y);
+}
+
+static inline void g(uint64_t *v, uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+  v[a] = blamka(v[a], v[b]);
+  v[d] = rotr64(v[d] ^ v[a], (uint32_t)32U);
+  v[c] = blamka(v[c], v[d]);
+  v[b] = rotr64(v[b] ^ v[c], (uint32_t)24U);
+  v[a] = blamka(v[a], v[b]);
+  v[d] = rotr64(v[d] ^ v[a], (uint32_t)16U);
+  v[c] = blamka(v[c], v[d]);
+  v[b] = rotr64(v[b] ^ v[c], (uint32_t)63U);
+}
+
+static void permute(uint64_t *v)
+{
+  g(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U);
+  g(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U);
+  g(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U);
+  g(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U);
+  g(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U);
+  g(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U);
+  g(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U);
+  g(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U);
+}
+
+static void fill_block_32(uint64_t *prev, uint64_t *ref, uint64_t *next, bool with_xor)
+{
+  uint64_t r[128U] = { 0U };
+  uint64_t q[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    r[i] = prev[i] ^ ref[i];
+  }
+  memcpy(q, r, (uint32_t)128U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    permute(q + (uint32_t)16U * i);
+  }
+  /* Column i is made of words 2i, 2i + 1 of each row. */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t v[16U] = { 0U };
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      v[(uint32_t)2U * k] = q[(uint32_t)16U * k + (uint32_t)2U * i];
+      v[(uint32_t)2U * k + (uint32_t)1U] = q[(uint32_t)16U * k + (uint32_t)2U * i + (uint32_t)1U];
+    }
+    permute(v);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      q[(uint32_t)16U * k + (uint32_t)2U * i] = v[(uint32_t)2U * k];
+      q[(uint32_t)16U * k + (uint32_t)2U * i + (uint32_t)1U] = v[(uint32_t)2U * k + (uint32_t)1U];
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    uint64_t z = q[i] ^ r[i];
+    if (with_xor)
+    {
+      next[i] = next[i] ^ z;
+    }
+    else
+    {
+      next[i] = z;
+    }
+  }
+}
+
+static void
+fill_block(bool vec256, uint64_t *prev, uint64_t *ref, uint64_t *next, bool with_xor)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    Hacl_Argon2id_Vec256_fill_block(prev, ref, next, with_xor);
+    return;
+  }
+  #endif
+  fill_block_32(prev, ref, next, with_xor);
+}
+
+/* The next 128 pseudo-random words of data-independent addressing: G(0, G(0, Z)) for the
+   input block Z with its counter incremented. */
+static void
+next_addresses(bool vec256, uint64_t *zero, uint64_t *input, uint64_t *addresses)
+{
+  input[6U] = input[6U] + (uint64_t)1U;
+  fill_block(vec256, zero, input, addresses, false);
+  fill_block(vec256, zero, addresses, addresses, false);
+}
+
+/* Index, within the reference lane, of the block referenced by block [index] of the segment,
+   from J1 (RFC 9106, section 3.4.1.2). */
+static uint32_t
+index_alpha(
+  uint32_t pass,
+  uint32_t slice,
+  uint32_t index,
+  uint32_t segLen,
+  uint32_t laneLen,
+  uint32_t j1,
+  bool sameLane
+)
+{
+  uint32_t area;
+  if (pass == (uint32_t)0U && slice == (uint32_t)0U)
+  {
+    area = index - (uint32_t)1U;
+  }
+  else
+  {
+    uint32_t finished;
+    if (pass == (uint32_t)0U)
+    {
+      finished = slice * segLen;
+    }
+    else
+    {
+      finished = laneLen - segLen;
+    }
+    if (sameLane)
+    {
+      area = finished + index - (uint32_t)1U;
+    }
+    else if (index == (uint32_t)0U)
+    {
+      area = finished - (uint32_t)1U;
+    }
+    else
+    {
+      area = finished;
+    }
+  }
+  uint64_t x = (uint64_t)j1 * (uint64_t)j1 >> (uint32_t)32U;
+  uint64_t y = (uint64_t)area * x >> (uint32_t)32U;
+  uint32_t rel = area - (uint32_t)1U - (uint32_t)y;
+  uint32_t start = (uint32_t)0U;
+  if (pass != (uint32_t)0U && slice != (uint32_t)3U)
+  {
+    start = (slice + (uint32_t)1U) * segLen;
+  }
+  return (start + rel) % laneLen;
+}
+
+uint32_t Hacl_Argon2id_memory_blocks(uint32_t lanes, uint32_t memoryKiB)
+{
+  return memoryKiB / ((uint32_t)4U * lanes) * ((uint32_t)4U * lanes);
+}
+
+/* The constraints of RFC 9106, section 3.1, plus those of this implementation: the
+   H0 input and the arena, in words, are indexed by uint32_t. */
+static bool
+valid_params(
+  uint32_t tagLen,
+  uint32_t pwdLen,
+  uint32_t saltLen,
+  uint32_t secretLen,
+  uint32_t adLen,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes
+)
+{
+  uint64_t
+  len =
+    (uint64_t)40U
+    + (uint64_t)pwdLen
+    + (uint64_t)saltLen
+    + (uint64_t)secretLen
+    + (uint64_t)adLen;
+  return
+    tagLen >= (uint32_t)4U
+    && passes >= (uint32_t)1U
+    && lanes >= (uint32_t)1U
+    && lanes <= (uint32_t)0xFFFFFFU
+    && memoryKiB >= (uint32_t)8U * lanes
+    && memoryKiB <= (uint32_t)0x2000000U
+    && len <= (uint64_t)0xFFFFFFFFU;
+}
+
+bool
+Hacl_Argon2id_init(
+  bool vec256,
+  uint32_t tagLen,
+  uint32_t pwdLen,
+  uint8_t *pwd,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t secretLen,
+  uint8_t *secret,
+  uint32_t adLen,
+  uint8_t *ad,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory
+)
+{
+  if (!valid_params(tagLen, pwdLen, saltLen, secretLen, adLen, passes, memoryKiB, lanes))
+  {
+    return false;
+  }
+  uint32_t laneLen = Hacl_Argon2id_memory_blocks(lanes, memoryKiB) / lanes;
+  uint32_t len = (uint32_t)40U + pwdLen + saltLen + secretLen + adLen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC(len, sizeof (uint8_t));
+  uint8_t *p = buf;
+  store32_le(p, lanes);
+  store32_le(p + (uint32_t)4U, tagLen);
+  store32_le(p + (uint32_t)8U, memoryKiB);
+  store32_le(p + (uint32_t)12U, passes);
+  store32_le(p + (uint32_t)16U, (uint32_t)0x13U);
+  store32_le(p + (uint32_t)20U, (uint32_t)2U);
+  p = p + (uint32_t)24U;
+  store32_le(p, pwdLen);
+  memcpy(p + (uint32_t)4U, pwd, pwdLen * sizeof (uint8_t));
+  p = p + (uint32_t)4U + pwdLen;
+  store32_le(p, saltLen);
+  memcpy(p + (uint32_t)4U, salt, saltLen * sizeof (uint8_t));
+  p = p + (uint32_t)4U + saltLen;
+  store32_le(p, secretLen);
+  memcpy(p + (uint32_t)4U, secret, secretLen * sizeof (uint8_t));
+  p = p + (uint32_t)4U + secretLen;
+  store32_le(p, adLen);
+  memcpy(p + (uint32_t)4U, ad, adLen * sizeof (uint8_t));
+  /* H0 || LE32(column) || LE32(lane) */
+  uint8_t h0[72U] = { 0U };
+  blake2b(vec256, (uint32_t)64U, h0, len, buf);
+  Lib_Memzero0_memzero(buf, len * sizeof (buf[0U]));
+  KRML_HOST_FREE(buf);
+  uint8_t block[1024U] = { 0U };
+  for (uint32_t l = (uint32_t)0U; l < lanes; l++)
+  {
+    store32_le(h0 + (uint32_t)68U, l);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)2U; j++)
+    {
+      uint64_t *b = memory + (uint32_t)128U * (l * laneLen + j);
+      store32_le(h0 + (uint32_t)64U, j);
+      blake2b_long(vec256, (uint32_t)1024U, block, (uint32_t)72U, h0);
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+      {
+        b[i] = load64_le(block + (uint32_t)8U * i);
+      }
+    }
+  }
+  Lib_Memzero0_memzero(h0, (uint32_t)72U * sizeof (h0[0U]));
+  Lib_Memzero0_memzero(block, (uint32_t)1024U * sizeof (block[0U]));
+  return true;
+}
+
+void
+Hacl_Argon2id_fill_segment(
+  bool vec256,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory,
+  uint32_t pass,
+  uint32_t slice,
+  uint32_t lane
+)
+{
+  uint32_t blocks = Hacl_Argon2id_memory_blocks(lanes, memoryKiB);
+  uint32_t laneLen = blocks / lanes;
+  uint32_t segLen = laneLen / (uint32_t)4U;
+  /* Argon2id uses data-independent addressing for the first half of the first pass. */
+  bool indep = pass == (uint32_t)0U && slice < (uint32_t)2U;
+  uint64_t zero[128U] = { 0U };
+  uint64_t input[128U] = { 0U };
+  uint64_t addresses[128U] = { 0U };
+  uint32_t start = (uint32_t)0U;
+  if (indep)
+  {
+    input[0U] = (uint64_t)pass;
+    input[1U] = (uint64_t)lane;
+    input[2U] = (uint64_t)slice;
+    input[3U] = (uint64_t)blocks;
+    input[4U] = (uint64_t)passes;
+    input[5U] = (uint64_t)2U;
+  }
+  if (pass == (uint32_t)0U && slice == (uint32_t)0U)
+  {
+    start = (uint32_t)2U;
+    if (indep)
+    {
+      next_addresses(vec256, zero, input, addresses);
+    }
+  }
+  for (uint32_t i = start; i < segLen; i++)
+  {
+    uint32_t col = slice * segLen + i;
+    uint32_t curr = lane * laneLen + col;
+    uint32_t prev;
+    if (col == (uint32_t)0U)
+    {
+      prev = curr + laneLen - (uint32_t)1U;
+    }
+    else
+    {
+      prev = curr - (uint32_t)1U;
+    }
+    uint64_t rnd;
+    if (indep)
+    {
+      if (i % (uint32_t)128U == (uint32_t)0U)
+      {
+        next_addresses(vec256, zero, input, addresses);
+      }
+      rnd = addresses[i % (uint32_t)128U];
+    }
+    else
+    {
+      rnd = memory[(uint32_t)128U * prev];
+    }
+    uint32_t refLane = (uint32_t)(rnd >> (uint32_t)32U) % lanes;
+    if (pass == (uint32_t)0U && slice == (uint32_t)0U)
+    {
+      refLane = lane;
+    }
+    uint32_t
+    refIndex =
+      index_alpha(pass,
+        slice,
+        i,
+        segLen,
+        laneLen,
+        (uint32_t)rnd,
+        refLane == lane);
+    fill_block(vec256,
+      memory + (uint32_t)128U * prev,
+      memory + (uint32_t)128U * (refLane * laneLen + refIndex),
+      memory + (uint32_t)128U * curr,
+      pass != (uint32_t)0U);
+  }
+}
+
+void
+Hacl_Argon2id_finish(
+  bool vec256,
+  uint32_t tagLen,
+  uint8_t *tag,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory
+)
+{
+  uint32_t laneLen = Hacl_Argon2id_memory_blocks(lanes, memoryKiB) / lanes;
+  uint64_t c[128U] = { 0U };
+  uint8_t block[1024U] = { 0U };
+  for (uint32_t l = (uint32_t)0U; l < lanes; l++)
+  {
+    uint64_t *b = memory + (uint32_t)128U * (l * laneLen + laneLen - (uint32_t)1U);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+    {
+      c[i] = c[i] ^ b[i];
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    store64_le(block + (uint32_t)8U * i, c[i]);
+  }
+  blake2b_long(vec256, tagLen, tag, (uint32_t)1024U, block);
+  Lib_Memzero0_memzero(c, (uint32_t)128U * sizeof (c[0U]));
+  Lib_Memzero0_memzero(block, (uint32_t)1024U * sizeof (block[0U]));
+}
+
+bool
+Hacl_Argon2id_argon2id(
+  bool vec256,
+  uint32_t tagLen,
+  uint8_t *tag,
+  uint32_t pwdLen,
+  uint8_t *pwd,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t secretLen,
+  uint8_t *secret,
+  uint32_t adLen,
+  uint8_t *ad,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory
+)
+{
+  if
+  (
+    !Hacl_Argon2id_init(vec256,
+      tagLen,
+      pwdLen,
+      pwd,
+      saltLen,
+      salt,
+      secretLen,
+      secret,
+      adLen,
+      ad,
+      passes,
+      memoryKiB,
+      lanes,
+      memory)
+  )
+  {
+    return false;
+  }
+  for (uint32_t pass = (uint32_t)0U; pass < passes; pass++)
+  {
+    for (uint32_t slice = (uint32_t)0U; slice < (uint32_t)4U; slice++)
+    {
+      for (uint32_t lane = (uint32_t)0U; lane < lanes; lane++)
+      {
+        Hacl_Argon2id_fill_segment(vec256, passes, memoryKiB, lanes, memory, pass, slice, lane);
+      }
+    }
+  }
+  Hacl_Argon2id_finish(vec256, tagLen, tag, memoryKiB, lanes, memory);
+  return true;
+}
+
@@ -0,0 +1,153 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Argon2id_H
+#define __Hacl_Argon2id_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_Hash_Blake2b_256.h"
+#include "Hacl_Hash_Blake2.h"
+#include "Hacl_Argon2id_Vec256.h"
+#include "Lib_Memzero0.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  Argon2id, version 0x13 (RFC 9106).
+
+  Parameters are the number of passes t >= 1, the memory size m in KiB and the number of
+  lanes p, with 1 <= p <= 2^24 - 1 and 8 * p <= m <= 2^25 (32 GiB). The tag is at least 4
+  bytes long, and the password, salt, secret and associated data are at most 2^32 - 41
+  bytes together. Hacl_Argon2id_init and Hacl_Argon2id_argon2id check these and return
+  false, without touching the memory or the tag, when they do not hold.
+
+  The memory is supplied by the caller, as an arena of Hacl_Argon2id_memory_blocks(p, m)
+  blocks of 128 words (1024 bytes) each, so that it can be allocated once and reused
+  across calls with the same parameters. Every call overwrites it entirely; it holds
+  password-dependent data on return, and callers should clear it once they no longer
+  need it.
+
+  [vec256] (see EverCrypt_AutoConfig2_has_vec256) moves H0, H' and the compression
+  function G onto Hacl_Hash_Blake2b_256 and Hacl_Argon2id_Vec256_fill_block.
+*/
+
+/*
+  Number of 1024-byte blocks of memory used for [lanes] lanes and [memoryKiB] KiB, i.e.
+  memoryKiB rounded down to a multiple of 4 * lanes.
+*/
+uint32_t Hacl_Argon2id_memory_blocks(uint32_t lanes, uint32_t memoryKiB);
+
+/*
+  First step: computes H0 from the inputs and parameters, and fills the first two blocks of
+  every lane of [memory]. Returns false if the parameters are invalid.
+*/
+bool
+Hacl_Argon2id_init(
+  bool vec256,
+  uint32_t tagLen,
+  uint32_t pwdLen,
+  uint8_t *pwd,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t secretLen,
+  uint8_t *secret,
+  uint32_t adLen,
+  uint8_t *ad,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory
+);
+
+/*
+  Fills the segment of lane [lane] in slice [slice] (0 .. 3) of pass [pass].
+
+  A segment only references its own lane and the finished slices of the other lanes, so
+  the [lanes] segments of one slice may be filled on as many threads, with a barrier
+  before the next slice (RFC 9106, section 3.4). Slices go in order, pass after pass.
+  The parameters are those accepted by Hacl_Argon2id_init.
+*/
+void
+Hacl_Argon2id_fill_segment(
+  bool vec256,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory,
+  uint32_t pass,
+  uint32_t slice,
+  uint32_t lane
+);
+
+/*
+  Last step: the tag of [tagLen] bytes, from the last block of every lane.
+*/
+void
+Hacl_Argon2id_finish(
+  bool vec256,
+  uint32_t tagLen,
+  uint8_t *tag,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory
+);
+
+/*
+  Argon2id of password [pwd] with salt [salt], secret value [secret] and associated data
+  [ad], on a single thread: init, then every segment in order, then finish. Returns false,
+  and leaves [tag] untouched, if the parameters are invalid.
+*/
+bool
+Hacl_Argon2id_argon2id(
+  bool vec256,
+  uint32_t tagLen,
+  uint8_t *tag,
+  uint32_t pwdLen,
+  uint8_t *pwd,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t secretLen,
+  uint8_t *secret,
+  uint32_t adLen,
+  uint8_t *ad,
+  uint32_t passes,
+  uint32_t memoryKiB,
+  uint32_t lanes,
+  uint64_t *memory
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Argon2id_H_DEFINED
+#endif
@@ -0,0 +1,132 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Argon2id_Vec256.h"
+
+
+
+static inline Lib_IntVector_Intrinsics_vec256
+blamka(Lib_IntVector_Intrinsics_vec256 x, Lib_IntVector_Intrinsics_vec256 y)
+{
+  Lib_IntVector_Intrinsics_vec256 xy = Lib_IntVector_Intrinsics_vec256_mul64(x, y);
+  return
+    Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(x, y),
+      Lib_IntVector_Intrinsics_vec256_add64(xy, xy));
+}
+
+static inline void
+g4(
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b,
+  Lib_IntVector_Intrinsics_vec256 *c,
+  Lib_IntVector_Intrinsics_vec256 *d
+)
+{
+  a[0U] = blamka(a[0U], b[0U]);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_xor(d[0U], a[0U]);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right64(d[0U], (uint32_t)32U);
+  c[0U] = blamka(c[0U], d[0U]);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_xor(b[0U], c[0U]);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right64(b[0U], (uint32_t)24U);
+  a[0U] = blamka(a[0U], b[0U]);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_xor(d[0U], a[0U]);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right64(d[0U], (uint32_t)16U);
+  c[0U] = blamka(c[0U], d[0U]);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_xor(b[0U], c[0U]);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right64(b[0U], (uint32_t)63U);
+}
+
+/* One Blake2b round without message on the 4x4 matrix of words with rows a, b, c, d:
+   the four column G's, then the four diagonal ones. */
+static inline void
+round4(
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b,
+  Lib_IntVector_Intrinsics_vec256 *c,
+  Lib_IntVector_Intrinsics_vec256 *d
+)
+{
+  g4(a, b, c, d);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(b[0U], (uint32_t)1U);
+  c[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(c[0U], (uint32_t)2U);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(d[0U], (uint32_t)3U);
+  g4(a, b, c, d);
+  b[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(b[0U], (uint32_t)3U);
+  c[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(c[0U], (uint32_t)2U);
+  d[0U] = Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(d[0U], (uint32_t)1U);
+}
+
+void
+Hacl_Argon2id_Vec256_fill_block(uint64_t *prev, uint64_t *ref, uint64_t *next, bool with_xor)
+{
+  Lib_IntVector_Intrinsics_vec256 r[32U];
+  Lib_IntVector_Intrinsics_vec256 q[32U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    r[i] =
+      Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(prev
+          + (uint32_t)4U * i)),
+        Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(ref + (uint32_t)4U * i)));
+    q[i] = r[i];
+  }
+  /* Rows: words 16i .. 16i + 15, i.e. registers 4i .. 4i + 3. */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *row = q + (uint32_t)4U * i;
+    round4(row, row + (uint32_t)1U, row + (uint32_t)2U, row + (uint32_t)3U);
+  }
+  /* Columns: column 2u (resp. 2u + 1) is made of the low (resp. high) 128-bit halves of
+     registers u, u + 4, ..., u + 28, two halves to a row of the 4x4 matrix. */
+  for (uint32_t u = (uint32_t)0U; u < (uint32_t)4U; u++)
+  {
+    Lib_IntVector_Intrinsics_vec256 lo[4U];
+    Lib_IntVector_Intrinsics_vec256 hi[4U];
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      Lib_IntVector_Intrinsics_vec256 x = q[u + (uint32_t)8U * k];
+      Lib_IntVector_Intrinsics_vec256 y = q[u + (uint32_t)8U * k + (uint32_t)4U];
+      lo[k] = Lib_IntVector_Intrinsics_vec256_interleave_low128(x, y);
+      hi[k] = Lib_IntVector_Intrinsics_vec256_interleave_high128(x, y);
+    }
+    round4(lo, lo + (uint32_t)1U, lo + (uint32_t)2U, lo + (uint32_t)3U);
+    round4(hi, hi + (uint32_t)1U, hi + (uint32_t)2U, hi + (uint32_t)3U);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      q[u + (uint32_t)8U * k] = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo[k], hi[k]);
+      q[u + (uint32_t)8U * k + (uint32_t)4U] =
+        Lib_IntVector_Intrinsics_vec256_interleave_high128(lo[k], hi[k]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint8_t *out = (uint8_t *)(next + (uint32_t)4U * i);
+    Lib_IntVector_Intrinsics_vec256 z = Lib_IntVector_Intrinsics_vec256_xor(q[i], r[i]);
+    if (with_xor)
+    {
+      z = Lib_IntVector_Intrinsics_vec256_xor(z, Lib_IntVector_Intrinsics_vec256_load64_le(out));
+    }
+    Lib_IntVector_Intrinsics_vec256_store64_le(out, z);
+  }
+}
+
@@ -0,0 +1,56 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Argon2id_Vec256_H
+#define __Hacl_Argon2id_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  The Argon2 compression function G on 1024-byte blocks of 128 little-endian words:
+  next = P(prev ^ ref) ^ prev ^ ref, further xor-ed with the previous contents of next
+  when with_xor holds (passes after the first). ref and next may alias.
+
+  Rows and columns of the 8x8 matrix of 16-byte registers are permuted four words at a
+  time, with the BlaMka multiply-add on 32x32-bit vector products.
+*/
+void
+Hacl_Argon2id_Vec256_fill_block(uint64_t *prev, uint64_t *ref, uint64_t *next, bool with_xor);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Argon2id_Vec256_H_DEFINED
+#endif
@@ -27,6 +27,229 @@
 #include "internal/Hacl_Poly1305_128.h"
 #include "internal/Hacl_Krmllib.h"
 
+/* One step of the two-way Horner loop: two blocks of text into the lanes of
+   the accumulator. */
+static inline void poly1305_blocks2_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *block)
+{
+  Lib_IntVector_Intrinsics_vec128 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec128 *acc0 = ctx;
+  Lib_IntVector_Intrinsics_vec128 e[5U];
+  for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+    e[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 b1 = Lib_IntVector_Intrinsics_vec128_load64_le(block);
+  Lib_IntVector_Intrinsics_vec128
+  b2 = Lib_IntVector_Intrinsics_vec128_load64_le(block + (uint32_t)16U);
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_interleave_low64(b1, b2);
+  Lib_IntVector_Intrinsics_vec128
+  hi = Lib_IntVector_Intrinsics_vec128_interleave_high64(b1, b2);
+  Lib_IntVector_Intrinsics_vec128
+  f00 =
+    Lib_IntVector_Intrinsics_vec128_and(lo,
+      Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec128
+  f15 =
+    Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
+        (uint32_t)26U),
+      Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec128
+  f25 =
+    Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
+        (uint32_t)52U),
+      Lib_IntVector_Intrinsics_vec128_shift_left64(Lib_IntVector_Intrinsics_vec128_and(hi,
+          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3fffU)),
+        (uint32_t)12U));
+  Lib_IntVector_Intrinsics_vec128
+  f30 =
+    Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(hi,
+        (uint32_t)14U),
+      Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
+  Lib_IntVector_Intrinsics_vec128
+  f40 = Lib_IntVector_Intrinsics_vec128_shift_right64(hi, (uint32_t)40U);
+  Lib_IntVector_Intrinsics_vec128 f0 = f00;
+  Lib_IntVector_Intrinsics_vec128 f1 = f15;
+  Lib_IntVector_Intrinsics_vec128 f2 = f25;
+  Lib_IntVector_Intrinsics_vec128 f3 = f30;
+  Lib_IntVector_Intrinsics_vec128 f41 = f40;
+  e[0U] = f0;
+  e[1U] = f1;
+  e[2U] = f2;
+  e[3U] = f3;
+  e[4U] = f41;
+  uint64_t b = (uint64_t)0x1000000U;
+  Lib_IntVector_Intrinsics_vec128 mask = Lib_IntVector_Intrinsics_vec128_load64(b);
+  Lib_IntVector_Intrinsics_vec128 f4 = e[4U];
+  e[4U] = Lib_IntVector_Intrinsics_vec128_or(f4, mask);
+  Lib_IntVector_Intrinsics_vec128 *rn = pre0 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec128 *rn5 = pre0 + (uint32_t)15U;
+  Lib_IntVector_Intrinsics_vec128 r0 = rn[0U];
+  Lib_IntVector_Intrinsics_vec128 r1 = rn[1U];
+  Lib_IntVector_Intrinsics_vec128 r2 = rn[2U];
+  Lib_IntVector_Intrinsics_vec128 r3 = rn[3U];
+  Lib_IntVector_Intrinsics_vec128 r4 = rn[4U];
+  Lib_IntVector_Intrinsics_vec128 r51 = rn5[1U];
+  Lib_IntVector_Intrinsics_vec128 r52 = rn5[2U];
+  Lib_IntVector_Intrinsics_vec128 r53 = rn5[3U];
+  Lib_IntVector_Intrinsics_vec128 r54 = rn5[4U];
+  Lib_IntVector_Intrinsics_vec128 f10 = acc0[0U];
+  Lib_IntVector_Intrinsics_vec128 f110 = acc0[1U];
+  Lib_IntVector_Intrinsics_vec128 f120 = acc0[2U];
+  Lib_IntVector_Intrinsics_vec128 f130 = acc0[3U];
+  Lib_IntVector_Intrinsics_vec128 f140 = acc0[4U];
+  Lib_IntVector_Intrinsics_vec128 a0 = Lib_IntVector_Intrinsics_vec128_mul64(r0, f10);
+  Lib_IntVector_Intrinsics_vec128 a1 = Lib_IntVector_Intrinsics_vec128_mul64(r1, f10);
+  Lib_IntVector_Intrinsics_vec128 a2 = Lib_IntVector_Intrinsics_vec128_mul64(r2, f10);
+  Lib_IntVector_Intrinsics_vec128 a3 = Lib_IntVector_Intrinsics_vec128_mul64(r3, f10);
+  Lib_IntVector_Intrinsics_vec128 a4 = Lib_IntVector_Intrinsics_vec128_mul64(r4, f10);
+  Lib_IntVector_Intrinsics_vec128
+  a01 =
+    Lib_IntVector_Intrinsics_vec128_add64(a0,
+      Lib_IntVector_Intrinsics_vec128_mul64(r54, f110));
+  Lib_IntVector_Intrinsics_vec128
+  a11 =
+    Lib_IntVector_Intrinsics_vec128_add64(a1,
+      Lib_IntVector_Intrinsics_vec128_mul64(r0, f110));
+  Lib_IntVector_Intrinsics_vec128
+  a21 =
+    Lib_IntVector_Intrinsics_vec128_add64(a2,
+      Lib_IntVector_Intrinsics_vec128_mul64(r1, f110));
+  Lib_IntVector_Intrinsics_vec128
+  a31 =
+    Lib_IntVector_Intrinsics_vec128_add64(a3,
+      Lib_IntVector_Intrinsics_vec128_mul64(r2, f110));
+  Lib_IntVector_Intrinsics_vec128
+  a41 =
+    Lib_IntVector_Intrinsics_vec128_add64(a4,
+      Lib_IntVector_Intrinsics_vec128_mul64(r3, f110));
+  Lib_IntVector_Intrinsics_vec128
+  a02 =
+    Lib_IntVector_Intrinsics_vec128_add64(a01,
+      Lib_IntVector_Intrinsics_vec128_mul64(r53, f120));
+  Lib_IntVector_Intrinsics_vec128
+  a12 =
+    Lib_IntVector_Intrinsics_vec128_add64(a11,
+      Lib_IntVector_Intrinsics_vec128_mul64(r54, f120));
+  Lib_IntVector_Intrinsics_vec128
+  a22 =
+    Lib_IntVector_Intrinsics_vec128_add64(a21,
+      Lib_IntVector_Intrinsics_vec128_mul64(r0, f120));
+  Lib_IntVector_Intrinsics_vec128
+  a32 =
+    Lib_IntVector_Intrinsics_vec128_add64(a31,
+      Lib_IntVector_Intrinsics_vec128_mul64(r1, f120));
+  Lib_IntVector_Intrinsics_vec128
+  a42 =
+    Lib_IntVector_Intrinsics_vec128_add64(a41,
+      Lib_IntVector_Intrinsics_vec128_mul64(r2, f120));
+  Lib_IntVector_Intrinsics_vec128
+  a03 =
+    Lib_IntVector_Intrinsics_vec128_add64(a02,
+      Lib_IntVector_Intrinsics_vec128_mul64(r52, f130));
+  Lib_IntVector_Intrinsics_vec128
+  a13 =
+    Lib_IntVector_Intrinsics_vec128_add64(a12,
+      Lib_IntVector_Intrinsics_vec128_mul64(r53, f130));
+  Lib_IntVector_Intrinsics_vec128
+  a23 =
+    Lib_IntVector_Intrinsics_vec128_add64(a22,
+      Lib_IntVector_Intrinsics_vec128_mul64(r54, f130));
+  Lib_IntVector_Intrinsics_vec128
+  a33 =
+    Lib_IntVector_Intrinsics_vec128_add64(a32,
+      Lib_IntVector_Intrinsics_vec128_mul64(r0, f130));
+  Lib_IntVector_Intrinsics_vec128
+  a43 =
+    Lib_IntVector_Intrinsics_vec128_add64(a42,
+      Lib_IntVector_Intrinsics_vec128_mul64(r1, f130));
+  Lib_IntVector_Intrinsics_vec128
+  a04 =
+    Lib_IntVector_Intrinsics_vec128_add64(a03,
+      Lib_IntVector_Intrinsics_vec128_mul64(r51, f140));
+  Lib_IntVector_Intrinsics_vec128
+  a14 =
+    Lib_IntVector_Intrinsics_vec128_add64(a13,
+      Lib_IntVector_Intrinsics_vec128_mul64(r52, f140));
+  Lib_IntVector_Intrinsics_vec128
+  a24 =
+    Lib_IntVector_Intrinsics_vec128_add64(a23,
+      Lib_IntVector_Intrinsics_vec128_mul64(r53, f140));
+  Lib_IntVector_Intrinsics_vec128
+  a34 =
+    Lib_IntVector_Intrinsics_vec128_add64(a33,
+      Lib_IntVector_Intrinsics_vec128_mul64(r54, f140));
+  Lib_IntVector_Intrinsics_vec128
+  a44 =
+    Lib_IntVector_Intrinsics_vec128_add64(a43,
+      Lib_IntVector_Intrinsics_vec128_mul64(r0, f140));
+  Lib_IntVector_Intrinsics_vec128 t01 = a04;
+  Lib_IntVector_Intrinsics_vec128 t1 = a14;
+  Lib_IntVector_Intrinsics_vec128 t2 = a24;
+  Lib_IntVector_Intrinsics_vec128 t3 = a34;
+  Lib_IntVector_Intrinsics_vec128 t4 = a44;
+  Lib_IntVector_Intrinsics_vec128
+  mask26 = Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec128
+  z0 = Lib_IntVector_Intrinsics_vec128_shift_right64(t01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128
+  z1 = Lib_IntVector_Intrinsics_vec128_shift_right64(t3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_and(t01, mask26);
+  Lib_IntVector_Intrinsics_vec128 x3 = Lib_IntVector_Intrinsics_vec128_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec128 x1 = Lib_IntVector_Intrinsics_vec128_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec128 x4 = Lib_IntVector_Intrinsics_vec128_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec128
+  z01 = Lib_IntVector_Intrinsics_vec128_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128
+  z11 = Lib_IntVector_Intrinsics_vec128_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128
+  t = Lib_IntVector_Intrinsics_vec128_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec128 z12 = Lib_IntVector_Intrinsics_vec128_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec128 x11 = Lib_IntVector_Intrinsics_vec128_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec128 x41 = Lib_IntVector_Intrinsics_vec128_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec128 x2 = Lib_IntVector_Intrinsics_vec128_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec128 x01 = Lib_IntVector_Intrinsics_vec128_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec128
+  z02 = Lib_IntVector_Intrinsics_vec128_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128
+  z13 = Lib_IntVector_Intrinsics_vec128_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128 x21 = Lib_IntVector_Intrinsics_vec128_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec128 x02 = Lib_IntVector_Intrinsics_vec128_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec128 x31 = Lib_IntVector_Intrinsics_vec128_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec128 x12 = Lib_IntVector_Intrinsics_vec128_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec128
+  z03 = Lib_IntVector_Intrinsics_vec128_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec128 x32 = Lib_IntVector_Intrinsics_vec128_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec128 x42 = Lib_IntVector_Intrinsics_vec128_add64(x41, z03);
+  Lib_IntVector_Intrinsics_vec128 o00 = x02;
+  Lib_IntVector_Intrinsics_vec128 o10 = x12;
+  Lib_IntVector_Intrinsics_vec128 o20 = x21;
+  Lib_IntVector_Intrinsics_vec128 o30 = x32;
+  Lib_IntVector_Intrinsics_vec128 o40 = x42;
+  acc0[0U] = o00;
+  acc0[1U] = o10;
+  acc0[2U] = o20;
+  acc0[3U] = o30;
+  acc0[4U] = o40;
+  Lib_IntVector_Intrinsics_vec128 f100 = acc0[0U];
+  Lib_IntVector_Intrinsics_vec128 f11 = acc0[1U];
+  Lib_IntVector_Intrinsics_vec128 f12 = acc0[2U];
+  Lib_IntVector_Intrinsics_vec128 f13 = acc0[3U];
+  Lib_IntVector_Intrinsics_vec128 f14 = acc0[4U];
+  Lib_IntVector_Intrinsics_vec128 f20 = e[0U];
+  Lib_IntVector_Intrinsics_vec128 f21 = e[1U];
+  Lib_IntVector_Intrinsics_vec128 f22 = e[2U];
+  Lib_IntVector_Intrinsics_vec128 f23 = e[3U];
+  Lib_IntVector_Intrinsics_vec128 f24 = e[4U];
+  Lib_IntVector_Intrinsics_vec128 o0 = Lib_IntVector_Intrinsics_vec128_add64(f100, f20);
+  Lib_IntVector_Intrinsics_vec128 o1 = Lib_IntVector_Intrinsics_vec128_add64(f11, f21);
+  Lib_IntVector_Intrinsics_vec128 o2 = Lib_IntVector_Intrinsics_vec128_add64(f12, f22);
+  Lib_IntVector_Intrinsics_vec128 o3 = Lib_IntVector_Intrinsics_vec128_add64(f13, f23);
+  Lib_IntVector_Intrinsics_vec128 o4 = Lib_IntVector_Intrinsics_vec128_add64(f14, f24);
+  acc0[0U] = o0;
+  acc0[1U] = o1;
+  acc0[2U] = o2;
+  acc0[3U] = o3;
+  acc0[4U] = o4;
+}
+
 static inline void
 poly1305_padded_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t *text)
 {
@@ -49,222 +272,7 @@ poly1305_padded_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t
     uint32_t nb = len1 / bs;
     for (uint32_t i = (uint32_t)0U; i < nb; i++)
     {
-      uint8_t *block = text1 + i * bs;
-      Lib_IntVector_Intrinsics_vec128 e[5U];
-      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
-        e[_i] = Lib_IntVector_Intrinsics_vec128_zero;
-      Lib_IntVector_Intrinsics_vec128 b1 = Lib_IntVector_Intrinsics_vec128_load64_le(block);
-      Lib_IntVector_Intrinsics_vec128
-      b2 = Lib_IntVector_Intrinsics_vec128_load64_le(block + (uint32_t)16U);
-      Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_interleave_low64(b1, b2);
-      Lib_IntVector_Intrinsics_vec128
-      hi = Lib_IntVector_Intrinsics_vec128_interleave_high64(b1, b2);
-      Lib_IntVector_Intrinsics_vec128
-      f00 =
-        Lib_IntVector_Intrinsics_vec128_and(lo,
-          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
-      Lib_IntVector_Intrinsics_vec128
-      f15 =
-        Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
-            (uint32_t)26U),
-          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
-      Lib_IntVector_Intrinsics_vec128
-      f25 =
-        Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
-            (uint32_t)52U),
-          Lib_IntVector_Intrinsics_vec128_shift_left64(Lib_IntVector_Intrinsics_vec128_and(hi,
-              Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3fffU)),
-            (uint32_t)12U));
-      Lib_IntVector_Intrinsics_vec128
-      f30 =
-        Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(hi,
-            (uint32_t)14U),
-          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
-      Lib_IntVector_Intrinsics_vec128
-      f40 = Lib_IntVector_Intrinsics_vec128_shift_right64(hi, (uint32_t)40U);
-      Lib_IntVector_Intrinsics_vec128 f0 = f00;
-      Lib_IntVector_Intrinsics_vec128 f1 = f15;
-      Lib_IntVector_Intrinsics_vec128 f2 = f25;
-      Lib_IntVector_Intrinsics_vec128 f3 = f30;
-      Lib_IntVector_Intrinsics_vec128 f41 = f40;
-      e[0U] = f0;
-      e[1U] = f1;
-      e[2U] = f2;
-      e[3U] = f3;
-      e[4U] = f41;
-      uint64_t b = (uint64_t)0x1000000U;
-      Lib_IntVector_Intrinsics_vec128 mask = Lib_IntVector_Intrinsics_vec128_load64(b);
-      Lib_IntVector_Intrinsics_vec128 f4 = e[4U];
-      e[4U] = Lib_IntVector_Intrinsics_vec128_or(f4, mask);
-      Lib_IntVector_Intrinsics_vec128 *rn = pre0 + (uint32_t)10U;
-      Lib_IntVector_Intrinsics_vec128 *rn5 = pre0 + (uint32_t)15U;
-      Lib_IntVector_Intrinsics_vec128 r0 = rn[0U];
-      Lib_IntVector_Intrinsics_vec128 r1 = rn[1U];
-      Lib_IntVector_Intrinsics_vec128 r2 = rn[2U];
-      Lib_IntVector_Intrinsics_vec128 r3 = rn[3U];
-      Lib_IntVector_Intrinsics_vec128 r4 = rn[4U];
-      Lib_IntVector_Intrinsics_vec128 r51 = rn5[1U];
-      Lib_IntVector_Intrinsics_vec128 r52 = rn5[2U];
-      Lib_IntVector_Intrinsics_vec128 r53 = rn5[3U];
-      Lib_IntVector_Intrinsics_vec128 r54 = rn5[4U];
-      Lib_IntVector_Intrinsics_vec128 f10 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec128 f110 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec128 f120 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec128 f130 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec128 f140 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec128 a0 = Lib_IntVector_Intrinsics_vec128_mul64(r0, f10);
-      Lib_IntVector_Intrinsics_vec128 a1 = Lib_IntVector_Intrinsics_vec128_mul64(r1, f10);
-      Lib_IntVector_Intrinsics_vec128 a2 = Lib_IntVector_Intrinsics_vec128_mul64(r2, f10);
-      Lib_IntVector_Intrinsics_vec128 a3 = Lib_IntVector_Intrinsics_vec128_mul64(r3, f10);
-      Lib_IntVector_Intrinsics_vec128 a4 = Lib_IntVector_Intrinsics_vec128_mul64(r4, f10);
-      Lib_IntVector_Intrinsics_vec128
-      a01 =
-        Lib_IntVector_Intrinsics_vec128_add64(a0,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a11 =
-        Lib_IntVector_Intrinsics_vec128_add64(a1,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a21 =
-        Lib_IntVector_Intrinsics_vec128_add64(a2,
-          Lib_IntVector_Intrinsics_vec128_mul64(r1, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a31 =
-        Lib_IntVector_Intrinsics_vec128_add64(a3,
-          Lib_IntVector_Intrinsics_vec128_mul64(r2, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a41 =
-        Lib_IntVector_Intrinsics_vec128_add64(a4,
-          Lib_IntVector_Intrinsics_vec128_mul64(r3, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a02 =
-        Lib_IntVector_Intrinsics_vec128_add64(a01,
-          Lib_IntVector_Intrinsics_vec128_mul64(r53, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a12 =
-        Lib_IntVector_Intrinsics_vec128_add64(a11,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a22 =
-        Lib_IntVector_Intrinsics_vec128_add64(a21,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a32 =
-        Lib_IntVector_Intrinsics_vec128_add64(a31,
-          Lib_IntVector_Intrinsics_vec128_mul64(r1, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a42 =
-        Lib_IntVector_Intrinsics_vec128_add64(a41,
-          Lib_IntVector_Intrinsics_vec128_mul64(r2, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a03 =
-        Lib_IntVector_Intrinsics_vec128_add64(a02,
-          Lib_IntVector_Intrinsics_vec128_mul64(r52, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a13 =
-        Lib_IntVector_Intrinsics_vec128_add64(a12,
-          Lib_IntVector_Intrinsics_vec128_mul64(r53, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a23 =
-        Lib_IntVector_Intrinsics_vec128_add64(a22,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a33 =
-        Lib_IntVector_Intrinsics_vec128_add64(a32,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a43 =
-        Lib_IntVector_Intrinsics_vec128_add64(a42,
-          Lib_IntVector_Intrinsics_vec128_mul64(r1, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a04 =
-        Lib_IntVector_Intrinsics_vec128_add64(a03,
-          Lib_IntVector_Intrinsics_vec128_mul64(r51, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a14 =
-        Lib_IntVector_Intrinsics_vec128_add64(a13,
-          Lib_IntVector_Intrinsics_vec128_mul64(r52, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a24 =
-        Lib_IntVector_Intrinsics_vec128_add64(a23,
-          Lib_IntVector_Intrinsics_vec128_mul64(r53, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a34 =
-        Lib_IntVector_Intrinsics_vec128_add64(a33,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a44 =
-        Lib_IntVector_Intrinsics_vec128_add64(a43,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f140));
-      Lib_IntVector_Intrinsics_vec128 t01 = a04;
-      Lib_IntVector_Intrinsics_vec128 t1 = a14;
-      Lib_IntVector_Intrinsics_vec128 t2 = a24;
-      Lib_IntVector_Intrinsics_vec128 t3 = a34;
-      Lib_IntVector_Intrinsics_vec128 t4 = a44;
-      Lib_IntVector_Intrinsics_vec128
-      mask26 = Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec128
-      z0 = Lib_IntVector_Intrinsics_vec128_shift_right64(t01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      z1 = Lib_IntVector_Intrinsics_vec128_shift_right64(t3, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_and(t01, mask26);
-      Lib_IntVector_Intrinsics_vec128 x3 = Lib_IntVector_Intrinsics_vec128_and(t3, mask26);
-      Lib_IntVector_Intrinsics_vec128 x1 = Lib_IntVector_Intrinsics_vec128_add64(t1, z0);
-      Lib_IntVector_Intrinsics_vec128 x4 = Lib_IntVector_Intrinsics_vec128_add64(t4, z1);
-      Lib_IntVector_Intrinsics_vec128
-      z01 = Lib_IntVector_Intrinsics_vec128_shift_right64(x1, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      z11 = Lib_IntVector_Intrinsics_vec128_shift_right64(x4, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      t = Lib_IntVector_Intrinsics_vec128_shift_left64(z11, (uint32_t)2U);
-      Lib_IntVector_Intrinsics_vec128 z12 = Lib_IntVector_Intrinsics_vec128_add64(z11, t);
-      Lib_IntVector_Intrinsics_vec128 x11 = Lib_IntVector_Intrinsics_vec128_and(x1, mask26);
-      Lib_IntVector_Intrinsics_vec128 x41 = Lib_IntVector_Intrinsics_vec128_and(x4, mask26);
-      Lib_IntVector_Intrinsics_vec128 x2 = Lib_IntVector_Intrinsics_vec128_add64(t2, z01);
-      Lib_IntVector_Intrinsics_vec128 x01 = Lib_IntVector_Intrinsics_vec128_add64(x0, z12);
-      Lib_IntVector_Intrinsics_vec128
-      z02 = Lib_IntVector_Intrinsics_vec128_shift_right64(x2, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      z13 = Lib_IntVector_Intrinsics_vec128_shift_right64(x01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128 x21 = Lib_IntVector_Intrinsics_vec128_and(x2, mask26);
-      Lib_IntVector_Intrinsics_vec128 x02 = Lib_IntVector_Intrinsics_vec128_and(x01, mask26);
-      Lib_IntVector_Intrinsics_vec128 x31 = Lib_IntVector_Intrinsics_vec128_add64(x3, z02);
-      Lib_IntVector_Intrinsics_vec128 x12 = Lib_IntVector_Intrinsics_vec128_add64(x11, z13);
-      Lib_IntVector_Intrinsics_vec128
-      z03 = Lib_IntVector_Intrinsics_vec128_shift_right64(x31, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128 x32 = Lib_IntVector_Intrinsics_vec128_and(x31, mask26);
-      Lib_IntVector_Intrinsics_vec128 x42 = Lib_IntVector_Intrinsics_vec128_add64(x41, z03);
-      Lib_IntVector_Intrinsics_vec128 o00 = x02;
-      Lib_IntVector_Intrinsics_vec128 o10 = x12;
-      Lib_IntVector_Intrinsics_vec128 o20 = x21;
-      Lib_IntVector_Intrinsics_vec128 o30 = x32;
-      Lib_IntVector_Intrinsics_vec128 o40 = x42;
-      acc0[0U] = o00;
-      acc0[1U] = o10;
-      acc0[2U] = o20;
-      acc0[3U] = o30;
-      acc0[4U] = o40;
-      Lib_IntVector_Intrinsics_vec128 f100 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec128 f11 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec128 f12 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec128 f13 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec128 f14 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec128 f20 = e[0U];
-      Lib_IntVector_Intrinsics_vec128 f21 = e[1U];
-      Lib_IntVector_Intrinsics_vec128 f22 = e[2U];
-      Lib_IntVector_Intrinsics_vec128 f23 = e[3U];
-      Lib_IntVector_Intrinsics_vec128 f24 = e[4U];
-      Lib_IntVector_Intrinsics_vec128 o0 = Lib_IntVector_Intrinsics_vec128_add64(f100, f20);
-      Lib_IntVector_Intrinsics_vec128 o1 = Lib_IntVector_Intrinsics_vec128_add64(f11, f21);
-      Lib_IntVector_Intrinsics_vec128 o2 = Lib_IntVector_Intrinsics_vec128_add64(f12, f22);
-      Lib_IntVector_Intrinsics_vec128 o3 = Lib_IntVector_Intrinsics_vec128_add64(f13, f23);
-      Lib_IntVector_Intrinsics_vec128 o4 = Lib_IntVector_Intrinsics_vec128_add64(f14, f24);
-      acc0[0U] = o0;
-      acc0[1U] = o1;
-      acc0[2U] = o2;
-      acc0[3U] = o3;
-      acc0[4U] = o4;
+      poly1305_blocks2_128(ctx, text1 + i * bs);
     }
     Hacl_Impl_Poly1305_Field32xN_128_fmul_r2_normalize(acc0, pre0);
   }
@@ -1193,3 +1201,257 @@ Hacl_Chacha20Poly1305_128_aead_decrypt(
   return (uint32_t)1U;
 }
 
+/* The keystream runs on across segment boundaries: whole runs of four blocks go
+   straight through the vector core, and the run straddling a boundary is
+   kept in block for the next segment, so that a boundary costs one call to the
+   core and no more. */
+static void
+chacha20_iov_128(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t in_num,
+  uint32_t *in_len,
+  uint8_t **in,
+  uint32_t out_num,
+  uint32_t *out_len,
+  uint8_t **out
+)
+{
+  uint8_t block[256U] = { 0U };
+  uint32_t used = (uint32_t)256U;
+  uint32_t ctr = (uint32_t)1U;
+  uint32_t i = (uint32_t)0U;
+  uint32_t i_off = (uint32_t)0U;
+  uint32_t o = (uint32_t)0U;
+  uint32_t o_off = (uint32_t)0U;
+  while (i < in_num && o < out_num)
+  {
+    if (i_off == in_len[i])
+    {
+      i++;
+      i_off = (uint32_t)0U;
+      continue;
+    }
+    if (o_off == out_len[o])
+    {
+      o++;
+      o_off = (uint32_t)0U;
+      continue;
+    }
+    uint32_t in_rem = in_len[i] - i_off;
+    uint32_t out_rem = out_len[o] - o_off;
+    uint32_t len = in_rem < out_rem ? in_rem : out_rem;
+    uint8_t *src = in[i] + i_off;
+    uint8_t *dst = out[o] + o_off;
+    i_off = i_off + len;
+    o_off = o_off + len;
+    if (used < (uint32_t)256U)
+    {
+      uint32_t l = (uint32_t)256U - used < len ? (uint32_t)256U - used : len;
+      for (uint32_t j = (uint32_t)0U; j < l; j++)
+      {
+        dst[j] = src[j] ^ block[used + j];
+      }
+      used = used + l;
+      src = src + l;
+      dst = dst + l;
+      len = len - l;
+    }
+    uint32_t full = len / (uint32_t)256U * (uint32_t)256U;
+    if (full > (uint32_t)0U)
+    {
+      Hacl_Chacha20_Vec128_chacha20_encrypt_128(full, dst, src, k, n, ctr);
+      ctr = ctr + full / (uint32_t)64U;
+    }
+    src = src + full;
+    dst = dst + full;
+    uint32_t rem = len - full;
+    if (rem > (uint32_t)0U)
+    {
+      memset(block, 0U, (uint32_t)256U * sizeof (uint8_t));
+      Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)256U, block, block, k, n, ctr);
+      ctr = ctr + (uint32_t)4U;
+      for (uint32_t j = (uint32_t)0U; j < rem; j++)
+      {
+        dst[j] = src[j] ^ block[j];
+      }
+      used = rem;
+    }
+  }
+}
+
+/* The Poly1305 input of an AEAD, fed segment by segment: whole chunks of two
+   blocks go through the two-way loop of poly1305_padded_128 straight from the
+   segments, chunks that straddle a boundary are gathered in chunk, and the
+   accumulator is only brought back into one lane at the end. */
+typedef struct mac_128_s
+{
+  Lib_IntVector_Intrinsics_vec128 *ctx;
+  bool lanes;
+  uint32_t used;
+  uint8_t chunk[32U];
+}
+mac_128;
+
+static void mac_chunk_128(mac_128 *m, uint8_t *text)
+{
+  if (m->lanes)
+  {
+    poly1305_blocks2_128(m->ctx, text);
+  }
+  else
+  {
+    Hacl_Impl_Poly1305_Field32xN_128_load_acc2(m->ctx, text);
+    m->lanes = true;
+  }
+}
+
+static void mac_absorb_128(mac_128 *m, uint32_t len, uint8_t *text)
+{
+  if (m->used > (uint32_t)0U)
+  {
+    uint32_t c = (uint32_t)32U - m->used < len ? (uint32_t)32U - m->used : len;
+    memcpy(m->chunk + m->used, text, c * sizeof (uint8_t));
+    m->used = m->used + c;
+    text = text + c;
+    len = len - c;
+    if (m->used == (uint32_t)32U)
+    {
+      mac_chunk_128(m, m->chunk);
+      m->used = (uint32_t)0U;
+    }
+  }
+  uint32_t nb = len / (uint32_t)32U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    mac_chunk_128(m, text + i * (uint32_t)32U);
+  }
+  uint32_t rem = len - nb * (uint32_t)32U;
+  memcpy(m->chunk + m->used, text + nb * (uint32_t)32U, rem * sizeof (uint8_t));
+  m->used = m->used + rem;
+}
+
+/* Zero-pads what has been absorbed so far to a multiple of 16 bytes. */
+static void mac_pad_128(mac_128 *m)
+{
+  uint32_t r = m->used % (uint32_t)16U;
+  if (r > (uint32_t)0U)
+  {
+    memset(m->chunk + m->used, 0U, ((uint32_t)16U - r) * sizeof (uint8_t));
+    m->used = m->used + (uint32_t)16U - r;
+    if (m->used == (uint32_t)32U)
+    {
+      mac_chunk_128(m, m->chunk);
+      m->used = (uint32_t)0U;
+    }
+  }
+}
+
+static uint64_t total_len(uint32_t num, uint32_t *len)
+{
+  uint64_t total = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    total = total + (uint64_t)len[i];
+  }
+  return total;
+}
+
+static void
+poly1305_do_iov_128(
+  uint8_t *k,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t c_num,
+  uint32_t *clen,
+  uint8_t **c,
+  uint8_t *out
+)
+{
+  Lib_IntVector_Intrinsics_vec128 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  uint8_t block[16U] = { 0U };
+  Hacl_Poly1305_128_poly1305_init(ctx, k);
+  mac_128 m = { .ctx = ctx, .lanes = false, .used = (uint32_t)0U };
+  for (uint32_t i = (uint32_t)0U; i < aad_num; i++)
+  {
+    mac_absorb_128(&m, aadlen[i], aad[i]);
+  }
+  mac_pad_128(&m);
+  for (uint32_t i = (uint32_t)0U; i < c_num; i++)
+  {
+    mac_absorb_128(&m, clen[i], c[i]);
+  }
+  mac_pad_128(&m);
+  store64_le(block, total_len(aad_num, aadlen));
+  store64_le(block + (uint32_t)8U, total_len(c_num, clen));
+  mac_absorb_128(&m, (uint32_t)16U, block);
+  if (m.lanes)
+  {
+    Hacl_Impl_Poly1305_Field32xN_128_fmul_r2_normalize(ctx, ctx + (uint32_t)5U);
+  }
+  poly1305_padded_128(ctx, m.used, m.chunk);
+  Hacl_Poly1305_128_poly1305_finish(out, k, ctx);
+}
+
+void
+Hacl_Chacha20Poly1305_128_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+)
+{
+  chacha20_iov_128(k, n, m_num, mlen, m, cipher_num, cipher_len, cipher);
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_iov_128(key, aad_num, aadlen, aad, cipher_num, cipher_len, cipher, mac);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_128_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+)
+{
+  uint8_t computed_mac[16U] = { 0U };
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_iov_128(key, aad_num, aadlen, aad, cipher_num, cipher_len, cipher, computed_mac);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_mac[i], mac[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    chacha20_iov_128(k, n, cipher_num, cipher_len, cipher, m_num, mlen, m);
+    return (uint32_t)0U;
+  }
+  return (uint32_t)1U;
+}
+
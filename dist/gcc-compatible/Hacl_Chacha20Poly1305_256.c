@@ -27,6 +27,231 @@
 #include "internal/Hacl_Poly1305_256.h"
 #include "internal/Hacl_Krmllib.h"
 
+/* One step of the four-way Horner loop: four blocks of text into the lanes of
+   the accumulator. */
+static inline void poly1305_blocks4_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint8_t *block)
+{
+  Lib_IntVector_Intrinsics_vec256 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec256 *acc0 = ctx;
+  Lib_IntVector_Intrinsics_vec256 e[5U];
+  for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+    e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load64_le(block);
+  Lib_IntVector_Intrinsics_vec256
+  hi = Lib_IntVector_Intrinsics_vec256_load64_le(block + (uint32_t)32U);
+  Lib_IntVector_Intrinsics_vec256
+  mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
+  Lib_IntVector_Intrinsics_vec256
+  m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
+  Lib_IntVector_Intrinsics_vec256
+  m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
+  Lib_IntVector_Intrinsics_vec256
+  m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
+  Lib_IntVector_Intrinsics_vec256
+  m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
+  Lib_IntVector_Intrinsics_vec256
+  t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
+  Lib_IntVector_Intrinsics_vec256
+  t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
+  Lib_IntVector_Intrinsics_vec256
+  t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
+  Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
+  Lib_IntVector_Intrinsics_vec256
+  t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
+  Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
+  Lib_IntVector_Intrinsics_vec256
+  t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
+  Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
+  Lib_IntVector_Intrinsics_vec256
+  o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
+  Lib_IntVector_Intrinsics_vec256 o00 = o5;
+  Lib_IntVector_Intrinsics_vec256 o11 = o10;
+  Lib_IntVector_Intrinsics_vec256 o21 = o20;
+  Lib_IntVector_Intrinsics_vec256 o31 = o30;
+  Lib_IntVector_Intrinsics_vec256 o41 = o40;
+  e[0U] = o00;
+  e[1U] = o11;
+  e[2U] = o21;
+  e[3U] = o31;
+  e[4U] = o41;
+  uint64_t b = (uint64_t)0x1000000U;
+  Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
+  Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
+  e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
+  Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
+  Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
+  Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
+  Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
+  Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
+  Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
+  Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
+  Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
+  Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
+  Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
+  Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
+  Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
+  Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
+  Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
+  Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
+  Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
+  Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
+  Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
+  Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
+  Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
+  Lib_IntVector_Intrinsics_vec256
+  a01 =
+    Lib_IntVector_Intrinsics_vec256_add64(a0,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
+  Lib_IntVector_Intrinsics_vec256
+  a11 =
+    Lib_IntVector_Intrinsics_vec256_add64(a1,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
+  Lib_IntVector_Intrinsics_vec256
+  a21 =
+    Lib_IntVector_Intrinsics_vec256_add64(a2,
+      Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
+  Lib_IntVector_Intrinsics_vec256
+  a31 =
+    Lib_IntVector_Intrinsics_vec256_add64(a3,
+      Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
+  Lib_IntVector_Intrinsics_vec256
+  a41 =
+    Lib_IntVector_Intrinsics_vec256_add64(a4,
+      Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
+  Lib_IntVector_Intrinsics_vec256
+  a02 =
+    Lib_IntVector_Intrinsics_vec256_add64(a01,
+      Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
+  Lib_IntVector_Intrinsics_vec256
+  a12 =
+    Lib_IntVector_Intrinsics_vec256_add64(a11,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
+  Lib_IntVector_Intrinsics_vec256
+  a22 =
+    Lib_IntVector_Intrinsics_vec256_add64(a21,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
+  Lib_IntVector_Intrinsics_vec256
+  a32 =
+    Lib_IntVector_Intrinsics_vec256_add64(a31,
+      Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
+  Lib_IntVector_Intrinsics_vec256
+  a42 =
+    Lib_IntVector_Intrinsics_vec256_add64(a41,
+      Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
+  Lib_IntVector_Intrinsics_vec256
+  a03 =
+    Lib_IntVector_Intrinsics_vec256_add64(a02,
+      Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
+  Lib_IntVector_Intrinsics_vec256
+  a13 =
+    Lib_IntVector_Intrinsics_vec256_add64(a12,
+      Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
+  Lib_IntVector_Intrinsics_vec256
+  a23 =
+    Lib_IntVector_Intrinsics_vec256_add64(a22,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
+  Lib_IntVector_Intrinsics_vec256
+  a33 =
+    Lib_IntVector_Intrinsics_vec256_add64(a32,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
+  Lib_IntVector_Intrinsics_vec256
+  a43 =
+    Lib_IntVector_Intrinsics_vec256_add64(a42,
+      Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
+  Lib_IntVector_Intrinsics_vec256
+  a04 =
+    Lib_IntVector_Intrinsics_vec256_add64(a03,
+      Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
+  Lib_IntVector_Intrinsics_vec256
+  a14 =
+    Lib_IntVector_Intrinsics_vec256_add64(a13,
+      Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
+  Lib_IntVector_Intrinsics_vec256
+  a24 =
+    Lib_IntVector_Intrinsics_vec256_add64(a23,
+      Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
+  Lib_IntVector_Intrinsics_vec256
+  a34 =
+    Lib_IntVector_Intrinsics_vec256_add64(a33,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
+  Lib_IntVector_Intrinsics_vec256
+  a44 =
+    Lib_IntVector_Intrinsics_vec256_add64(a43,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
+  Lib_IntVector_Intrinsics_vec256 t01 = a04;
+  Lib_IntVector_Intrinsics_vec256 t1 = a14;
+  Lib_IntVector_Intrinsics_vec256 t2 = a24;
+  Lib_IntVector_Intrinsics_vec256 t3 = a34;
+  Lib_IntVector_Intrinsics_vec256 t4 = a44;
+  Lib_IntVector_Intrinsics_vec256
+  mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256
+  z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
+  Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec256
+  z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256
+  z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256
+  t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec256
+  z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256
+  z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec256
+  z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+  Lib_IntVector_Intrinsics_vec256 o01 = x02;
+  Lib_IntVector_Intrinsics_vec256 o12 = x12;
+  Lib_IntVector_Intrinsics_vec256 o22 = x21;
+  Lib_IntVector_Intrinsics_vec256 o32 = x32;
+  Lib_IntVector_Intrinsics_vec256 o42 = x42;
+  acc0[0U] = o01;
+  acc0[1U] = o12;
+  acc0[2U] = o22;
+  acc0[3U] = o32;
+  acc0[4U] = o42;
+  Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
+  Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
+  Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
+  Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
+  Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
+  Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
+  Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
+  Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
+  Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
+  Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
+  Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
+  Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
+  Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
+  Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
+  Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
+  acc0[0U] = o0;
+  acc0[1U] = o1;
+  acc0[2U] = o2;
+  acc0[3U] = o3;
+  acc0[4U] = o4;
+}
+
 static inline void
 poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t *text)
 {
@@ -49,224 +274,7 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
     uint32_t nb = len1 / bs;
     for (uint32_t i = (uint32_t)0U; i < nb; i++)
     {
-      uint8_t *block = text1 + i * bs;
-      Lib_IntVector_Intrinsics_vec256 e[5U];
-      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
-        e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
-      Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load64_le(block);
-      Lib_IntVector_Intrinsics_vec256
-      hi = Lib_IntVector_Intrinsics_vec256_load64_le(block + (uint32_t)32U);
-      Lib_IntVector_Intrinsics_vec256
-      mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
-      Lib_IntVector_Intrinsics_vec256
-      t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
-      Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
-      Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
-      Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
-      Lib_IntVector_Intrinsics_vec256 o00 = o5;
-      Lib_IntVector_Intrinsics_vec256 o11 = o10;
-      Lib_IntVector_Intrinsics_vec256 o21 = o20;
-      Lib_IntVector_Intrinsics_vec256 o31 = o30;
-      Lib_IntVector_Intrinsics_vec256 o41 = o40;
-      e[0U] = o00;
-      e[1U] = o11;
-      e[2U] = o21;
-      e[3U] = o31;
-      e[4U] = o41;
-      uint64_t b = (uint64_t)0x1000000U;
-      Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
-      Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
-      e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
-      Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
-      Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
-      Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
-      Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
-      Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
-      Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
-      Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
-      Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
-      Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
-      Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
-      Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
-      Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
-      Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
-      Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
-      Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
-      Lib_IntVector_Intrinsics_vec256
-      a01 =
-        Lib_IntVector_Intrinsics_vec256_add64(a0,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a11 =
-        Lib_IntVector_Intrinsics_vec256_add64(a1,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a21 =
-        Lib_IntVector_Intrinsics_vec256_add64(a2,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a31 =
-        Lib_IntVector_Intrinsics_vec256_add64(a3,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a41 =
-        Lib_IntVector_Intrinsics_vec256_add64(a4,
-          Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a02 =
-        Lib_IntVector_Intrinsics_vec256_add64(a01,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a12 =
-        Lib_IntVector_Intrinsics_vec256_add64(a11,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a22 =
-        Lib_IntVector_Intrinsics_vec256_add64(a21,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a32 =
-        Lib_IntVector_Intrinsics_vec256_add64(a31,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a42 =
-        Lib_IntVector_Intrinsics_vec256_add64(a41,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a03 =
-        Lib_IntVector_Intrinsics_vec256_add64(a02,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a13 =
-        Lib_IntVector_Intrinsics_vec256_add64(a12,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a23 =
-        Lib_IntVector_Intrinsics_vec256_add64(a22,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a33 =
-        Lib_IntVector_Intrinsics_vec256_add64(a32,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a43 =
-        Lib_IntVector_Intrinsics_vec256_add64(a42,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a04 =
-        Lib_IntVector_Intrinsics_vec256_add64(a03,
-          Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a14 =
-        Lib_IntVector_Intrinsics_vec256_add64(a13,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a24 =
-        Lib_IntVector_Intrinsics_vec256_add64(a23,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a34 =
-        Lib_IntVector_Intrinsics_vec256_add64(a33,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a44 =
-        Lib_IntVector_Intrinsics_vec256_add64(a43,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
-      Lib_IntVector_Intrinsics_vec256 t01 = a04;
-      Lib_IntVector_Intrinsics_vec256 t1 = a14;
-      Lib_IntVector_Intrinsics_vec256 t2 = a24;
-      Lib_IntVector_Intrinsics_vec256 t3 = a34;
-      Lib_IntVector_Intrinsics_vec256 t4 = a44;
-      Lib_IntVector_Intrinsics_vec256
-      mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
-      Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
-      Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
-      Lib_IntVector_Intrinsics_vec256
-      z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
-      Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
-      Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
-      Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
-      Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
-      Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
-      Lib_IntVector_Intrinsics_vec256
-      z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
-      Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
-      Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
-      Lib_IntVector_Intrinsics_vec256
-      z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
-      Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
-      Lib_IntVector_Intrinsics_vec256 o01 = x02;
-      Lib_IntVector_Intrinsics_vec256 o12 = x12;
-      Lib_IntVector_Intrinsics_vec256 o22 = x21;
-      Lib_IntVector_Intrinsics_vec256 o32 = x32;
-      Lib_IntVector_Intrinsics_vec256 o42 = x42;
-      acc0[0U] = o01;
-      acc0[1U] = o12;
-      acc0[2U] = o22;
-      acc0[3U] = o32;
-      acc0[4U] = o42;
-      Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
-      Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
-      Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
-      Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
-      Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
-      Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
-      Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
-      Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
-      Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
-      Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
-      acc0[0U] = o0;
-      acc0[1U] = o1;
-      acc0[2U] = o2;
-      acc0[3U] = o3;
-      acc0[4U] = o4;
+      poly1305_blocks4_256(ctx, text1 + i * bs);
     }
     Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(acc0, pre0);
   }
@@ -1195,3 +1203,950 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   return (uint32_t)1U;
 }
 
+
+/* Packets with more than this many bytes of plaintext fill the lanes on their
+   own and go through the one-packet functions. */
+static uint32_t batch_max_len = (uint32_t)1280U;
+
+static uint32_t batch_chunk = (uint32_t)16U;
+
+static inline void
+quarter_round8(
+  Lib_IntVector_Intrinsics_vec256 *x,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d
+)
+{
+  x[a] = Lib_IntVector_Intrinsics_vec256_add32(x[a], x[b]);
+  x[d] = Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(x[d],
+        x[a]),
+      (uint32_t)16U);
+  x[c] = Lib_IntVector_Intrinsics_vec256_add32(x[c], x[d]);
+  x[b] = Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(x[b],
+        x[c]),
+      (uint32_t)12U);
+  x[a] = Lib_IntVector_Intrinsics_vec256_add32(x[a], x[b]);
+  x[d] = Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(x[d],
+        x[a]),
+      (uint32_t)8U);
+  x[c] = Lib_IntVector_Intrinsics_vec256_add32(x[c], x[d]);
+  x[b] = Lib_IntVector_Intrinsics_vec256_rotate_left32(Lib_IntVector_Intrinsics_vec256_xor(x[b],
+        x[c]),
+      (uint32_t)7U);
+}
+
+/* Rows of eight 32-bit words to columns: on return, x[i] holds lane i. */
+static inline void transpose8(Lib_IntVector_Intrinsics_vec256 *x)
+{
+  Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(x[0U], x[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  a1 = Lib_IntVector_Intrinsics_vec256_interleave_high32(x[0U], x[1U]);
+  Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_interleave_low32(x[2U], x[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  a3 = Lib_IntVector_Intrinsics_vec256_interleave_high32(x[2U], x[3U]);
+  Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_interleave_low32(x[4U], x[5U]);
+  Lib_IntVector_Intrinsics_vec256
+  a5 = Lib_IntVector_Intrinsics_vec256_interleave_high32(x[4U], x[5U]);
+  Lib_IntVector_Intrinsics_vec256 a6 = Lib_IntVector_Intrinsics_vec256_interleave_low32(x[6U], x[7U]);
+  Lib_IntVector_Intrinsics_vec256
+  a7 = Lib_IntVector_Intrinsics_vec256_interleave_high32(x[6U], x[7U]);
+  Lib_IntVector_Intrinsics_vec256 b0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(a0, a2);
+  Lib_IntVector_Intrinsics_vec256 b2 = Lib_IntVector_Intrinsics_vec256_interleave_high64(a0, a2);
+  Lib_IntVector_Intrinsics_vec256 b1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(a1, a3);
+  Lib_IntVector_Intrinsics_vec256 b3 = Lib_IntVector_Intrinsics_vec256_interleave_high64(a1, a3);
+  Lib_IntVector_Intrinsics_vec256 b4 = Lib_IntVector_Intrinsics_vec256_interleave_low64(a4, a6);
+  Lib_IntVector_Intrinsics_vec256 b6 = Lib_IntVector_Intrinsics_vec256_interleave_high64(a4, a6);
+  Lib_IntVector_Intrinsics_vec256 b5 = Lib_IntVector_Intrinsics_vec256_interleave_low64(a5, a7);
+  Lib_IntVector_Intrinsics_vec256 b7 = Lib_IntVector_Intrinsics_vec256_interleave_high64(a5, a7);
+  x[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b0, b4);
+  x[4U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b0, b4);
+  x[2U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b1, b5);
+  x[6U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b1, b5);
+  x[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b2, b6);
+  x[5U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b2, b6);
+  x[3U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b3, b7);
+  x[7U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b3, b7);
+}
+
+/* Eight ChaCha20 blocks under the same key, lane i with nonce n[i] and block
+   counter ctr[i], written to out + 64 * i. */
+static void chacha20_blocks8(uint8_t *out, uint8_t *k, uint8_t **n, uint32_t *ctr)
+{
+  Lib_IntVector_Intrinsics_vec256 st[16U];
+  st[0U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x61707865U);
+  st[1U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x3320646eU);
+  st[2U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x79622d32U);
+  st[3U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x6b206574U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[(uint32_t)4U + i] = Lib_IntVector_Intrinsics_vec256_load32(load32_le(k + (uint32_t)4U * i));
+  }
+  st[12U] =
+    Lib_IntVector_Intrinsics_vec256_load32s(ctr[0U],
+      ctr[1U],
+      ctr[2U],
+      ctr[3U],
+      ctr[4U],
+      ctr[5U],
+      ctr[6U],
+      ctr[7U]);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)3U; i++)
+  {
+    uint32_t o = (uint32_t)4U * i;
+    st[(uint32_t)13U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(n[0U] + o),
+        load32_le(n[1U] + o),
+        load32_le(n[2U] + o),
+        load32_le(n[3U] + o),
+        load32_le(n[4U] + o),
+        load32_le(n[5U] + o),
+        load32_le(n[6U] + o),
+        load32_le(n[7U] + o));
+  }
+  Lib_IntVector_Intrinsics_vec256 x[16U];
+  memcpy(x, st, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    quarter_round8(x, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U);
+    quarter_round8(x, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U);
+    quarter_round8(x, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U);
+    quarter_round8(x, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U);
+    quarter_round8(x, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U);
+    quarter_round8(x, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U);
+    quarter_round8(x, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U);
+    quarter_round8(x, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    x[i] = Lib_IntVector_Intrinsics_vec256_add32(x[i], st[i]);
+  }
+  transpose8(x);
+  transpose8(x + (uint32_t)8U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le(out + (uint32_t)64U * i, x[i]);
+    Lib_IntVector_Intrinsics_vec256_store32_le(out + (uint32_t)64U * i + (uint32_t)32U,
+      x[(uint32_t)8U + i]);
+  }
+}
+
+/* Up to eight pending keystream blocks, possibly from different packets. A block
+   with a NULL source is copied out as is (a Poly1305 key); otherwise it is
+   XORed with len bytes of source into the destination. */
+typedef struct blocks8_s
+{
+  uint8_t *k;
+  uint32_t len;
+  uint8_t *n[8U];
+  uint32_t ctr[8U];
+  uint8_t *src[8U];
+  uint8_t *dst[8U];
+  uint32_t dst_len[8U];
+}
+blocks8;
+
+static void flush_blocks8(blocks8 *b)
+{
+  if (b->len == (uint32_t)0U)
+  {
+    return;
+  }
+  for (uint32_t i = b->len; i < (uint32_t)8U; i++)
+  {
+    b->n[i] = b->n[0U];
+    b->ctr[i] = b->ctr[0U];
+  }
+  uint8_t ks[512U];
+  chacha20_blocks8(ks, b->k, b->n, b->ctr);
+  for (uint32_t i = (uint32_t)0U; i < b->len; i++)
+  {
+    uint8_t *ksi = ks + (uint32_t)64U * i;
+    uint8_t *src = b->src[i];
+    uint8_t *dst = b->dst[i];
+    uint32_t len = b->dst_len[i];
+    if (src == NULL)
+    {
+      memcpy(dst, ksi, len * sizeof (uint8_t));
+    }
+    else if (len == (uint32_t)64U)
+    {
+      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_load32_le(src);
+      Lib_IntVector_Intrinsics_vec256
+      x1 = Lib_IntVector_Intrinsics_vec256_load32_le(src + (uint32_t)32U);
+      Lib_IntVector_Intrinsics_vec256 k0 = Lib_IntVector_Intrinsics_vec256_load32_le(ksi);
+      Lib_IntVector_Intrinsics_vec256
+      k1 = Lib_IntVector_Intrinsics_vec256_load32_le(ksi + (uint32_t)32U);
+      Lib_IntVector_Intrinsics_vec256_store32_le(dst, Lib_IntVector_Intrinsics_vec256_xor(x0, k0));
+      Lib_IntVector_Intrinsics_vec256_store32_le(dst + (uint32_t)32U,
+        Lib_IntVector_Intrinsics_vec256_xor(x1, k1));
+    }
+    else
+    {
+      for (uint32_t j = (uint32_t)0U; j < len; j++)
+      {
+        dst[j] = src[j] ^ ksi[j];
+      }
+    }
+  }
+  b->len = (uint32_t)0U;
+}
+
+static void
+push_block8(blocks8 *b, uint8_t *n, uint32_t ctr, uint8_t *src, uint8_t *dst, uint32_t len)
+{
+  uint32_t i = b->len;
+  b->n[i] = n;
+  b->ctr[i] = ctr;
+  b->src[i] = src;
+  b->dst[i] = dst;
+  b->dst_len[i] = len;
+  b->len = i + (uint32_t)1U;
+  if (b->len == (uint32_t)8U)
+  {
+    flush_blocks8(b);
+  }
+}
+
+/* Queues the keystream blocks, from counter 1, that turn len bytes of src into
+   dst. */
+static void push_packet8(blocks8 *b, uint8_t *n, uint32_t len, uint8_t *src, uint8_t *dst)
+{
+  for (uint32_t i = (uint32_t)0U; (uint32_t)64U * i < len; i++)
+  {
+    uint32_t o = (uint32_t)64U * i;
+    uint32_t l = len - o < (uint32_t)64U ? len - o : (uint32_t)64U;
+    push_block8(b, n, i + (uint32_t)1U, src + o, dst + o, l);
+  }
+}
+
+/* One packet's Poly1305 input, pad16(aad) || pad16(cipher) || lengths, seen as
+   a sequence of 16-byte blocks. */
+static uint8_t
+*poly1305_block(
+  uint8_t *pad,
+  uint8_t *lengths,
+  uint32_t i,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *cipher
+)
+{
+  uint32_t na = (aadlen + (uint32_t)15U) / (uint32_t)16U;
+  uint32_t nc = (mlen + (uint32_t)15U) / (uint32_t)16U;
+  uint8_t *seg;
+  uint32_t seg_len;
+  uint32_t o;
+  if (i < na)
+  {
+    seg = aad;
+    seg_len = aadlen;
+    o = (uint32_t)16U * i;
+  }
+  else if (i < na + nc)
+  {
+    seg = cipher;
+    seg_len = mlen;
+    o = (uint32_t)16U * (i - na);
+  }
+  else
+  {
+    return lengths;
+  }
+  if (seg_len - o >= (uint32_t)16U)
+  {
+    return seg + o;
+  }
+  memset(pad, 0U, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(pad, seg + o, (seg_len - o) * sizeof (uint8_t));
+  return pad;
+}
+
+/* Fully reduces the 26-bit limbs a of an accumulator and adds s. */
+static void poly1305_finish1(uint8_t *tag, uint64_t *a, uint8_t *s)
+{
+  uint64_t m = (uint64_t)0x3ffffffU;
+  uint64_t h0 = a[0U];
+  uint64_t h1 = a[1U];
+  uint64_t h2 = a[2U];
+  uint64_t h3 = a[3U];
+  uint64_t h4 = a[4U];
+  h1 = h1 + (h0 >> (uint32_t)26U);
+  h0 = h0 & m;
+  h2 = h2 + (h1 >> (uint32_t)26U);
+  h1 = h1 & m;
+  h3 = h3 + (h2 >> (uint32_t)26U);
+  h2 = h2 & m;
+  h4 = h4 + (h3 >> (uint32_t)26U);
+  h3 = h3 & m;
+  h0 = h0 + (h4 >> (uint32_t)26U) * (uint64_t)5U;
+  h4 = h4 & m;
+  h1 = h1 + (h0 >> (uint32_t)26U);
+  h0 = h0 & m;
+  h2 = h2 + (h1 >> (uint32_t)26U);
+  h1 = h1 & m;
+  h3 = h3 + (h2 >> (uint32_t)26U);
+  h2 = h2 & m;
+  h4 = h4 + (h3 >> (uint32_t)26U);
+  h3 = h3 & m;
+  uint64_t g0 = h0 + (uint64_t)5U;
+  uint64_t g1 = h1 + (g0 >> (uint32_t)26U);
+  g0 = g0 & m;
+  uint64_t g2 = h2 + (g1 >> (uint32_t)26U);
+  g1 = g1 & m;
+  uint64_t g3 = h3 + (g2 >> (uint32_t)26U);
+  g2 = g2 & m;
+  uint64_t g4 = h4 + (g3 >> (uint32_t)26U) - ((uint64_t)1U << (uint32_t)26U);
+  g3 = g3 & m;
+  uint64_t mask = (g4 >> (uint32_t)63U) - (uint64_t)1U;
+  h0 = (h0 & ~mask) | (g0 & mask);
+  h1 = (h1 & ~mask) | (g1 & mask);
+  h2 = (h2 & ~mask) | (g2 & mask);
+  h3 = (h3 & ~mask) | (g3 & mask);
+  h4 = (h4 & ~mask) | (g4 & mask);
+  uint64_t lo = h0 | h1 << (uint32_t)26U | h2 << (uint32_t)52U;
+  uint64_t hi = h2 >> (uint32_t)12U | h3 << (uint32_t)14U | h4 << (uint32_t)40U;
+  uint64_t s0 = load64_le(s);
+  uint64_t s1 = load64_le(s + (uint32_t)8U);
+  uint64_t lo1 = lo + s0;
+  uint64_t hi1 = hi + s1 + (lo1 < s0);
+  store64_le(tag, lo1);
+  store64_le(tag + (uint32_t)8U, hi1);
+}
+
+/* Poly1305 tags of num packets, four at a time: every 64-bit lane keeps its own
+   accumulator and r, and takes the next packet as soon as its current one is
+   done. Packet j is p[j], with one-time key keys + 32 * j, and its tag goes to
+   tags + 16 * j. */
+static void
+poly1305_batch4(
+  uint32_t num,
+  uint32_t *p,
+  uint8_t *keys,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **cipher,
+  uint8_t *tags
+)
+{
+  uint32_t job[4U] = { 0U };
+  uint32_t blk[4U] = { 0U };
+  uint32_t nblk[4U] = { 0U };
+  bool busy[4U] = { false };
+  uint8_t pad[64U] = { 0U };
+  uint8_t lengths[64U] = { 0U };
+  uint8_t rs[320U] = { 0U };
+  uint8_t accs[160U] = { 0U };
+  uint64_t lanes[5U];
+  uint32_t next = (uint32_t)0U;
+  Lib_IntVector_Intrinsics_vec256 acc[5U];
+  Lib_IntVector_Intrinsics_vec256 r[10U];
+  bool refill = true;
+  while (true)
+  {
+    if (refill)
+    {
+      bool any = false;
+      for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+      {
+        if (!busy[l] && next < num)
+        {
+          uint32_t j = next;
+          uint32_t i = p[j];
+          next++;
+          uint8_t *key = keys + (uint32_t)32U * j;
+          uint64_t lo = load64_le(key) & (uint64_t)0x0ffffffc0fffffffU;
+          uint64_t hi = load64_le(key + (uint32_t)8U) & (uint64_t)0x0ffffffc0ffffffcU;
+          uint64_t rl[5U];
+          rl[0U] = lo & (uint64_t)0x3ffffffU;
+          rl[1U] = lo >> (uint32_t)26U & (uint64_t)0x3ffffffU;
+          rl[2U] = (lo >> (uint32_t)52U | hi << (uint32_t)12U) & (uint64_t)0x3ffffffU;
+          rl[3U] = hi >> (uint32_t)14U & (uint64_t)0x3ffffffU;
+          rl[4U] = hi >> (uint32_t)40U;
+          for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+          {
+            store64_le(rs + (uint32_t)32U * k + (uint32_t)8U * l, rl[k]);
+            store64_le(rs + (uint32_t)32U * (k + (uint32_t)5U) + (uint32_t)8U * l,
+              rl[k] * (uint64_t)5U);
+            store64_le(accs + (uint32_t)32U * k + (uint32_t)8U * l, (uint64_t)0U);
+          }
+          uint8_t *len_l = lengths + (uint32_t)16U * l;
+          store64_le(len_l, (uint64_t)aadlen[i]);
+          store64_le(len_l + (uint32_t)8U, (uint64_t)mlen[i]);
+          job[l] = j;
+          blk[l] = (uint32_t)0U;
+          nblk[l] =
+            (aadlen[i] + (uint32_t)15U)
+            / (uint32_t)16U
+            + (mlen[i] + (uint32_t)15U) / (uint32_t)16U
+            + (uint32_t)1U;
+          busy[l] = true;
+        }
+        any = any || busy[l];
+      }
+      if (!any)
+      {
+        return;
+      }
+      for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+      {
+        acc[k] = Lib_IntVector_Intrinsics_vec256_load64_le(accs + (uint32_t)32U * k);
+      }
+      for (uint32_t k = (uint32_t)0U; k < (uint32_t)10U; k++)
+      {
+        r[k] = Lib_IntVector_Intrinsics_vec256_load64_le(rs + (uint32_t)32U * k);
+      }
+      refill = false;
+    }
+    uint64_t lo[4U] = { 0U };
+    uint64_t hi[4U] = { 0U };
+    for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+    {
+      if (busy[l])
+      {
+        uint32_t i = p[job[l]];
+        uint8_t
+        *b =
+          poly1305_block(pad + (uint32_t)16U * l,
+            lengths + (uint32_t)16U * l,
+            blk[l],
+            aadlen[i],
+            aad[i],
+            mlen[i],
+            cipher[i]);
+        lo[l] = load64_le(b);
+        hi[l] = load64_le(b + (uint32_t)8U);
+      }
+    }
+    Lib_IntVector_Intrinsics_vec256
+    f0 = Lib_IntVector_Intrinsics_vec256_load64s(lo[0U], lo[1U], lo[2U], lo[3U]);
+    Lib_IntVector_Intrinsics_vec256
+    f1 = Lib_IntVector_Intrinsics_vec256_load64s(hi[0U], hi[1U], hi[2U], hi[3U]);
+    Lib_IntVector_Intrinsics_vec256
+    mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    e0 = Lib_IntVector_Intrinsics_vec256_and(f0, mask26);
+    Lib_IntVector_Intrinsics_vec256
+    e1 =
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f0,
+          (uint32_t)26U),
+        mask26);
+    Lib_IntVector_Intrinsics_vec256
+    e2 =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(f0,
+          (uint32_t)52U),
+        Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(f1,
+            Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffU)),
+          (uint32_t)12U));
+    Lib_IntVector_Intrinsics_vec256
+    e3 =
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f1,
+          (uint32_t)14U),
+        mask26);
+    Lib_IntVector_Intrinsics_vec256
+    e4 =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(f1,
+          (uint32_t)40U),
+        Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x1000000U));
+    Lib_IntVector_Intrinsics_vec256 h0 = Lib_IntVector_Intrinsics_vec256_add64(acc[0U], e0);
+    Lib_IntVector_Intrinsics_vec256 h1 = Lib_IntVector_Intrinsics_vec256_add64(acc[1U], e1);
+    Lib_IntVector_Intrinsics_vec256 h2 = Lib_IntVector_Intrinsics_vec256_add64(acc[2U], e2);
+    Lib_IntVector_Intrinsics_vec256 h3 = Lib_IntVector_Intrinsics_vec256_add64(acc[3U], e3);
+    Lib_IntVector_Intrinsics_vec256 h4 = Lib_IntVector_Intrinsics_vec256_add64(acc[4U], e4);
+    Lib_IntVector_Intrinsics_vec256 r0 = r[0U];
+    Lib_IntVector_Intrinsics_vec256 r1 = r[1U];
+    Lib_IntVector_Intrinsics_vec256 r2 = r[2U];
+    Lib_IntVector_Intrinsics_vec256 r3 = r[3U];
+    Lib_IntVector_Intrinsics_vec256 r4 = r[4U];
+    Lib_IntVector_Intrinsics_vec256 r51 = r[6U];
+    Lib_IntVector_Intrinsics_vec256 r52 = r[7U];
+    Lib_IntVector_Intrinsics_vec256 r53 = r[8U];
+    Lib_IntVector_Intrinsics_vec256 r54 = r[9U];
+    Lib_IntVector_Intrinsics_vec256
+    t0 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r0,
+              h0),
+            Lib_IntVector_Intrinsics_vec256_mul64(r54, h1)),
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r53, h2),
+            Lib_IntVector_Intrinsics_vec256_mul64(r52, h3))),
+        Lib_IntVector_Intrinsics_vec256_mul64(r51, h4));
+    Lib_IntVector_Intrinsics_vec256
+    t1 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r1,
+              h0),
+            Lib_IntVector_Intrinsics_vec256_mul64(r0, h1)),
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r54, h2),
+            Lib_IntVector_Intrinsics_vec256_mul64(r53, h3))),
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, h4));
+    Lib_IntVector_Intrinsics_vec256
+    t2 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r2,
+              h0),
+            Lib_IntVector_Intrinsics_vec256_mul64(r1, h1)),
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r0, h2),
+            Lib_IntVector_Intrinsics_vec256_mul64(r54, h3))),
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, h4));
+    Lib_IntVector_Intrinsics_vec256
+    t3 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r3,
+              h0),
+            Lib_IntVector_Intrinsics_vec256_mul64(r2, h1)),
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r1, h2),
+            Lib_IntVector_Intrinsics_vec256_mul64(r0, h3))),
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, h4));
+    Lib_IntVector_Intrinsics_vec256
+    t4 =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r4,
+              h0),
+            Lib_IntVector_Intrinsics_vec256_mul64(r3, h1)),
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_mul64(r2, h2),
+            Lib_IntVector_Intrinsics_vec256_mul64(r1, h3))),
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, h4));
+    Lib_IntVector_Intrinsics_vec256
+    z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t0, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t0, mask26);
+    Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
+    Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec256
+    z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z12 =
+      Lib_IntVector_Intrinsics_vec256_add64(z11,
+        Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U));
+    Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec256
+    z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec256
+    z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+    acc[0U] = x02;
+    acc[1U] = x12;
+    acc[2U] = x21;
+    acc[3U] = x32;
+    acc[4U] = x42;
+    for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+    {
+      if (busy[l])
+      {
+        blk[l]++;
+        if (blk[l] == nblk[l])
+        {
+          if (!refill)
+          {
+            for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+            {
+              Lib_IntVector_Intrinsics_vec256_store64_le(accs + (uint32_t)32U * k, acc[k]);
+            }
+          }
+          for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+          {
+            lanes[k] = load64_le(accs + (uint32_t)32U * k + (uint32_t)8U * l);
+          }
+          uint32_t j = job[l];
+          poly1305_finish1(tags + (uint32_t)16U * j,
+            lanes,
+            keys + (uint32_t)32U * j + (uint32_t)16U);
+          busy[l] = false;
+          refill = true;
+        }
+      }
+    }
+  }
+}
+
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_batch(
+  uint8_t *k,
+  uint32_t num,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac
+)
+{
+  uint8_t keys[512U] = { 0U };
+  uint8_t tags[256U] = { 0U };
+  uint32_t p[16U] = { 0U };
+  for (uint32_t start = (uint32_t)0U; start < num; start = start + batch_chunk)
+  {
+    uint32_t chunk = num - start < batch_chunk ? num - start : batch_chunk;
+    blocks8 b = { .k = k, .len = (uint32_t)0U };
+    uint32_t cnt = (uint32_t)0U;
+    for (uint32_t i0 = (uint32_t)0U; i0 < chunk; i0++)
+    {
+      uint32_t i = start + i0;
+      if (mlen[i] > batch_max_len)
+      {
+        Hacl_Chacha20Poly1305_256_aead_encrypt(k,
+          n[i],
+          aadlen[i],
+          aad[i],
+          mlen[i],
+          m[i],
+          cipher[i],
+          mac[i]);
+      }
+      else
+      {
+        p[cnt] = i;
+        push_block8(&b, n[i], (uint32_t)0U, NULL, keys + (uint32_t)32U * cnt, (uint32_t)32U);
+        push_packet8(&b, n[i], mlen[i], m[i], cipher[i]);
+        cnt++;
+      }
+    }
+    flush_blocks8(&b);
+    poly1305_batch4(cnt, p, keys, aadlen, aad, mlen, cipher, tags);
+    for (uint32_t j = (uint32_t)0U; j < cnt; j++)
+    {
+      memcpy(mac[p[j]], tags + (uint32_t)16U * j, (uint32_t)16U * sizeof (uint8_t));
+    }
+  }
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_256_aead_decrypt_batch(
+  uint8_t *k,
+  uint32_t num,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac,
+  uint32_t *res
+)
+{
+  uint8_t keys[512U] = { 0U };
+  uint8_t tags[256U] = { 0U };
+  uint32_t p[16U] = { 0U };
+  uint32_t failed = (uint32_t)0U;
+  for (uint32_t start = (uint32_t)0U; start < num; start = start + batch_chunk)
+  {
+    uint32_t chunk = num - start < batch_chunk ? num - start : batch_chunk;
+    blocks8 b = { .k = k, .len = (uint32_t)0U };
+    uint32_t cnt = (uint32_t)0U;
+    for (uint32_t i0 = (uint32_t)0U; i0 < chunk; i0++)
+    {
+      uint32_t i = start + i0;
+      if (mlen[i] > batch_max_len)
+      {
+        res[i] =
+          Hacl_Chacha20Poly1305_256_aead_decrypt(k,
+            n[i],
+            aadlen[i],
+            aad[i],
+            mlen[i],
+            m[i],
+            cipher[i],
+            mac[i]);
+        failed = failed | res[i];
+      }
+      else
+      {
+        p[cnt] = i;
+        push_block8(&b, n[i], (uint32_t)0U, NULL, keys + (uint32_t)32U * cnt, (uint32_t)32U);
+        cnt++;
+      }
+    }
+    flush_blocks8(&b);
+    poly1305_batch4(cnt, p, keys, aadlen, aad, mlen, cipher, tags);
+    for (uint32_t j = (uint32_t)0U; j < cnt; j++)
+    {
+      uint32_t i = p[j];
+      uint8_t ok = (uint8_t)255U;
+      for (uint32_t l = (uint32_t)0U; l < (uint32_t)16U; l++)
+      {
+        ok = FStar_UInt8_eq_mask(tags[(uint32_t)16U * j + l], mac[i][l]) & ok;
+      }
+      if (ok == (uint8_t)255U)
+      {
+        res[i] = (uint32_t)0U;
+        push_packet8(&b, n[i], mlen[i], cipher[i], m[i]);
+      }
+      else
+      {
+        res[i] = (uint32_t)1U;
+        failed = (uint32_t)1U;
+      }
+    }
+    flush_blocks8(&b);
+  }
+  return failed;
+}
+
+/* The keystream runs on across segment boundaries: whole runs of eight blocks go
+   straight through the vector core, and the run straddling a boundary is
+   kept in block for the next segment, so that a boundary costs one call to the
+   core and no more. */
+static void
+chacha20_iov_256(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t in_num,
+  uint32_t *in_len,
+  uint8_t **in,
+  uint32_t out_num,
+  uint32_t *out_len,
+  uint8_t **out
+)
+{
+  uint8_t block[512U] = { 0U };
+  uint32_t used = (uint32_t)512U;
+  uint32_t ctr = (uint32_t)1U;
+  uint32_t i = (uint32_t)0U;
+  uint32_t i_off = (uint32_t)0U;
+  uint32_t o = (uint32_t)0U;
+  uint32_t o_off = (uint32_t)0U;
+  while (i < in_num && o < out_num)
+  {
+    if (i_off == in_len[i])
+    {
+      i++;
+      i_off = (uint32_t)0U;
+      continue;
+    }
+    if (o_off == out_len[o])
+    {
+      o++;
+      o_off = (uint32_t)0U;
+      continue;
+    }
+    uint32_t in_rem = in_len[i] - i_off;
+    uint32_t out_rem = out_len[o] - o_off;
+    uint32_t len = in_rem < out_rem ? in_rem : out_rem;
+    uint8_t *src = in[i] + i_off;
+    uint8_t *dst = out[o] + o_off;
+    i_off = i_off + len;
+    o_off = o_off + len;
+    if (used < (uint32_t)512U)
+    {
+      uint32_t l = (uint32_t)512U - used < len ? (uint32_t)512U - used : len;
+      for (uint32_t j = (uint32_t)0U; j < l; j++)
+      {
+        dst[j] = src[j] ^ block[used + j];
+      }
+      used = used + l;
+      src = src + l;
+      dst = dst + l;
+      len = len - l;
+    }
+    uint32_t full = len / (uint32_t)512U * (uint32_t)512U;
+    if (full > (uint32_t)0U)
+    {
+      Hacl_Chacha20_Vec256_chacha20_encrypt_256(full, dst, src, k, n, ctr);
+      ctr = ctr + full / (uint32_t)64U;
+    }
+    src = src + full;
+    dst = dst + full;
+    uint32_t rem = len - full;
+    if (rem > (uint32_t)0U)
+    {
+      memset(block, 0U, (uint32_t)512U * sizeof (uint8_t));
+      Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)512U, block, block, k, n, ctr);
+      ctr = ctr + (uint32_t)8U;
+      for (uint32_t j = (uint32_t)0U; j < rem; j++)
+      {
+        dst[j] = src[j] ^ block[j];
+      }
+      used = rem;
+    }
+  }
+}
+
+/* The Poly1305 input of an AEAD, fed segment by segment: whole chunks of four
+   blocks go through the four-way loop of poly1305_padded_256 straight from the
+   segments, chunks that straddle a boundary are gathered in chunk, and the
+   accumulator is only brought back into one lane at the end. */
+typedef struct mac_256_s
+{
+  Lib_IntVector_Intrinsics_vec256 *ctx;
+  bool lanes;
+  uint32_t used;
+  uint8_t chunk[64U];
+}
+mac_256;
+
+static void mac_chunk_256(mac_256 *m, uint8_t *text)
+{
+  if (m->lanes)
+  {
+    poly1305_blocks4_256(m->ctx, text);
+  }
+  else
+  {
+    Hacl_Impl_Poly1305_Field32xN_256_load_acc4(m->ctx, text);
+    m->lanes = true;
+  }
+}
+
+static void mac_absorb_256(mac_256 *m, uint32_t len, uint8_t *text)
+{
+  if (m->used > (uint32_t)0U)
+  {
+    uint32_t c = (uint32_t)64U - m->used < len ? (uint32_t)64U - m->used : len;
+    memcpy(m->chunk + m->used, text, c * sizeof (uint8_t));
+    m->used = m->used + c;
+    text = text + c;
+    len = len - c;
+    if (m->used == (uint32_t)64U)
+    {
+      mac_chunk_256(m, m->chunk);
+      m->used = (uint32_t)0U;
+    }
+  }
+  uint32_t nb = len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    mac_chunk_256(m, text + i * (uint32_t)64U);
+  }
+  uint32_t rem = len - nb * (uint32_t)64U;
+  memcpy(m->chunk + m->used, text + nb * (uint32_t)64U, rem * sizeof (uint8_t));
+  m->used = m->used + rem;
+}
+
+/* Zero-pads what has been absorbed so far to a multiple of 16 bytes. */
+static void mac_pad_256(mac_256 *m)
+{
+  uint32_t r = m->used % (uint32_t)16U;
+  if (r > (uint32_t)0U)
+  {
+    memset(m->chunk + m->used, 0U, ((uint32_t)16U - r) * sizeof (uint8_t));
+    m->used = m->used + (uint32_t)16U - r;
+    if (m->used == (uint32_t)64U)
+    {
+      mac_chunk_256(m, m->chunk);
+      m->used = (uint32_t)0U;
+    }
+  }
+}
+
+static uint64_t total_len(uint32_t num, uint32_t *len)
+{
+  uint64_t total = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    total = total + (uint64_t)len[i];
+  }
+  return total;
+}
+
+static void
+poly1305_do_iov_256(
+  uint8_t *k,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t c_num,
+  uint32_t *clen,
+  uint8_t **c,
+  uint8_t *out
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t block[16U] = { 0U };
+  Hacl_Poly1305_256_poly1305_init(ctx, k);
+  mac_256 m = { .ctx = ctx, .lanes = false, .used = (uint32_t)0U };
+  for (uint32_t i = (uint32_t)0U; i < aad_num; i++)
+  {
+    mac_absorb_256(&m, aadlen[i], aad[i]);
+  }
+  mac_pad_256(&m);
+  for (uint32_t i = (uint32_t)0U; i < c_num; i++)
+  {
+    mac_absorb_256(&m, clen[i], c[i]);
+  }
+  mac_pad_256(&m);
+  store64_le(block, total_len(aad_num, aadlen));
+  store64_le(block + (uint32_t)8U, total_len(c_num, clen));
+  mac_absorb_256(&m, (uint32_t)16U, block);
+  if (m.lanes)
+  {
+    Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(ctx, ctx + (uint32_t)5U);
+  }
+  poly1305_padded_256(ctx, m.used, m.chunk);
+  Hacl_Poly1305_256_poly1305_finish(out, k, ctx);
+}
+
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+)
+{
+  chacha20_iov_256(k, n, m_num, mlen, m, cipher_num, cipher_len, cipher);
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_iov_256(key, aad_num, aadlen, aad, cipher_num, cipher_len, cipher, mac);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_256_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+)
+{
+  uint8_t computed_mac[16U] = { 0U };
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_iov_256(key, aad_num, aadlen, aad, cipher_num, cipher_len, cipher, computed_mac);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_mac[i], mac[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    chacha20_iov_256(k, n, cipher_num, cipher_len, cipher, m_num, mlen, m);
+    return (uint32_t)0U;
+  }
+  return (uint32_t)1U;
+}
+
@@ -599,3 +599,215 @@ Hacl_Chacha20Poly1305_32_aead_decrypt(
   return (uint32_t)1U;
 }
 
+/* The keystream runs on across segment boundaries: the block straddling a
+   boundary is kept in block for the next segment. */
+static void
+chacha20_iov_32(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t in_num,
+  uint32_t *in_len,
+  uint8_t **in,
+  uint32_t out_num,
+  uint32_t *out_len,
+  uint8_t **out
+)
+{
+  uint8_t block[64U] = { 0U };
+  uint32_t used = (uint32_t)64U;
+  uint32_t ctr = (uint32_t)1U;
+  uint32_t i = (uint32_t)0U;
+  uint32_t i_off = (uint32_t)0U;
+  uint32_t o = (uint32_t)0U;
+  uint32_t o_off = (uint32_t)0U;
+  while (i < in_num && o < out_num)
+  {
+    if (i_off == in_len[i])
+    {
+      i++;
+      i_off = (uint32_t)0U;
+      continue;
+    }
+    if (o_off == out_len[o])
+    {
+      o++;
+      o_off = (uint32_t)0U;
+      continue;
+    }
+    uint32_t in_rem = in_len[i] - i_off;
+    uint32_t out_rem = out_len[o] - o_off;
+    uint32_t len = in_rem < out_rem ? in_rem : out_rem;
+    uint8_t *src = in[i] + i_off;
+    uint8_t *dst = out[o] + o_off;
+    i_off = i_off + len;
+    o_off = o_off + len;
+    if (used < (uint32_t)64U)
+    {
+      uint32_t l = (uint32_t)64U - used < len ? (uint32_t)64U - used : len;
+      for (uint32_t j = (uint32_t)0U; j < l; j++)
+      {
+        dst[j] = src[j] ^ block[used + j];
+      }
+      used = used + l;
+      src = src + l;
+      dst = dst + l;
+      len = len - l;
+    }
+    uint32_t full = len / (uint32_t)64U * (uint32_t)64U;
+    if (full > (uint32_t)0U)
+    {
+      Hacl_Chacha20_chacha20_encrypt(full, dst, src, k, n, ctr);
+      ctr = ctr + full / (uint32_t)64U;
+    }
+    src = src + full;
+    dst = dst + full;
+    uint32_t rem = len - full;
+    if (rem > (uint32_t)0U)
+    {
+      memset(block, 0U, (uint32_t)64U * sizeof (uint8_t));
+      Hacl_Chacha20_chacha20_encrypt((uint32_t)64U, block, block, k, n, ctr);
+      ctr++;
+      for (uint32_t j = (uint32_t)0U; j < rem; j++)
+      {
+        dst[j] = src[j] ^ block[j];
+      }
+      used = rem;
+    }
+  }
+}
+
+/* Feeds the concatenation of num segments to ctx, zero-padded to a multiple of
+   16 bytes; only the blocks that straddle a segment boundary are copied. */
+static void
+poly1305_padded_iov_32(
+  uint64_t *ctx,
+  uint32_t num,
+  uint32_t *len,
+  uint8_t **text
+)
+{
+  uint8_t block[16U] = { 0U };
+  uint32_t used = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    uint8_t *t = text[i];
+    uint32_t l = len[i];
+    if (used > (uint32_t)0U)
+    {
+      uint32_t c = (uint32_t)16U - used < l ? (uint32_t)16U - used : l;
+      memcpy(block + used, t, c * sizeof (uint8_t));
+      used = used + c;
+      t = t + c;
+      l = l - c;
+      if (used == (uint32_t)16U)
+      {
+        Hacl_Poly1305_32_poly1305_update1(ctx, block);
+        used = (uint32_t)0U;
+      }
+    }
+    uint32_t full = l / (uint32_t)16U * (uint32_t)16U;
+    if (full > (uint32_t)0U)
+    {
+      poly1305_padded_32(ctx, full, t);
+    }
+    memcpy(block + used, t + full, (l - full) * sizeof (uint8_t));
+    used = used + l - full;
+  }
+  if (used > (uint32_t)0U)
+  {
+    poly1305_padded_32(ctx, used, block);
+  }
+}
+
+static uint64_t total_len(uint32_t num, uint32_t *len)
+{
+  uint64_t total = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    total = total + (uint64_t)len[i];
+  }
+  return total;
+}
+
+static void
+poly1305_do_iov_32(
+  uint8_t *k,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t c_num,
+  uint32_t *clen,
+  uint8_t **c,
+  uint8_t *out
+)
+{
+  uint64_t ctx[25U] = { 0U };
+  uint8_t block[16U] = { 0U };
+  Hacl_Poly1305_32_poly1305_init(ctx, k);
+  poly1305_padded_iov_32(ctx, aad_num, aadlen, aad);
+  poly1305_padded_iov_32(ctx, c_num, clen, c);
+  store64_le(block, total_len(aad_num, aadlen));
+  store64_le(block + (uint32_t)8U, total_len(c_num, clen));
+  Hacl_Poly1305_32_poly1305_update1(ctx, block);
+  Hacl_Poly1305_32_poly1305_finish(out, k, ctx);
+}
+
+void
+Hacl_Chacha20Poly1305_32_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+)
+{
+  chacha20_iov_32(k, n, m_num, mlen, m, cipher_num, cipher_len, cipher);
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_chacha20_encrypt((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_iov_32(key, aad_num, aadlen, aad, cipher_num, cipher_len, cipher, mac);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_32_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+)
+{
+  uint8_t computed_mac[16U] = { 0U };
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_chacha20_encrypt((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_iov_32(key, aad_num, aadlen, aad, cipher_num, cipher_len, cipher, computed_mac);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_mac[i], mac[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    chacha20_iov_32(k, n, cipher_num, cipher_len, cipher, m_num, mlen, m);
+    return (uint32_t)0U;
+  }
+  return (uint32_t)1U;
+}
+
@@ -40,6 +40,9 @@ extern "C" {
 #include "Hacl_Chacha20.h"
 #include "evercrypt_targetconfig.h"
 #include "libintvector.h"
+/*
+  cipher may be equal to m, to encrypt in place.
+*/
 void
 Hacl_Chacha20Poly1305_32_aead_encrypt(
   uint8_t *k,
@@ -52,6 +55,10 @@ Hacl_Chacha20Poly1305_32_aead_encrypt(
   uint8_t *mac
 );
 
+/*
+  Returns 0 and writes the plaintext to m, which may be equal to cipher, if mac
+  authenticates the message; returns 1 and leaves m untouched otherwise.
+*/
 uint32_t
 Hacl_Chacha20Poly1305_32_aead_decrypt(
   uint8_t *k,
@@ -64,6 +71,50 @@ Hacl_Chacha20Poly1305_32_aead_decrypt(
   uint8_t *mac
 );
 
+/*
+  Encrypt as Hacl_Chacha20Poly1305_32_aead_encrypt does, but with the aad, the
+  plaintext and the ciphertext each given as a list of segments: the aad is the
+  concatenation of the aad_num segments aad[i] of aadlen[i] bytes, and so on.
+  The plaintext and ciphertext segments may be cut at different places but must
+  add up to the same length. Nothing is gathered into a contiguous buffer.
+*/
+void
+Hacl_Chacha20Poly1305_32_aead_encrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+);
+
+/*
+  Decrypt the cipher_num segments of cipher into the m_num segments of m, as
+  Hacl_Chacha20Poly1305_32_aead_decrypt does: the mac is checked over the
+  segments first, and m is only written if it matches.
+*/
+uint32_t
+Hacl_Chacha20Poly1305_32_aead_decrypt_iov(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aad_num,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t m_num,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint32_t cipher_num,
+  uint32_t *cipher_len,
+  uint8_t **cipher,
+  uint8_t *mac
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -39,7 +39,7 @@ uint32_t Hacl_Frodo64_crypto_secretkeybytes = (uint32_t)2032U;
 
 uint32_t Hacl_Frodo64_crypto_ciphertextbytes = (uint32_t)1080U;
 
-uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+static uint32_t crypto_kem_keypair(bool vec256, uint8_t *pk, uint8_t *sk)
 {
   uint8_t coins[48U] = { 0U };
   randombytes_((uint32_t)48U, coins);
@@ -66,6 +66,7 @@ uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   uint16_t b_matrix[512U] = { 0U };
   uint16_t a_matrix[4096U] = { 0U };
   Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+    vec256,
     (uint32_t)64U,
     seed_a,
     a_matrix);
@@ -89,7 +90,7 @@ uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+static uint32_t crypto_kem_enc(bool vec256, uint8_t *ct, uint8_t *ss, uint8_t *pk)
 {
   uint8_t coins[16U] = { 0U };
   randombytes_((uint32_t)16U, coins);
@@ -125,6 +126,7 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint16_t bp_matrix[512U] = { 0U };
   uint16_t a_matrix[4096U] = { 0U };
   Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+    vec256,
     (uint32_t)64U,
     seed_a,
     a_matrix);
@@ -172,7 +174,7 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+static uint32_t crypto_kem_dec(bool vec256, uint8_t *ss, uint8_t *ct, uint8_t *sk)
 {
   uint16_t bp_matrix[512U] = { 0U };
   uint16_t c_matrix[64U] = { 0U };
@@ -236,6 +238,7 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *b = pk + (uint32_t)16U;
   uint16_t a_matrix[4096U] = { 0U };
   Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+    vec256,
     (uint32_t)64U,
     seed_a,
     a_matrix);
@@ -294,3 +297,33 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return (uint32_t)0U;
 }
 
+uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  return crypto_kem_keypair(false, pk, sk);
+}
+
+uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return crypto_kem_enc(false, ct, ss, pk);
+}
+
+uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return crypto_kem_dec(false, ss, ct, sk);
+}
+
+uint32_t Hacl_Frodo64_crypto_kem_keypair_vec256(uint8_t *pk, uint8_t *sk)
+{
+  return crypto_kem_keypair(true, pk, sk);
+}
+
+uint32_t Hacl_Frodo64_crypto_kem_enc_vec256(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return crypto_kem_enc(true, ct, ss, pk);
+}
+
+uint32_t Hacl_Frodo64_crypto_kem_dec_vec256(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return crypto_kem_dec(true, ss, ct, sk);
+}
+
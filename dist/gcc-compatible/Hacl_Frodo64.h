@@ -60,6 +60,16 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk);
 
 uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk);
 
+/*
+  FrodoKEM-64 with A (64 x 64) expanded from seedA in 16 calls to
+  Hacl_SHA3_Vec256_shake128_4x, four rows each (see EverCrypt_AutoConfig2_has_vec256).
+*/
+uint32_t Hacl_Frodo64_crypto_kem_keypair_vec256(uint8_t *pk, uint8_t *sk);
+
+uint32_t Hacl_Frodo64_crypto_kem_enc_vec256(uint8_t *ct, uint8_t *ss, uint8_t *pk);
+
+uint32_t Hacl_Frodo64_crypto_kem_dec_vec256(uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -34,7 +34,7 @@ uint32_t Hacl_Frodo640_crypto_secretkeybytes = (uint32_t)19888U;
 
 uint32_t Hacl_Frodo640_crypto_ciphertextbytes = (uint32_t)9720U;
 
-uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+static uint32_t crypto_kem_keypair(bool vec256, uint8_t *pk, uint8_t *sk)
 {
   uint8_t coins[48U] = { 0U };
   randombytes_((uint32_t)48U, coins);
@@ -61,6 +61,7 @@ uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   uint16_t b_matrix[5120U] = { 0U };
   uint16_t a_matrix[409600U] = { 0U };
   Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+    vec256,
     (uint32_t)640U,
     seed_a,
     a_matrix);
@@ -88,7 +89,7 @@ uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+static uint32_t crypto_kem_enc(bool vec256, uint8_t *ct, uint8_t *ss, uint8_t *pk)
 {
   uint8_t coins[16U] = { 0U };
   randombytes_((uint32_t)16U, coins);
@@ -124,6 +125,7 @@ uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint16_t bp_matrix[5120U] = { 0U };
   uint16_t a_matrix[409600U] = { 0U };
   Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+    vec256,
     (uint32_t)640U,
     seed_a,
     a_matrix);
@@ -171,7 +173,7 @@ uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+static uint32_t crypto_kem_dec(bool vec256, uint8_t *ss, uint8_t *ct, uint8_t *sk)
 {
   uint16_t bp_matrix[5120U] = { 0U };
   uint16_t c_matrix[64U] = { 0U };
@@ -235,6 +237,7 @@ uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *b = pk + (uint32_t)16U;
   uint16_t a_matrix[409600U] = { 0U };
   Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+    vec256,
     (uint32_t)640U,
     seed_a,
     a_matrix);
@@ -293,3 +296,33 @@ uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return (uint32_t)0U;
 }
 
+uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  return crypto_kem_keypair(false, pk, sk);
+}
+
+uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return crypto_kem_enc(false, ct, ss, pk);
+}
+
+uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return crypto_kem_dec(false, ss, ct, sk);
+}
+
+uint32_t Hacl_Frodo640_crypto_kem_keypair_vec256(uint8_t *pk, uint8_t *sk)
+{
+  return crypto_kem_keypair(true, pk, sk);
+}
+
+uint32_t Hacl_Frodo640_crypto_kem_enc_vec256(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return crypto_kem_enc(true, ct, ss, pk);
+}
+
+uint32_t Hacl_Frodo640_crypto_kem_dec_vec256(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return crypto_kem_dec(true, ss, ct, sk);
+}
+
@@ -37,6 +37,7 @@ extern "C" {
 
 #include "Lib_RandomBuffer_System.h"
 #include "Hacl_Spec.h"
+#include "Hacl_SHA3_Vec256.h"
 #include "Hacl_SHA3.h"
 #include "Hacl_Krmllib.h"
 #include "evercrypt_targetconfig.h"
@@ -190,7 +191,12 @@ Hacl_Impl_Matrix_matrix_from_lbytes(uint32_t n1, uint32_t n2, uint8_t *b, uint16
 }
 
 static inline void
-Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_t *res)
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(
+  bool vec256,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *res
+)
 {
   KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * n);
   uint8_t r[(uint32_t)8U * n];
@@ -215,16 +221,34 @@ Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_
     store16_le(tmp_seed1, (uint16_t)((uint32_t)4U * i + (uint32_t)1U));
     store16_le(tmp_seed2, (uint16_t)((uint32_t)4U * i + (uint32_t)2U));
     store16_le(tmp_seed3, (uint16_t)((uint32_t)4U * i + (uint32_t)3U));
-    Hacl_Keccak_shake128_4x((uint32_t)18U,
-      tmp_seed0,
-      tmp_seed1,
-      tmp_seed2,
-      tmp_seed3,
-      (uint32_t)2U * n,
-      r0,
-      r1,
-      r2,
-      r3);
+    #if HACL_CAN_COMPILE_VEC256
+    if (vec256)
+    {
+      Hacl_SHA3_Vec256_shake128_4x((uint32_t)18U,
+        tmp_seed0,
+        tmp_seed1,
+        tmp_seed2,
+        tmp_seed3,
+        (uint32_t)2U * n,
+        r0,
+        r1,
+        r2,
+        r3);
+    }
+    else
+    #endif
+    {
+      Hacl_Keccak_shake128_4x((uint32_t)18U,
+        tmp_seed0,
+        tmp_seed1,
+        tmp_seed2,
+        tmp_seed3,
+        (uint32_t)2U * n,
+        r0,
+        r1,
+        r2,
+        r3);
+    }
     for (uint32_t i0 = (uint32_t)0U; i0 < n; i0++)
     {
       uint8_t *resij0 = r0 + i0 * (uint32_t)2U;
@@ -246,6 +270,7 @@ Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_
 static inline void
 Hacl_Impl_Frodo_Params_frodo_gen_matrix(
   Spec_Frodo_Params_frodo_gen_a a,
+  bool vec256,
   uint32_t n,
   uint8_t *seed,
   uint16_t *a_matrix
@@ -255,7 +280,7 @@ Hacl_Impl_Frodo_Params_frodo_gen_matrix(
   {
     case Spec_Frodo_Params_SHAKE128:
       {
-        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(n, seed, a_matrix);
+        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(vec256, n, seed, a_matrix);
         break;
       }
     default:
@@ -0,0 +1,166 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Gf128_CT64.h"
+
+/* The multiplication of BearSSL's ghash_ctmul64. Integer multiplications of
+   operands with holes of three zero bits between their bits cannot carry into the
+   bits that matter, which gives a 64x64 carry-less product from sixteen
+   multiplications and masks; the 128x128 product is then three of those on the
+   bit-reversed halves (Karatsuba), and its reduction is shifts and xors. */
+
+static inline uint64_t bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t x0 = x & (uint64_t)0x1111111111111111U;
+  uint64_t x1 = x & (uint64_t)0x2222222222222222U;
+  uint64_t x2 = x & (uint64_t)0x4444444444444444U;
+  uint64_t x3 = x & (uint64_t)0x8888888888888888U;
+  uint64_t y0 = y & (uint64_t)0x1111111111111111U;
+  uint64_t y1 = y & (uint64_t)0x2222222222222222U;
+  uint64_t y2 = y & (uint64_t)0x4444444444444444U;
+  uint64_t y3 = y & (uint64_t)0x8888888888888888U;
+  uint64_t z0 = (x0 * y0 ^ x1 * y3 ^ x2 * y2 ^ x3 * y1) & (uint64_t)0x1111111111111111U;
+  uint64_t z1 = (x0 * y1 ^ x1 * y0 ^ x2 * y3 ^ x3 * y2) & (uint64_t)0x2222222222222222U;
+  uint64_t z2 = (x0 * y2 ^ x1 * y1 ^ x2 * y0 ^ x3 * y3) & (uint64_t)0x4444444444444444U;
+  uint64_t z3 = (x0 * y3 ^ x1 * y2 ^ x2 * y1 ^ x3 * y0) & (uint64_t)0x8888888888888888U;
+  return z0 | z1 | z2 | z3;
+}
+
+static inline uint64_t rev64(uint64_t x)
+{
+  uint64_t
+  x1 =
+    (x & (uint64_t)0x5555555555555555U) << (uint32_t)1U
+    | (x >> (uint32_t)1U & (uint64_t)0x5555555555555555U);
+  uint64_t
+  x2 =
+    (x1 & (uint64_t)0x3333333333333333U) << (uint32_t)2U
+    | (x1 >> (uint32_t)2U & (uint64_t)0x3333333333333333U);
+  uint64_t
+  x3 =
+    (x2 & (uint64_t)0x0F0F0F0F0F0F0F0FU) << (uint32_t)4U
+    | (x2 >> (uint32_t)4U & (uint64_t)0x0F0F0F0F0F0F0F0FU);
+  uint64_t
+  x4 =
+    (x3 & (uint64_t)0x00FF00FF00FF00FFU) << (uint32_t)8U
+    | (x3 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU);
+  uint64_t
+  x5 =
+    (x4 & (uint64_t)0x0000FFFF0000FFFFU) << (uint32_t)16U
+    | (x4 >> (uint32_t)16U & (uint64_t)0x0000FFFF0000FFFFU);
+  return x5 << (uint32_t)32U | x5 >> (uint32_t)32U;
+}
+
+/* The accumulator ctx[0..2], low half first, times H. */
+static void gf128_mul_h(uint64_t *ctx)
+{
+  uint64_t y0 = ctx[0U];
+  uint64_t y1 = ctx[1U];
+  uint64_t h0 = ctx[2U];
+  uint64_t h1 = ctx[3U];
+  uint64_t h2 = ctx[4U];
+  uint64_t h0r = ctx[5U];
+  uint64_t h1r = ctx[6U];
+  uint64_t h2r = ctx[7U];
+  uint64_t y0r = rev64(y0);
+  uint64_t y1r = rev64(y1);
+  uint64_t y2 = y0 ^ y1;
+  uint64_t y2r = y0r ^ y1r;
+  uint64_t z0 = bmul64(y0, h0);
+  uint64_t z1 = bmul64(y1, h1);
+  uint64_t z2 = bmul64(y2, h2);
+  uint64_t z0h = bmul64(y0r, h0r);
+  uint64_t z1h = bmul64(y1r, h1r);
+  uint64_t z2h = bmul64(y2r, h2r);
+  z2 = z2 ^ z0 ^ z1;
+  z2h = z2h ^ z0h ^ z1h;
+  z0h = rev64(z0h) >> (uint32_t)1U;
+  z1h = rev64(z1h) >> (uint32_t)1U;
+  z2h = rev64(z2h) >> (uint32_t)1U;
+  uint64_t v0 = z0;
+  uint64_t v1 = z0h ^ z2;
+  uint64_t v2 = z1 ^ z2h;
+  uint64_t v3 = z1h;
+  v3 = v3 << (uint32_t)1U | v2 >> (uint32_t)63U;
+  v2 = v2 << (uint32_t)1U | v1 >> (uint32_t)63U;
+  v1 = v1 << (uint32_t)1U | v0 >> (uint32_t)63U;
+  v0 = v0 << (uint32_t)1U;
+  v2 = v2 ^ v0 ^ v0 >> (uint32_t)1U ^ v0 >> (uint32_t)2U ^ v0 >> (uint32_t)7U;
+  v1 = v1 ^ v0 << (uint32_t)63U ^ v0 << (uint32_t)62U ^ v0 << (uint32_t)57U;
+  v3 = v3 ^ v1 ^ v1 >> (uint32_t)1U ^ v1 >> (uint32_t)2U ^ v1 >> (uint32_t)7U;
+  v2 = v2 ^ v1 << (uint32_t)63U ^ v1 << (uint32_t)62U ^ v1 << (uint32_t)57U;
+  ctx[0U] = v2;
+  ctx[1U] = v3;
+}
+
+void Hacl_Gf128_CT64_gcm_init(uint64_t *ctx, uint8_t *key)
+{
+  uint64_t h1 = load64_be(key);
+  uint64_t h0 = load64_be(key + (uint32_t)8U);
+  uint64_t h0r = rev64(h0);
+  uint64_t h1r = rev64(h1);
+  ctx[0U] = (uint64_t)0U;
+  ctx[1U] = (uint64_t)0U;
+  ctx[2U] = h0;
+  ctx[3U] = h1;
+  ctx[4U] = h0 ^ h1;
+  ctx[5U] = h0r;
+  ctx[6U] = h1r;
+  ctx[7U] = h0r ^ h1r;
+}
+
+void Hacl_Gf128_CT64_gcm_update_blocks(uint64_t *ctx, uint32_t len, uint8_t *text)
+{
+  uint32_t nb = len / (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *b = text + i * (uint32_t)16U;
+    ctx[1U] = ctx[1U] ^ load64_be(b);
+    ctx[0U] = ctx[0U] ^ load64_be(b + (uint32_t)8U);
+    gf128_mul_h(ctx);
+  }
+  uint32_t last = len % (uint32_t)16U;
+  if (last > (uint32_t)0U)
+  {
+    uint8_t block[16U] = { 0U };
+    memcpy(block, text + nb * (uint32_t)16U, last * sizeof (uint8_t));
+    ctx[1U] = ctx[1U] ^ load64_be(block);
+    ctx[0U] = ctx[0U] ^ load64_be(block + (uint32_t)8U);
+    gf128_mul_h(ctx);
+  }
+}
+
+void Hacl_Gf128_CT64_gcm_emit(uint8_t *tag, uint64_t *ctx)
+{
+  store64_be(tag, ctx[1U]);
+  store64_be(tag + (uint32_t)8U, ctx[0U]);
+}
+
+void Hacl_Gf128_CT64_ghash(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  uint64_t ctx[8U] = { 0U };
+  Hacl_Gf128_CT64_gcm_init(ctx, key);
+  Hacl_Gf128_CT64_gcm_update_blocks(ctx, len, text);
+  Hacl_Gf128_CT64_gcm_emit(tag, ctx);
+}
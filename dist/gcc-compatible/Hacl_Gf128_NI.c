@@ -0,0 +1,176 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Gf128_NI.h"
+
+#include <wmmintrin.h>
+
+/* The 256-bit carry-less product of x and y, as lo and hi. */
+static inline void
+clmul_wide(
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y,
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo0 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x00U);
+  Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x10U);
+  Lib_IntVector_Intrinsics_vec128 m2 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x01U);
+  Lib_IntVector_Intrinsics_vec128 hi0 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x11U);
+  Lib_IntVector_Intrinsics_vec128 m = Lib_IntVector_Intrinsics_vec128_xor(m1, m2);
+  lo[0U] = Lib_IntVector_Intrinsics_vec128_xor(lo0, Lib_IntVector_Intrinsics_vec128_shift_left(m, (uint32_t)64U));
+  hi[0U] = Lib_IntVector_Intrinsics_vec128_xor(hi0, Lib_IntVector_Intrinsics_vec128_shift_right(m, (uint32_t)64U));
+}
+
+/* Reduces the byte-reversed 256-bit product hi:lo modulo x^128 + x^7 + x^2 + x + 1.
+   The bits of GCM field elements are reflected, so the product is first shifted
+   left by one bit. */
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_reduce(Lib_IntVector_Intrinsics_vec128 lo, Lib_IntVector_Intrinsics_vec128 hi)
+{
+  Lib_IntVector_Intrinsics_vec128 lo_c = Lib_IntVector_Intrinsics_vec128_shift_right32(lo, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 hi_c = Lib_IntVector_Intrinsics_vec128_shift_right32(hi, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 lo1 = Lib_IntVector_Intrinsics_vec128_shift_left32(lo, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 hi1 = Lib_IntVector_Intrinsics_vec128_shift_left32(hi, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 top = Lib_IntVector_Intrinsics_vec128_shift_right(lo_c, (uint32_t)96U);
+  lo1 = Lib_IntVector_Intrinsics_vec128_or(lo1, Lib_IntVector_Intrinsics_vec128_shift_left(lo_c, (uint32_t)32U));
+  hi1 = Lib_IntVector_Intrinsics_vec128_or(hi1, Lib_IntVector_Intrinsics_vec128_shift_left(hi_c, (uint32_t)32U));
+  hi1 = Lib_IntVector_Intrinsics_vec128_or(hi1, top);
+  Lib_IntVector_Intrinsics_vec128
+  a =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_left32(lo1,
+          (uint32_t)31U),
+        Lib_IntVector_Intrinsics_vec128_shift_left32(lo1, (uint32_t)30U)),
+      Lib_IntVector_Intrinsics_vec128_shift_left32(lo1, (uint32_t)25U));
+  Lib_IntVector_Intrinsics_vec128 a_hi = Lib_IntVector_Intrinsics_vec128_shift_right(a, (uint32_t)32U);
+  lo1 = Lib_IntVector_Intrinsics_vec128_xor(lo1, Lib_IntVector_Intrinsics_vec128_shift_left(a, (uint32_t)96U));
+  Lib_IntVector_Intrinsics_vec128
+  b =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_shift_right32(lo1,
+          (uint32_t)1U),
+        Lib_IntVector_Intrinsics_vec128_shift_right32(lo1, (uint32_t)2U)),
+      Lib_IntVector_Intrinsics_vec128_shift_right32(lo1, (uint32_t)7U));
+  b = Lib_IntVector_Intrinsics_vec128_xor(b, a_hi);
+  lo1 = Lib_IntVector_Intrinsics_vec128_xor(lo1, b);
+  return Lib_IntVector_Intrinsics_vec128_xor(hi1, lo1);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+gf128_mul(Lib_IntVector_Intrinsics_vec128 x, Lib_IntVector_Intrinsics_vec128 y)
+{
+  Lib_IntVector_Intrinsics_vec128 lo;
+  Lib_IntVector_Intrinsics_vec128 hi;
+  clmul_wide(x, y, &lo, &hi);
+  return gf128_reduce(lo, hi);
+}
+
+void Hacl_Gf128_NI_gcm_init(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 h1 = Lib_IntVector_Intrinsics_vec128_load_be(key);
+  Lib_IntVector_Intrinsics_vec128 h2 = gf128_mul(h1, h1);
+  Lib_IntVector_Intrinsics_vec128 h3 = gf128_mul(h2, h1);
+  Lib_IntVector_Intrinsics_vec128 h4 = gf128_mul(h3, h1);
+  ctx[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+  ctx[1U] = h4;
+  ctx[2U] = h3;
+  ctx[3U] = h2;
+  ctx[4U] = h1;
+}
+
+void
+Hacl_Gf128_NI_gcm_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  Lib_IntVector_Intrinsics_vec128 acc = ctx[0U];
+  Lib_IntVector_Intrinsics_vec128 h4 = ctx[1U];
+  Lib_IntVector_Intrinsics_vec128 h3 = ctx[2U];
+  Lib_IntVector_Intrinsics_vec128 h2 = ctx[3U];
+  Lib_IntVector_Intrinsics_vec128 h1 = ctx[4U];
+  uint32_t nb4 = len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb4; i++)
+  {
+    uint8_t *b = text + i * (uint32_t)64U;
+    Lib_IntVector_Intrinsics_vec128
+    x1 = Lib_IntVector_Intrinsics_vec128_xor(acc, Lib_IntVector_Intrinsics_vec128_load_be(b));
+    Lib_IntVector_Intrinsics_vec128
+    x2 = Lib_IntVector_Intrinsics_vec128_load_be(b + (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128
+    x3 = Lib_IntVector_Intrinsics_vec128_load_be(b + (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec128
+    x4 = Lib_IntVector_Intrinsics_vec128_load_be(b + (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec128 lo;
+    Lib_IntVector_Intrinsics_vec128 hi;
+    Lib_IntVector_Intrinsics_vec128 lo1;
+    Lib_IntVector_Intrinsics_vec128 hi1;
+    clmul_wide(x1, h4, &lo, &hi);
+    clmul_wide(x2, h3, &lo1, &hi1);
+    lo = Lib_IntVector_Intrinsics_vec128_xor(lo, lo1);
+    hi = Lib_IntVector_Intrinsics_vec128_xor(hi, hi1);
+    clmul_wide(x3, h2, &lo1, &hi1);
+    lo = Lib_IntVector_Intrinsics_vec128_xor(lo, lo1);
+    hi = Lib_IntVector_Intrinsics_vec128_xor(hi, hi1);
+    clmul_wide(x4, h1, &lo1, &hi1);
+    lo = Lib_IntVector_Intrinsics_vec128_xor(lo, lo1);
+    hi = Lib_IntVector_Intrinsics_vec128_xor(hi, hi1);
+    acc = gf128_reduce(lo, hi);
+  }
+  uint32_t rem = len - nb4 * (uint32_t)64U;
+  uint8_t *t = text + nb4 * (uint32_t)64U;
+  uint32_t nb = rem / (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_be(t + i * (uint32_t)16U);
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h1);
+  }
+  uint32_t last = rem % (uint32_t)16U;
+  if (last > (uint32_t)0U)
+  {
+    uint8_t block[16U] = { 0U };
+    memcpy(block, t + nb * (uint32_t)16U, last * sizeof (uint8_t));
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load_be(block);
+    acc = gf128_mul(Lib_IntVector_Intrinsics_vec128_xor(acc, x), h1);
+  }
+  ctx[0U] = acc;
+}
+
+void Hacl_Gf128_NI_gcm_emit(uint8_t *tag, Lib_IntVector_Intrinsics_vec128 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec128_store_be(tag, ctx[0U]);
+}
+
+void Hacl_Gf128_NI_ghash(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 ctx[5U];
+  for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Hacl_Gf128_NI_gcm_init(ctx, key);
+  Hacl_Gf128_NI_gcm_update_blocks(ctx, len, text);
+  Hacl_Gf128_NI_gcm_emit(tag, ctx);
+}
+
@@ -0,0 +1,170 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_HMAC_Vec256.h"
+
+
+
+void
+Hacl_HMAC_Vec256_compute_sha2_256_8(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+)
+{
+  uint32_t block_state[64U] = { 0U };
+  uint8_t buf[512U] = { 0U };
+  uint64_t total_len[8U] = { 0U };
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256
+  s = { .block_state = block_state, .buf = buf, .total_len = total_len };
+  uint8_t pads[512U] = { 0U };
+  uint8_t hash1[256U] = { 0U };
+  uint8_t *pad[8U];
+  uint32_t pad_len[8U];
+  uint8_t *h[8U];
+  uint32_t h_len[8U];
+  uint32_t d_len[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t *key_block = pads + i * (uint32_t)64U;
+    if (dst[i] == NULL)
+    {
+      pad_len[i] = (uint32_t)0U;
+      h_len[i] = (uint32_t)0U;
+      d_len[i] = (uint32_t)0U;
+      h[i] = NULL;
+    }
+    else
+    {
+      if (key_len[i] <= (uint32_t)64U)
+      {
+        memcpy(key_block, key[i], key_len[i] * sizeof (uint8_t));
+      }
+      else
+      {
+        Hacl_Hash_SHA2_hash_256(key[i], key_len[i], key_block);
+      }
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)64U; j++)
+      {
+        key_block[j] = key_block[j] ^ (uint8_t)0x36U;
+      }
+      pad_len[i] = (uint32_t)64U;
+      h_len[i] = (uint32_t)32U;
+      d_len[i] = data_len[i];
+      h[i] = hash1 + i * (uint32_t)32U;
+    }
+    pad[i] = key_block;
+  }
+  /* Inner hashes: key ^ ipad || data. */
+  Hacl_Streaming_SHA2_Vec256_init_256(&s);
+  Hacl_Streaming_SHA2_Vec256_update_256(&s, pad, pad_len);
+  Hacl_Streaming_SHA2_Vec256_update_256(&s, data, d_len);
+  Hacl_Streaming_SHA2_Vec256_finish_256(&s, h);
+  /* Outer hashes: key ^ opad || inner hash. */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)512U; i++)
+  {
+    pads[i] = pads[i] ^ ((uint8_t)0x36U ^ (uint8_t)0x5cU);
+  }
+  Hacl_Streaming_SHA2_Vec256_init_256(&s);
+  Hacl_Streaming_SHA2_Vec256_update_256(&s, pad, pad_len);
+  Hacl_Streaming_SHA2_Vec256_update_256(&s, h, h_len);
+  Hacl_Streaming_SHA2_Vec256_finish_256(&s, dst);
+  Lib_Memzero0_memzero(pads, (uint32_t)512U * sizeof (pads[0U]));
+  Lib_Memzero0_memzero(hash1, (uint32_t)256U * sizeof (hash1[0U]));
+  Lib_Memzero0_memzero(block_state, (uint32_t)64U * sizeof (block_state[0U]));
+  Lib_Memzero0_memzero(buf, (uint32_t)512U * sizeof (buf[0U]));
+}
+
+void
+Hacl_HMAC_Vec256_compute_sha2_512_4(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+)
+{
+  uint64_t block_state[32U] = { 0U };
+  uint8_t buf[512U] = { 0U };
+  uint64_t total_len[4U] = { 0U };
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512
+  s = { .block_state = block_state, .buf = buf, .total_len = total_len };
+  uint8_t pads[512U] = { 0U };
+  uint8_t hash1[256U] = { 0U };
+  uint8_t *pad[4U];
+  uint32_t pad_len[4U];
+  uint8_t *h[4U];
+  uint32_t h_len[4U];
+  uint32_t d_len[4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *key_block = pads + i * (uint32_t)128U;
+    if (dst[i] == NULL)
+    {
+      pad_len[i] = (uint32_t)0U;
+      h_len[i] = (uint32_t)0U;
+      d_len[i] = (uint32_t)0U;
+      h[i] = NULL;
+    }
+    else
+    {
+      if (key_len[i] <= (uint32_t)128U)
+      {
+        memcpy(key_block, key[i], key_len[i] * sizeof (uint8_t));
+      }
+      else
+      {
+        Hacl_Hash_SHA2_hash_512(key[i], key_len[i], key_block);
+      }
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)128U; j++)
+      {
+        key_block[j] = key_block[j] ^ (uint8_t)0x36U;
+      }
+      pad_len[i] = (uint32_t)128U;
+      h_len[i] = (uint32_t)64U;
+      d_len[i] = data_len[i];
+      h[i] = hash1 + i * (uint32_t)64U;
+    }
+    pad[i] = key_block;
+  }
+  Hacl_Streaming_SHA2_Vec256_init_512(&s);
+  Hacl_Streaming_SHA2_Vec256_update_512(&s, pad, pad_len);
+  Hacl_Streaming_SHA2_Vec256_update_512(&s, data, d_len);
+  Hacl_Streaming_SHA2_Vec256_finish_512(&s, h);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)512U; i++)
+  {
+    pads[i] = pads[i] ^ ((uint8_t)0x36U ^ (uint8_t)0x5cU);
+  }
+  Hacl_Streaming_SHA2_Vec256_init_512(&s);
+  Hacl_Streaming_SHA2_Vec256_update_512(&s, pad, pad_len);
+  Hacl_Streaming_SHA2_Vec256_update_512(&s, h, h_len);
+  Hacl_Streaming_SHA2_Vec256_finish_512(&s, dst);
+  Lib_Memzero0_memzero(pads, (uint32_t)512U * sizeof (pads[0U]));
+  Lib_Memzero0_memzero(hash1, (uint32_t)256U * sizeof (hash1[0U]));
+  Lib_Memzero0_memzero(block_state, (uint32_t)32U * sizeof (block_state[0U]));
+  Lib_Memzero0_memzero(buf, (uint32_t)512U * sizeof (buf[0U]));
+}
+
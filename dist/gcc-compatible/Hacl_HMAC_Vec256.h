@@ -0,0 +1,75 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_HMAC_Vec256_H
+#define __Hacl_HMAC_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "Hacl_Streaming_SHA2_Vec256.h"
+#include "Hacl_Hash_SHA2.h"
+#include "evercrypt_targetconfig.h"
+
+/*
+  Eight independent HMAC-SHA2-256 computations in one pass of the 8-way kernel:
+  dst[i] = HMAC-SHA2-256(key[i], data[i]), for keys and messages of arbitrary and possibly
+  different lengths. A lane with dst[i] = NULL is unused; its key and data may be NULL
+  with length 0.
+*/
+void
+Hacl_HMAC_Vec256_compute_sha2_256_8(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+);
+
+/*
+  As compute_sha2_256_8, for four lanes of HMAC-SHA2-512.
+*/
+void
+Hacl_HMAC_Vec256_compute_sha2_512_4(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t *data_len
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_HMAC_Vec256_H_DEFINED
+#endif
@@ -0,0 +1,471 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Hash_Blake2sp_256.h"
+
+#include "internal/Hacl_Hash_Blake2sp_256.h"
+
+/* BLAKE2sp runs eight BLAKE2s leaves over the 64-byte blocks of the input,
+   dealt round-robin, then hashes the eight leaf digests in a root node. The
+   leaf states are kept transposed: word w of leaf i is lane i of h[w], so a
+   single pass of the compression function advances all eight leaves. */
+
+static inline void
+g(
+  Lib_IntVector_Intrinsics_vec256 *v,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y
+)
+{
+  v[a] = Lib_IntVector_Intrinsics_vec256_add32(v[a], Lib_IntVector_Intrinsics_vec256_add32(v[b], x));
+  v[d] = Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]),
+      (uint32_t)16U);
+  v[c] = Lib_IntVector_Intrinsics_vec256_add32(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]),
+      (uint32_t)12U);
+  v[a] = Lib_IntVector_Intrinsics_vec256_add32(v[a], Lib_IntVector_Intrinsics_vec256_add32(v[b], y));
+  v[d] = Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]),
+      (uint32_t)8U);
+  v[c] = Lib_IntVector_Intrinsics_vec256_add32(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]),
+      (uint32_t)7U);
+}
+
+/* Loads one 64-byte block per lane and transposes them, so that m[w] holds
+   word w of every lane's block. */
+static inline void load_blocks8(Lib_IntVector_Intrinsics_vec256 *m, uint8_t **blocks)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)2U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 r[8U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      r[j] = Lib_IntVector_Intrinsics_vec256_load32_le(blocks[j] + (uint32_t)32U * i);
+    }
+    Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(r[0U], r[1U]);
+    Lib_IntVector_Intrinsics_vec256 v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(r[0U], r[1U]);
+    Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(r[2U], r[3U]);
+    Lib_IntVector_Intrinsics_vec256 v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(r[2U], r[3U]);
+    Lib_IntVector_Intrinsics_vec256 v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(r[4U], r[5U]);
+    Lib_IntVector_Intrinsics_vec256 v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(r[4U], r[5U]);
+    Lib_IntVector_Intrinsics_vec256 v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(r[6U], r[7U]);
+    Lib_IntVector_Intrinsics_vec256 v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(r[6U], r[7U]);
+    Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+    Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+    Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+    Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+    Lib_IntVector_Intrinsics_vec256 *mi = m + (uint32_t)8U * i;
+    mi[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+    mi[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+    mi[2U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+    mi[3U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+    mi[4U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+    mi[5U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+    mi[6U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+    mi[7U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec256 load_counters(uint64_t *t, uint32_t shift)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_load32s((uint32_t)(t[0U] >> shift),
+      (uint32_t)(t[1U] >> shift),
+      (uint32_t)(t[2U] >> shift),
+      (uint32_t)(t[3U] >> shift),
+      (uint32_t)(t[4U] >> shift),
+      (uint32_t)(t[5U] >> shift),
+      (uint32_t)(t[6U] >> shift),
+      (uint32_t)(t[7U] >> shift));
+}
+
+/* One compression of every lane. The counters t and the flags f0 and f1
+   are per-lane; lanes whose keep mask is all ones are left unchanged, which
+   lets the finalization passes advance only the leaves that still have
+   data. */
+static void
+compress8(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint8_t **blocks,
+  uint64_t *t,
+  Lib_IntVector_Intrinsics_vec256 f0,
+  Lib_IntVector_Intrinsics_vec256 f1,
+  Lib_IntVector_Intrinsics_vec256 keep
+)
+{
+  Lib_IntVector_Intrinsics_vec256 m[16U];
+  Lib_IntVector_Intrinsics_vec256 v[16U];
+  load_blocks8(m, blocks);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    v[i] = h[i];
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    v[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec256_load32(Hacl_Impl_Blake2_Constants_ivTable_S[i]);
+  }
+  v[12U] = Lib_IntVector_Intrinsics_vec256_xor(v[12U], load_counters(t, (uint32_t)0U));
+  v[13U] = Lib_IntVector_Intrinsics_vec256_xor(v[13U], load_counters(t, (uint32_t)32U));
+  v[14U] = Lib_IntVector_Intrinsics_vec256_xor(v[14U], f0);
+  v[15U] = Lib_IntVector_Intrinsics_vec256_xor(v[15U], f1);
+  for (uint32_t r = (uint32_t)0U; r < (uint32_t)10U; r++)
+  {
+    const uint32_t *s = Hacl_Impl_Blake2_Constants_sigmaTable + r * (uint32_t)16U;
+    g(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s[0U]], m[s[1U]]);
+    g(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s[2U]], m[s[3U]]);
+    g(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s[4U]], m[s[5U]]);
+    g(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s[6U]], m[s[7U]]);
+    g(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s[8U]], m[s[9U]]);
+    g(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s[10U]], m[s[11U]]);
+    g(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s[12U]], m[s[13U]]);
+    g(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s[14U]], m[s[15U]]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x =
+      Lib_IntVector_Intrinsics_vec256_xor(h[i],
+        Lib_IntVector_Intrinsics_vec256_xor(v[i], v[(uint32_t)8U + i]));
+    h[i] =
+      Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(keep, h[i]),
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(keep), x));
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec256 mask_of_bool(bool *b)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_load32s((uint32_t)0U - (uint32_t)b[0U],
+      (uint32_t)0U - (uint32_t)b[1U],
+      (uint32_t)0U - (uint32_t)b[2U],
+      (uint32_t)0U - (uint32_t)b[3U],
+      (uint32_t)0U - (uint32_t)b[4U],
+      (uint32_t)0U - (uint32_t)b[5U],
+      (uint32_t)0U - (uint32_t)b[6U],
+      (uint32_t)0U - (uint32_t)b[7U]);
+}
+
+/* Parameter block of a BLAKE2sp node: fanout 8, depth 2, inner length 32. */
+static inline void
+init_node(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint32_t kk,
+  uint32_t nn,
+  uint32_t *node_offset,
+  uint32_t node_depth
+)
+{
+  uint32_t
+  p0 = nn ^ (kk << (uint32_t)8U ^ ((uint32_t)8U << (uint32_t)16U ^ (uint32_t)2U << (uint32_t)24U));
+  uint32_t p3 = node_depth << (uint32_t)16U ^ (uint32_t)32U << (uint32_t)24U;
+  const uint32_t *iv = Hacl_Impl_Blake2_Constants_ivTable_S;
+  h[0U] = Lib_IntVector_Intrinsics_vec256_load32(iv[0U] ^ p0);
+  h[1U] = Lib_IntVector_Intrinsics_vec256_load32(iv[1U]);
+  h[2U] =
+    Lib_IntVector_Intrinsics_vec256_load32s(iv[2U] ^ node_offset[0U],
+      iv[2U] ^ node_offset[1U],
+      iv[2U] ^ node_offset[2U],
+      iv[2U] ^ node_offset[3U],
+      iv[2U] ^ node_offset[4U],
+      iv[2U] ^ node_offset[5U],
+      iv[2U] ^ node_offset[6U],
+      iv[2U] ^ node_offset[7U]);
+  h[3U] = Lib_IntVector_Intrinsics_vec256_load32(iv[3U] ^ p3);
+  for (uint32_t i = (uint32_t)4U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec256_load32(iv[i]);
+  }
+}
+
+void
+Hacl_Hash_Blake2sp_256_init_leaves(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint32_t kk,
+  uint32_t nn
+)
+{
+  uint32_t
+  node_offset[8U] =
+    {
+      (uint32_t)0U, (uint32_t)1U, (uint32_t)2U, (uint32_t)3U, (uint32_t)4U, (uint32_t)5U,
+      (uint32_t)6U, (uint32_t)7U
+    };
+  init_node(h, kk, nn, node_offset, (uint32_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    t[i] = (uint64_t)0U;
+  }
+}
+
+void
+Hacl_Hash_Blake2sp_256_update_key(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  uint8_t key_block[64U] = { 0U };
+  memcpy(key_block, k, kk * sizeof (uint8_t));
+  uint8_t
+  *blocks[8U] =
+    { key_block, key_block, key_block, key_block, key_block, key_block, key_block, key_block };
+  Lib_IntVector_Intrinsics_vec256 zero = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    t[i] = t[i] + (uint64_t)64U;
+  }
+  compress8(h, blocks, t, zero, zero, zero);
+  Lib_Memzero0_memzero(key_block, (uint32_t)64U * sizeof (key_block[0U]));
+}
+
+void
+Hacl_Hash_Blake2sp_256_update_stripes(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint8_t *stripes,
+  uint32_t n_stripes
+)
+{
+  Lib_IntVector_Intrinsics_vec256 zero = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < n_stripes; i++)
+  {
+    uint8_t *stripe = stripes + i * (uint32_t)512U;
+    uint8_t *blocks[8U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      blocks[j] = stripe + (uint32_t)64U * j;
+      t[j] = t[j] + (uint64_t)64U;
+    }
+    compress8(h, blocks, t, zero, zero, zero);
+  }
+}
+
+/* Compresses blocks[i] (of len[i] bytes) into every leaf that is not done
+   yet, with the last-block flag set for the leaves in last. */
+static void
+lanes_pass(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  bool *done,
+  uint8_t **blocks,
+  uint32_t *len,
+  bool *last
+)
+{
+  bool last_node[8U] = { false, false, false, false, false, false, false, last[7U] };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (!done[i])
+    {
+      t[i] = t[i] + (uint64_t)len[i];
+    }
+  }
+  compress8(h, blocks, t, mask_of_bool(last), mask_of_bool(last_node), mask_of_bool(done));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    done[i] = done[i] || last[i];
+  }
+}
+
+/* Leaf i's next block starts at rest + 64 * i and may be short or empty.
+   It is the leaf's last block unless rest extends beyond 512 + 64 * i. */
+static void
+finish_pass(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  bool *done,
+  uint8_t *rest,
+  uint32_t rest_len
+)
+{
+  uint8_t buf[512U] = { 0U };
+  uint8_t *blocks[8U];
+  uint32_t len[8U];
+  bool last[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t off = (uint32_t)64U * i;
+    len[i] = (uint32_t)0U;
+    if (rest_len > off)
+    {
+      len[i] = rest_len - off;
+      if (len[i] > (uint32_t)64U)
+      {
+        len[i] = (uint32_t)64U;
+      }
+    }
+    memcpy(buf + off, rest + off, len[i] * sizeof (uint8_t));
+    blocks[i] = buf + off;
+    last[i] = rest_len <= (uint32_t)512U + off;
+  }
+  lanes_pass(h, t, done, blocks, len, last);
+  Lib_Memzero0_memzero(buf, (uint32_t)512U * sizeof (buf[0U]));
+}
+
+void
+Hacl_Hash_Blake2sp_256_finish(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint32_t kk,
+  uint8_t *k,
+  uint8_t *rest,
+  uint32_t rest_len,
+  uint32_t nn,
+  uint8_t *output
+)
+{
+  bool done[8U] = { false, false, false, false, false, false, false, false };
+  if (k != NULL)
+  {
+    /* The key block is still pending: it is the last block of the leaves
+       that receive no data. */
+    uint8_t key_block[64U] = { 0U };
+    memcpy(key_block, k, kk * sizeof (uint8_t));
+    uint8_t *blocks[8U];
+    uint32_t len[8U];
+    bool last[8U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      blocks[i] = key_block;
+      len[i] = (uint32_t)64U;
+      last[i] = rest_len <= (uint32_t)64U * i;
+    }
+    lanes_pass(h, t, done, blocks, len, last);
+    Lib_Memzero0_memzero(key_block, (uint32_t)64U * sizeof (key_block[0U]));
+  }
+  /* Every leaf has between zero and two blocks left in rest. */
+  finish_pass(h, t, done, rest, rest_len);
+  if (rest_len > (uint32_t)512U)
+  {
+    finish_pass(h, t, done, rest + (uint32_t)512U, rest_len - (uint32_t)512U);
+  }
+  uint8_t leaves[256U] = { 0U };
+  uint8_t hb[256U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le(hb + (uint32_t)32U * i, h[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+    {
+      memcpy(leaves + (uint32_t)32U * i + (uint32_t)4U * w,
+        hb + (uint32_t)32U * w + (uint32_t)4U * i,
+        (uint32_t)4U * sizeof (uint8_t));
+    }
+  }
+  /* The root node only occupies lane 0. */
+  Lib_IntVector_Intrinsics_vec256 root[8U];
+  uint32_t node_offset[8U] = { 0U };
+  init_node(root, kk, nn, node_offset, (uint32_t)1U);
+  uint8_t zero_block[64U] = { 0U };
+  uint8_t *blocks[8U];
+  uint64_t root_t[8U] = { 0U };
+  bool last[8U] = { true, false, false, false, false, false, false, false };
+  Lib_IntVector_Intrinsics_vec256 zero = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    blocks[i] = zero_block;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    blocks[0U] = leaves + (uint32_t)64U * i;
+    root_t[0U] = root_t[0U] + (uint64_t)64U;
+    if (i == (uint32_t)3U)
+    {
+      compress8(root, blocks, root_t, mask_of_bool(last), mask_of_bool(last), zero);
+    }
+    else
+    {
+      compress8(root, blocks, root_t, zero, zero, zero);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le(hb + (uint32_t)32U * i, root[i]);
+  }
+  uint8_t out[32U] = { 0U };
+  for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+  {
+    memcpy(out + (uint32_t)4U * w, hb + (uint32_t)32U * w, (uint32_t)4U * sizeof (uint8_t));
+  }
+  memcpy(output, out, nn * sizeof (uint8_t));
+  Lib_Memzero0_memzero(leaves, (uint32_t)256U * sizeof (leaves[0U]));
+  Lib_Memzero0_memzero(hb, (uint32_t)256U * sizeof (hb[0U]));
+  Lib_Memzero0_memzero(out, (uint32_t)32U * sizeof (out[0U]));
+}
+
+/*
+  Write the BLAKE2sp digest of the `ll` bytes of `d`, keyed with the `kk`
+  bytes of `k` (possibly none), into the first `nn` bytes of `output`.
+*/
+void
+Hacl_Blake2sp_256_blake2sp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h[8U];
+  uint64_t t[8U] = { 0U };
+  Hacl_Hash_Blake2sp_256_init_leaves(h, t, kk, nn);
+  /* A stripe of 8 blocks is only compressed once every leaf is known to
+     receive more data, i.e. when more than 448 bytes follow it. */
+  uint8_t *k_pending = NULL;
+  if (kk > (uint32_t)0U)
+  {
+    if (ll > (uint32_t)448U)
+    {
+      Hacl_Hash_Blake2sp_256_update_key(h, t, kk, k);
+    }
+    else
+    {
+      k_pending = k;
+    }
+  }
+  uint32_t n_stripes = (uint32_t)0U;
+  if (ll > (uint32_t)960U)
+  {
+    n_stripes = (ll - (uint32_t)449U) / (uint32_t)512U;
+  }
+  Hacl_Hash_Blake2sp_256_update_stripes(h, t, d, n_stripes);
+  uint32_t done = n_stripes * (uint32_t)512U;
+  Hacl_Hash_Blake2sp_256_finish(h, t, kk, k_pending, d + done, ll - done, nn, output);
+  Lib_Memzero0_memzero(h, (uint32_t)8U * sizeof (h[0U]));
+}
+
@@ -0,0 +1,320 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_K12.h"
+
+
+
+static void
+absorb(
+  uint32_t rateInBytes,
+  uint64_t *s,
+  uint8_t *buf,
+  uint32_t *pos,
+  uint32_t len,
+  uint8_t *data
+)
+{
+  uint32_t off = (uint32_t)0U;
+  if (pos[0U] > (uint32_t)0U)
+  {
+    uint32_t n = rateInBytes - pos[0U];
+    if (len < n)
+    {
+      n = len;
+    }
+    memcpy(buf + pos[0U], data, n * sizeof (uint8_t));
+    pos[0U] = pos[0U] + n;
+    off = n;
+    if (pos[0U] == rateInBytes)
+    {
+      Hacl_Impl_SHA3_loadState(rateInBytes, buf, s);
+      Hacl_Impl_SHA3_state_permute_rounds((uint32_t)12U, s);
+      pos[0U] = (uint32_t)0U;
+    }
+  }
+  if (pos[0U] == (uint32_t)0U)
+  {
+    uint32_t nb = (len - off) / rateInBytes;
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      Hacl_Impl_SHA3_loadState(rateInBytes, data + off + i * rateInBytes, s);
+      Hacl_Impl_SHA3_state_permute_rounds((uint32_t)12U, s);
+    }
+    off = off + nb * rateInBytes;
+    memcpy(buf, data + off, (len - off) * sizeof (uint8_t));
+    pos[0U] = len - off;
+  }
+}
+
+static void
+squeeze(
+  uint32_t rateInBytes,
+  uint64_t *s,
+  uint8_t *buf,
+  uint32_t pos,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  memset(buf + pos, 0U, (rateInBytes - pos) * sizeof (uint8_t));
+  buf[pos] = domain;
+  buf[rateInBytes - (uint32_t)1U] = buf[rateInBytes - (uint32_t)1U] ^ (uint8_t)0x80U;
+  Hacl_Impl_SHA3_loadState(rateInBytes, buf, s);
+  Hacl_Impl_SHA3_state_permute_rounds((uint32_t)12U, s);
+  uint32_t outBlocks = outputByteLen / rateInBytes;
+  uint32_t remOut = outputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < outBlocks; i++)
+  {
+    Hacl_Impl_SHA3_storeState(rateInBytes, s, output + i * rateInBytes);
+    Hacl_Impl_SHA3_state_permute_rounds((uint32_t)12U, s);
+  }
+  Hacl_Impl_SHA3_storeState(remOut, s, output + outputByteLen - remOut);
+}
+
+static void
+turboshake(
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  uint64_t s[25U] = { 0U };
+  uint8_t buf[168U] = { 0U };
+  uint32_t pos = (uint32_t)0U;
+  absorb(rateInBytes, s, buf, &pos, inputByteLen, input);
+  squeeze(rateInBytes, s, buf, pos, domain, outputByteLen, output);
+  Lib_Memzero0_memzero(buf, (uint32_t)168U * sizeof (buf[0U]));
+}
+
+void
+Hacl_K12_turboshake128(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  turboshake((uint32_t)168U, inputByteLen, input, domain, outputByteLen, output);
+}
+
+void
+Hacl_K12_turboshake256(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  turboshake((uint32_t)136U, inputByteLen, input, domain, outputByteLen, output);
+}
+
+void Hacl_K12_leaf_cvs(bool vec256, uint32_t n, uint8_t *input, uint8_t *cvs)
+{
+  uint32_t done = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    uint32_t nb = n / (uint32_t)4U;
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      uint8_t *in0 = input + (uint32_t)4U * i * (uint32_t)8192U;
+      uint8_t *out0 = cvs + (uint32_t)4U * i * (uint32_t)32U;
+      Hacl_SHA3_Vec256_turboshake128_4x((uint32_t)8192U,
+        in0,
+        in0 + (uint32_t)8192U,
+        in0 + (uint32_t)16384U,
+        in0 + (uint32_t)24576U,
+        (uint8_t)0x0BU,
+        (uint32_t)32U,
+        out0,
+        out0 + (uint32_t)32U,
+        out0 + (uint32_t)64U,
+        out0 + (uint32_t)96U);
+    }
+    done = nb * (uint32_t)4U;
+  }
+  #endif
+  for (uint32_t i = done; i < n; i++)
+  {
+    Hacl_K12_turboshake128((uint32_t)8192U,
+      input + i * (uint32_t)8192U,
+      (uint8_t)0x0BU,
+      (uint32_t)32U,
+      cvs + i * (uint32_t)32U);
+  }
+}
+
+/*
+  Big-endian bytes of [x] without leading zeros, followed by their number
+*/
+static uint32_t length_encode(uint32_t x, uint8_t *res)
+{
+  uint32_t n = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    if (x >> ((uint32_t)24U - (uint32_t)8U * i) != (uint32_t)0U || n > (uint32_t)0U)
+    {
+      res[n] = (uint8_t)(x >> ((uint32_t)24U - (uint32_t)8U * i));
+      n++;
+    }
+  }
+  res[n] = (uint8_t)n;
+  return n + (uint32_t)1U;
+}
+
+/*
+  Absorbs bytes [from, to) of S = input || custom || enc, without building S
+*/
+static void
+absorb_s(
+  uint64_t *s,
+  uint8_t *buf,
+  uint32_t *pos,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t encLen,
+  uint8_t *enc,
+  uint64_t from,
+  uint64_t to
+)
+{
+  uint8_t *seg[3U] = { input, custom, enc };
+  uint64_t segLen[3U] = { (uint64_t)inputByteLen, (uint64_t)customByteLen, (uint64_t)encLen };
+  uint64_t start = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)3U; i++)
+  {
+    uint64_t stop = start + segLen[i];
+    uint64_t lo = from > start ? from : start;
+    uint64_t hi = to < stop ? to : stop;
+    if (lo < hi)
+    {
+      absorb((uint32_t)168U, s, buf, pos, (uint32_t)(hi - lo), seg[i] + (uint32_t)(lo - start));
+    }
+    start = stop;
+  }
+}
+
+void
+Hacl_K12_kangarootwelve_with_cvs(
+  bool vec256,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t ncvs,
+  uint8_t *cvs,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  uint8_t enc[5U] = { 0U };
+  uint32_t encLen = length_encode(customByteLen, enc);
+  uint64_t sLen = (uint64_t)inputByteLen + (uint64_t)customByteLen + (uint64_t)encLen;
+  uint64_t s[25U] = { 0U };
+  uint8_t buf[168U] = { 0U };
+  uint32_t pos = (uint32_t)0U;
+  if (sLen <= (uint64_t)8192U)
+  {
+    absorb_s(s, buf, &pos, inputByteLen, input, customByteLen, custom, encLen, enc,
+      (uint64_t)0U,
+      sLen);
+    squeeze((uint32_t)168U, s, buf, pos, (uint8_t)0x07U, outputByteLen, output);
+  }
+  else
+  {
+    uint32_t n = (uint32_t)((sLen + (uint64_t)8191U) / (uint64_t)8192U);
+    uint32_t full = inputByteLen / (uint32_t)8192U;
+    uint8_t marker[8U] = { (uint8_t)0x03U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+    absorb_s(s, buf, &pos, inputByteLen, input, customByteLen, custom, encLen, enc,
+      (uint64_t)0U,
+      (uint64_t)8192U);
+    absorb((uint32_t)168U, s, buf, &pos, (uint32_t)8U, marker);
+    if (ncvs > (uint32_t)0U)
+    {
+      absorb((uint32_t)168U, s, buf, &pos, ncvs * (uint32_t)32U, cvs);
+    }
+    /* Leaves entirely inside [input], eight at a time */
+    uint8_t cv[256U] = { 0U };
+    uint32_t i = (uint32_t)1U + ncvs;
+    while (i < full)
+    {
+      uint32_t k = full - i < (uint32_t)8U ? full - i : (uint32_t)8U;
+      Hacl_K12_leaf_cvs(vec256, k, input + i * (uint32_t)8192U, cv);
+      absorb((uint32_t)168U, s, buf, &pos, k * (uint32_t)32U, cv);
+      i = i + k;
+    }
+    /* Leaves that reach into [custom] or its length encoding */
+    for (uint32_t j = i; j < n; j++)
+    {
+      uint64_t s1[25U] = { 0U };
+      uint8_t buf1[168U] = { 0U };
+      uint32_t pos1 = (uint32_t)0U;
+      uint64_t from = (uint64_t)j * (uint64_t)8192U;
+      uint64_t to = from + (uint64_t)8192U < sLen ? from + (uint64_t)8192U : sLen;
+      absorb_s(s1, buf1, &pos1, inputByteLen, input, customByteLen, custom, encLen, enc, from, to);
+      squeeze((uint32_t)168U, s1, buf1, pos1, (uint8_t)0x0BU, (uint32_t)32U, cv);
+      absorb((uint32_t)168U, s, buf, &pos, (uint32_t)32U, cv);
+    }
+    uint8_t tail[7U] = { 0U };
+    uint32_t tailLen = length_encode(n - (uint32_t)1U, tail);
+    tail[tailLen] = (uint8_t)0xFFU;
+    tail[tailLen + (uint32_t)1U] = (uint8_t)0xFFU;
+    absorb((uint32_t)168U, s, buf, &pos, tailLen + (uint32_t)2U, tail);
+    squeeze((uint32_t)168U, s, buf, pos, (uint8_t)0x06U, outputByteLen, output);
+    Lib_Memzero0_memzero(cv, (uint32_t)256U * sizeof (cv[0U]));
+  }
+  Lib_Memzero0_memzero(buf, (uint32_t)168U * sizeof (buf[0U]));
+}
+
+void
+Hacl_K12_kangarootwelve(
+  bool vec256,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+)
+{
+  Hacl_K12_kangarootwelve_with_cvs(vec256,
+    inputByteLen,
+    input,
+    customByteLen,
+    custom,
+    (uint32_t)0U,
+    NULL,
+    outputByteLen,
+    output);
+}
+
@@ -0,0 +1,119 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_K12_H
+#define __Hacl_K12_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_SHA3_Vec256.h"
+#include "Hacl_SHA3.h"
+#include "Lib_Memzero0.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  TurboSHAKE128: Keccak-p[1600, 12] sponge at the SHAKE128 rate, with domain
+  separation byte [domain] in 0x01..0x7F (0x1F for the plain XOF)
+*/
+void
+Hacl_K12_turboshake128(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+/*
+  TurboSHAKE256: as TurboSHAKE128, at the SHAKE256 rate
+*/
+void
+Hacl_K12_turboshake256(
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+/*
+  Chaining values of [n] consecutive 8192-byte chunks of [input], 32 bytes
+  each, written to [cvs]. With [vec256] (see EverCrypt_AutoConfig2_has_vec256),
+  four chunks share each call to the 4-way Keccak-p[1600,12] of Hacl_SHA3_Vec256.
+
+  Leaves do not depend on each other, so the chaining values of a long message
+  can be computed over disjoint chunk ranges, e.g. one per thread, and handed
+  in order to Hacl_K12_kangarootwelve_with_cvs.
+*/
+void Hacl_K12_leaf_cvs(bool vec256, uint32_t n, uint8_t *input, uint8_t *cvs);
+
+/*
+  KangarooTwelve of [input] with customization string [custom], given the
+  chaining values [cvs] of the first [ncvs] chunks after chunk 0, i.e. of
+  bytes 8192 .. 8192 * (ncvs + 1) - 1 of [input], as computed by
+  Hacl_K12_leaf_cvs. Requires 8192 * (ncvs + 1) <= inputByteLen when ncvs > 0.
+  The remaining chunks go through Hacl_K12_leaf_cvs with [vec256].
+*/
+void
+Hacl_K12_kangarootwelve_with_cvs(
+  bool vec256,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t ncvs,
+  uint8_t *cvs,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+/*
+  KangarooTwelve (RFC 9861) of [input] with customization string [custom], with the
+  leaves hashed as in Hacl_K12_leaf_cvs
+*/
+void
+Hacl_K12_kangarootwelve(
+  bool vec256,
+  uint32_t inputByteLen,
+  uint8_t *input,
+  uint32_t customByteLen,
+  uint8_t *custom,
+  uint32_t outputByteLen,
+  uint8_t *output
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_K12_H_DEFINED
+#endif
@@ -0,0 +1,141 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_PBKDF2_Vec256.h"
+
+#include "internal/Hacl_SHA2_Vec256.h"
+
+void
+Hacl_PBKDF2_Vec256_iterate_sha2_256_8(
+  uint32_t c,
+  uint32_t *inner,
+  uint32_t *outer,
+  uint32_t *u
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ih[8U];
+  Lib_IntVector_Intrinsics_vec256 oh[8U];
+  Lib_IntVector_Intrinsics_vec256 uv[8U];
+  Lib_IntVector_Intrinsics_vec256 t[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    ih[i] = Lib_IntVector_Intrinsics_vec256_load32_le((uint8_t *)(inner + i * (uint32_t)8U));
+    oh[i] = Lib_IntVector_Intrinsics_vec256_load32_le((uint8_t *)(outer + i * (uint32_t)8U));
+    uv[i] = Lib_IntVector_Intrinsics_vec256_load32_le((uint8_t *)(u + i * (uint32_t)8U));
+    t[i] = uv[i];
+  }
+  /* Both hashed messages are one pad block followed by 32 bytes: 768 bits in total. */
+  Lib_IntVector_Intrinsics_vec256 pad = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x80000000U);
+  Lib_IntVector_Intrinsics_vec256 len = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)768U);
+  for (uint32_t j = (uint32_t)1U; j < c; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256 ws[16U];
+    Lib_IntVector_Intrinsics_vec256 h[8U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      ws[i] = uv[i];
+      ws[i + (uint32_t)8U] = Lib_IntVector_Intrinsics_vec256_zero;
+      h[i] = ih[i];
+    }
+    ws[8U] = pad;
+    ws[15U] = len;
+    Hacl_SHA2_Vec256_sha256_update8_words(ws, h);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      ws[i] = h[i];
+      ws[i + (uint32_t)8U] = Lib_IntVector_Intrinsics_vec256_zero;
+      h[i] = oh[i];
+    }
+    ws[8U] = pad;
+    ws[15U] = len;
+    Hacl_SHA2_Vec256_sha256_update8_words(ws, h);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      uv[i] = h[i];
+      t[i] = Lib_IntVector_Intrinsics_vec256_xor(t[i], h[i]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store32_le((uint8_t *)(u + i * (uint32_t)8U), t[i]);
+  }
+}
+
+void
+Hacl_PBKDF2_Vec256_iterate_sha2_512_4(
+  uint32_t c,
+  uint64_t *inner,
+  uint64_t *outer,
+  uint64_t *u
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ih[8U];
+  Lib_IntVector_Intrinsics_vec256 oh[8U];
+  Lib_IntVector_Intrinsics_vec256 uv[8U];
+  Lib_IntVector_Intrinsics_vec256 t[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    ih[i] = Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(inner + i * (uint32_t)4U));
+    oh[i] = Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(outer + i * (uint32_t)4U));
+    uv[i] = Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(u + i * (uint32_t)4U));
+    t[i] = uv[i];
+  }
+  /* One 128-byte pad block followed by 64 bytes: 1536 bits in total. */
+  Lib_IntVector_Intrinsics_vec256
+  pad = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x8000000000000000U);
+  Lib_IntVector_Intrinsics_vec256 len = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1536U);
+  for (uint32_t j = (uint32_t)1U; j < c; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256 ws[16U];
+    Lib_IntVector_Intrinsics_vec256 h[8U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      ws[i] = uv[i];
+      ws[i + (uint32_t)8U] = Lib_IntVector_Intrinsics_vec256_zero;
+      h[i] = ih[i];
+    }
+    ws[8U] = pad;
+    ws[15U] = len;
+    Hacl_SHA2_Vec256_sha512_update4_words(ws, h);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      ws[i] = h[i];
+      ws[i + (uint32_t)8U] = Lib_IntVector_Intrinsics_vec256_zero;
+      h[i] = oh[i];
+    }
+    ws[8U] = pad;
+    ws[15U] = len;
+    Hacl_SHA2_Vec256_sha512_update4_words(ws, h);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      uv[i] = h[i];
+      t[i] = Lib_IntVector_Intrinsics_vec256_xor(t[i], h[i]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)(u + i * (uint32_t)4U), t[i]);
+  }
+}
+
@@ -0,0 +1,71 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_PBKDF2_Vec256_H
+#define __Hacl_PBKDF2_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "evercrypt_targetconfig.h"
+/*
+  The inner loop of PBKDF2-HMAC-SHA2-256 on eight lanes. Each lane j comes with the HMAC
+  midstates of its password after key ^ ipad and key ^ opad, and with U_1; all arrays are
+  word-major (word i of lane j at index 8 * i + j), as in Hacl_Streaming_SHA2_Vec256.
+
+  On return, u holds U_1 ^ U_2 ^ ... ^ U_c for every lane. Each iteration is two calls to the
+  8-way compression function, on message words built directly in vector registers.
+*/
+void
+Hacl_PBKDF2_Vec256_iterate_sha2_256_8(
+  uint32_t c,
+  uint32_t *inner,
+  uint32_t *outer,
+  uint32_t *u
+);
+
+/*
+  As iterate_sha2_256_8, for four lanes of PBKDF2-HMAC-SHA2-512 (index 4 * i + j).
+*/
+void
+Hacl_PBKDF2_Vec256_iterate_sha2_512_4(
+  uint32_t c,
+  uint64_t *inner,
+  uint64_t *outer,
+  uint64_t *u
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_PBKDF2_Vec256_H_DEFINED
+#endif
@@ -0,0 +1,67 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_PBKDF2_Vec512_H
+#define __Hacl_PBKDF2_Vec512_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "evercrypt_targetconfig.h"
+/*
+  As Hacl_PBKDF2_Vec256_iterate_sha2_256_8, on sixteen lanes with the AVX-512 compression
+  function (word i of lane j at index 16 * i + j).
+*/
+void
+Hacl_PBKDF2_Vec512_iterate_sha2_256_16(
+  uint32_t c,
+  uint32_t *inner,
+  uint32_t *outer,
+  uint32_t *u
+);
+
+/*
+  As iterate_sha2_256_16, for eight lanes of PBKDF2-HMAC-SHA2-512 (index 8 * i + j).
+*/
+void
+Hacl_PBKDF2_Vec512_iterate_sha2_512_8(
+  uint32_t c,
+  uint64_t *inner,
+  uint64_t *outer,
+  uint64_t *u
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_PBKDF2_Vec512_H_DEFINED
+#endif
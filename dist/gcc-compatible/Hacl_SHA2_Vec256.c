@@ -24,39 +24,6 @@
 
 #include "internal/Hacl_SHA2_Vec256.h"
 
-
-
-typedef struct ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
-{
-  uint8_t *fst;
-  K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ snd;
-}
-___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
-
-typedef struct ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
-{
-  uint8_t *fst;
-  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ snd;
-}
-___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
-
-typedef struct
-___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
-{
-  uint8_t *fst;
-  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ snd;
-}
-___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
-
-typedef struct
-___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
-{
-  uint8_t *fst;
-  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
-  snd;
-}
-___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
-
 static inline void
 sha224_update8(
   ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
@@ -800,20 +767,119 @@ Hacl_SHA2_Vec256_sha224_8(
   memcpy(b71, hbuf + (uint32_t)224U, (uint32_t)28U * sizeof (uint8_t));
 }
 
-static inline void
-sha256_update8(
+/* The compression function on a message already loaded as words: ws[i] holds word i of the
+   block of every lane. ws is overwritten by the message schedule. */
+void
+Hacl_SHA2_Vec256_sha256_update8_words(
+  Lib_IntVector_Intrinsics_vec256 *ws,
+  Lib_IntVector_Intrinsics_vec256 *hash
+)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load32(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02,
+                Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
+                    (uint32_t)6U),
+                  Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
+                      (uint32_t)11U),
+                    Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)))),
+              Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
+                Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))),
+            k_e_t),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
+              (uint32_t)2U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
+                (uint32_t)13U),
+              Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U))),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
+              Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)4U - (uint32_t)1U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
+              (uint32_t)17U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
+                (uint32_t)19U),
+              Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
+              (uint32_t)7U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
+                (uint32_t)18U),
+              Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1,
+                t7),
+              s0),
+            t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+void
+Hacl_SHA2_Vec256_sha256_update8(
   ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
   block,
   Lib_IntVector_Intrinsics_vec256 *hash
 )
 {
-  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
-  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
-    hash_old[_i] = Lib_IntVector_Intrinsics_vec256_zero;
   Lib_IntVector_Intrinsics_vec256 ws[16U];
   for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
     ws[_i] = Lib_IntVector_Intrinsics_vec256_zero;
-  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
   uint8_t *b7 = block.snd.snd.snd.snd.snd.snd.snd;
   uint8_t *b6 = block.snd.snd.snd.snd.snd.snd.fst;
   uint8_t *b5 = block.snd.snd.snd.snd.snd.fst;
@@ -1046,97 +1112,7 @@ sha256_update8(
   ws[13U] = ws13;
   ws[14U] = ws14;
   ws[15U] = ws15;
-  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
-  {
-    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
-    {
-      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
-      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
-      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
-      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
-      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
-      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
-      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
-      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
-      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
-      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
-      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load32(k_t);
-      Lib_IntVector_Intrinsics_vec256
-      t1 =
-        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02,
-                Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
-                    (uint32_t)6U),
-                  Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
-                      (uint32_t)11U),
-                    Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)))),
-              Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
-                Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))),
-            k_e_t),
-          ws_t);
-      Lib_IntVector_Intrinsics_vec256
-      t2 =
-        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
-              (uint32_t)2U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
-                (uint32_t)13U),
-              Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U))),
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
-              Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
-      Lib_IntVector_Intrinsics_vec256 b1 = a0;
-      Lib_IntVector_Intrinsics_vec256 c1 = b0;
-      Lib_IntVector_Intrinsics_vec256 d1 = c0;
-      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
-      Lib_IntVector_Intrinsics_vec256 f1 = e0;
-      Lib_IntVector_Intrinsics_vec256 g1 = f0;
-      Lib_IntVector_Intrinsics_vec256 h12 = g0;
-      hash[0U] = a1;
-      hash[1U] = b1;
-      hash[2U] = c1;
-      hash[3U] = d1;
-      hash[4U] = e1;
-      hash[5U] = f1;
-      hash[6U] = g1;
-      hash[7U] = h12;
-    }
-    if (i0 < (uint32_t)4U - (uint32_t)1U)
-    {
-      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
-      {
-        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
-        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256
-        s1 =
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
-              (uint32_t)17U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
-                (uint32_t)19U),
-              Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
-        Lib_IntVector_Intrinsics_vec256
-        s0 =
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
-              (uint32_t)7U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
-                (uint32_t)18U),
-              Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
-        ws[i] =
-          Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1,
-                t7),
-              s0),
-            t16);
-      }
-    }
-  }
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
-  {
-    Lib_IntVector_Intrinsics_vec256 *os = hash;
-    Lib_IntVector_Intrinsics_vec256
-    x = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
-    os[i] = x;
-  }
+  Hacl_SHA2_Vec256_sha256_update8_words(ws, hash);
 }
 
 void
@@ -1239,7 +1215,7 @@ Hacl_SHA2_Vec256_sha256_8(
           }
         }
       };
-    sha256_update8(mb, st);
+    Hacl_SHA2_Vec256_sha256_update8(mb, st);
   }
   uint32_t rem1 = input_len % (uint32_t)64U;
   uint8_t *b7 = ib.snd.snd.snd.snd.snd.snd.snd;
@@ -1403,10 +1379,10 @@ Hacl_SHA2_Vec256_sha256_8(
   last0 = scrut7.fst;
   ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
   last1 = scrut7.snd;
-  sha256_update8(last0, st);
+  Hacl_SHA2_Vec256_sha256_update8(last0, st);
   if (blocks > (uint32_t)1U)
   {
-    sha256_update8(last1, st);
+    Hacl_SHA2_Vec256_sha256_update8(last1, st);
   }
   KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * (uint32_t)8U * (uint32_t)4U);
   uint8_t hbuf[(uint32_t)8U * (uint32_t)8U * (uint32_t)4U];
@@ -1966,19 +1942,117 @@ Hacl_SHA2_Vec256_sha384_4(
   memcpy(b31, hbuf + (uint32_t)192U, (uint32_t)48U * sizeof (uint8_t));
 }
 
-static inline void
-sha512_update4(
-  K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ block,
+/* As sha256_update8_words, for four lanes of SHA2-512. */
+void
+Hacl_SHA2_Vec256_sha512_update4_words(
+  Lib_IntVector_Intrinsics_vec256 *ws,
   Lib_IntVector_Intrinsics_vec256 *hash
 )
 {
   Lib_IntVector_Intrinsics_vec256 hash_old[8U];
-  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
-    hash_old[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint64_t k_t = Hacl_Impl_SHA2_Generic_k384_512[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load64(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(h02,
+                Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0,
+                    (uint32_t)14U),
+                  Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0,
+                      (uint32_t)18U),
+                    Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)41U)))),
+              Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
+                Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))),
+            k_e_t),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0,
+              (uint32_t)28U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0,
+                (uint32_t)34U),
+              Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)39U))),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
+              Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add64(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add64(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;
+    }
+    if (i0 < (uint32_t)5U - (uint32_t)1U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
+              (uint32_t)19U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
+                (uint32_t)61U),
+              Lib_IntVector_Intrinsics_vec256_shift_right64(t2, (uint32_t)6U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
+              (uint32_t)1U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
+                (uint32_t)8U),
+              Lib_IntVector_Intrinsics_vec256_shift_right64(t15, (uint32_t)7U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1,
+                t7),
+              s0),
+            t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_add64(hash[i], hash_old[i]);
+    os[i] = x;
+  }
+}
+
+void
+Hacl_SHA2_Vec256_sha512_update4(
+  K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ block,
+  Lib_IntVector_Intrinsics_vec256 *hash
+)
+{
   Lib_IntVector_Intrinsics_vec256 ws[16U];
   for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
     ws[_i] = Lib_IntVector_Intrinsics_vec256_zero;
-  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
   uint8_t *b3 = block.snd.snd.snd;
   uint8_t *b2 = block.snd.snd.fst;
   uint8_t *b10 = block.snd.fst;
@@ -2111,97 +2185,7 @@ sha512_update4(
   ws[13U] = ws13;
   ws[14U] = ws14;
   ws[15U] = ws15;
-  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
-  {
-    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
-    {
-      uint64_t k_t = Hacl_Impl_SHA2_Generic_k384_512[(uint32_t)16U * i0 + i];
-      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
-      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
-      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
-      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
-      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
-      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
-      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
-      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
-      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
-      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load64(k_t);
-      Lib_IntVector_Intrinsics_vec256
-      t1 =
-        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(h02,
-                Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0,
-                    (uint32_t)14U),
-                  Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0,
-                      (uint32_t)18U),
-                    Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)41U)))),
-              Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
-                Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))),
-            k_e_t),
-          ws_t);
-      Lib_IntVector_Intrinsics_vec256
-      t2 =
-        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0,
-              (uint32_t)28U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0,
-                (uint32_t)34U),
-              Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)39U))),
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
-              Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add64(t1, t2);
-      Lib_IntVector_Intrinsics_vec256 b1 = a0;
-      Lib_IntVector_Intrinsics_vec256 c1 = b0;
-      Lib_IntVector_Intrinsics_vec256 d1 = c0;
-      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add64(d0, t1);
-      Lib_IntVector_Intrinsics_vec256 f1 = e0;
-      Lib_IntVector_Intrinsics_vec256 g1 = f0;
-      Lib_IntVector_Intrinsics_vec256 h12 = g0;
-      hash[0U] = a1;
-      hash[1U] = b1;
-      hash[2U] = c1;
-      hash[3U] = d1;
-      hash[4U] = e1;
-      hash[5U] = f1;
-      hash[6U] = g1;
-      hash[7U] = h12;
-    }
-    if (i0 < (uint32_t)5U - (uint32_t)1U)
-    {
-      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
-      {
-        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
-        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256
-        s1 =
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
-              (uint32_t)19U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
-                (uint32_t)61U),
-              Lib_IntVector_Intrinsics_vec256_shift_right64(t2, (uint32_t)6U)));
-        Lib_IntVector_Intrinsics_vec256
-        s0 =
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
-              (uint32_t)1U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
-                (uint32_t)8U),
-              Lib_IntVector_Intrinsics_vec256_shift_right64(t15, (uint32_t)7U)));
-        ws[i] =
-          Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1,
-                t7),
-              s0),
-            t16);
-      }
-    }
-  }
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
-  {
-    Lib_IntVector_Intrinsics_vec256 *os = hash;
-    Lib_IntVector_Intrinsics_vec256
-    x = Lib_IntVector_Intrinsics_vec256_add64(hash[i], hash_old[i]);
-    os[i] = x;
-  }
+  Hacl_SHA2_Vec256_sha512_update4_words(ws, hash);
 }
 
 void
@@ -2246,7 +2230,7 @@ Hacl_SHA2_Vec256_sha512_4(
     uint8_t *bl3 = b3 + i * (uint32_t)128U;
     K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
     mb = { .fst = bl0, .snd = { .fst = bl1, .snd = { .fst = bl2, .snd = bl3 } } };
-    sha512_update4(mb, st);
+    Hacl_SHA2_Vec256_sha512_update4(mb, st);
   }
   uint32_t rem1 = input_len % (uint32_t)128U;
   uint8_t *b3 = ib.snd.snd.snd;
@@ -2321,10 +2305,10 @@ Hacl_SHA2_Vec256_sha512_4(
   scrut3 = { .fst = mb0, .snd = mb1 };
   K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ last0 = scrut3.fst;
   K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ last1 = scrut3.snd;
-  sha512_update4(last0, st);
+  Hacl_SHA2_Vec256_sha512_update4(last0, st);
   if (blocks > (uint32_t)1U)
   {
-    sha512_update4(last1, st);
+    Hacl_SHA2_Vec256_sha512_update4(last1, st);
   }
   KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)4U * (uint32_t)8U * (uint32_t)8U);
   uint8_t hbuf[(uint32_t)4U * (uint32_t)8U * (uint32_t)8U];
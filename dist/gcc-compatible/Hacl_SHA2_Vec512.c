@@ -0,0 +1,893 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_SHA2_Vec512.h"
+
+
+
+/* Transposes a 16x16 matrix of 32-bit words held in 16 vectors, so that v[j]
+   ends up holding word j of each of the 16 input rows. */
+static inline void transpose16x16(Lib_IntVector_Intrinsics_vec512 *v)
+{
+  Lib_IntVector_Intrinsics_vec512 a[16U];
+  Lib_IntVector_Intrinsics_vec512 b[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    a[(uint32_t)2U * i] =
+      Lib_IntVector_Intrinsics_vec512_interleave_low32(v[(uint32_t)2U * i],
+        v[(uint32_t)2U * i + (uint32_t)1U]);
+    a[(uint32_t)2U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec512_interleave_high32(v[(uint32_t)2U * i],
+        v[(uint32_t)2U * i + (uint32_t)1U]);
+  }
+  for (uint32_t g = (uint32_t)0U; g < (uint32_t)16U; g = g + (uint32_t)4U)
+  {
+    b[g] = Lib_IntVector_Intrinsics_vec512_interleave_low64(a[g], a[g + (uint32_t)2U]);
+    b[g + (uint32_t)1U] = Lib_IntVector_Intrinsics_vec512_interleave_high64(a[g], a[g + (uint32_t)2U]);
+    b[g + (uint32_t)2U] =
+      Lib_IntVector_Intrinsics_vec512_interleave_low64(a[g + (uint32_t)1U],
+        a[g + (uint32_t)3U]);
+    b[g + (uint32_t)3U] =
+      Lib_IntVector_Intrinsics_vec512_interleave_high64(a[g + (uint32_t)1U],
+        a[g + (uint32_t)3U]);
+  }
+  for (uint32_t m = (uint32_t)0U; m < (uint32_t)4U; m++)
+  {
+    Lib_IntVector_Intrinsics_vec512 cl = Lib_IntVector_Intrinsics_vec512_interleave_low128(b[m], b[(uint32_t)4U + m]);
+    Lib_IntVector_Intrinsics_vec512 ch = Lib_IntVector_Intrinsics_vec512_interleave_high128(b[m], b[(uint32_t)4U + m]);
+    Lib_IntVector_Intrinsics_vec512
+    dl =
+      Lib_IntVector_Intrinsics_vec512_interleave_low128(b[(uint32_t)8U + m],
+        b[(uint32_t)12U + m]);
+    Lib_IntVector_Intrinsics_vec512
+    dh =
+      Lib_IntVector_Intrinsics_vec512_interleave_high128(b[(uint32_t)8U + m],
+        b[(uint32_t)12U + m]);
+    v[m] = Lib_IntVector_Intrinsics_vec512_interleave_low256(cl, dl);
+    v[(uint32_t)8U + m] = Lib_IntVector_Intrinsics_vec512_interleave_high256(cl, dl);
+    v[(uint32_t)4U + m] = Lib_IntVector_Intrinsics_vec512_interleave_low256(ch, dh);
+    v[(uint32_t)12U + m] = Lib_IntVector_Intrinsics_vec512_interleave_high256(ch, dh);
+  }
+}
+
+/* Same, for an 8x8 matrix of 64-bit words. */
+static inline void transpose8x8(Lib_IntVector_Intrinsics_vec512 *v)
+{
+  Lib_IntVector_Intrinsics_vec512 a[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    a[(uint32_t)2U * i] =
+      Lib_IntVector_Intrinsics_vec512_interleave_low64(v[(uint32_t)2U * i],
+        v[(uint32_t)2U * i + (uint32_t)1U]);
+    a[(uint32_t)2U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec512_interleave_high64(v[(uint32_t)2U * i],
+        v[(uint32_t)2U * i + (uint32_t)1U]);
+  }
+  for (uint32_t h = (uint32_t)0U; h < (uint32_t)2U; h++)
+  {
+    Lib_IntVector_Intrinsics_vec512 cl = Lib_IntVector_Intrinsics_vec512_interleave_low128(a[h], a[(uint32_t)2U + h]);
+    Lib_IntVector_Intrinsics_vec512 ch = Lib_IntVector_Intrinsics_vec512_interleave_high128(a[h], a[(uint32_t)2U + h]);
+    Lib_IntVector_Intrinsics_vec512
+    dl =
+      Lib_IntVector_Intrinsics_vec512_interleave_low128(a[(uint32_t)4U + h],
+        a[(uint32_t)6U + h]);
+    Lib_IntVector_Intrinsics_vec512
+    dh =
+      Lib_IntVector_Intrinsics_vec512_interleave_high128(a[(uint32_t)4U + h],
+        a[(uint32_t)6U + h]);
+    v[h] = Lib_IntVector_Intrinsics_vec512_interleave_low256(cl, dl);
+    v[(uint32_t)4U + h] = Lib_IntVector_Intrinsics_vec512_interleave_high256(cl, dl);
+    v[(uint32_t)2U + h] = Lib_IntVector_Intrinsics_vec512_interleave_low256(ch, dh);
+    v[(uint32_t)6U + h] = Lib_IntVector_Intrinsics_vec512_interleave_high256(ch, dh);
+  }
+}
+
+void
+Hacl_SHA2_Vec512_sha256_update16_words(
+  Lib_IntVector_Intrinsics_vec512 *ws,
+  Lib_IntVector_Intrinsics_vec512 *hash
+)
+{
+  Lib_IntVector_Intrinsics_vec512 hash_old[8U];
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec512 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec512 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec512 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec512 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec512 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec512 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec512 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec512 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec512 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec512 k_e_t = Lib_IntVector_Intrinsics_vec512_load32(k_t);
+      Lib_IntVector_Intrinsics_vec512
+      t1 =
+        Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(h02,
+                Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(e0,
+                    (uint32_t)6U),
+                  Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(e0,
+                      (uint32_t)11U),
+                    Lib_IntVector_Intrinsics_vec512_rotate_right32(e0, (uint32_t)25U)))),
+              Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(e0, f0),
+                Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_lognot(e0), g0))),
+            k_e_t),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec512
+      t2 =
+        Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(a0,
+              (uint32_t)2U),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(a0,
+                (uint32_t)13U),
+              Lib_IntVector_Intrinsics_vec512_rotate_right32(a0, (uint32_t)22U))),
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(a0, b0),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(a0, c0),
+              Lib_IntVector_Intrinsics_vec512_and(b0, c0))));
+      hash[0U] = Lib_IntVector_Intrinsics_vec512_add32(t1, t2);
+      hash[1U] = a0;
+      hash[2U] = b0;
+      hash[3U] = c0;
+      hash[4U] = Lib_IntVector_Intrinsics_vec512_add32(d0, t1);
+      hash[5U] = e0;
+      hash[6U] = f0;
+      hash[7U] = g0;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec512 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec512 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec512 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec512 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec512
+        s1 =
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(t2,
+              (uint32_t)17U),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(t2,
+                (uint32_t)19U),
+              Lib_IntVector_Intrinsics_vec512_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec512
+        s0 =
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(t15,
+              (uint32_t)7U),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(t15,
+                (uint32_t)18U),
+              Lib_IntVector_Intrinsics_vec512_shift_right32(t15, (uint32_t)3U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(s1,
+                t7),
+              s0),
+            t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec512_add32(hash[i], hash_old[i]);
+  }
+}
+
+void Hacl_SHA2_Vec512_sha256_update16(uint8_t **block, Lib_IntVector_Intrinsics_vec512 *hash)
+{
+  Lib_IntVector_Intrinsics_vec512 ws[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    ws[i] = Lib_IntVector_Intrinsics_vec512_load32_be(block[i]);
+  }
+  transpose16x16(ws);
+  Hacl_SHA2_Vec512_sha256_update16_words(ws, hash);
+}
+
+void
+Hacl_SHA2_Vec512_sha512_update8_words(
+  Lib_IntVector_Intrinsics_vec512 *ws,
+  Lib_IntVector_Intrinsics_vec512 *hash
+)
+{
+  Lib_IntVector_Intrinsics_vec512 hash_old[8U];
+  memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint64_t k_t = Hacl_Impl_SHA2_Generic_k384_512[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec512 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec512 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec512 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec512 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec512 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec512 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec512 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec512 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec512 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec512 k_e_t = Lib_IntVector_Intrinsics_vec512_load64(k_t);
+      Lib_IntVector_Intrinsics_vec512
+      t1 =
+        Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(h02,
+                Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(e0,
+                    (uint32_t)14U),
+                  Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(e0,
+                      (uint32_t)18U),
+                    Lib_IntVector_Intrinsics_vec512_rotate_right64(e0, (uint32_t)41U)))),
+              Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(e0, f0),
+                Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_lognot(e0), g0))),
+            k_e_t),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec512
+      t2 =
+        Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(a0,
+              (uint32_t)28U),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(a0,
+                (uint32_t)34U),
+              Lib_IntVector_Intrinsics_vec512_rotate_right64(a0, (uint32_t)39U))),
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(a0, b0),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(a0, c0),
+              Lib_IntVector_Intrinsics_vec512_and(b0, c0))));
+      hash[0U] = Lib_IntVector_Intrinsics_vec512_add64(t1, t2);
+      hash[1U] = a0;
+      hash[2U] = b0;
+      hash[3U] = c0;
+      hash[4U] = Lib_IntVector_Intrinsics_vec512_add64(d0, t1);
+      hash[5U] = e0;
+      hash[6U] = f0;
+      hash[7U] = g0;
+    }
+    if (i0 < (uint32_t)4U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec512 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec512 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec512 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec512 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec512
+        s1 =
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(t2,
+              (uint32_t)19U),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(t2,
+                (uint32_t)61U),
+              Lib_IntVector_Intrinsics_vec512_shift_right64(t2, (uint32_t)6U)));
+        Lib_IntVector_Intrinsics_vec512
+        s0 =
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(t15,
+              (uint32_t)1U),
+            Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(t15,
+                (uint32_t)8U),
+              Lib_IntVector_Intrinsics_vec512_shift_right64(t15, (uint32_t)7U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(s1,
+                t7),
+              s0),
+            t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec512_add64(hash[i], hash_old[i]);
+  }
+}
+
+void Hacl_SHA2_Vec512_sha512_update8(uint8_t **block, Lib_IntVector_Intrinsics_vec512 *hash)
+{
+  Lib_IntVector_Intrinsics_vec512 ws[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    ws[i] = Lib_IntVector_Intrinsics_vec512_load64_be(block[i]);
+    ws[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec512_load64_be(block[i] + (uint32_t)64U);
+  }
+  transpose8x8(ws);
+  transpose8x8(ws + (uint32_t)8U);
+  Hacl_SHA2_Vec512_sha512_update8_words(ws, hash);
+}
+
+static inline void
+sha256_16(const uint32_t *h0, uint32_t hash_len, uint8_t **dst, uint32_t len, uint8_t **input)
+{
+  Lib_IntVector_Intrinsics_vec512 st[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[i] = Lib_IntVector_Intrinsics_vec512_load32(h0[i]);
+  }
+  uint32_t blocks = len / (uint32_t)64U;
+  uint32_t rem = len % (uint32_t)64U;
+  uint8_t *b[16U];
+  for (uint32_t i0 = (uint32_t)0U; i0 < blocks; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      b[i] = input[i] + i0 * (uint32_t)64U;
+    }
+    Hacl_SHA2_Vec512_sha256_update16(b, st);
+  }
+  uint32_t nb;
+  if (rem + (uint32_t)9U <= (uint32_t)64U)
+  {
+    nb = (uint32_t)1U;
+  }
+  else
+  {
+    nb = (uint32_t)2U;
+  }
+  uint8_t last[2048U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t *l = last + i * (uint32_t)128U;
+    memcpy(l, input[i] + blocks * (uint32_t)64U, rem * sizeof (uint8_t));
+    l[rem] = (uint8_t)0x80U;
+    store64_be(l + nb * (uint32_t)64U - (uint32_t)8U, (uint64_t)len << (uint32_t)3U);
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < nb; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      b[i] = last + i * (uint32_t)128U + i0 * (uint32_t)64U;
+    }
+    Hacl_SHA2_Vec512_sha256_update16(b, st);
+  }
+  uint32_t words[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512_store32_le((uint8_t *)(words + i * (uint32_t)16U), st[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t out[32U] = { 0U };
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store32_be(out + j * (uint32_t)4U, words[j * (uint32_t)16U + i]);
+    }
+    memcpy(dst[i], out, hash_len * sizeof (uint8_t));
+  }
+}
+
+static inline void
+sha512_8(const uint64_t *h0, uint32_t hash_len, uint8_t **dst, uint32_t len, uint8_t **input)
+{
+  Lib_IntVector_Intrinsics_vec512 st[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[i] = Lib_IntVector_Intrinsics_vec512_load64(h0[i]);
+  }
+  uint32_t blocks = len / (uint32_t)128U;
+  uint32_t rem = len % (uint32_t)128U;
+  uint8_t *b[8U];
+  for (uint32_t i0 = (uint32_t)0U; i0 < blocks; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      b[i] = input[i] + i0 * (uint32_t)128U;
+    }
+    Hacl_SHA2_Vec512_sha512_update8(b, st);
+  }
+  uint32_t nb;
+  if (rem + (uint32_t)17U <= (uint32_t)128U)
+  {
+    nb = (uint32_t)1U;
+  }
+  else
+  {
+    nb = (uint32_t)2U;
+  }
+  uint8_t last[2048U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t *l = last + i * (uint32_t)256U;
+    memcpy(l, input[i] + blocks * (uint32_t)128U, rem * sizeof (uint8_t));
+    l[rem] = (uint8_t)0x80U;
+    store64_be(l + nb * (uint32_t)128U - (uint32_t)8U, (uint64_t)len << (uint32_t)3U);
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < nb; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      b[i] = last + i * (uint32_t)256U + i0 * (uint32_t)128U;
+    }
+    Hacl_SHA2_Vec512_sha512_update8(b, st);
+  }
+  uint64_t words[64U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512_store64_le((uint8_t *)(words + i * (uint32_t)8U), st[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t out[64U] = { 0U };
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store64_be(out + j * (uint32_t)8U, words[j * (uint32_t)8U + i]);
+    }
+    memcpy(dst[i], out, hash_len * sizeof (uint8_t));
+  }
+}
+
+void
+Hacl_SHA2_Vec512_sha224_16(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint8_t *dst8,
+  uint8_t *dst9,
+  uint8_t *dst10,
+  uint8_t *dst11,
+  uint8_t *dst12,
+  uint8_t *dst13,
+  uint8_t *dst14,
+  uint8_t *dst15,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7,
+  uint8_t *input8,
+  uint8_t *input9,
+  uint8_t *input10,
+  uint8_t *input11,
+  uint8_t *input12,
+  uint8_t *input13,
+  uint8_t *input14,
+  uint8_t *input15
+)
+{
+  uint8_t *dst[16U] = { dst0, dst1, dst2, dst3, dst4, dst5, dst6, dst7, dst8, dst9, dst10, dst11, dst12, dst13, dst14, dst15 };
+  uint8_t *input[16U] = { input0, input1, input2, input3, input4, input5, input6, input7, input8, input9, input10, input11, input12, input13, input14, input15 };
+  sha256_16(Hacl_Impl_SHA2_Generic_h224, (uint32_t)28U, dst, input_len, input);
+}
+
+void
+Hacl_SHA2_Vec512_sha256_16(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint8_t *dst8,
+  uint8_t *dst9,
+  uint8_t *dst10,
+  uint8_t *dst11,
+  uint8_t *dst12,
+  uint8_t *dst13,
+  uint8_t *dst14,
+  uint8_t *dst15,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7,
+  uint8_t *input8,
+  uint8_t *input9,
+  uint8_t *input10,
+  uint8_t *input11,
+  uint8_t *input12,
+  uint8_t *input13,
+  uint8_t *input14,
+  uint8_t *input15
+)
+{
+  uint8_t *dst[16U] = { dst0, dst1, dst2, dst3, dst4, dst5, dst6, dst7, dst8, dst9, dst10, dst11, dst12, dst13, dst14, dst15 };
+  uint8_t *input[16U] = { input0, input1, input2, input3, input4, input5, input6, input7, input8, input9, input10, input11, input12, input13, input14, input15 };
+  sha256_16(Hacl_Impl_SHA2_Generic_h256, (uint32_t)32U, dst, input_len, input);
+}
+
+void
+Hacl_SHA2_Vec512_sha384_8(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+)
+{
+  uint8_t *dst[8U] = { dst0, dst1, dst2, dst3, dst4, dst5, dst6, dst7 };
+  uint8_t *input[8U] = { input0, input1, input2, input3, input4, input5, input6, input7 };
+  sha512_8(Hacl_Impl_SHA2_Generic_h384, (uint32_t)48U, dst, input_len, input);
+}
+
+void
+Hacl_SHA2_Vec512_sha512_8(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+)
+{
+  uint8_t *dst[8U] = { dst0, dst1, dst2, dst3, dst4, dst5, dst6, dst7 };
+  uint8_t *input[8U] = { input0, input1, input2, input3, input4, input5, input6, input7 };
+  sha512_8(Hacl_Impl_SHA2_Generic_h512, (uint32_t)64U, dst, input_len, input);
+}
+
+/* One round of the 16-way kernel; lanes with blocks[i] == NULL hash a dummy
+   block and keep their previous state. */
+static inline void update_blocks16(uint32_t *block_state, uint8_t **blocks)
+{
+  uint8_t dummy[64U] = { 0U };
+  uint8_t *b[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    b[i] = blocks[i] == NULL ? dummy : blocks[i];
+  }
+  Lib_IntVector_Intrinsics_vec512 hash[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec512_load32_le((uint8_t *)(block_state + i * (uint32_t)16U));
+  }
+  Hacl_SHA2_Vec512_sha256_update16(b, hash);
+  uint32_t res[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512_store32_le((uint8_t *)(res + i * (uint32_t)16U), hash[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    if (blocks[i] != NULL)
+    {
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        block_state[j * (uint32_t)16U + i] = res[j * (uint32_t)16U + i];
+      }
+    }
+  }
+}
+
+static inline void update_blocks8(uint64_t *block_state, uint8_t **blocks)
+{
+  uint8_t dummy[128U] = { 0U };
+  uint8_t *b[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    b[i] = blocks[i] == NULL ? dummy : blocks[i];
+  }
+  Lib_IntVector_Intrinsics_vec512 hash[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec512_load64_le((uint8_t *)(block_state + i * (uint32_t)8U));
+  }
+  Hacl_SHA2_Vec512_sha512_update8(b, hash);
+  uint64_t res[64U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512_store64_le((uint8_t *)(res + i * (uint32_t)8U), hash[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (blocks[i] != NULL)
+    {
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        block_state[j * (uint32_t)8U + i] = res[j * (uint32_t)8U + i];
+      }
+    }
+  }
+}
+
+/* Writes the padded final block(s) of a message of total_len bytes, whose last
+   len (< 64) bytes are in buf, to last (128 bytes). Returns the number of
+   blocks. */
+static inline uint32_t pad_256(uint64_t total_len, uint8_t *buf, uint32_t len, uint8_t *last)
+{
+  uint32_t nb;
+  if (len + (uint32_t)9U <= (uint32_t)64U)
+  {
+    nb = (uint32_t)1U;
+  }
+  else
+  {
+    nb = (uint32_t)2U;
+  }
+  memset(last, 0U, (uint32_t)128U * sizeof (uint8_t));
+  memcpy(last, buf, len * sizeof (uint8_t));
+  last[len] = (uint8_t)0x80U;
+  store64_be(last + nb * (uint32_t)64U - (uint32_t)8U, total_len << (uint32_t)3U);
+  return nb;
+}
+
+static inline uint32_t pad_512(uint64_t total_len, uint8_t *buf, uint32_t len, uint8_t *last)
+{
+  uint32_t nb;
+  if (len + (uint32_t)17U <= (uint32_t)128U)
+  {
+    nb = (uint32_t)1U;
+  }
+  else
+  {
+    nb = (uint32_t)2U;
+  }
+  memset(last, 0U, (uint32_t)256U * sizeof (uint8_t));
+  memcpy(last, buf, len * sizeof (uint8_t));
+  last[len] = (uint8_t)0x80U;
+  store64_be(last + nb * (uint32_t)128U - (uint32_t)16U, total_len >> (uint32_t)61U);
+  store64_be(last + nb * (uint32_t)128U - (uint32_t)8U, total_len << (uint32_t)3U);
+  return nb;
+}
+
+static inline void
+hash_many_16(
+  const uint32_t *h0,
+  uint32_t hash_len,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  uint32_t block_state[128U] = { 0U };
+  uint8_t last[2048U];
+  uint32_t job[16U];
+  uint32_t off[16U];
+  uint32_t nb[16U];
+  uint32_t nb_done[16U];
+  bool busy[16U];
+  uint32_t next = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    busy[i] = false;
+  }
+  while (true)
+  {
+    uint8_t *blocks[16U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      if (!busy[i] && next < n)
+      {
+        /* Refill the lane with the next message in the queue. */
+        job[i] = next;
+        next++;
+        off[i] = (uint32_t)0U;
+        nb[i] = (uint32_t)0U;
+        nb_done[i] = (uint32_t)0U;
+        busy[i] = true;
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          block_state[j * (uint32_t)16U + i] = h0[j];
+        }
+      }
+      if (!busy[i])
+      {
+        blocks[i] = NULL;
+        continue;
+      }
+      uint32_t len = input_len[job[i]];
+      uint32_t full = len - len % (uint32_t)64U;
+      if (off[i] < full)
+      {
+        blocks[i] = input[job[i]] + off[i];
+        off[i] = off[i] + (uint32_t)64U;
+      }
+      else
+      {
+        if (nb[i] == (uint32_t)0U)
+        {
+          nb[i] =
+            pad_256((uint64_t)len,
+              input[job[i]] + full,
+              len - full,
+              last + i * (uint32_t)128U);
+        }
+        blocks[i] = last + i * (uint32_t)128U + nb_done[i] * (uint32_t)64U;
+        nb_done[i]++;
+      }
+      any = true;
+    }
+    if (!any)
+    {
+      break;
+    }
+    update_blocks16(block_state, blocks);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      if (busy[i] && nb[i] != (uint32_t)0U && nb_done[i] == nb[i])
+      {
+        uint8_t out[32U] = { 0U };
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          store32_be(out + j * (uint32_t)4U, block_state[j * (uint32_t)16U + i]);
+        }
+        memcpy(dst[job[i]], out, hash_len * sizeof (uint8_t));
+        busy[i] = false;
+      }
+    }
+  }
+}
+
+static inline void
+hash_many_8(
+  const uint64_t *h0,
+  uint32_t hash_len,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  uint64_t block_state[64U] = { 0U };
+  uint8_t last[2048U];
+  uint32_t job[8U];
+  uint32_t off[8U];
+  uint32_t nb[8U];
+  uint32_t nb_done[8U];
+  bool busy[8U];
+  uint32_t next = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    busy[i] = false;
+  }
+  while (true)
+  {
+    uint8_t *blocks[8U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (!busy[i] && next < n)
+      {
+        job[i] = next;
+        next++;
+        off[i] = (uint32_t)0U;
+        nb[i] = (uint32_t)0U;
+        nb_done[i] = (uint32_t)0U;
+        busy[i] = true;
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          block_state[j * (uint32_t)8U + i] = h0[j];
+        }
+      }
+      if (!busy[i])
+      {
+        blocks[i] = NULL;
+        continue;
+      }
+      uint32_t len = input_len[job[i]];
+      uint32_t full = len - len % (uint32_t)128U;
+      if (off[i] < full)
+      {
+        blocks[i] = input[job[i]] + off[i];
+        off[i] = off[i] + (uint32_t)128U;
+      }
+      else
+      {
+        if (nb[i] == (uint32_t)0U)
+        {
+          nb[i] =
+            pad_512((uint64_t)len,
+              input[job[i]] + full,
+              len - full,
+              last + i * (uint32_t)256U);
+        }
+        blocks[i] = last + i * (uint32_t)256U + nb_done[i] * (uint32_t)128U;
+        nb_done[i]++;
+      }
+      any = true;
+    }
+    if (!any)
+    {
+      break;
+    }
+    update_blocks8(block_state, blocks);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (busy[i] && nb[i] != (uint32_t)0U && nb_done[i] == nb[i])
+      {
+        uint8_t out[64U] = { 0U };
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          store64_be(out + j * (uint32_t)8U, block_state[j * (uint32_t)8U + i]);
+        }
+        memcpy(dst[job[i]], out, hash_len * sizeof (uint8_t));
+        busy[i] = false;
+      }
+    }
+  }
+}
+
+void
+Hacl_SHA2_Vec512_hash_many_224(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_16(Hacl_Impl_SHA2_Generic_h224, (uint32_t)28U, n, dst, input_len, input);
+}
+
+void
+Hacl_SHA2_Vec512_hash_many_256(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_16(Hacl_Impl_SHA2_Generic_h256, (uint32_t)32U, n, dst, input_len, input);
+}
+
+void
+Hacl_SHA2_Vec512_hash_many_384(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_8(Hacl_Impl_SHA2_Generic_h384, (uint32_t)48U, n, dst, input_len, input);
+}
+
+void
+Hacl_SHA2_Vec512_hash_many_512(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_8(Hacl_Impl_SHA2_Generic_h512, (uint32_t)64U, n, dst, input_len, input);
+}
+
@@ -0,0 +1,207 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_SHA2_Vec512_H
+#define __Hacl_SHA2_Vec512_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_SHA2_Generic.h"
+#include "Hacl_Krmllib.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/* 16-lane SHA-224/SHA-256 and 8-lane SHA-384/SHA-512 over AVX-512. These have
+   the same contract as their Hacl_SHA2_Vec256 counterparts: all lanes hash
+   input_len bytes, and the caller must check
+   EverCrypt_AutoConfig2_has_vec512 before calling them. */
+
+void
+Hacl_SHA2_Vec512_sha224_16(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint8_t *dst8,
+  uint8_t *dst9,
+  uint8_t *dst10,
+  uint8_t *dst11,
+  uint8_t *dst12,
+  uint8_t *dst13,
+  uint8_t *dst14,
+  uint8_t *dst15,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7,
+  uint8_t *input8,
+  uint8_t *input9,
+  uint8_t *input10,
+  uint8_t *input11,
+  uint8_t *input12,
+  uint8_t *input13,
+  uint8_t *input14,
+  uint8_t *input15
+);
+
+void
+Hacl_SHA2_Vec512_sha256_16(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint8_t *dst8,
+  uint8_t *dst9,
+  uint8_t *dst10,
+  uint8_t *dst11,
+  uint8_t *dst12,
+  uint8_t *dst13,
+  uint8_t *dst14,
+  uint8_t *dst15,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7,
+  uint8_t *input8,
+  uint8_t *input9,
+  uint8_t *input10,
+  uint8_t *input11,
+  uint8_t *input12,
+  uint8_t *input13,
+  uint8_t *input14,
+  uint8_t *input15
+);
+
+void
+Hacl_SHA2_Vec512_sha384_8(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+);
+
+void
+Hacl_SHA2_Vec512_sha512_8(
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+);
+
+/*
+  Hash n messages of arbitrary (and possibly different) lengths with the 16-lane
+  (SHA2-224/256) or 8-lane (SHA2-384/512) kernel: dst[i] receives the digest of
+  input[i], of length input_len[i]. As in Hacl_Streaming_SHA2_Vec256_hash_many_*,
+  lanes are refilled from the array as they become free.
+*/
+void
+Hacl_SHA2_Vec512_hash_many_224(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+void
+Hacl_SHA2_Vec512_hash_many_256(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+void
+Hacl_SHA2_Vec512_hash_many_384(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+void
+Hacl_SHA2_Vec512_hash_many_512(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_SHA2_Vec512_H_DEFINED
+#endif
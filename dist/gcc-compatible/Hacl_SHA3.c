@@ -65,6 +65,222 @@ inline uint64_t Hacl_Impl_SHA3_rotl(uint64_t a, uint32_t b)
   return a << b | a >> ((uint32_t)64U - b);
 }
 
+/*
+  The last [rounds] rounds of Keccak-f[1600] ([rounds] even, at most 24), two
+  rounds per iteration with the 25 lanes held in locals. Lanes 1, 2, 8, 12, 17
+  and 20 are kept complemented between rounds (lane complementing), which
+  removes most of the NOTs from chi.
+
+  This function is written by hand and is not extracted from F*; it is tested
+  against Hacl_Impl_SHA3_state_permute, not proved equivalent to it. None of
+  the SHA-3 functions in this file call it.
+*/
+void Hacl_Impl_SHA3_state_permute_rounds(uint32_t rounds, uint64_t *s)
+{
+  uint64_t a0 = s[0U];
+  uint64_t a1 = ~s[1U];
+  uint64_t a2 = ~s[2U];
+  uint64_t a3 = s[3U];
+  uint64_t a4 = s[4U];
+  uint64_t a5 = s[5U];
+  uint64_t a6 = s[6U];
+  uint64_t a7 = s[7U];
+  uint64_t a8 = ~s[8U];
+  uint64_t a9 = s[9U];
+  uint64_t a10 = s[10U];
+  uint64_t a11 = s[11U];
+  uint64_t a12 = ~s[12U];
+  uint64_t a13 = s[13U];
+  uint64_t a14 = s[14U];
+  uint64_t a15 = s[15U];
+  uint64_t a16 = s[16U];
+  uint64_t a17 = ~s[17U];
+  uint64_t a18 = s[18U];
+  uint64_t a19 = s[19U];
+  uint64_t a20 = ~s[20U];
+  uint64_t a21 = s[21U];
+  uint64_t a22 = s[22U];
+  uint64_t a23 = s[23U];
+  uint64_t a24 = s[24U];
+  for (uint32_t i0 = ((uint32_t)24U - rounds) / (uint32_t)2U; i0 < (uint32_t)12U; i0++)
+  {
+    uint64_t e0;
+    uint64_t e1;
+    uint64_t e2;
+    uint64_t e3;
+    uint64_t e4;
+    uint64_t e5;
+    uint64_t e6;
+    uint64_t e7;
+    uint64_t e8;
+    uint64_t e9;
+    uint64_t e10;
+    uint64_t e11;
+    uint64_t e12;
+    uint64_t e13;
+    uint64_t e14;
+    uint64_t e15;
+    uint64_t e16;
+    uint64_t e17;
+    uint64_t e18;
+    uint64_t e19;
+    uint64_t e20;
+    uint64_t e21;
+    uint64_t e22;
+    uint64_t e23;
+    uint64_t e24;
+    {
+      uint64_t c0 = a0 ^ a5 ^ a10 ^ a15 ^ a20;
+      uint64_t c1 = a1 ^ a6 ^ a11 ^ a16 ^ a21;
+      uint64_t c2 = a2 ^ a7 ^ a12 ^ a17 ^ a22;
+      uint64_t c3 = a3 ^ a8 ^ a13 ^ a18 ^ a23;
+      uint64_t c4 = a4 ^ a9 ^ a14 ^ a19 ^ a24;
+      uint64_t d0 = c4 ^ Hacl_Impl_SHA3_rotl(c1, (uint32_t)1U);
+      uint64_t d1 = c0 ^ Hacl_Impl_SHA3_rotl(c2, (uint32_t)1U);
+      uint64_t d2 = c1 ^ Hacl_Impl_SHA3_rotl(c3, (uint32_t)1U);
+      uint64_t d3 = c2 ^ Hacl_Impl_SHA3_rotl(c4, (uint32_t)1U);
+      uint64_t d4 = c3 ^ Hacl_Impl_SHA3_rotl(c0, (uint32_t)1U);
+      uint64_t b00 = a0 ^ d0;
+      uint64_t b10 = Hacl_Impl_SHA3_rotl(a6 ^ d1, (uint32_t)44U);
+      uint64_t b20 = Hacl_Impl_SHA3_rotl(a12 ^ d2, (uint32_t)43U);
+      uint64_t b30 = Hacl_Impl_SHA3_rotl(a18 ^ d3, (uint32_t)21U);
+      uint64_t b40 = Hacl_Impl_SHA3_rotl(a24 ^ d4, (uint32_t)14U);
+      e0 = b00 ^ (b10 | b20) ^ Hacl_Impl_SHA3_keccak_rndc[(uint32_t)2U * i0];
+      e1 = b10 ^ (~b20 | b30);
+      e2 = b20 ^ (b30 & b40);
+      e3 = b30 ^ (b40 | b00);
+      e4 = b40 ^ (b00 & b10);
+      uint64_t b01 = Hacl_Impl_SHA3_rotl(a3 ^ d3, (uint32_t)28U);
+      uint64_t b11 = Hacl_Impl_SHA3_rotl(a9 ^ d4, (uint32_t)20U);
+      uint64_t b21 = Hacl_Impl_SHA3_rotl(a10 ^ d0, (uint32_t)3U);
+      uint64_t b31 = Hacl_Impl_SHA3_rotl(a16 ^ d1, (uint32_t)45U);
+      uint64_t b41 = Hacl_Impl_SHA3_rotl(a22 ^ d2, (uint32_t)61U);
+      e5 = b01 ^ (b11 | b21);
+      e6 = b11 ^ (b21 & b31);
+      e7 = b21 ^ (b31 | ~b41);
+      e8 = b31 ^ (b41 | b01);
+      e9 = b41 ^ (b01 & b11);
+      uint64_t b02 = Hacl_Impl_SHA3_rotl(a1 ^ d1, (uint32_t)1U);
+      uint64_t b12 = Hacl_Impl_SHA3_rotl(a7 ^ d2, (uint32_t)6U);
+      uint64_t b22 = Hacl_Impl_SHA3_rotl(a13 ^ d3, (uint32_t)25U);
+      uint64_t b32 = Hacl_Impl_SHA3_rotl(a19 ^ d4, (uint32_t)8U);
+      uint64_t b42 = Hacl_Impl_SHA3_rotl(a20 ^ d0, (uint32_t)18U);
+      e10 = b02 ^ (b12 | b22);
+      e11 = b12 ^ (b22 & b32);
+      e12 = b22 ^ (~b32 & b42);
+      e13 = b32 ^ ~(b42 | b02);
+      e14 = b42 ^ (b02 & b12);
+      uint64_t b03 = Hacl_Impl_SHA3_rotl(a4 ^ d4, (uint32_t)27U);
+      uint64_t b13 = Hacl_Impl_SHA3_rotl(a5 ^ d0, (uint32_t)36U);
+      uint64_t b23 = Hacl_Impl_SHA3_rotl(a11 ^ d1, (uint32_t)10U);
+      uint64_t b33 = Hacl_Impl_SHA3_rotl(a17 ^ d2, (uint32_t)15U);
+      uint64_t b43 = Hacl_Impl_SHA3_rotl(a23 ^ d3, (uint32_t)56U);
+      e15 = b03 ^ (b13 & b23);
+      e16 = b13 ^ (b23 | b33);
+      e17 = b23 ^ (~b33 | b43);
+      e18 = b33 ^ ~(b43 & b03);
+      e19 = b43 ^ (b03 | b13);
+      uint64_t b04 = Hacl_Impl_SHA3_rotl(a2 ^ d2, (uint32_t)62U);
+      uint64_t b14 = Hacl_Impl_SHA3_rotl(a8 ^ d3, (uint32_t)55U);
+      uint64_t b24 = Hacl_Impl_SHA3_rotl(a14 ^ d4, (uint32_t)39U);
+      uint64_t b34 = Hacl_Impl_SHA3_rotl(a15 ^ d0, (uint32_t)41U);
+      uint64_t b44 = Hacl_Impl_SHA3_rotl(a21 ^ d1, (uint32_t)2U);
+      e20 = b04 ^ (~b14 & b24);
+      e21 = b14 ^ ~(b24 | b34);
+      e22 = b24 ^ (b34 & b44);
+      e23 = b34 ^ (b44 | b04);
+      e24 = b44 ^ (b04 & b14);
+    }
+    {
+      uint64_t c0 = e0 ^ e5 ^ e10 ^ e15 ^ e20;
+      uint64_t c1 = e1 ^ e6 ^ e11 ^ e16 ^ e21;
+      uint64_t c2 = e2 ^ e7 ^ e12 ^ e17 ^ e22;
+      uint64_t c3 = e3 ^ e8 ^ e13 ^ e18 ^ e23;
+      uint64_t c4 = e4 ^ e9 ^ e14 ^ e19 ^ e24;
+      uint64_t d0 = c4 ^ Hacl_Impl_SHA3_rotl(c1, (uint32_t)1U);
+      uint64_t d1 = c0 ^ Hacl_Impl_SHA3_rotl(c2, (uint32_t)1U);
+      uint64_t d2 = c1 ^ Hacl_Impl_SHA3_rotl(c3, (uint32_t)1U);
+      uint64_t d3 = c2 ^ Hacl_Impl_SHA3_rotl(c4, (uint32_t)1U);
+      uint64_t d4 = c3 ^ Hacl_Impl_SHA3_rotl(c0, (uint32_t)1U);
+      uint64_t b00 = e0 ^ d0;
+      uint64_t b10 = Hacl_Impl_SHA3_rotl(e6 ^ d1, (uint32_t)44U);
+      uint64_t b20 = Hacl_Impl_SHA3_rotl(e12 ^ d2, (uint32_t)43U);
+      uint64_t b30 = Hacl_Impl_SHA3_rotl(e18 ^ d3, (uint32_t)21U);
+      uint64_t b40 = Hacl_Impl_SHA3_rotl(e24 ^ d4, (uint32_t)14U);
+      a0 = b00 ^ (b10 | b20) ^ Hacl_Impl_SHA3_keccak_rndc[(uint32_t)2U * i0 + (uint32_t)1U];
+      a1 = b10 ^ (~b20 | b30);
+      a2 = b20 ^ (b30 & b40);
+      a3 = b30 ^ (b40 | b00);
+      a4 = b40 ^ (b00 & b10);
+      uint64_t b01 = Hacl_Impl_SHA3_rotl(e3 ^ d3, (uint32_t)28U);
+      uint64_t b11 = Hacl_Impl_SHA3_rotl(e9 ^ d4, (uint32_t)20U);
+      uint64_t b21 = Hacl_Impl_SHA3_rotl(e10 ^ d0, (uint32_t)3U);
+      uint64_t b31 = Hacl_Impl_SHA3_rotl(e16 ^ d1, (uint32_t)45U);
+      uint64_t b41 = Hacl_Impl_SHA3_rotl(e22 ^ d2, (uint32_t)61U);
+      a5 = b01 ^ (b11 | b21);
+      a6 = b11 ^ (b21 & b31);
+      a7 = b21 ^ (b31 | ~b41);
+      a8 = b31 ^ (b41 | b01);
+      a9 = b41 ^ (b01 & b11);
+      uint64_t b02 = Hacl_Impl_SHA3_rotl(e1 ^ d1, (uint32_t)1U);
+      uint64_t b12 = Hacl_Impl_SHA3_rotl(e7 ^ d2, (uint32_t)6U);
+      uint64_t b22 = Hacl_Impl_SHA3_rotl(e13 ^ d3, (uint32_t)25U);
+      uint64_t b32 = Hacl_Impl_SHA3_rotl(e19 ^ d4, (uint32_t)8U);
+      uint64_t b42 = Hacl_Impl_SHA3_rotl(e20 ^ d0, (uint32_t)18U);
+      a10 = b02 ^ (b12 | b22);
+      a11 = b12 ^ (b22 & b32);
+      a12 = b22 ^ (~b32 & b42);
+      a13 = b32 ^ ~(b42 | b02);
+      a14 = b42 ^ (b02 & b12);
+      uint64_t b03 = Hacl_Impl_SHA3_rotl(e4 ^ d4, (uint32_t)27U);
+      uint64_t b13 = Hacl_Impl_SHA3_rotl(e5 ^ d0, (uint32_t)36U);
+      uint64_t b23 = Hacl_Impl_SHA3_rotl(e11 ^ d1, (uint32_t)10U);
+      uint64_t b33 = Hacl_Impl_SHA3_rotl(e17 ^ d2, (uint32_t)15U);
+      uint64_t b43 = Hacl_Impl_SHA3_rotl(e23 ^ d3, (uint32_t)56U);
+      a15 = b03 ^ (b13 & b23);
+      a16 = b13 ^ (b23 | b33);
+      a17 = b23 ^ (~b33 | b43);
+      a18 = b33 ^ ~(b43 & b03);
+      a19 = b43 ^ (b03 | b13);
+      uint64_t b04 = Hacl_Impl_SHA3_rotl(e2 ^ d2, (uint32_t)62U);
+      uint64_t b14 = Hacl_Impl_SHA3_rotl(e8 ^ d3, (uint32_t)55U);
+      uint64_t b24 = Hacl_Impl_SHA3_rotl(e14 ^ d4, (uint32_t)39U);
+      uint64_t b34 = Hacl_Impl_SHA3_rotl(e15 ^ d0, (uint32_t)41U);
+      uint64_t b44 = Hacl_Impl_SHA3_rotl(e21 ^ d1, (uint32_t)2U);
+      a20 = b04 ^ (~b14 & b24);
+      a21 = b14 ^ ~(b24 | b34);
+      a22 = b24 ^ (b34 & b44);
+      a23 = b34 ^ (b44 | b04);
+      a24 = b44 ^ (b04 & b14);
+    }
+  }
+  s[0U] = a0;
+  s[1U] = ~a1;
+  s[2U] = ~a2;
+  s[3U] = a3;
+  s[4U] = a4;
+  s[5U] = a5;
+  s[6U] = a6;
+  s[7U] = a7;
+  s[8U] = ~a8;
+  s[9U] = a9;
+  s[10U] = a10;
+  s[11U] = a11;
+  s[12U] = ~a12;
+  s[13U] = a13;
+  s[14U] = a14;
+  s[15U] = a15;
+  s[16U] = a16;
+  s[17U] = ~a17;
+  s[18U] = a18;
+  s[19U] = a19;
+  s[20U] = ~a20;
+  s[21U] = a21;
+  s[22U] = a22;
+  s[23U] = a23;
+  s[24U] = a24;
+}
+
 void Hacl_Impl_SHA3_state_permute(uint64_t *s)
 {
   for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0++)
@@ -149,6 +365,12 @@ void Hacl_Impl_SHA3_storeState(uint32_t rateInBytes, uint64_t *s, uint8_t *res)
   Lib_Memzero0_memzero(b, (uint32_t)200U * sizeof (b[0U]));
 }
 
+void Hacl_Impl_SHA3_absorb_inner(uint32_t rateInBytes, uint8_t *block, uint64_t *s)
+{
+  Hacl_Impl_SHA3_loadState(rateInBytes, block, s);
+  Hacl_Impl_SHA3_state_permute(s);
+}
+
 void
 Hacl_Impl_SHA3_absorb(
   uint64_t *s,
@@ -163,8 +385,7 @@ Hacl_Impl_SHA3_absorb(
   for (uint32_t i = (uint32_t)0U; i < nb; i++)
   {
     uint8_t *block = input + i * rateInBytes;
-    Hacl_Impl_SHA3_loadState(rateInBytes, block, s);
-    Hacl_Impl_SHA3_state_permute(s);
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, block, s);
   }
   uint8_t *last = input + nb * rateInBytes;
   KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
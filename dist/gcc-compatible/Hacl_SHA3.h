@@ -47,12 +47,23 @@ extern const uint64_t Hacl_Impl_SHA3_keccak_rndc[24U];
 
 uint64_t Hacl_Impl_SHA3_rotl(uint64_t a, uint32_t b);
 
+/*
+  The last [rounds] rounds of Keccak-f[1600]; [rounds] must be even.
+
+  Unrolled and lane-complemented by hand, outside the verified code: only callers that
+  opt in use it (with 24 rounds, as a faster Hacl_Impl_SHA3_state_permute). The SHA-3
+  and SHAKE functions below always use the verified Hacl_Impl_SHA3_state_permute.
+*/
+void Hacl_Impl_SHA3_state_permute_rounds(uint32_t rounds, uint64_t *s);
+
 void Hacl_Impl_SHA3_state_permute(uint64_t *s);
 
 void Hacl_Impl_SHA3_loadState(uint32_t rateInBytes, uint8_t *input, uint64_t *s);
 
 void Hacl_Impl_SHA3_storeState(uint32_t rateInBytes, uint64_t *s, uint8_t *res);
 
+void Hacl_Impl_SHA3_absorb_inner(uint32_t rateInBytes, uint8_t *block, uint64_t *s);
+
 void
 Hacl_Impl_SHA3_absorb(
   uint64_t *s,
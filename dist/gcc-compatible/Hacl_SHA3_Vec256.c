@@ -0,0 +1,458 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA3_Vec256.h"
+
+
+
+void
+Hacl_Impl_SHA3_Vec256_state_permute4_rounds(uint32_t rounds, Lib_IntVector_Intrinsics_vec256 *s)
+{
+  for (uint32_t i0 = (uint32_t)24U - rounds; i0 < (uint32_t)24U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 _C[5U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+    {
+      _C[i] =
+        Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)0U],
+          Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)5U],
+            Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)10U],
+              Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)15U], s[i + (uint32_t)20U]))));
+    }
+    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      _D =
+        Lib_IntVector_Intrinsics_vec256_xor(_C[(i1 + (uint32_t)4U) % (uint32_t)5U],
+          Lib_IntVector_Intrinsics_vec256_rotate_left64(_C[(i1 + (uint32_t)1U) % (uint32_t)5U],
+            (uint32_t)1U));
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+      {
+        s[i1 + (uint32_t)5U * i] = Lib_IntVector_Intrinsics_vec256_xor(s[i1 + (uint32_t)5U * i], _D);
+      }
+    }
+    Lib_IntVector_Intrinsics_vec256 current = s[1U];
+    Lib_IntVector_Intrinsics_vec256 temp0 = s[10U];
+    s[10U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)1U);
+    current = temp0;
+    Lib_IntVector_Intrinsics_vec256 temp1 = s[7U];
+    s[7U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)3U);
+    current = temp1;
+    Lib_IntVector_Intrinsics_vec256 temp2 = s[11U];
+    s[11U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)6U);
+    current = temp2;
+    Lib_IntVector_Intrinsics_vec256 temp3 = s[17U];
+    s[17U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)10U);
+    current = temp3;
+    Lib_IntVector_Intrinsics_vec256 temp4 = s[18U];
+    s[18U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)15U);
+    current = temp4;
+    Lib_IntVector_Intrinsics_vec256 temp5 = s[3U];
+    s[3U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)21U);
+    current = temp5;
+    Lib_IntVector_Intrinsics_vec256 temp6 = s[5U];
+    s[5U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)28U);
+    current = temp6;
+    Lib_IntVector_Intrinsics_vec256 temp7 = s[16U];
+    s[16U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)36U);
+    current = temp7;
+    Lib_IntVector_Intrinsics_vec256 temp8 = s[8U];
+    s[8U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)45U);
+    current = temp8;
+    Lib_IntVector_Intrinsics_vec256 temp9 = s[21U];
+    s[21U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)55U);
+    current = temp9;
+    Lib_IntVector_Intrinsics_vec256 temp10 = s[24U];
+    s[24U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)2U);
+    current = temp10;
+    Lib_IntVector_Intrinsics_vec256 temp11 = s[4U];
+    s[4U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)14U);
+    current = temp11;
+    Lib_IntVector_Intrinsics_vec256 temp12 = s[15U];
+    s[15U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)27U);
+    current = temp12;
+    Lib_IntVector_Intrinsics_vec256 temp13 = s[23U];
+    s[23U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)41U);
+    current = temp13;
+    Lib_IntVector_Intrinsics_vec256 temp14 = s[19U];
+    s[19U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)56U);
+    current = temp14;
+    Lib_IntVector_Intrinsics_vec256 temp15 = s[13U];
+    s[13U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)8U);
+    current = temp15;
+    Lib_IntVector_Intrinsics_vec256 temp16 = s[12U];
+    s[12U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)25U);
+    current = temp16;
+    Lib_IntVector_Intrinsics_vec256 temp17 = s[2U];
+    s[2U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)43U);
+    current = temp17;
+    Lib_IntVector_Intrinsics_vec256 temp18 = s[20U];
+    s[20U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)62U);
+    current = temp18;
+    Lib_IntVector_Intrinsics_vec256 temp19 = s[14U];
+    s[14U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)18U);
+    current = temp19;
+    Lib_IntVector_Intrinsics_vec256 temp20 = s[22U];
+    s[22U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)39U);
+    current = temp20;
+    Lib_IntVector_Intrinsics_vec256 temp21 = s[9U];
+    s[9U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)61U);
+    current = temp21;
+    Lib_IntVector_Intrinsics_vec256 temp22 = s[6U];
+    s[6U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)20U);
+    current = temp22;
+    s[1U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(current, (uint32_t)44U);
+    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
+    {
+      Lib_IntVector_Intrinsics_vec256 b0 = s[(uint32_t)5U * i1 + (uint32_t)0U];
+      Lib_IntVector_Intrinsics_vec256 b1 = s[(uint32_t)5U * i1 + (uint32_t)1U];
+      Lib_IntVector_Intrinsics_vec256 b2 = s[(uint32_t)5U * i1 + (uint32_t)2U];
+      Lib_IntVector_Intrinsics_vec256 b3 = s[(uint32_t)5U * i1 + (uint32_t)3U];
+      Lib_IntVector_Intrinsics_vec256 b4 = s[(uint32_t)5U * i1 + (uint32_t)4U];
+      s[(uint32_t)5U * i1 + (uint32_t)0U] =
+        Lib_IntVector_Intrinsics_vec256_xor(b0,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b1), b2));
+      s[(uint32_t)5U * i1 + (uint32_t)1U] =
+        Lib_IntVector_Intrinsics_vec256_xor(b1,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b2), b3));
+      s[(uint32_t)5U * i1 + (uint32_t)2U] =
+        Lib_IntVector_Intrinsics_vec256_xor(b2,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b3), b4));
+      s[(uint32_t)5U * i1 + (uint32_t)3U] =
+        Lib_IntVector_Intrinsics_vec256_xor(b3,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b4), b0));
+      s[(uint32_t)5U * i1 + (uint32_t)4U] =
+        Lib_IntVector_Intrinsics_vec256_xor(b4,
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b0), b1));
+    }
+    uint64_t c = Hacl_Impl_SHA3_keccak_rndc[i0];
+    s[0U] = Lib_IntVector_Intrinsics_vec256_xor(s[0U], Lib_IntVector_Intrinsics_vec256_load64(c));
+  }
+}
+
+void Hacl_Impl_SHA3_Vec256_state_permute4(Lib_IntVector_Intrinsics_vec256 *s)
+{
+  Hacl_Impl_SHA3_Vec256_state_permute4_rounds((uint32_t)24U, s);
+}
+
+void
+Hacl_Impl_SHA3_Vec256_loadState4(
+  uint32_t rateInBytes,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  Lib_IntVector_Intrinsics_vec256 *s
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < rateInBytes / (uint32_t)8U; i++)
+  {
+    uint64_t u0 = load64_le(input0 + i * (uint32_t)8U);
+    uint64_t u1 = load64_le(input1 + i * (uint32_t)8U);
+    uint64_t u2 = load64_le(input2 + i * (uint32_t)8U);
+    uint64_t u3 = load64_le(input3 + i * (uint32_t)8U);
+    s[i] =
+      Lib_IntVector_Intrinsics_vec256_xor(s[i],
+        Lib_IntVector_Intrinsics_vec256_load64s(u0, u1, u2, u3));
+  }
+}
+
+void
+Hacl_Impl_SHA3_Vec256_storeState4(
+  uint32_t rateInBytes,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint8_t *res0,
+  uint8_t *res1,
+  uint8_t *res2,
+  uint8_t *res3
+)
+{
+  uint8_t b[800U] = { 0U };
+  uint8_t *b0 = b;
+  uint8_t *b1 = b + (uint32_t)200U;
+  uint8_t *b2 = b + (uint32_t)400U;
+  uint8_t *b3 = b + (uint32_t)600U;
+  uint8_t tmp[32U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (rateInBytes + (uint32_t)7U) / (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_le(tmp, s[i]);
+    memcpy(b0 + i * (uint32_t)8U, tmp, (uint32_t)8U * sizeof (uint8_t));
+    memcpy(b1 + i * (uint32_t)8U, tmp + (uint32_t)8U, (uint32_t)8U * sizeof (uint8_t));
+    memcpy(b2 + i * (uint32_t)8U, tmp + (uint32_t)16U, (uint32_t)8U * sizeof (uint8_t));
+    memcpy(b3 + i * (uint32_t)8U, tmp + (uint32_t)24U, (uint32_t)8U * sizeof (uint8_t));
+  }
+  memcpy(res0, b0, rateInBytes * sizeof (uint8_t));
+  memcpy(res1, b1, rateInBytes * sizeof (uint8_t));
+  memcpy(res2, b2, rateInBytes * sizeof (uint8_t));
+  memcpy(res3, b3, rateInBytes * sizeof (uint8_t));
+  Lib_Memzero0_memzero(tmp, (uint32_t)32U * sizeof (tmp[0U]));
+  Lib_Memzero0_memzero(b, (uint32_t)800U * sizeof (b[0U]));
+}
+
+void
+Hacl_Impl_SHA3_Vec256_absorb4(
+  uint32_t rounds,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix
+)
+{
+  uint32_t nb = inputByteLen / rateInBytes;
+  uint32_t rem = inputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Hacl_Impl_SHA3_Vec256_loadState4(rateInBytes,
+      input0 + i * rateInBytes,
+      input1 + i * rateInBytes,
+      input2 + i * rateInBytes,
+      input3 + i * rateInBytes,
+      s);
+    Hacl_Impl_SHA3_Vec256_state_permute4_rounds(rounds, s);
+  }
+  uint8_t b[800U] = { 0U };
+  uint8_t *b0 = b;
+  uint8_t *b1 = b + (uint32_t)200U;
+  uint8_t *b2 = b + (uint32_t)400U;
+  uint8_t *b3 = b + (uint32_t)600U;
+  memcpy(b0, input0 + nb * rateInBytes, rem * sizeof (uint8_t));
+  memcpy(b1, input1 + nb * rateInBytes, rem * sizeof (uint8_t));
+  memcpy(b2, input2 + nb * rateInBytes, rem * sizeof (uint8_t));
+  memcpy(b3, input3 + nb * rateInBytes, rem * sizeof (uint8_t));
+  b0[rem] = delimitedSuffix;
+  b1[rem] = delimitedSuffix;
+  b2[rem] = delimitedSuffix;
+  b3[rem] = delimitedSuffix;
+  Hacl_Impl_SHA3_Vec256_loadState4(rateInBytes, b0, b1, b2, b3, s);
+  if (!((delimitedSuffix & (uint8_t)0x80U) == (uint8_t)0U) && rem == rateInBytes - (uint32_t)1U)
+  {
+    Hacl_Impl_SHA3_Vec256_state_permute4_rounds(rounds, s);
+  }
+  memset(b, 0U, (uint32_t)800U * sizeof (uint8_t));
+  b0[rateInBytes - (uint32_t)1U] = (uint8_t)0x80U;
+  b1[rateInBytes - (uint32_t)1U] = (uint8_t)0x80U;
+  b2[rateInBytes - (uint32_t)1U] = (uint8_t)0x80U;
+  b3[rateInBytes - (uint32_t)1U] = (uint8_t)0x80U;
+  Hacl_Impl_SHA3_Vec256_loadState4(rateInBytes, b0, b1, b2, b3, s);
+  Hacl_Impl_SHA3_Vec256_state_permute4_rounds(rounds, s);
+  Lib_Memzero0_memzero(b, (uint32_t)800U * sizeof (b[0U]));
+}
+
+void
+Hacl_Impl_SHA3_Vec256_squeeze4(
+  uint32_t rounds,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t outBlocks = outputByteLen / rateInBytes;
+  uint32_t remOut = outputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < outBlocks; i++)
+  {
+    Hacl_Impl_SHA3_Vec256_storeState4(rateInBytes,
+      s,
+      output0 + i * rateInBytes,
+      output1 + i * rateInBytes,
+      output2 + i * rateInBytes,
+      output3 + i * rateInBytes);
+    Hacl_Impl_SHA3_Vec256_state_permute4_rounds(rounds, s);
+  }
+  Hacl_Impl_SHA3_Vec256_storeState4(remOut,
+    s,
+    output0 + outputByteLen - remOut,
+    output1 + outputByteLen - remOut,
+    output2 + outputByteLen - remOut,
+    output3 + outputByteLen - remOut);
+}
+
+void
+Hacl_Impl_SHA3_Vec256_keccak4(
+  uint32_t rounds,
+  uint32_t rate,
+  uint32_t capacity,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t rateInBytes = rate / (uint32_t)8U;
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    s[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Impl_SHA3_Vec256_absorb4(rounds,
+    s,
+    rateInBytes,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    delimitedSuffix);
+  Hacl_Impl_SHA3_Vec256_squeeze4(rounds,
+    s,
+    rateInBytes,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake128_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Impl_SHA3_Vec256_keccak4((uint32_t)24U,
+    (uint32_t)1344U,
+    (uint32_t)256U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake256_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Impl_SHA3_Vec256_keccak4((uint32_t)24U,
+    (uint32_t)1088U,
+    (uint32_t)512U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_256_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Impl_SHA3_Vec256_keccak4((uint32_t)24U,
+    (uint32_t)1088U,
+    (uint32_t)512U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x06U,
+    (uint32_t)32U,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_turboshake128_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Impl_SHA3_Vec256_keccak4((uint32_t)12U,
+    (uint32_t)1344U,
+    (uint32_t)256U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    domain,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
@@ -0,0 +1,189 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_SHA3_Vec256_H
+#define __Hacl_SHA3_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_SHA3.h"
+#include "Lib_Memzero0.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  Four independent Keccak-f[1600] states, one per 64-bit lane of each vector:
+  s[i] holds lane i of the four states. Rates must be multiples of 8 bytes,
+  which is the case for every SHA-3 and SHAKE instance.
+*/
+void
+Hacl_Impl_SHA3_Vec256_state_permute4_rounds(uint32_t rounds, Lib_IntVector_Intrinsics_vec256 *s);
+
+void Hacl_Impl_SHA3_Vec256_state_permute4(Lib_IntVector_Intrinsics_vec256 *s);
+
+void
+Hacl_Impl_SHA3_Vec256_loadState4(
+  uint32_t rateInBytes,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  Lib_IntVector_Intrinsics_vec256 *s
+);
+
+void
+Hacl_Impl_SHA3_Vec256_storeState4(
+  uint32_t rateInBytes,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint8_t *res0,
+  uint8_t *res1,
+  uint8_t *res2,
+  uint8_t *res3
+);
+
+void
+Hacl_Impl_SHA3_Vec256_absorb4(
+  uint32_t rounds,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix
+);
+
+void
+Hacl_Impl_SHA3_Vec256_squeeze4(
+  uint32_t rounds,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+void
+Hacl_Impl_SHA3_Vec256_keccak4(
+  uint32_t rounds,
+  uint32_t rate,
+  uint32_t capacity,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+/*
+  SHAKE128 of four inputs of the same length, computed in parallel
+*/
+void
+Hacl_SHA3_Vec256_shake128_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+/*
+  SHAKE256 of four inputs of the same length, computed in parallel
+*/
+void
+Hacl_SHA3_Vec256_shake256_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+/*
+  SHA3-256 of four inputs of the same length, computed in parallel
+*/
+void
+Hacl_SHA3_Vec256_sha3_256_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+/*
+  TurboSHAKE128 (Keccak-p[1600, 12] at the SHAKE128 rate) of four inputs of the
+  same length, with domain separation byte [domain] in 0x01..0x7F
+*/
+void
+Hacl_SHA3_Vec256_turboshake128_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t domain,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_SHA3_Vec256_H_DEFINED
+#endif
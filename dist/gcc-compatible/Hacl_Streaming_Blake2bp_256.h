@@ -0,0 +1,81 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Streaming_Blake2bp_256_H
+#define __Hacl_Streaming_Blake2bp_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_Hash_Blake2bp_256.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+typedef struct Hacl_Streaming_Blake2bp_256_blake2bp_256_state_s
+{
+  Lib_IntVector_Intrinsics_vec256 *block_state;
+  uint64_t *counters;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_Streaming_Blake2bp_256_blake2bp_256_state;
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2bp_256_blake2bp_256_state *Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_create_in();
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_init(Hacl_Streaming_Blake2bp_256_blake2bp_256_state *s);
+
+/*
+  Update function when there is no key
+*/
+void Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_update(Hacl_Streaming_Blake2bp_256_blake2bp_256_state *p, uint8_t *data, uint32_t len);
+
+/*
+  Finish function when there is no key
+*/
+void Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_finish(Hacl_Streaming_Blake2bp_256_blake2bp_256_state *p, uint8_t *dst);
+
+/*
+  Free state function when there is no key
+*/
+void Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_free(Hacl_Streaming_Blake2bp_256_blake2bp_256_state *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_Blake2bp_256_H_DEFINED
+#endif
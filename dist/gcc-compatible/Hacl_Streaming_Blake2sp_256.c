@@ -0,0 +1,143 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Streaming_Blake2sp_256.h"
+
+#include "internal/Hacl_Hash_Blake2sp_256.h"
+
+/* The buffer holds the data that cannot be compressed yet: a stripe of
+   8 blocks is only compressed once more than 448 bytes follow it, so
+   that every leaf is known to receive more data. Its length is therefore a
+   function of total_len, at most 960 bytes. */
+static uint32_t buffered_len(uint64_t total_len)
+{
+  if (total_len <= (uint64_t)960U)
+  {
+    return (uint32_t)total_len;
+  }
+  return (uint32_t)449U + (uint32_t)((total_len - (uint64_t)449U) % (uint64_t)512U);
+}
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2sp_256_blake2sp_256_state *Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_create_in()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)960U, sizeof (uint8_t));
+  Lib_IntVector_Intrinsics_vec256
+  *block_state =
+    (Lib_IntVector_Intrinsics_vec256 *)KRML_ALIGNED_MALLOC(32,
+      sizeof (Lib_IntVector_Intrinsics_vec256) * (uint32_t)8U);
+  uint64_t *counters = KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_state
+  s = { .block_state = block_state, .counters = counters, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_Blake2sp_256_blake2sp_256_state), (uint32_t)1U);
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_state *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_Blake2sp_256_blake2sp_256_state));
+  p[0U] = s;
+  Hacl_Hash_Blake2sp_256_init_leaves(block_state, counters, (uint32_t)0U, (uint32_t)32U);
+  return p;
+}
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_init(Hacl_Streaming_Blake2sp_256_blake2sp_256_state *s)
+{
+  Hacl_Hash_Blake2sp_256_init_leaves(s->block_state, s->counters, (uint32_t)0U, (uint32_t)32U);
+  s->total_len = (uint64_t)0U;
+}
+
+/*
+  Update function when there is no key
+*/
+void Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_update(Hacl_Streaming_Blake2sp_256_blake2sp_256_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_state s = *p;
+  uint8_t *buf = s.buf;
+  uint32_t sz = buffered_len(s.total_len);
+  uint8_t *data1 = data;
+  uint32_t len1 = len;
+  while (len1 > (uint32_t)960U - sz)
+  {
+    if (sz == (uint32_t)0U)
+    {
+      /* Nothing buffered: compress the input in place. */
+      uint32_t n_stripes = (len1 - (uint32_t)449U) / (uint32_t)512U;
+      Hacl_Hash_Blake2sp_256_update_stripes(s.block_state, s.counters, data1, n_stripes);
+      data1 = data1 + n_stripes * (uint32_t)512U;
+      len1 = len1 - n_stripes * (uint32_t)512U;
+    }
+    else if (sz < (uint32_t)512U)
+    {
+      uint32_t diff = (uint32_t)512U - sz;
+      memcpy(buf + sz, data1, diff * sizeof (uint8_t));
+      Hacl_Hash_Blake2sp_256_update_stripes(s.block_state, s.counters, buf, (uint32_t)1U);
+      data1 = data1 + diff;
+      len1 = len1 - diff;
+      sz = (uint32_t)0U;
+    }
+    else
+    {
+      Hacl_Hash_Blake2sp_256_update_stripes(s.block_state, s.counters, buf, (uint32_t)1U);
+      memmove(buf, buf + (uint32_t)512U, (sz - (uint32_t)512U) * sizeof (uint8_t));
+      sz = sz - (uint32_t)512U;
+    }
+  }
+  memcpy(buf + sz, data1, len1 * sizeof (uint8_t));
+  p->total_len = s.total_len + (uint64_t)len;
+}
+
+/*
+  Finish function when there is no key
+*/
+void Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_finish(Hacl_Streaming_Blake2sp_256_blake2sp_256_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_state s = *p;
+  Lib_IntVector_Intrinsics_vec256 h[8U];
+  uint64_t t[8U];
+  memcpy(h, s.block_state, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  memcpy(t, s.counters, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_Blake2sp_256_finish(h,
+    t,
+    (uint32_t)0U,
+    NULL,
+    s.buf,
+    buffered_len(s.total_len),
+    (uint32_t)32U,
+    dst);
+}
+
+/*
+  Free state function when there is no key
+*/
+void Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_free(Hacl_Streaming_Blake2sp_256_blake2sp_256_state *s)
+{
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_state scrut = *s;
+  KRML_ALIGNED_FREE(scrut.block_state);
+  KRML_HOST_FREE(scrut.counters);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(s);
+}
+
@@ -31,7 +31,9 @@ Hacl_Streaming_Poly1305_256_poly1305_256_state
 {
   uint8_t *buf = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
   Lib_IntVector_Intrinsics_vec256
-  *r1 = KRML_HOST_MALLOC(sizeof (Lib_IntVector_Intrinsics_vec256) * (uint32_t)25U);
+  *r1 =
+    (Lib_IntVector_Intrinsics_vec256 *)KRML_ALIGNED_MALLOC(32,
+      sizeof (Lib_IntVector_Intrinsics_vec256) * (uint32_t)25U);
   for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
     r1[_i] = Lib_IntVector_Intrinsics_vec256_zero;
   Lib_IntVector_Intrinsics_vec256 *block_state = r1;
@@ -331,7 +333,7 @@ void Hacl_Streaming_Poly1305_256_free(Hacl_Streaming_Poly1305_256_poly1305_256_s
   uint8_t *buf = scrut.buf;
   Lib_IntVector_Intrinsics_vec256 *block_state = scrut.block_state;
   KRML_HOST_FREE(k_);
-  KRML_HOST_FREE(block_state);
+  KRML_ALIGNED_FREE(block_state);
   KRML_HOST_FREE(buf);
   KRML_HOST_FREE(s);
 }
@@ -0,0 +1,812 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Streaming_SHA2_Vec256.h"
+
+#include "internal/Hacl_SHA2_Vec256.h"
+
+typedef
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
+multibuf8;
+
+typedef K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ multibuf4;
+
+/* One round of the 8-way kernel. blocks[i] == NULL means that lane i has no
+   block this round: it is fed a dummy block and its state is restored
+   afterwards. */
+static inline void update_blocks_256(uint32_t *block_state, uint8_t **blocks)
+{
+  uint8_t dummy[64U] = { 0U };
+  uint8_t *b[8U];
+  uint32_t m[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    b[i] = blocks[i] == NULL ? dummy : blocks[i];
+    m[i] = blocks[i] == NULL ? (uint32_t)0U : (uint32_t)0xffffffffU;
+  }
+  multibuf8
+  mb =
+    {
+      .fst = b[0U],
+      .snd = {
+        .fst = b[1U],
+        .snd = {
+          .fst = b[2U],
+          .snd = {
+            .fst = b[3U],
+            .snd = { .fst = b[4U], .snd = { .fst = b[5U], .snd = { .fst = b[6U], .snd = b[7U] } } }
+          }
+        }
+      }
+    };
+  Lib_IntVector_Intrinsics_vec256 hash[8U];
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec256_load32_le((uint8_t *)(block_state + i * (uint32_t)8U));
+    hash_old[i] = hash[i];
+  }
+  Hacl_SHA2_Vec256_sha256_update8(mb, hash);
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_load32s(m[0U], m[1U], m[2U], m[3U], m[4U], m[5U], m[6U], m[7U]);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x =
+      Lib_IntVector_Intrinsics_vec256_xor(hash_old[i],
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_xor(hash[i], hash_old[i]),
+          mask));
+    Lib_IntVector_Intrinsics_vec256_store32_le((uint8_t *)(block_state + i * (uint32_t)8U), x);
+  }
+}
+
+static inline void update_blocks_512(uint64_t *block_state, uint8_t **blocks)
+{
+  uint8_t dummy[128U] = { 0U };
+  uint8_t *b[4U];
+  uint64_t m[4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    b[i] = blocks[i] == NULL ? dummy : blocks[i];
+    m[i] = blocks[i] == NULL ? (uint64_t)0U : (uint64_t)0xffffffffffffffffU;
+  }
+  multibuf4 mb = { .fst = b[0U], .snd = { .fst = b[1U], .snd = { .fst = b[2U], .snd = b[3U] } } };
+  Lib_IntVector_Intrinsics_vec256 hash[8U];
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec256_load64_le((uint8_t *)(block_state + i * (uint32_t)4U));
+    hash_old[i] = hash[i];
+  }
+  Hacl_SHA2_Vec256_sha512_update4(mb, hash);
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_load64s(m[0U], m[1U], m[2U], m[3U]);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x =
+      Lib_IntVector_Intrinsics_vec256_xor(hash_old[i],
+        Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_xor(hash[i], hash_old[i]),
+          mask));
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)(block_state + i * (uint32_t)4U), x);
+  }
+}
+
+/* Writes the padded final block(s) of a message of total_len bytes, whose last
+   len (< 64) bytes are in buf, to last (128 bytes). Returns the number of
+   blocks. */
+static inline uint32_t pad_256(uint64_t total_len, uint8_t *buf, uint32_t len, uint8_t *last)
+{
+  uint32_t nb;
+  if (len + (uint32_t)9U <= (uint32_t)64U)
+  {
+    nb = (uint32_t)1U;
+  }
+  else
+  {
+    nb = (uint32_t)2U;
+  }
+  memset(last, 0U, (uint32_t)128U * sizeof (uint8_t));
+  memcpy(last, buf, len * sizeof (uint8_t));
+  last[len] = (uint8_t)0x80U;
+  store64_be(last + nb * (uint32_t)64U - (uint32_t)8U, total_len << (uint32_t)3U);
+  return nb;
+}
+
+static inline uint32_t pad_512(uint64_t total_len, uint8_t *buf, uint32_t len, uint8_t *last)
+{
+  uint32_t nb;
+  if (len + (uint32_t)17U <= (uint32_t)128U)
+  {
+    nb = (uint32_t)1U;
+  }
+  else
+  {
+    nb = (uint32_t)2U;
+  }
+  memset(last, 0U, (uint32_t)256U * sizeof (uint8_t));
+  memcpy(last, buf, len * sizeof (uint8_t));
+  last[len] = (uint8_t)0x80U;
+  store64_be(last + nb * (uint32_t)128U - (uint32_t)16U, total_len >> (uint32_t)61U);
+  store64_be(last + nb * (uint32_t)128U - (uint32_t)8U, total_len << (uint32_t)3U);
+  return nb;
+}
+
+Hacl_Streaming_SHA2_Vec256_state_sha2_256 *Hacl_Streaming_SHA2_Vec256_create_in_256()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)512U, sizeof (uint8_t));
+  uint32_t *block_state = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint32_t));
+  uint64_t *total_len = KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256
+  s = { .block_state = block_state, .buf = buf, .total_len = total_len };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA2_Vec256_state_sha2_256), (uint32_t)1U);
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA2_Vec256_state_sha2_256));
+  p[0U] = s;
+  Hacl_Streaming_SHA2_Vec256_init_256(p);
+  return p;
+}
+
+void Hacl_Streaming_SHA2_Vec256_init_256(Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Streaming_SHA2_Vec256_init_lane_256(s, i);
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_init_lane_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint32_t lane
+)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 scrut = *s;
+  uint32_t *block_state = scrut.block_state;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    block_state[i * (uint32_t)8U + lane] = Hacl_Impl_SHA2_Generic_h256[i];
+  }
+  scrut.total_len[lane] = (uint64_t)0U;
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_update_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint8_t **data,
+  uint32_t *len
+)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 scrut = *s;
+  uint32_t *block_state = scrut.block_state;
+  uint8_t *buf = scrut.buf;
+  uint64_t *total_len = scrut.total_len;
+  uint8_t *cur[8U];
+  uint32_t rem[8U];
+  bool pending[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t sz = (uint32_t)(total_len[i] % (uint64_t)64U);
+    uint8_t *buf_i = buf + i * (uint32_t)64U;
+    total_len[i] = total_len[i] + (uint64_t)len[i];
+    pending[i] = false;
+    if (len[i] == (uint32_t)0U)
+    {
+      /* Idle lane (e.g. from update_lane): data[i] may be NULL. */
+      cur[i] = NULL;
+      rem[i] = (uint32_t)0U;
+    }
+    else if (len[i] < (uint32_t)64U - sz)
+    {
+      /* Not enough to complete the partial block: just buffer. */
+      memcpy(buf_i + sz, data[i], len[i] * sizeof (uint8_t));
+      cur[i] = NULL;
+      rem[i] = (uint32_t)0U;
+    }
+    else if (sz > (uint32_t)0U)
+    {
+      uint32_t diff = (uint32_t)64U - sz;
+      memcpy(buf_i + sz, data[i], diff * sizeof (uint8_t));
+      pending[i] = true;
+      cur[i] = data[i] + diff;
+      rem[i] = len[i] - diff;
+    }
+    else
+    {
+      cur[i] = data[i];
+      rem[i] = len[i];
+    }
+  }
+  while (true)
+  {
+    uint8_t *blocks[8U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (pending[i])
+      {
+        blocks[i] = buf + i * (uint32_t)64U;
+        pending[i] = false;
+        any = true;
+      }
+      else if (rem[i] >= (uint32_t)64U)
+      {
+        blocks[i] = cur[i];
+        cur[i] = cur[i] + (uint32_t)64U;
+        rem[i] = rem[i] - (uint32_t)64U;
+        any = true;
+      }
+      else
+      {
+        blocks[i] = NULL;
+      }
+    }
+    if (!any)
+    {
+      break;
+    }
+    update_blocks_256(block_state, blocks);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (rem[i] > (uint32_t)0U)
+    {
+      memcpy(buf + i * (uint32_t)64U, cur[i], rem[i] * sizeof (uint8_t));
+    }
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_update_lane_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint32_t lane,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  uint8_t *data8[8U] = { NULL };
+  uint32_t len8[8U] = { 0U };
+  data8[lane] = data;
+  len8[lane] = len;
+  Hacl_Streaming_SHA2_Vec256_update_256(s, data8, len8);
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint8_t **dst
+)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *total_len = scrut.total_len;
+  uint32_t tmp_block_state[64U];
+  memcpy(tmp_block_state, scrut.block_state, (uint32_t)64U * sizeof (uint32_t));
+  uint8_t last[1024U];
+  uint32_t nb[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (dst[i] != NULL)
+    {
+      nb[i] =
+        pad_256(total_len[i],
+          buf + i * (uint32_t)64U,
+          (uint32_t)(total_len[i] % (uint64_t)64U),
+          last + i * (uint32_t)128U);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)2U; j++)
+  {
+    uint8_t *blocks[8U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (j < nb[i])
+      {
+        blocks[i] = last + i * (uint32_t)128U + j * (uint32_t)64U;
+        any = true;
+      }
+      else
+      {
+        blocks[i] = NULL;
+      }
+    }
+    if (any)
+    {
+      update_blocks_256(tmp_block_state, blocks);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (dst[i] != NULL)
+    {
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        store32_be(dst[i] + j * (uint32_t)4U, tmp_block_state[j * (uint32_t)8U + i]);
+      }
+    }
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_lane_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint32_t lane,
+  uint8_t *dst
+)
+{
+  uint8_t *dst8[8U] = { NULL };
+  dst8[lane] = dst;
+  Hacl_Streaming_SHA2_Vec256_finish_256(s, dst8);
+}
+
+void Hacl_Streaming_SHA2_Vec256_free_256(Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 scrut = *s;
+  KRML_HOST_FREE(scrut.total_len);
+  KRML_HOST_FREE(scrut.block_state);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(s);
+}
+
+static inline void
+hash_many_256(
+  const uint32_t *h0,
+  uint32_t hash_len,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  uint32_t block_state[64U] = { 0U };
+  uint8_t last[1024U];
+  uint32_t job[8U];
+  uint32_t off[8U];
+  uint32_t nb[8U];
+  uint32_t nb_done[8U];
+  bool busy[8U];
+  uint32_t next = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    busy[i] = false;
+  }
+  while (true)
+  {
+    uint8_t *blocks[8U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (!busy[i] && next < n)
+      {
+        /* Refill the lane with the next message in the queue. */
+        job[i] = next;
+        next++;
+        off[i] = (uint32_t)0U;
+        nb[i] = (uint32_t)0U;
+        nb_done[i] = (uint32_t)0U;
+        busy[i] = true;
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          block_state[j * (uint32_t)8U + i] = h0[j];
+        }
+      }
+      if (!busy[i])
+      {
+        blocks[i] = NULL;
+        continue;
+      }
+      uint32_t len = input_len[job[i]];
+      uint32_t full = len - len % (uint32_t)64U;
+      if (off[i] < full)
+      {
+        blocks[i] = input[job[i]] + off[i];
+        off[i] = off[i] + (uint32_t)64U;
+      }
+      else
+      {
+        if (nb[i] == (uint32_t)0U)
+        {
+          nb[i] =
+            pad_256((uint64_t)len,
+              input[job[i]] + full,
+              len - full,
+              last + i * (uint32_t)128U);
+        }
+        blocks[i] = last + i * (uint32_t)128U + nb_done[i] * (uint32_t)64U;
+        nb_done[i]++;
+      }
+      any = true;
+    }
+    if (!any)
+    {
+      break;
+    }
+    update_blocks_256(block_state, blocks);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (busy[i] && nb[i] != (uint32_t)0U && nb_done[i] == nb[i])
+      {
+        uint8_t out[32U] = { 0U };
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          store32_be(out + j * (uint32_t)4U, block_state[j * (uint32_t)8U + i]);
+        }
+        memcpy(dst[job[i]], out, hash_len * sizeof (uint8_t));
+        busy[i] = false;
+      }
+    }
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_224(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_256(Hacl_Impl_SHA2_Generic_h224, (uint32_t)28U, n, dst, input_len, input);
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_256(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_256(Hacl_Impl_SHA2_Generic_h256, (uint32_t)32U, n, dst, input_len, input);
+}
+
+Hacl_Streaming_SHA2_Vec256_state_sha2_512 *Hacl_Streaming_SHA2_Vec256_create_in_512()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)512U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint64_t));
+  uint64_t *total_len = KRML_HOST_CALLOC((uint32_t)4U, sizeof (uint64_t));
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512
+  s = { .block_state = block_state, .buf = buf, .total_len = total_len };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA2_Vec256_state_sha2_512), (uint32_t)1U);
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA2_Vec256_state_sha2_512));
+  p[0U] = s;
+  Hacl_Streaming_SHA2_Vec256_init_512(p);
+  return p;
+}
+
+void Hacl_Streaming_SHA2_Vec256_init_512(Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Hacl_Streaming_SHA2_Vec256_init_lane_512(s, i);
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_init_lane_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint32_t lane
+)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 scrut = *s;
+  uint64_t *block_state = scrut.block_state;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    block_state[i * (uint32_t)4U + lane] = Hacl_Impl_SHA2_Generic_h512[i];
+  }
+  scrut.total_len[lane] = (uint64_t)0U;
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_update_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint8_t **data,
+  uint32_t *len
+)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 scrut = *s;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf = scrut.buf;
+  uint64_t *total_len = scrut.total_len;
+  uint8_t *cur[4U];
+  uint32_t rem[4U];
+  bool pending[4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t sz = (uint32_t)(total_len[i] % (uint64_t)128U);
+    uint8_t *buf_i = buf + i * (uint32_t)128U;
+    total_len[i] = total_len[i] + (uint64_t)len[i];
+    pending[i] = false;
+    if (len[i] == (uint32_t)0U)
+    {
+      /* Idle lane (e.g. from update_lane): data[i] may be NULL. */
+      cur[i] = NULL;
+      rem[i] = (uint32_t)0U;
+    }
+    else if (len[i] < (uint32_t)128U - sz)
+    {
+      memcpy(buf_i + sz, data[i], len[i] * sizeof (uint8_t));
+      cur[i] = NULL;
+      rem[i] = (uint32_t)0U;
+    }
+    else if (sz > (uint32_t)0U)
+    {
+      uint32_t diff = (uint32_t)128U - sz;
+      memcpy(buf_i + sz, data[i], diff * sizeof (uint8_t));
+      pending[i] = true;
+      cur[i] = data[i] + diff;
+      rem[i] = len[i] - diff;
+    }
+    else
+    {
+      cur[i] = data[i];
+      rem[i] = len[i];
+    }
+  }
+  while (true)
+  {
+    uint8_t *blocks[4U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      if (pending[i])
+      {
+        blocks[i] = buf + i * (uint32_t)128U;
+        pending[i] = false;
+        any = true;
+      }
+      else if (rem[i] >= (uint32_t)128U)
+      {
+        blocks[i] = cur[i];
+        cur[i] = cur[i] + (uint32_t)128U;
+        rem[i] = rem[i] - (uint32_t)128U;
+        any = true;
+      }
+      else
+      {
+        blocks[i] = NULL;
+      }
+    }
+    if (!any)
+    {
+      break;
+    }
+    update_blocks_512(block_state, blocks);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    if (rem[i] > (uint32_t)0U)
+    {
+      memcpy(buf + i * (uint32_t)128U, cur[i], rem[i] * sizeof (uint8_t));
+    }
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_update_lane_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint32_t lane,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  uint8_t *data4[4U] = { NULL };
+  uint32_t len4[4U] = { 0U };
+  data4[lane] = data;
+  len4[lane] = len;
+  Hacl_Streaming_SHA2_Vec256_update_512(s, data4, len4);
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint8_t **dst
+)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *total_len = scrut.total_len;
+  uint64_t tmp_block_state[32U];
+  memcpy(tmp_block_state, scrut.block_state, (uint32_t)32U * sizeof (uint64_t));
+  uint8_t last[1024U];
+  uint32_t nb[4U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    if (dst[i] != NULL)
+    {
+      nb[i] =
+        pad_512(total_len[i],
+          buf + i * (uint32_t)128U,
+          (uint32_t)(total_len[i] % (uint64_t)128U),
+          last + i * (uint32_t)256U);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)2U; j++)
+  {
+    uint8_t *blocks[4U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      if (j < nb[i])
+      {
+        blocks[i] = last + i * (uint32_t)256U + j * (uint32_t)128U;
+        any = true;
+      }
+      else
+      {
+        blocks[i] = NULL;
+      }
+    }
+    if (any)
+    {
+      update_blocks_512(tmp_block_state, blocks);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    if (dst[i] != NULL)
+    {
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        store64_be(dst[i] + j * (uint32_t)8U, tmp_block_state[j * (uint32_t)4U + i]);
+      }
+    }
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_lane_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint32_t lane,
+  uint8_t *dst
+)
+{
+  uint8_t *dst4[4U] = { NULL };
+  dst4[lane] = dst;
+  Hacl_Streaming_SHA2_Vec256_finish_512(s, dst4);
+}
+
+void Hacl_Streaming_SHA2_Vec256_free_512(Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s)
+{
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 scrut = *s;
+  KRML_HOST_FREE(scrut.total_len);
+  KRML_HOST_FREE(scrut.block_state);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(s);
+}
+
+static inline void
+hash_many_512(
+  const uint64_t *h0,
+  uint32_t hash_len,
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  uint64_t block_state[32U] = { 0U };
+  uint8_t last[1024U];
+  uint32_t job[4U];
+  uint32_t off[4U];
+  uint32_t nb[4U];
+  uint32_t nb_done[4U];
+  bool busy[4U];
+  uint32_t next = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    busy[i] = false;
+  }
+  while (true)
+  {
+    uint8_t *blocks[4U];
+    bool any = false;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      if (!busy[i] && next < n)
+      {
+        job[i] = next;
+        next++;
+        off[i] = (uint32_t)0U;
+        nb[i] = (uint32_t)0U;
+        nb_done[i] = (uint32_t)0U;
+        busy[i] = true;
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          block_state[j * (uint32_t)4U + i] = h0[j];
+        }
+      }
+      if (!busy[i])
+      {
+        blocks[i] = NULL;
+        continue;
+      }
+      uint32_t len = input_len[job[i]];
+      uint32_t full = len - len % (uint32_t)128U;
+      if (off[i] < full)
+      {
+        blocks[i] = input[job[i]] + off[i];
+        off[i] = off[i] + (uint32_t)128U;
+      }
+      else
+      {
+        if (nb[i] == (uint32_t)0U)
+        {
+          nb[i] =
+            pad_512((uint64_t)len,
+              input[job[i]] + full,
+              len - full,
+              last + i * (uint32_t)256U);
+        }
+        blocks[i] = last + i * (uint32_t)256U + nb_done[i] * (uint32_t)128U;
+        nb_done[i]++;
+      }
+      any = true;
+    }
+    if (!any)
+    {
+      break;
+    }
+    update_blocks_512(block_state, blocks);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      if (busy[i] && nb[i] != (uint32_t)0U && nb_done[i] == nb[i])
+      {
+        uint8_t out[64U] = { 0U };
+        for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+        {
+          store64_be(out + j * (uint32_t)8U, block_state[j * (uint32_t)4U + i]);
+        }
+        memcpy(dst[job[i]], out, hash_len * sizeof (uint8_t));
+        busy[i] = false;
+      }
+    }
+  }
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_384(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_512(Hacl_Impl_SHA2_Generic_h384, (uint32_t)48U, n, dst, input_len, input);
+}
+
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_512(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+)
+{
+  hash_many_512(Hacl_Impl_SHA2_Generic_h512, (uint32_t)64U, n, dst, input_len, input);
+}
+
@@ -0,0 +1,217 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Streaming_SHA2_Vec256_H
+#define __Hacl_Streaming_SHA2_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_SHA2_Vec256.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  Multi-lane streaming state for SHA2-256: eight independent messages hashed
+  side by side with the 8-way AVX2 compression function.
+
+  The hash state is stored word-major (word i of lane j lives at
+  block_state[8 * i + j]) so that it can be fed directly to the vectorized
+  kernel. Each lane has its own 64-byte partial block and its own length.
+*/
+typedef struct Hacl_Streaming_SHA2_Vec256_state_sha2_256_s
+{
+  uint32_t *block_state;
+  uint8_t *buf;
+  uint64_t *total_len;
+}
+Hacl_Streaming_SHA2_Vec256_state_sha2_256;
+
+/*
+  Multi-lane streaming state for SHA2-512: four independent messages hashed
+  side by side. Same layout as above, with 64-bit words and 128-byte blocks.
+*/
+typedef struct Hacl_Streaming_SHA2_Vec256_state_sha2_512_s
+{
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t *total_len;
+}
+Hacl_Streaming_SHA2_Vec256_state_sha2_512;
+
+Hacl_Streaming_SHA2_Vec256_state_sha2_256 *Hacl_Streaming_SHA2_Vec256_create_in_256();
+
+/*
+  Reset all eight lanes.
+*/
+void Hacl_Streaming_SHA2_Vec256_init_256(Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s);
+
+/*
+  Reset a single lane (lane < 8), leaving the other lanes untouched. This is
+  how a finished lane is refilled with a new message.
+*/
+void
+Hacl_Streaming_SHA2_Vec256_init_lane_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint32_t lane
+);
+
+/*
+  Feed data[i] (of length len[i]) to lane i, for all eight lanes at once. A lane
+  with len[i] = 0 is left untouched. Every round of the vectorized kernel
+  advances all the lanes that have a full block available; the other lanes are
+  masked out and keep their state.
+*/
+void
+Hacl_Streaming_SHA2_Vec256_update_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint8_t **data,
+  uint32_t *len
+);
+
+void
+Hacl_Streaming_SHA2_Vec256_update_lane_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint32_t lane,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Write the digest of lane i to dst[i] for every lane where dst[i] is not NULL.
+  The final blocks of all requested lanes are processed together. As with the
+  single-lane streaming API, the state is not modified and may be updated
+  further.
+*/
+void
+Hacl_Streaming_SHA2_Vec256_finish_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint8_t **dst
+);
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_lane_256(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s,
+  uint32_t lane,
+  uint8_t *dst
+);
+
+void Hacl_Streaming_SHA2_Vec256_free_256(Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s);
+
+/*
+  Hash n messages of arbitrary (and possibly different) lengths: dst[i] receives
+  the SHA2-256 digest of input[i], of length input_len[i]. Messages are pulled
+  from the array as lanes become free, so the eight lanes stay busy until fewer
+  than eight messages remain.
+*/
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_256(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+/*
+  As hash_many_256, for SHA2-224
+*/
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_224(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+Hacl_Streaming_SHA2_Vec256_state_sha2_512 *Hacl_Streaming_SHA2_Vec256_create_in_512();
+
+void Hacl_Streaming_SHA2_Vec256_init_512(Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s);
+
+void
+Hacl_Streaming_SHA2_Vec256_init_lane_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint32_t lane
+);
+
+void
+Hacl_Streaming_SHA2_Vec256_update_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint8_t **data,
+  uint32_t *len
+);
+
+void
+Hacl_Streaming_SHA2_Vec256_update_lane_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint32_t lane,
+  uint8_t *data,
+  uint32_t len
+);
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint8_t **dst
+);
+
+void
+Hacl_Streaming_SHA2_Vec256_finish_lane_512(
+  Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s,
+  uint32_t lane,
+  uint8_t *dst
+);
+
+void Hacl_Streaming_SHA2_Vec256_free_512(Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s);
+
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_512(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+/*
+  As hash_many_512, for SHA2-384
+*/
+void
+Hacl_Streaming_SHA2_Vec256_hash_many_384(
+  uint32_t n,
+  uint8_t **dst,
+  uint32_t *input_len,
+  uint8_t **input
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_SHA2_Vec256_H_DEFINED
+#endif
@@ -0,0 +1,254 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_SHA3.h"
+
+
+
+uint32_t Hacl_Streaming_SHA3_block_len(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)144U;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)136U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)104U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)72U;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        return (uint32_t)168U;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        return (uint32_t)136U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+uint32_t Hacl_Streaming_SHA3_hash_len(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)28U;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)48U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)64U;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        return (uint32_t)0U;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        return (uint32_t)0U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+bool Hacl_Streaming_SHA3_is_shake(Hacl_Streaming_SHA3_state *s)
+{
+  Spec_Hash_Definitions_hash_alg a = s->alg;
+  return a == Spec_Hash_Definitions_Shake128 || a == Spec_Hash_Definitions_Shake256;
+}
+
+Hacl_Streaming_SHA3_state *Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_hash_alg a)
+{
+  uint32_t block_len = Hacl_Streaming_SHA3_block_len(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), block_len);
+  uint8_t *buf = KRML_HOST_CALLOC(block_len, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state
+  s =
+    {
+      .alg = a,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U,
+      .squeezing = false,
+      .squeeze_off = (uint32_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state));
+  p[0U] = s;
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init(Hacl_Streaming_SHA3_state *s)
+{
+  Hacl_Streaming_SHA3_state scrut = *s;
+  memset(scrut.block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state){
+        .alg = scrut.alg,
+        .block_state = scrut.block_state,
+        .buf = scrut.buf,
+        .total_len = (uint64_t)0U,
+        .squeezing = false,
+        .squeeze_off = (uint32_t)0U
+      }
+    );
+}
+
+/*
+  Unlike the Merkle-Damgard functor, full blocks are absorbed eagerly: the
+  sponge padding fits in an empty block, so the buffer never holds more than
+  block_len - 1 bytes.
+*/
+void Hacl_Streaming_SHA3_update(Hacl_Streaming_SHA3_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_SHA3_state s = *p;
+  uint64_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint64_t total_len = s.total_len;
+  uint32_t block_len = Hacl_Streaming_SHA3_block_len(s.alg);
+  uint32_t sz = (uint32_t)(total_len % (uint64_t)block_len);
+  uint8_t *data1 = data;
+  uint32_t len1 = len;
+  if (len1 < block_len - sz)
+  {
+    memcpy(buf + sz, data1, len1 * sizeof (uint8_t));
+  }
+  else
+  {
+    if (!(sz == (uint32_t)0U))
+    {
+      uint32_t diff = block_len - sz;
+      memcpy(buf + sz, data1, diff * sizeof (uint8_t));
+      Hacl_Impl_SHA3_absorb_inner(block_len, buf, block_state);
+      data1 = data1 + diff;
+      len1 = len1 - diff;
+    }
+    uint32_t n_blocks = len1 / block_len;
+    for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner(block_len, data1 + i * block_len, block_state);
+    }
+    uint32_t rem = len1 % block_len;
+    memcpy(buf, data1 + n_blocks * block_len, rem * sizeof (uint8_t));
+  }
+  p->total_len = total_len + (uint64_t)len;
+}
+
+void Hacl_Streaming_SHA3_finish(Hacl_Streaming_SHA3_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_SHA3_state s = *p;
+  uint32_t block_len = Hacl_Streaming_SHA3_block_len(s.alg);
+  uint32_t hash_len = Hacl_Streaming_SHA3_hash_len(s.alg);
+  uint32_t r = (uint32_t)(s.total_len % (uint64_t)block_len);
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, s.block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_Impl_SHA3_absorb(tmp_block_state, block_len, r, s.buf, (uint8_t)0x06U);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, block_len, hash_len, dst);
+  Lib_Memzero0_memzero(tmp_block_state, (uint32_t)25U * sizeof (tmp_block_state[0U]));
+}
+
+/*
+  While squeezing, [buf] holds the output block being consumed, of which
+  [squeeze_off] bytes were already returned, and [block_state] is the state
+  that yields the next output block.
+*/
+void Hacl_Streaming_SHA3_squeeze(Hacl_Streaming_SHA3_state *p, uint8_t *dst, uint32_t len)
+{
+  Hacl_Streaming_SHA3_state s = *p;
+  uint64_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint32_t block_len = Hacl_Streaming_SHA3_block_len(s.alg);
+  uint32_t off = s.squeeze_off;
+  if (!s.squeezing)
+  {
+    uint32_t r = (uint32_t)(s.total_len % (uint64_t)block_len);
+    Hacl_Impl_SHA3_absorb(block_state, block_len, r, buf, (uint8_t)0x1FU);
+    off = block_len;
+  }
+  uint32_t n0 = block_len - off;
+  uint32_t n1;
+  if (len < n0)
+  {
+    n1 = len;
+  }
+  else
+  {
+    n1 = n0;
+  }
+  memcpy(dst, buf + off, n1 * sizeof (uint8_t));
+  off = off + n1;
+  uint8_t *dst1 = dst + n1;
+  uint32_t len1 = len - n1;
+  uint32_t n_blocks = len1 / block_len;
+  uint32_t rem = len1 % block_len;
+  Hacl_Impl_SHA3_squeeze(block_state, block_len, n_blocks * block_len, dst1);
+  if (!(rem == (uint32_t)0U))
+  {
+    Hacl_Impl_SHA3_storeState(block_len, block_state, buf);
+    Hacl_Impl_SHA3_state_permute(block_state);
+    memcpy(dst1 + n_blocks * block_len, buf, rem * sizeof (uint8_t));
+    off = rem;
+  }
+  p->squeezing = true;
+  p->squeeze_off = off;
+}
+
+void Hacl_Streaming_SHA3_free(Hacl_Streaming_SHA3_state *s)
+{
+  Hacl_Streaming_SHA3_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
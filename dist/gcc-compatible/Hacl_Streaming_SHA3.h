@@ -0,0 +1,119 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Streaming_SHA3_H
+#define __Hacl_Streaming_SHA3_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_Spec.h"
+#include "Hacl_SHA3.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  Spec_Hash_Definitions_hash_alg values for the Keccak family, which Hacl_Spec.h
+  does not have yet. Besides this module, EverCrypt_Hash accepts the four SHA3_*
+  values in this dist.
+*/
+#define Spec_Hash_Definitions_SHA3_256 8
+#define Spec_Hash_Definitions_SHA3_224 9
+#define Spec_Hash_Definitions_SHA3_384 10
+#define Spec_Hash_Definitions_SHA3_512 11
+#define Spec_Hash_Definitions_Shake128 12
+#define Spec_Hash_Definitions_Shake256 13
+
+typedef struct Hacl_Streaming_SHA3_state_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+  bool squeezing;
+  uint32_t squeeze_off;
+}
+Hacl_Streaming_SHA3_state;
+
+/*
+  Rate of the sponge, in bytes, for one of the SHA3_* or Shake* algorithms
+*/
+uint32_t Hacl_Streaming_SHA3_block_len(Spec_Hash_Definitions_hash_alg a);
+
+/*
+  Digest length of a SHA3_* algorithm; 0 for the Shake* algorithms, whose
+  output length is chosen by the caller
+*/
+uint32_t Hacl_Streaming_SHA3_hash_len(Spec_Hash_Definitions_hash_alg a);
+
+bool Hacl_Streaming_SHA3_is_shake(Hacl_Streaming_SHA3_state *s);
+
+/*
+  State allocation function; [a] is one of SHA3_224, SHA3_256, SHA3_384,
+  SHA3_512, Shake128 or Shake256
+*/
+Hacl_Streaming_SHA3_state *Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_hash_alg a);
+
+/*
+  (Re-)initialization function; also brings a Shake state back to absorbing
+*/
+void Hacl_Streaming_SHA3_init(Hacl_Streaming_SHA3_state *s);
+
+/*
+  Absorb [len] bytes of [data]. Must not be called on a Shake state once
+  Hacl_Streaming_SHA3_squeeze has been called (until the next init).
+*/
+void Hacl_Streaming_SHA3_update(Hacl_Streaming_SHA3_state *p, uint8_t *data, uint32_t len);
+
+/*
+  Write the digest of a SHA3_* state to [dst] (hash_len bytes). The state is
+  left untouched, so more data may be absorbed afterwards.
+*/
+void Hacl_Streaming_SHA3_finish(Hacl_Streaming_SHA3_state *p, uint8_t *dst);
+
+/*
+  Write the next [len] bytes of the output stream of a Shake state to [dst].
+  The first call ends the absorbing phase; successive calls continue the
+  stream, so that squeezing n1 then n2 bytes yields the same output as
+  squeezing n1 + n2 bytes at once.
+*/
+void Hacl_Streaming_SHA3_squeeze(Hacl_Streaming_SHA3_state *p, uint8_t *dst, uint32_t len);
+
+/*
+  Free state function
+*/
+void Hacl_Streaming_SHA3_free(Hacl_Streaming_SHA3_state *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_SHA3_H_DEFINED
+#endif
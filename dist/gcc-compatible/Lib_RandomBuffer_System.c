@@ -24,6 +24,10 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
   return pass;
 }
 
+uint32_t Lib_RandomBuffer_System_process_id(void) {
+  return (uint32_t)GetCurrentProcessId();
+}
+
 #else
 
 /* assume POSIX here */
@@ -32,6 +36,9 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 bool read_random_bytes(uint32_t len, uint8_t *buf) {
 #ifdef SYS_getrandom
@@ -50,6 +57,10 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
   return ((size_t)res == (size_t)len);
 }
 
+uint32_t Lib_RandomBuffer_System_process_id(void) {
+  return (uint32_t)getpid();
+}
+
 #endif
 
 // WARNING: this function is deprecated
@@ -46,6 +46,13 @@ extern void *Lib_RandomBuffer_System_entropy_p;
 
 extern void Lib_RandomBuffer_System_crypto_random(uint8_t *buf, uint32_t len);
 
+/*
+  Returns the identifier of the calling process. A generator that keeps state in
+  memory compares it against the value it recorded when it was seeded, so that
+  the child of a fork reseeds instead of repeating the output of its parent.
+*/
+extern uint32_t Lib_RandomBuffer_System_process_id(void);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,13 @@
+#ifndef __Lib_SHA1_Shaext_H
+#define __Lib_SHA1_Shaext_H
+
+#include <inttypes.h>
+
+/* SHA-1 compression of n consecutive 64-byte blocks using the Intel SHA
+   extensions. The state s is the five-word state of Hacl_Hash_SHA1. This is
+   only compiled when HACL_CAN_COMPILE_SHAEXT is set, and must only be called
+   when EverCrypt_AutoConfig2_has_shaext and EverCrypt_AutoConfig2_has_sse
+   both hold. */
+void Lib_SHA1_Shaext_update_multi(uint32_t *s, uint8_t *blocks, uint32_t n);
+
+#endif
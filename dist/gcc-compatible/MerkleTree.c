@@ -24,6 +24,7 @@
 
 #include "MerkleTree.h"
 
+#include "internal/EverCrypt_Hash.h"
 #include "internal/Hacl_Krmllib.h"
 
 static uint8_t *hash_r_alloc(uint32_t s)
@@ -126,6 +126,20 @@ check_avx512 proc
   ret
 check_avx512 endp
 ALIGN 16
+check_vaes_vpclmulqdq proc
+  mov r9, rbx
+  mov rax, 7
+  mov rcx, 0
+  cpuid
+  mov rax, rcx
+  and rax, 1024
+  shr rax, 1
+  and rcx, 512
+  and rax, rcx
+  mov rbx, r9
+  ret
+check_vaes_vpclmulqdq endp
+ALIGN 16
 check_osxsave proc
   mov r9, rbx
   mov rcx, 0
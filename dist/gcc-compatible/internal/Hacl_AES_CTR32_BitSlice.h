@@ -0,0 +1,58 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __internal_Hacl_AES_CTR32_BitSlice_H
+#define __internal_Hacl_AES_CTR32_BitSlice_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "../Hacl_AES_CTR32_BitSlice.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/*
+  Spread the four counter blocks n || ctr, ..., n || ctr + 3 over q[0..8], before
+  orthogonalization.
+*/
+void Hacl_Impl_AES_CTR32_BitSlice_load_ctr(uint64_t *q, uint8_t *n, uint32_t ctr);
+
+/*
+  Xor the first len bytes, at most 64, of the four encrypted blocks in the
+  orthogonalized state q with text, into out.
+*/
+void
+Hacl_Impl_AES_CTR32_BitSlice_xor_blocks(uint32_t len, uint8_t *out, uint8_t *text, uint64_t *q);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_AES_CTR32_BitSlice_H_DEFINED
+#endif
@@ -0,0 +1,83 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_Hash_Blake2sp_256_H
+#define __internal_Hacl_Hash_Blake2sp_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "../Hacl_Hash_Blake2sp_256.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+void
+Hacl_Hash_Blake2sp_256_init_leaves(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint32_t kk,
+  uint32_t nn
+);
+
+void
+Hacl_Hash_Blake2sp_256_update_key(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint32_t kk,
+  uint8_t *k
+);
+
+void
+Hacl_Hash_Blake2sp_256_update_stripes(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint8_t *stripes,
+  uint32_t n_stripes
+);
+
+void
+Hacl_Hash_Blake2sp_256_finish(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  uint64_t *t,
+  uint32_t kk,
+  uint8_t *k,
+  uint8_t *rest,
+  uint32_t rest_len,
+  uint32_t nn,
+  uint8_t *output
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_Hash_Blake2sp_256_H_DEFINED
+#endif
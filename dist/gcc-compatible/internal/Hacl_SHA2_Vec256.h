@@ -67,6 +67,62 @@ K___K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__K____uint8_t__K____uint8
 }
 K___K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
 
+typedef struct ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
+{
+  uint8_t *fst;
+  K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ snd;
+}
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
+
+typedef struct ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
+{
+  uint8_t *fst;
+  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ snd;
+}
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
+
+typedef struct
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
+{
+  uint8_t *fst;
+  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ snd;
+}
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
+
+typedef struct
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t__s
+{
+  uint8_t *fst;
+  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
+  snd;
+}
+___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_;
+
+void
+Hacl_SHA2_Vec256_sha256_update8_words(
+  Lib_IntVector_Intrinsics_vec256 *ws,
+  Lib_IntVector_Intrinsics_vec256 *hash
+);
+
+void
+Hacl_SHA2_Vec256_sha256_update8(
+  ___uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_
+  block,
+  Lib_IntVector_Intrinsics_vec256 *hash
+);
+
+void
+Hacl_SHA2_Vec256_sha512_update4_words(
+  Lib_IntVector_Intrinsics_vec256 *ws,
+  Lib_IntVector_Intrinsics_vec256 *hash
+);
+
+void
+Hacl_SHA2_Vec256_sha512_update4(
+  K____uint8_t__K____uint8_t__K____uint8_t___uint8_t_ block,
+  Lib_IntVector_Intrinsics_vec256 *hash
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -38,6 +38,13 @@ extern "C" {
 #include "../Hacl_Spec.h"
 #include "evercrypt_targetconfig.h"
 #include "libintvector.h"
+/*
+  Spec_Cipher_Expansion_impl values for the bitsliced AES key expansions that
+  EverCrypt_AEAD uses in this dist only.
+*/
+#define Spec_Cipher_Expansion_Hacl_AES128 3
+#define Spec_Cipher_Expansion_Hacl_AES256 4
+
 #define Spec_ECDSA_NoHash 0
 #define Spec_ECDSA_Hash 1
 
@@ -64,6 +64,8 @@ extern uint64_t check_rdrand();
 
 extern uint64_t check_avx512();
 
+extern uint64_t check_vaes_vpclmulqdq();
+
 extern uint64_t check_osxsave();
 
 extern uint64_t check_avx_xcr0();
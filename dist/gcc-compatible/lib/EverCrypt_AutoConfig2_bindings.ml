@@ -35,6 +35,9 @@ module Bindings(F:Cstubs.FOREIGN) =
     let everCrypt_AutoConfig2_wants_bcrypt =
       foreign "EverCrypt_AutoConfig2_wants_bcrypt"
         (void @-> (returning bool))
+    let everCrypt_AutoConfig2_wants_bitsliced_aes =
+      foreign "EverCrypt_AutoConfig2_wants_bitsliced_aes"
+        (void @-> (returning bool))
     let everCrypt_AutoConfig2_recall =
       foreign "EverCrypt_AutoConfig2_recall" (void @-> (returning void))
     let everCrypt_AutoConfig2_init =
@@ -81,6 +84,9 @@ module Bindings(F:Cstubs.FOREIGN) =
     let everCrypt_AutoConfig2_disable_bcrypt =
       foreign "EverCrypt_AutoConfig2_disable_bcrypt"
         (void @-> (returning void))
+    let everCrypt_AutoConfig2_enable_bitsliced_aes =
+      foreign "EverCrypt_AutoConfig2_enable_bitsliced_aes"
+        (void @-> (returning void))
     let everCrypt_AutoConfig2_has_vec128 =
       foreign "EverCrypt_AutoConfig2_has_vec128" (void @-> (returning bool))
     let everCrypt_AutoConfig2_has_vec256 =
@@ -19,6 +19,29 @@
 
 #define Lib_IntVector_Intrinsics_bit_mask64(x) -((x) & 1)
 
+/* Heap-allocated vector states must honor the alignment of the vector type;
+ * malloc only guarantees 16 bytes on most platforms. [X] is the alignment, [Y]
+ * the size (a multiple of [X]). Memory from KRML_ALIGNED_MALLOC is released
+ * with KRML_ALIGNED_FREE. A KaRaMeL that provides these macros takes
+ * precedence. */
+#include <stdlib.h>
+
+#ifndef KRML_ALIGNED_MALLOC
+#if defined(_MSC_VER)
+#define KRML_ALIGNED_MALLOC(X, Y) _aligned_malloc(Y, X)
+#else
+#define KRML_ALIGNED_MALLOC(X, Y) aligned_alloc(X, Y)
+#endif
+#endif
+
+#ifndef KRML_ALIGNED_FREE
+#if defined(_MSC_VER)
+#define KRML_ALIGNED_FREE(X) _aligned_free(X)
+#else
+#define KRML_ALIGNED_FREE(X) free(X)
+#endif
+#endif
+
 #if defined(__x86_64__) || defined(_M_X64)
 
 #if defined(HACL_CAN_COMPILE_VEC128)
@@ -448,6 +471,191 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 
 #endif /* HACL_CAN_COMPILE_VEC256 */
 
+#if defined(HACL_CAN_COMPILE_VEC512)
+
+#include <immintrin.h>
+
+typedef __m512i Lib_IntVector_Intrinsics_vec512;
+
+/* AVX-512 comparisons produce mask registers; widen them back to a vector so
+   that callers see the same all-ones/all-zeros lanes as with vec128/vec256. */
+#define Lib_IntVector_Intrinsics_vec512_eq64(x0, x1) \
+  (_mm512_movm_epi64(_mm512_cmpeq_epi64_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_eq32(x0, x1) \
+  (_mm512_movm_epi32(_mm512_cmpeq_epi32_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_gt64(x0, x1) \
+  (_mm512_movm_epi64(_mm512_cmpgt_epu64_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_gt32(x0, x1) \
+  (_mm512_movm_epi32(_mm512_cmpgt_epu32_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_xor(x0, x1) \
+  (_mm512_xor_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_or(x0, x1) \
+  (_mm512_or_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_and(x0, x1) \
+  (_mm512_and_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_lognot(x0) \
+  (_mm512_xor_si512(x0, _mm512_set1_epi32(-1)))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left64(x0, x1) \
+  (_mm512_slli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right64(x0, x1) \
+  (_mm512_srli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left32(x0, x1) \
+  (_mm512_slli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right32(x0, x1) \
+  (_mm512_srli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left32(x0,x1) \
+  (_mm512_rol_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right32(x0,x1) \
+  (_mm512_ror_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left64(x0,x1) \
+  (_mm512_rol_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right64(x0,x1) \
+  (_mm512_ror_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_load32_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_load32_be(x0)		\
+  (_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)(x0)), _mm512_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64_be(x0)		\
+  (_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)(x0)), _mm512_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7)))
+
+#define Lib_IntVector_Intrinsics_vec512_store32_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_store64_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_store32_be(x0, x1)	\
+  (_mm512_storeu_si512((__m512i*)(x0), _mm512_shuffle_epi8(x1, _mm512_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3))))
+
+#define Lib_IntVector_Intrinsics_vec512_store64_be(x0, x1)	\
+  (_mm512_storeu_si512((__m512i*)(x0), _mm512_shuffle_epi8(x1, _mm512_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7))))
+
+#define Lib_IntVector_Intrinsics_vec512_zero  \
+  (_mm512_setzero_si512())
+
+#define Lib_IntVector_Intrinsics_vec512_add64(x0, x1) \
+  (_mm512_add_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub64(x0, x1)		\
+  (_mm512_sub_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul64(x0, x1) \
+  (_mm512_mul_epu32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_smul64(x0, x1) \
+  (_mm512_mul_epu32(x0, _mm512_set1_epi64(x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_add32(x0, x1) \
+  (_mm512_add_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub32(x0, x1)		\
+  (_mm512_sub_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul32(x0, x1) \
+  (_mm512_mullo_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_smul32(x0, x1) \
+  (_mm512_mullo_epi32(x0, _mm512_set1_epi32(x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64(x1) \
+  (_mm512_set1_epi64(x1)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load64s(x0, x1, x2, x3, x4, x5, x6, x7) \
+  (_mm512_set_epi64(x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load32(x) \
+  (_mm512_set1_epi32(x))
+
+#define Lib_IntVector_Intrinsics_vec512_load32s(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) \
+  (_mm512_set_epi32(x15, x14, x13, x12, x11, x10, x9, x8, x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low32(x1, x2) \
+  (_mm512_unpacklo_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high32(x1, x2) \
+  (_mm512_unpackhi_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low64(x1, x2) \
+  (_mm512_unpacklo_epi64(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high64(x1, x2) \
+  (_mm512_unpackhi_epi64(x1, x2))
+
+/* As with vec256, the 128-bit interleavings operate independently on each
+   256-bit half: [x1.0, x2.0, x1.2, x2.2] and [x1.1, x2.1, x1.3, x2.3]. */
+#define Lib_IntVector_Intrinsics_vec512_interleave_low128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0x44))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0xEE))
+
+/* The operations below work on each 128-bit lane independently, as the
+   corresponding vec128 ones do. The AES and carry-less multiplication ones need
+   VAES and VPCLMULQDQ on top of AVX-512, i.e. the CFLAGS_VAES of configure. */
+#define Lib_IntVector_Intrinsics_vec512_aes_enc(x0, x1) \
+  (_mm512_aesenc_epi128(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_aes_enc_last(x0, x1) \
+  (_mm512_aesenclast_epi128(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_clmul(x0, x1, x2) \
+  (_mm512_clmulepi64_epi128(x0, x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left128(x0, x1) \
+  (_mm512_bslli_epi128(x0, (x1)/8))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right128(x0, x1) \
+  (_mm512_bsrli_epi128(x0, (x1)/8))
+
+#define Lib_IntVector_Intrinsics_vec512_reverse_bytes128(x0) \
+  (_mm512_shuffle_epi8(x0, _mm512_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)))
+
+#define Lib_IntVector_Intrinsics_vec512_load_be128(x0) \
+  (Lib_IntVector_Intrinsics_vec512_reverse_bytes128(_mm512_loadu_si512((__m512i*)(x0))))
+
+#define Lib_IntVector_Intrinsics_vec512_store_be128(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), Lib_IntVector_Intrinsics_vec512_reverse_bytes128(x1)))
+
+/* load128 copies the vec128 x0 to every lane, insert128 replaces lane x2 of x0
+   with x1, and extract128 returns lane x1 of x0. */
+#define Lib_IntVector_Intrinsics_vec512_load128(x0) \
+  (_mm512_broadcast_i32x4(x0))
+
+#define Lib_IntVector_Intrinsics_vec512_insert128(x0, x1, x2) \
+  (_mm512_inserti32x4(x0, x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_extract128(x0, x1) \
+  (_mm512_extracti32x4_epi32(x0, x1))
+
+#endif /* HACL_CAN_COMPILE_VEC512 */
+
 #elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)) \
       && !defined(__ARM_32BIT_STATE)
 
@@ -0,0 +1,153 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "aead_test_helpers.h"
+
+#define N_PKTS  200
+#define MAX_LEN 1600
+#define MAX_AD  40
+
+#define ROUNDS     2000
+#define BENCH_PKTS 64
+
+static uint8_t plain[N_PKTS][MAX_LEN];
+static uint8_t cipher[N_PKTS][MAX_LEN];
+static uint8_t expected[N_PKTS][MAX_LEN];
+static uint8_t decrypted[N_PKTS][MAX_LEN];
+static uint8_t ad[N_PKTS][MAX_AD];
+static uint8_t iv[N_PKTS][12];
+static uint8_t tag[N_PKTS][16];
+static uint8_t expected_tag[N_PKTS][16];
+
+// Lengths around every block and lane boundary, up to past the point where
+// packets go on their own, against one packet at a time; then every other
+// packet with a forged tag.
+static bool check(Spec_Agile_AEAD_alg a, const char *path) {
+  uint8_t key[32];
+  uint8_t *ivs[N_PKTS], *ads[N_PKTS], *ins[N_PKTS], *outs[N_PKTS], *tags[N_PKTS], *dsts[N_PKTS];
+  uint32_t ad_len[N_PKTS], len[N_PKTS];
+  EverCrypt_Error_error_code res[N_PKTS];
+  EverCrypt_AEAD_state_s *s;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(3 * i + 1);
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return true;
+
+  srand(a);
+  for (int i = 0; i < N_PKTS; i++) {
+    ivs[i] = iv[i];
+    ads[i] = ad[i];
+    ins[i] = plain[i];
+    outs[i] = cipher[i];
+    tags[i] = tag[i];
+    dsts[i] = decrypted[i];
+    for (int j = 0; j < 12; j++) iv[i][j] = (uint8_t)(i + 7 * j);
+    ad_len[i] = (uint32_t)(i % (MAX_AD + 1));
+    len[i] = i < 130 ? (uint32_t)i : (uint32_t)(rand() % MAX_LEN);
+    EverCrypt_AEAD_encrypt(s, ivs[i], 12, ads[i], ad_len[i], ins[i], len[i], expected[i],
+      expected_tag[i]);
+  }
+  len[N_PKTS - 1] = 1280;
+  EverCrypt_AEAD_encrypt(s, ivs[N_PKTS - 1], 12, ads[N_PKTS - 1], ad_len[N_PKTS - 1],
+    ins[N_PKTS - 1], len[N_PKTS - 1], expected[N_PKTS - 1], expected_tag[N_PKTS - 1]);
+
+  bool ok = EverCrypt_AEAD_encrypt_batch(s, N_PKTS, ivs, 12, ads, ad_len, ins, len, outs, tags)
+    == EverCrypt_Error_Success;
+  for (int i = 0; i < N_PKTS; i++) {
+    ok &= memcmp(cipher[i], expected[i], len[i]) == 0;
+    ok &= memcmp(tag[i], expected_tag[i], 16) == 0;
+  }
+
+  for (int i = 1; i < N_PKTS; i += 2)
+    tag[i][i % 16] ^= 1;
+  memset(decrypted, 0, sizeof decrypted);
+  ok &= EverCrypt_AEAD_decrypt_batch(s, N_PKTS, ivs, 12, ads, ad_len, outs, len, tags, dsts, res)
+    == EverCrypt_Error_AuthenticationFailure;
+  for (int i = 0; i < N_PKTS; i++) {
+    if (i % 2 == 0) {
+      ok &= res[i] == EverCrypt_Error_Success;
+      ok &= memcmp(decrypted[i], plain[i], len[i]) == 0;
+    } else
+      ok &= res[i] == EverCrypt_Error_AuthenticationFailure;
+  }
+  ok &= EverCrypt_AEAD_decrypt_batch(s, N_PKTS / 2, ivs, 12, ads, ad_len, outs, len, tags, dsts,
+    res) == EverCrypt_Error_AuthenticationFailure;
+  ok &= EverCrypt_AEAD_decrypt_batch(s, 1, ivs, 12, ads, ad_len, outs, len, tags, dsts, res)
+    == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_encrypt_batch(s, N_PKTS, ivs, 0, ads, ad_len, ins, len, outs, tags)
+    == EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+
+  return aead_report(a, "batch", path, ok);
+}
+
+static void bench(Spec_Agile_AEAD_alg a, uint32_t pkt_len) {
+  uint8_t key[32] = { 0 };
+  uint8_t *ivs[BENCH_PKTS], *ads[BENCH_PKTS], *ins[BENCH_PKTS], *outs[BENCH_PKTS],
+    *tags[BENCH_PKTS];
+  uint32_t ad_len[BENCH_PKTS], len[BENCH_PKTS];
+  EverCrypt_AEAD_state_s *s;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  for (int i = 0; i < BENCH_PKTS; i++) {
+    ivs[i] = iv[i];
+    ads[i] = ad[i];
+    ins[i] = plain[i];
+    outs[i] = cipher[i];
+    tags[i] = tag[i];
+    ad_len[i] = 16;
+    len[i] = pkt_len;
+  }
+  uint64_t count = (uint64_t)ROUNDS * BENCH_PKTS * pkt_len;
+  bench_timer b;
+
+  printf("%s, %d x %" PRIu32 "-byte packets, one at a time:\n", aead_alg_name(a), BENCH_PKTS,
+    pkt_len);
+  b = bench_start();
+  for (int j = 0; j < ROUNDS; j++)
+    for (int i = 0; i < BENCH_PKTS; i++)
+      EverCrypt_AEAD_encrypt(s, ivs[i], 12, ads[i], 16, ins[i], pkt_len, outs[i], tags[i]);
+  bench_stop(b, count);
+
+  printf("%s, %d x %" PRIu32 "-byte packets, batch:\n", aead_alg_name(a), BENCH_PKTS, pkt_len);
+  b = bench_start();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_encrypt_batch(s, BENCH_PKTS, ivs, 12, ads, ad_len, ins, len, outs, tags);
+  bench_stop(b, count);
+  EverCrypt_AEAD_free(s);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int i = 0; i < N_PKTS; i++) {
+    for (int j = 0; j < MAX_LEN; j++)
+      plain[i][j] = (uint8_t)(i * 5 + j);
+    for (int j = 0; j < MAX_AD; j++)
+      ad[i][j] = (uint8_t)(i * 3 + j + 128);
+  }
+
+  Spec_Agile_AEAD_alg algs[3] = {
+    Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_CHACHA20_POLY1305
+  };
+  for (int k = 0; k < 3; k++)
+    ok &= check(algs[k], "all features");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "no AVX2");
+  EverCrypt_AutoConfig2_init();
+
+  uint32_t sizes[3] = { 64, 256, 1200 };
+  for (int k = 0; k < 3; k++)
+    for (int j = 0; j < 3; j++)
+      bench(algs[k], sizes[j]);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
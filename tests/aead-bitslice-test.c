@@ -0,0 +1,216 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "aead_test_helpers.h"
+
+#define MAX_LEN 2000
+#define MAX_AD  70
+#define MAX_IV  64
+
+#define ROUNDS   100000
+#define PKT_LEN  1350
+
+static uint8_t plain[MAX_LEN];
+static uint8_t ad[MAX_AD];
+static uint8_t expected[MAX_LEN];
+static uint8_t cipher[MAX_LEN];
+static uint8_t decrypted[MAX_LEN];
+
+// Streams plain in chunks of chunk bytes, the additional data in two pieces.
+static bool stream(EverCrypt_AEAD_state_s *s, uint8_t *iv, uint32_t iv_len, uint32_t ad_len,
+  uint32_t len, uint32_t chunk, uint8_t *tag) {
+  EverCrypt_AEAD_Incremental_state_s *st;
+  bool ok = EverCrypt_AEAD_Incremental_create_in(s, &st) == EverCrypt_Error_Success;
+  if (!ok)
+    return false;
+  ok &= EverCrypt_AEAD_Incremental_init(st, iv, iv_len) == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad, ad_len / 2) == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad + ad_len / 2, ad_len - ad_len / 2) ==
+    EverCrypt_Error_Success;
+  for (uint32_t off = 0; off < len; off += chunk) {
+    uint32_t n = len - off < chunk ? len - off : chunk;
+    ok &= EverCrypt_AEAD_Incremental_encrypt_update(st, plain + off, n, cipher + off) ==
+      EverCrypt_Error_Success;
+  }
+  ok &= EverCrypt_AEAD_Incremental_encrypt_finish(st, tag) == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_Incremental_init(st, iv, iv_len) == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad, ad_len) == EverCrypt_Error_Success;
+  for (uint32_t off = 0; off < len; off += chunk) {
+    uint32_t n = len - off < chunk ? len - off : chunk;
+    ok &= EverCrypt_AEAD_Incremental_decrypt_update(st, cipher + off, n, decrypted + off) ==
+      EverCrypt_Error_Success;
+  }
+  ok &= EverCrypt_AEAD_Incremental_decrypt_finish(st, tag) == EverCrypt_Error_Success;
+  EverCrypt_AEAD_Incremental_free(st);
+  return ok;
+}
+
+// The known answers, then every entry point against the reference state ref,
+// created with all features, at lengths around every block and every lane
+// boundary, with 96-bit and other ivs; then a forged tag, which must leave dst
+// untouched.
+static bool check(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s *ref, const char *path) {
+  uint8_t key[32], iv[MAX_IV], tag[16], expected_tag[16];
+  uint32_t iv_lens[5] = { 12, 1, 16, 20, MAX_IV };
+  EverCrypt_AEAD_state_s *s;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(3 * i + 1);
+  for (int i = 0; i < MAX_IV; i++) iv[i] = (uint8_t)(i + 200);
+  bool ok = aead_check_gcm_kat(a);
+  ok &= EverCrypt_AEAD_create_in(a, &s, key) == EverCrypt_Error_Success;
+  if (!ok)
+    return aead_report(a, "bitsliced", path, false);
+
+  for (uint32_t l = 0; l <= MAX_LEN; l += l < 300 ? 1 : 83) {
+    uint32_t iv_len = iv_lens[l % 5];
+    uint32_t ad_len = l % MAX_AD;
+    EverCrypt_AEAD_encrypt(ref, iv, iv_len, ad, ad_len, plain, l, expected, expected_tag);
+    memset(cipher, 0, l);
+    ok &= EverCrypt_AEAD_encrypt(s, iv, iv_len, ad, ad_len, plain, l, cipher, tag) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(cipher, expected, l) == 0 && memcmp(tag, expected_tag, 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt(s, iv, iv_len, ad, ad_len, cipher, l, tag, decrypted) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(decrypted, plain, l) == 0;
+
+    ok &= EverCrypt_AEAD_encrypt_expand(a, key, iv, iv_len, ad, ad_len, plain, l, cipher, tag) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(cipher, expected, l) == 0 && memcmp(tag, expected_tag, 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt_expand(a, key, iv, iv_len, ad, ad_len, cipher, l, tag,
+      decrypted) == EverCrypt_Error_Success;
+    ok &= memcmp(decrypted, plain, l) == 0;
+
+    if (l % 7 == 0) {
+      ok &= stream(s, iv, iv_len, ad_len, l, 1 + l % 100, tag);
+      ok &= memcmp(cipher, expected, l) == 0 && memcmp(tag, expected_tag, 16) == 0;
+      ok &= memcmp(decrypted, plain, l) == 0;
+    }
+  }
+
+  uint8_t *ivs[2] = { iv, iv + 1 };
+  uint8_t *ads[2] = { ad, ad };
+  uint8_t *plains[2] = { plain, plain + 1 };
+  uint8_t *ciphers[2] = { cipher, cipher + 1000 };
+  uint8_t tags[2][16];
+  uint8_t *tagp[2] = { tags[0], tags[1] };
+  uint32_t ad_lens[2] = { 13, 0 };
+  uint32_t lens[2] = { 1000, 999 };
+  ok &= EverCrypt_AEAD_encrypt_batch(s, 2, ivs, 12, ads, ad_lens, plains, lens, ciphers, tagp) ==
+    EverCrypt_Error_Success;
+  for (int j = 0; j < 2; j++) {
+    EverCrypt_AEAD_encrypt(ref, ivs[j], 12, ad, ad_lens[j], plains[j], lens[j], expected,
+      expected_tag);
+    ok &= memcmp(ciphers[j], expected, lens[j]) == 0 && memcmp(tags[j], expected_tag, 16) == 0;
+  }
+
+  uint32_t seg_len[3] = { 100, 17, 383 };
+  uint8_t *segs[3] = { cipher, cipher + 100, cipher + 117 };
+  uint8_t *plain_segs[1] = { plain };
+  uint32_t plain_len = 500;
+  uint32_t ad13 = 13;
+  EverCrypt_AEAD_encrypt(ref, iv, 12, ad, 13, plain, 500, expected, expected_tag);
+  ok &= EverCrypt_AEAD_encrypt_iov(s, iv, 12, 1, &ad13, ads, 1, &plain_len, plain_segs, 3,
+    seg_len, segs, tag) == EverCrypt_Error_Success;
+  ok &= memcmp(cipher, expected, 500) == 0 && memcmp(tag, expected_tag, 16) == 0;
+
+  memset(decrypted, 0x5a, 500);
+  tag[9] ^= 4;
+  ok &= EverCrypt_AEAD_decrypt(s, iv, 12, ad, 13, cipher, 500, tag, decrypted) ==
+    EverCrypt_Error_AuthenticationFailure;
+  ok &= EverCrypt_AEAD_decrypt_expand(a, key, iv, 12, ad, 13, cipher, 500, tag, decrypted) ==
+    EverCrypt_Error_AuthenticationFailure;
+  for (int i = 0; i < 500; i++)
+    ok &= decrypted[i] == 0x5a;
+  ok &= EverCrypt_AEAD_encrypt(s, iv, 0, ad, 13, plain, 500, cipher, tag) ==
+    EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+
+  return aead_report(a, "bitsliced", path, ok);
+}
+
+// The software fallback is about ten times slower: fewer rounds without AES-NI.
+static void bench(Spec_Agile_AEAD_alg a, const char *path) {
+  char label[64];
+  uint32_t rounds = EverCrypt_AutoConfig2_has_aesni() ? ROUNDS : ROUNDS / 10;
+  snprintf(label, sizeof label, "%d-byte packets, %s", PKT_LEN, path);
+  aead_bench_encrypt(a, ad, PKT_LEN, rounds, label);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int j = 0; j < MAX_LEN; j++)
+    plain[j] = (uint8_t)(j * 13 + 7);
+  for (int j = 0; j < MAX_AD; j++)
+    ad[j] = (uint8_t)(j + 32);
+
+  Spec_Agile_AEAD_alg algs[2] = { Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM };
+
+  // Without AES-NI, AES-GCM is unsupported until the caller opts into the bitsliced code.
+  bool ok_off = true;
+  EverCrypt_AutoConfig2_disable_aesni();
+  for (int k = 0; k < 2; k++) {
+    uint8_t key[32] = { 0 };
+    EverCrypt_AEAD_state_s *s = NULL;
+    ok_off &= EverCrypt_AEAD_create_in(algs[k], &s, key) == EverCrypt_Error_UnsupportedAlgorithm;
+    ok_off &= s == NULL;
+  }
+  {
+    uint8_t key[32] = { 0 }, iv[12] = { 0 }, tag[16];
+    ok_off &= EverCrypt_AEAD_encrypt_expand_aes128_gcm(key, iv, 12, ad, 0, plain, 16, cipher, tag)
+      == EverCrypt_Error_UnsupportedAlgorithm;
+    ok_off &= EverCrypt_AEAD_decrypt_expand_aes256_gcm(key, iv, 12, ad, 0, cipher, 16, tag, decrypted)
+      == EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  printf("AES-GCM without AES-NI, bitsliced code not enabled: ");
+  if (ok_off)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  ok &= ok_off;
+  EverCrypt_AutoConfig2_enable_bitsliced_aes();
+
+  for (int k = 0; k < 2; k++) {
+    uint8_t key[32];
+    EverCrypt_AEAD_state_s *ref;
+    for (int i = 0; i < 32; i++) key[i] = (uint8_t)(3 * i + 1);
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_AEAD_create_in(algs[k], &ref, key);
+    // Each step takes away one more feature; with AES-NI gone, AES-GCM is bitsliced.
+    EverCrypt_AutoConfig2_disable_aesni();
+    ok &= check(algs[k], ref, "vec256");
+    EverCrypt_AutoConfig2_disable_pclmulqdq();
+    ok &= check(algs[k], ref, "vec256, no PCLMULQDQ");
+    EverCrypt_AutoConfig2_disable_avx2();
+    ok &= check(algs[k], ref, "vec128, no PCLMULQDQ");
+    EverCrypt_AutoConfig2_disable_avx();
+    EverCrypt_AutoConfig2_disable_sse();
+    ok &= check(algs[k], ref, "portable");
+    EverCrypt_AEAD_free(ref);
+  }
+  EverCrypt_AutoConfig2_init();
+
+  for (int k = 0; k < 2; k++) {
+    bench(algs[k], "Vale");
+    EverCrypt_AutoConfig2_disable_aesni();
+    bench(algs[k], "bitsliced vec256");
+    EverCrypt_AutoConfig2_disable_pclmulqdq();
+    bench(algs[k], "bitsliced vec256, no PCLMULQDQ");
+    EverCrypt_AutoConfig2_disable_avx2();
+    bench(algs[k], "bitsliced vec128, no PCLMULQDQ");
+    EverCrypt_AutoConfig2_disable_avx();
+    EverCrypt_AutoConfig2_disable_sse();
+    bench(algs[k], "bitsliced portable");
+    EverCrypt_AutoConfig2_init();
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
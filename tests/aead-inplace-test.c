@@ -0,0 +1,183 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "aead_test_helpers.h"
+
+#define MAX_LEN 3000
+#define N_PKTS  8
+
+#define ROUNDS   200000
+#define PKT_LEN  1350
+
+static uint8_t plain[N_PKTS][MAX_LEN];
+static uint8_t expected[N_PKTS][MAX_LEN];
+static uint8_t buf[N_PKTS][MAX_LEN];
+static uint8_t ad[64];
+
+static bool all_zero(uint8_t *b, uint32_t len) {
+  uint8_t acc = 0;
+  for (uint32_t i = 0; i < len; i++) acc |= b[i];
+  return acc == 0;
+}
+
+// Every entry point with the output on top of the input, against the same
+// call with separate buffers, at lengths around every block boundary; then a
+// forged tag, which must leave no plaintext behind.
+static bool check(Spec_Agile_AEAD_alg a, const char *path) {
+  uint8_t key[32], iv[N_PKTS][12], tag[N_PKTS][16], expected_tag[N_PKTS][16];
+  uint8_t *ivs[N_PKTS], *ads[N_PKTS], *bufs[N_PKTS], *tags[N_PKTS];
+  uint32_t ad_len[N_PKTS], len[N_PKTS];
+  EverCrypt_Error_error_code res[N_PKTS];
+  EverCrypt_AEAD_state_s *s;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(7 * i + 5);
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return true;
+  for (int j = 0; j < N_PKTS; j++) {
+    for (int i = 0; i < 12; i++) iv[j][i] = (uint8_t)(i + 16 * j);
+    ivs[j] = iv[j];
+    ads[j] = ad;
+    bufs[j] = buf[j];
+    tags[j] = tag[j];
+    ad_len[j] = (uint32_t)(j * 7);
+  }
+
+  bool ok = true;
+  for (uint32_t l = 0; l <= MAX_LEN; l += l < 130 ? 1 : 97) {
+    EverCrypt_AEAD_encrypt(s, iv[0], 12, ad, 13, plain[0], l, expected[0], expected_tag[0]);
+    memcpy(buf[0], plain[0], l);
+    ok &= EverCrypt_AEAD_encrypt(s, iv[0], 12, ad, 13, buf[0], l, buf[0], tag[0]) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(buf[0], expected[0], l) == 0 && memcmp(tag[0], expected_tag[0], 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt(s, iv[0], 12, ad, 13, buf[0], l, tag[0], buf[0]) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(buf[0], plain[0], l) == 0;
+
+    memcpy(buf[0], plain[0], l);
+    ok &= EverCrypt_AEAD_encrypt_expand(a, key, iv[0], 12, ad, 13, buf[0], l, buf[0], tag[0]) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(buf[0], expected[0], l) == 0 && memcmp(tag[0], expected_tag[0], 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt_expand(a, key, iv[0], 12, ad, 13, buf[0], l, tag[0], buf[0]) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(buf[0], plain[0], l) == 0;
+
+    // The same segments on both sides.
+    uint32_t seg_len[3] = { l / 3, l / 3, l - 2 * (l / 3) };
+    uint8_t *segs[3] = { buf[0], buf[0] + seg_len[0], buf[0] + seg_len[0] + seg_len[1] };
+    uint32_t ad13 = 13;
+    uint8_t *ad1[1] = { ad };
+    memcpy(buf[0], plain[0], l);
+    ok &= EverCrypt_AEAD_encrypt_iov(s, iv[0], 12, 1, &ad13, ad1, 3, seg_len, segs, 3, seg_len,
+      segs, tag[0]) == EverCrypt_Error_Success;
+    ok &= memcmp(buf[0], expected[0], l) == 0 && memcmp(tag[0], expected_tag[0], 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt_iov(s, iv[0], 12, 1, &ad13, ad1, 3, seg_len, segs, tag[0], 3,
+      seg_len, segs) == EverCrypt_Error_Success;
+    ok &= memcmp(buf[0], plain[0], l) == 0;
+
+    for (int j = 0; j < N_PKTS; j++) {
+      len[j] = (l + (uint32_t)j * 131) % (MAX_LEN + 1);
+      EverCrypt_AEAD_encrypt(s, iv[j], 12, ad, ad_len[j], plain[j], len[j], expected[j],
+        expected_tag[j]);
+      memcpy(buf[j], plain[j], len[j]);
+    }
+    ok &= EverCrypt_AEAD_encrypt_batch(s, N_PKTS, ivs, 12, ads, ad_len, bufs, len, bufs, tags) ==
+      EverCrypt_Error_Success;
+    for (int j = 0; j < N_PKTS; j++)
+      ok &= memcmp(buf[j], expected[j], len[j]) == 0 && memcmp(tag[j], expected_tag[j], 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt_batch(s, N_PKTS, ivs, 12, ads, ad_len, bufs, len, tags, bufs,
+      res) == EverCrypt_Error_Success;
+    for (int j = 0; j < N_PKTS; j++)
+      ok &= memcmp(buf[j], plain[j], len[j]) == 0;
+  }
+
+  // Chacha20-Poly1305 checks the tag before decrypting, so the ciphertext is
+  // still there; AES-GCM decrypts as it goes, and wipes what it wrote.
+  bool chacha = a == Spec_Agile_AEAD_CHACHA20_POLY1305;
+  for (int j = 0; j < N_PKTS; j++) {
+    len[j] = 100 + (uint32_t)j * 200;
+    EverCrypt_AEAD_encrypt(s, iv[j], 12, ad, ad_len[j], plain[j], len[j], buf[j], tag[j]);
+    memcpy(expected[j], buf[j], len[j]);
+  }
+  tag[0][5] ^= 1;
+  ok &= EverCrypt_AEAD_decrypt(s, iv[0], 12, ad, ad_len[0], buf[0], len[0], tag[0], buf[0]) ==
+    EverCrypt_Error_AuthenticationFailure;
+  ok &= chacha ? memcmp(buf[0], expected[0], len[0]) == 0 : all_zero(buf[0], len[0]);
+  memcpy(buf[0], expected[0], len[0]);
+  ok &= EverCrypt_AEAD_decrypt_expand(a, key, iv[0], 12, ad, ad_len[0], buf[0], len[0], tag[0],
+    buf[0]) == EverCrypt_Error_AuthenticationFailure;
+  ok &= chacha ? memcmp(buf[0], expected[0], len[0]) == 0 : all_zero(buf[0], len[0]);
+  memcpy(buf[0], expected[0], len[0]);
+  tag[3][0] ^= 0x80;
+  ok &= EverCrypt_AEAD_decrypt_batch(s, N_PKTS, ivs, 12, ads, ad_len, bufs, len, tags, bufs,
+    res) == EverCrypt_Error_AuthenticationFailure;
+  for (int j = 0; j < N_PKTS; j++) {
+    if (j == 0 || j == 3) {
+      ok &= res[j] == EverCrypt_Error_AuthenticationFailure;
+      ok &= chacha ? memcmp(buf[j], expected[j], len[j]) == 0 : all_zero(buf[j], len[j]);
+    } else {
+      ok &= res[j] == EverCrypt_Error_Success;
+      ok &= memcmp(buf[j], plain[j], len[j]) == 0;
+    }
+  }
+  EverCrypt_AEAD_free(s);
+
+  return aead_report(a, "in place", path, ok);
+}
+
+// A packet sealed into a second buffer, then where it lies.
+static void bench(Spec_Agile_AEAD_alg a) {
+  uint8_t key[32] = { 0 };
+  uint8_t iv[12] = { 0 };
+  uint8_t tag[16];
+  uint8_t *pkt = malloc(PKT_LEN);
+  EverCrypt_AEAD_state_s *s;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  memset(pkt, 'P', PKT_LEN);
+  char label[64];
+  snprintf(label, sizeof label, "%d-byte packets, separate output", PKT_LEN);
+  aead_bench_encrypt(a, ad, PKT_LEN, ROUNDS, label);
+
+  printf("%s, %d-byte packets, in place:\n", aead_alg_name(a), PKT_LEN);
+  bench_timer b = bench_start();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_encrypt(s, iv, 12, ad, 13, pkt, PKT_LEN, pkt, tag);
+  bench_stop(b, (uint64_t)ROUNDS * PKT_LEN);
+  EverCrypt_AEAD_free(s);
+  free(pkt);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int i = 0; i < N_PKTS; i++)
+    for (int j = 0; j < MAX_LEN; j++)
+      plain[i][j] = (uint8_t)(j * 11 + i);
+  for (int j = 0; j < 64; j++)
+    ad[j] = (uint8_t)(j + 64);
+
+  Spec_Agile_AEAD_alg algs[3] = {
+    Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_CHACHA20_POLY1305
+  };
+  for (int k = 0; k < 3; k++)
+    ok &= check(algs[k], "all features");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "no AVX2");
+  EverCrypt_AutoConfig2_disable_avx();
+  EverCrypt_AutoConfig2_disable_sse();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "portable");
+  EverCrypt_AutoConfig2_init();
+
+  for (int k = 0; k < 3; k++)
+    bench(algs[k]);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
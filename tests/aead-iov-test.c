@@ -0,0 +1,191 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "aead_test_helpers.h"
+
+#define MAX_LEN  3000
+#define MAX_AD   100
+#define MAX_SEGS 64
+#define N_CUTS   40
+
+#define ROUNDS 20000
+
+static uint8_t plain[MAX_LEN];
+static uint8_t ad[MAX_AD];
+static uint8_t expected[MAX_LEN];
+static uint8_t cipher[MAX_LEN];
+static uint8_t decrypted[MAX_LEN];
+
+// Cuts buf[0..len) into segments of 0 to max_seg bytes; returns their number.
+static uint32_t cut(uint8_t *buf, uint32_t len, uint32_t max_seg, uint8_t **seg,
+  uint32_t *seg_len) {
+  uint32_t num = 0, off = 0;
+  while (off < len || num == 0) {
+    uint32_t l = num == MAX_SEGS - 1 ? len - off : (uint32_t)(rand() % (max_seg + 1));
+    if (l > len - off) l = len - off;
+    seg[num] = buf + off;
+    seg_len[num] = l;
+    off += l;
+    num++;
+  }
+  return num;
+}
+
+// Lengths around every block boundary, cut in many ways (empty segments,
+// single bytes, segments much longer than a block), each list cut
+// independently of the others, against the contiguous encryption; then a
+// forged tag, lists that do not add up, and lists too long to gather.
+static bool check(Spec_Agile_AEAD_alg a, const char *path) {
+  uint8_t key[32], iv[12], tag[16], expected_tag[16];
+  uint8_t *ads[MAX_SEGS], *ins[MAX_SEGS], *outs[MAX_SEGS], *dsts[MAX_SEGS];
+  uint32_t ad_len[MAX_SEGS], in_len[MAX_SEGS], out_len[MAX_SEGS], dst_len[MAX_SEGS];
+  EverCrypt_AEAD_state_s *s;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(5 * i + 2);
+  for (int i = 0; i < 12; i++) iv[i] = (uint8_t)(i + 40);
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return true;
+
+  bool ok = true;
+  srand(a);
+  uint32_t lens[8] = { 0, 1, 63, 64, 65, 513, 1000, MAX_LEN };
+  for (int l = 0; l < 8; l++) {
+    uint32_t len = lens[l];
+    uint32_t adl = (uint32_t)(l * 13 % MAX_AD);
+    EverCrypt_AEAD_encrypt(s, iv, 12, ad, adl, plain, len, expected, expected_tag);
+    for (int c = 0; c < N_CUTS; c++) {
+      uint32_t max_seg = c % 4 == 0 ? 1 : (uint32_t)(rand() % 300);
+      uint32_t ad_num = cut(ad, adl, max_seg, ads, ad_len);
+      uint32_t in_num = cut(plain, len, max_seg, ins, in_len);
+      uint32_t out_num = cut(cipher, len, (uint32_t)(rand() % 300), outs, out_len);
+      uint32_t dst_num = cut(decrypted, len, max_seg, dsts, dst_len);
+      memset(cipher, 0, sizeof cipher);
+      memset(decrypted, 0, sizeof decrypted);
+      ok &= EverCrypt_AEAD_encrypt_iov(s, iv, 12, ad_num, ad_len, ads, in_num, in_len, ins,
+        out_num, out_len, outs, tag) == EverCrypt_Error_Success;
+      ok &= memcmp(cipher, expected, len) == 0;
+      ok &= memcmp(tag, expected_tag, 16) == 0;
+      ok &= EverCrypt_AEAD_decrypt_iov(s, iv, 12, ad_num, ad_len, ads, out_num, out_len, outs,
+        tag, dst_num, dst_len, dsts) == EverCrypt_Error_Success;
+      ok &= memcmp(decrypted, plain, len) == 0;
+    }
+  }
+
+  uint32_t ad_num = cut(ad, 20, 7, ads, ad_len);
+  uint32_t in_num = cut(plain, 100, 30, ins, in_len);
+  uint32_t out_num = cut(cipher, 100, 30, outs, out_len);
+  uint32_t dst_num = cut(decrypted, 100, 30, dsts, dst_len);
+  EverCrypt_AEAD_encrypt_iov(s, iv, 12, ad_num, ad_len, ads, in_num, in_len, ins, out_num,
+    out_len, outs, tag);
+  tag[3] ^= 1;
+  ok &= EverCrypt_AEAD_decrypt_iov(s, iv, 12, ad_num, ad_len, ads, out_num, out_len, outs, tag,
+    dst_num, dst_len, dsts) == EverCrypt_Error_AuthenticationFailure;
+  out_len[out_num - 1]++;
+  ok &= EverCrypt_AEAD_encrypt_iov(s, iv, 12, ad_num, ad_len, ads, in_num, in_len, ins, out_num,
+    out_len, outs, tag) == EverCrypt_Error_DecodeError;
+  ok &= EverCrypt_AEAD_decrypt_iov(s, iv, 12, ad_num, ad_len, ads, out_num, out_len, outs, tag,
+    dst_num, dst_len, dsts) == EverCrypt_Error_DecodeError;
+  ok &= EverCrypt_AEAD_encrypt_iov(s, iv, 0, ad_num, ad_len, ads, in_num, in_len, ins, in_num,
+    in_len, outs, tag) == EverCrypt_Error_InvalidIVLength;
+
+  // AES-GCM gathers into one buffer of at most 2^32 - 1 bytes: longer lists are
+  // rejected before any segment is read.
+  if (a != Spec_Agile_AEAD_CHACHA20_POLY1305) {
+    uint8_t *huge[2] = { plain, plain };
+    uint32_t huge_len[2] = { 0x80000000U, 0x80000000U };
+    ok &= EverCrypt_AEAD_encrypt_iov(s, iv, 12, ad_num, ad_len, ads, 2, huge_len, huge, 2,
+      huge_len, huge, tag) == EverCrypt_Error_MaximumLengthExceeded;
+    ok &= EverCrypt_AEAD_decrypt_iov(s, iv, 12, ad_num, ad_len, ads, 2, huge_len, huge, tag,
+      2, huge_len, huge) == EverCrypt_Error_MaximumLengthExceeded;
+    ok &= EverCrypt_AEAD_encrypt_iov(s, iv, 12, 2, huge_len, huge, in_num, in_len, ins,
+      in_num, in_len, outs, tag) == EverCrypt_Error_MaximumLengthExceeded;
+  }
+  EverCrypt_AEAD_free(s);
+
+  return aead_report(a, "iov", path, ok);
+}
+
+// A record whose plaintext sits in num_segs fragments, encrypted into one
+// buffer: gathered first, then encrypted in place of the copy.
+static void bench(Spec_Agile_AEAD_alg a, uint32_t num_segs, uint32_t seg_len) {
+  uint8_t key[32] = { 0 };
+  uint8_t iv[12] = { 0 };
+  uint8_t tag[16];
+  uint8_t *ins[MAX_SEGS];
+  uint32_t in_len[MAX_SEGS];
+  uint32_t len = num_segs * seg_len;
+  uint8_t *frags = malloc(len);
+  uint8_t *gathered = malloc(len);
+  uint8_t *out = malloc(len);
+  uint32_t ad_len = 13;
+  uint8_t *ads[1] = { ad };
+  uint8_t *outs[1] = { out };
+  EverCrypt_AEAD_state_s *s;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  memset(frags, 'P', len);
+  for (uint32_t i = 0; i < num_segs; i++) {
+    ins[i] = frags + i * seg_len;
+    in_len[i] = seg_len;
+  }
+  uint64_t count = (uint64_t)ROUNDS * len;
+  bench_timer b;
+
+  printf("%s, %" PRIu32 " x %" PRIu32 "-byte fragments, gather then encrypt:\n",
+    aead_alg_name(a), num_segs, seg_len);
+  b = bench_start();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (uint32_t i = 0; i < num_segs; i++)
+      memcpy(gathered + i * seg_len, ins[i], seg_len);
+    EverCrypt_AEAD_encrypt(s, iv, 12, ad, 13, gathered, len, out, tag);
+  }
+  bench_stop(b, count);
+
+  printf("%s, %" PRIu32 " x %" PRIu32 "-byte fragments, iov:\n", aead_alg_name(a), num_segs,
+    seg_len);
+  b = bench_start();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_encrypt_iov(s, iv, 12, 1, &ad_len, ads, num_segs, in_len, ins, 1, &len, outs,
+      tag);
+  bench_stop(b, count);
+  EverCrypt_AEAD_free(s);
+  free(frags);
+  free(gathered);
+  free(out);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int j = 0; j < MAX_LEN; j++)
+    plain[j] = (uint8_t)(j * 7 + 1);
+  for (int j = 0; j < MAX_AD; j++)
+    ad[j] = (uint8_t)(j + 128);
+
+  Spec_Agile_AEAD_alg algs[3] = {
+    Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_CHACHA20_POLY1305
+  };
+  for (int k = 0; k < 3; k++)
+    ok &= check(algs[k], "all features");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "no AVX2");
+  EverCrypt_AutoConfig2_disable_avx();
+  EverCrypt_AutoConfig2_disable_sse();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "portable");
+  EverCrypt_AutoConfig2_init();
+
+  for (int k = 0; k < 3; k++) {
+    bench(algs[k], 4, 4096);
+    bench(algs[k], 3, 500);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,226 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+#if defined(HACL_CAN_COMPILE_PCLMUL)
+#include "Hacl_Gf128_NI.h"
+#endif
+
+#include "aead_test_helpers.h"
+
+#define MAX_LEN 3000
+#define MAX_AD  100
+#define N_CUTS  40
+
+#define ROUNDS    64
+#define BENCH_LEN (1 << 20)
+#define CHUNK_LEN 16384
+
+static uint8_t plain[MAX_LEN];
+static uint8_t ad[MAX_AD];
+static uint8_t expected[MAX_LEN];
+static uint8_t cipher[MAX_LEN];
+
+static uint32_t chunk(uint32_t left, uint32_t max_chunk) {
+  uint32_t l = (uint32_t)(rand() % (max_chunk + 1));
+  return l < left ? l : left;
+}
+
+// Lengths around every block boundary, fed in random chunks (empty ones,
+// single bytes, chunks much longer than a block) through one state, against
+// the one-shot encryption; decryption in place, a forged tag, then calls out of
+// order.
+static bool check(Spec_Agile_AEAD_alg a, const char *path) {
+  uint8_t key[32], iv[12], tag[16], expected_tag[16];
+  EverCrypt_AEAD_state_s *s;
+  EverCrypt_AEAD_Incremental_state_s *st;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(3 * i + 1);
+  for (int i = 0; i < 12; i++) iv[i] = (uint8_t)(i + 60);
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return true;
+  if (EverCrypt_AEAD_Incremental_create_in(s, &st) != EverCrypt_Error_Success) {
+    EverCrypt_AEAD_free(s);
+    return true;
+  }
+
+  bool ok = true;
+  srand(a);
+  uint32_t lens[8] = { 0, 1, 15, 16, 63, 65, 1000, MAX_LEN };
+  for (int l = 0; l < 8; l++) {
+    uint32_t len = lens[l];
+    uint32_t adl = (uint32_t)(l * 13 % MAX_AD);
+    EverCrypt_AEAD_encrypt(s, iv, 12, ad, adl, plain, len, expected, expected_tag);
+    for (int c = 0; c < N_CUTS; c++) {
+      uint32_t max_chunk = c % 4 == 0 ? 1 : (uint32_t)(rand() % 300);
+      memset(cipher, 0, sizeof cipher);
+      ok &= EverCrypt_AEAD_Incremental_init(st, iv, 12) == EverCrypt_Error_Success;
+      for (uint32_t off = 0, n; off < adl || off == 0; off += n) {
+        n = chunk(adl - off, max_chunk);
+        ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad + off, n) == EverCrypt_Error_Success;
+        if (adl == 0) break;
+      }
+      for (uint32_t off = 0, n; off < len; off += n) {
+        n = chunk(len - off, max_chunk);
+        ok &= EverCrypt_AEAD_Incremental_encrypt_update(st, plain + off, n, cipher + off) ==
+          EverCrypt_Error_Success;
+      }
+      ok &= EverCrypt_AEAD_Incremental_encrypt_finish(st, tag) == EverCrypt_Error_Success;
+      ok &= memcmp(cipher, expected, len) == 0;
+      ok &= memcmp(tag, expected_tag, 16) == 0;
+
+      ok &= EverCrypt_AEAD_Incremental_init(st, iv, 12) == EverCrypt_Error_Success;
+      ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad, adl) == EverCrypt_Error_Success;
+      for (uint32_t off = 0, n; off < len; off += n) {
+        n = chunk(len - off, max_chunk);
+        ok &= EverCrypt_AEAD_Incremental_decrypt_update(st, cipher + off, n, cipher + off) ==
+          EverCrypt_Error_Success;
+      }
+      ok &= EverCrypt_AEAD_Incremental_decrypt_finish(st, tag) == EverCrypt_Error_Success;
+      ok &= memcmp(cipher, plain, len) == 0;
+    }
+  }
+
+  EverCrypt_AEAD_Incremental_init(st, iv, 12);
+  EverCrypt_AEAD_Incremental_update_ad(st, ad, 20);
+  EverCrypt_AEAD_Incremental_encrypt_update(st, plain, 100, cipher);
+  EverCrypt_AEAD_Incremental_encrypt_finish(st, tag);
+  tag[3] ^= 1;
+  EverCrypt_AEAD_Incremental_init(st, iv, 12);
+  EverCrypt_AEAD_Incremental_update_ad(st, ad, 20);
+  EverCrypt_AEAD_Incremental_decrypt_update(st, cipher, 100, cipher);
+  ok &= EverCrypt_AEAD_Incremental_decrypt_finish(st, tag) ==
+    EverCrypt_Error_AuthenticationFailure;
+
+  ok &= EverCrypt_AEAD_Incremental_encrypt_finish(st, tag) == EverCrypt_Error_DecodeError;
+  ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad, 1) == EverCrypt_Error_DecodeError;
+  EverCrypt_AEAD_Incremental_init(st, iv, 12);
+  EverCrypt_AEAD_Incremental_encrypt_update(st, plain, 10, cipher);
+  ok &= EverCrypt_AEAD_Incremental_update_ad(st, ad, 1) == EverCrypt_Error_DecodeError;
+  ok &= EverCrypt_AEAD_Incremental_decrypt_update(st, cipher, 1, cipher) ==
+    EverCrypt_Error_DecodeError;
+  ok &= EverCrypt_AEAD_Incremental_decrypt_finish(st, tag) == EverCrypt_Error_DecodeError;
+  ok &= EverCrypt_AEAD_Incremental_init(st, iv, 0) == EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_Incremental_free(st);
+  EverCrypt_AEAD_free(s);
+
+  return aead_report(a, "streaming", path, ok);
+}
+
+#if defined(HACL_CAN_COMPILE_PCLMUL)
+// Bit by bit, as in the GCM specification.
+static void gf128_mul_ref(uint8_t *x, const uint8_t *y) {
+  uint8_t z[16] = { 0 }, v[16];
+  memcpy(v, y, 16);
+  for (int i = 0; i < 128; i++) {
+    if (x[i / 8] >> (7 - i % 8) & 1)
+      for (int j = 0; j < 16; j++) z[j] ^= v[j];
+    uint8_t lsb = v[15] & 1;
+    for (int j = 15; j > 0; j--) v[j] = (uint8_t)(v[j] >> 1 | v[j - 1] << 7);
+    v[0] >>= 1;
+    if (lsb) v[0] ^= 0xe1;
+  }
+  memcpy(x, z, 16);
+}
+
+static bool check_ghash(void) {
+  uint8_t h[16], computed[16];
+  bool ok = true;
+  for (int i = 0; i < 16; i++) h[i] = (uint8_t)(i * 17 + 3);
+  for (uint32_t len = 0; len < 300; len += 7) {
+    uint8_t acc[16] = { 0 };
+    for (uint32_t i = 0; i < len; i += 16) {
+      for (uint32_t j = 0; j < 16 && i + j < len; j++) acc[j] ^= plain[i + j];
+      gf128_mul_ref(acc, h);
+    }
+    Hacl_Gf128_NI_ghash(computed, len, plain, h);
+    ok &= memcmp(computed, acc, 16) == 0;
+  }
+  printf("GHASH (PCLMUL): ");
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+#endif
+
+// A large object sealed in one call, then in CHUNK_LEN-byte pieces.
+static void bench(Spec_Agile_AEAD_alg a) {
+  uint8_t key[32] = { 0 };
+  uint8_t iv[12] = { 0 };
+  uint8_t tag[16];
+  uint8_t *in = malloc(BENCH_LEN);
+  uint8_t *out = malloc(BENCH_LEN);
+  EverCrypt_AEAD_state_s *s;
+  EverCrypt_AEAD_Incremental_state_s *st;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  if (EverCrypt_AEAD_Incremental_create_in(s, &st) != EverCrypt_Error_Success)
+    return;
+  memset(in, 'P', BENCH_LEN);
+  char label[64];
+  snprintf(label, sizeof label, "%d bytes, one call", BENCH_LEN);
+  aead_bench_encrypt(a, ad, BENCH_LEN, ROUNDS, label);
+
+  printf("%s, %d bytes, streaming in %d-byte chunks:\n", aead_alg_name(a), BENCH_LEN,
+    CHUNK_LEN);
+  bench_timer b = bench_start();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_AEAD_Incremental_init(st, iv, 12);
+    EverCrypt_AEAD_Incremental_update_ad(st, ad, 13);
+    for (uint32_t off = 0; off < BENCH_LEN; off += CHUNK_LEN)
+      EverCrypt_AEAD_Incremental_encrypt_update(st, in + off, CHUNK_LEN, out + off);
+    EverCrypt_AEAD_Incremental_encrypt_finish(st, tag);
+  }
+  bench_stop(b, (uint64_t)ROUNDS * BENCH_LEN);
+  EverCrypt_AEAD_Incremental_free(st);
+  EverCrypt_AEAD_free(s);
+  free(in);
+  free(out);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int j = 0; j < MAX_LEN; j++)
+    plain[j] = (uint8_t)(j * 7 + 1);
+  for (int j = 0; j < MAX_AD; j++)
+    ad[j] = (uint8_t)(j + 128);
+
+  EverCrypt_AEAD_state_s *s;
+  EverCrypt_AEAD_Incremental_state_s *st;
+  ok &= EverCrypt_AEAD_Incremental_create_in(NULL, &st) == EverCrypt_Error_InvalidKey;
+  EverCrypt_AEAD_create_in(Spec_Agile_AEAD_CHACHA20_POLY1305, &s, plain);
+  EverCrypt_AEAD_Incremental_create_in(s, &st);
+  ok &= EverCrypt_AEAD_Incremental_init(st, plain, 16) == EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_Incremental_free(st);
+  EverCrypt_AEAD_free(s);
+
+#if defined(HACL_CAN_COMPILE_PCLMUL)
+  if (EverCrypt_AutoConfig2_has_pclmulqdq())
+    ok &= check_ghash();
+#endif
+  Spec_Agile_AEAD_alg algs[3] = {
+    Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM, Spec_Agile_AEAD_CHACHA20_POLY1305
+  };
+  for (int k = 0; k < 3; k++)
+    ok &= check(algs[k], "all features");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "no AVX2");
+  EverCrypt_AutoConfig2_disable_avx();
+  EverCrypt_AutoConfig2_disable_sse();
+  ok &= check(Spec_Agile_AEAD_CHACHA20_POLY1305, "portable");
+  EverCrypt_AutoConfig2_init();
+
+  for (int k = 0; k < 3; k++)
+    bench(algs[k]);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,131 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "aead_test_helpers.h"
+
+#define MAX_LEN 4200
+#define MAX_AD  600
+#define MAX_IV  300
+
+#define ROUNDS 2000
+
+static uint8_t plain[MAX_LEN];
+static uint8_t ad[MAX_AD];
+static uint8_t expected[MAX_LEN];
+static uint8_t cipher[MAX_LEN];
+static uint8_t decrypted[MAX_LEN];
+
+// The known answers, then a state created with all features against one created
+// without VAES, at lengths around every block and every 16-block boundary, with
+// additional data and ivs of up to two such strides; in place, in a batch, and a
+// forged tag, after which the Vale code and the wide one both zero dst.
+static bool check(Spec_Agile_AEAD_alg a, const char *path) {
+  uint8_t key[32], iv[MAX_IV], tag[16], expected_tag[16];
+  uint32_t iv_lens[6] = { 12, 1, 16, 20, 257, MAX_IV };
+  EverCrypt_AEAD_state_s *s, *ref;
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(5 * i + 2);
+  for (int i = 0; i < MAX_IV; i++) iv[i] = (uint8_t)(i + 100);
+  bool ok = aead_check_gcm_kat(a);
+  ok &= EverCrypt_AEAD_create_in(a, &s, key) == EverCrypt_Error_Success;
+  EverCrypt_AutoConfig2_disable_vaes();
+  ok &= EverCrypt_AEAD_create_in(a, &ref, key) == EverCrypt_Error_Success;
+  EverCrypt_AutoConfig2_init();
+  if (!ok)
+    return aead_report(a, "", path, false);
+
+  for (uint32_t l = 0; l <= MAX_LEN; l += l < 600 ? 1 : 37) {
+    uint32_t iv_len = iv_lens[l % 6];
+    uint32_t ad_len = (l * 7) % MAX_AD;
+    EverCrypt_AEAD_encrypt(ref, iv, iv_len, ad, ad_len, plain, l, expected, expected_tag);
+    memset(cipher, 0, l);
+    ok &= EverCrypt_AEAD_encrypt(s, iv, iv_len, ad, ad_len, plain, l, cipher, tag) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(cipher, expected, l) == 0 && memcmp(tag, expected_tag, 16) == 0;
+    ok &= EverCrypt_AEAD_decrypt(s, iv, iv_len, ad, ad_len, cipher, l, tag, decrypted) ==
+      EverCrypt_Error_Success;
+    ok &= memcmp(decrypted, plain, l) == 0;
+
+    if (l % 5 == 0) {
+      memcpy(cipher, plain, l);
+      ok &= EverCrypt_AEAD_encrypt(s, iv, iv_len, ad, ad_len, cipher, l, cipher, tag) ==
+        EverCrypt_Error_Success;
+      ok &= memcmp(cipher, expected, l) == 0 && memcmp(tag, expected_tag, 16) == 0;
+      ok &= EverCrypt_AEAD_decrypt(s, iv, iv_len, ad, ad_len, cipher, l, tag, cipher) ==
+        EverCrypt_Error_Success;
+      ok &= memcmp(cipher, plain, l) == 0;
+    }
+  }
+
+  uint8_t *ivs[2] = { iv, iv + 1 };
+  uint8_t *ads[2] = { ad, ad };
+  uint8_t *plains[2] = { plain, plain + 1 };
+  uint8_t *ciphers[2] = { cipher, cipher + 2000 };
+  uint8_t tags[2][16];
+  uint8_t *tagp[2] = { tags[0], tags[1] };
+  uint32_t ad_lens[2] = { 13, 0 };
+  uint32_t lens[2] = { 2000, 1999 };
+  ok &= EverCrypt_AEAD_encrypt_batch(s, 2, ivs, 12, ads, ad_lens, plains, lens, ciphers, tagp) ==
+    EverCrypt_Error_Success;
+  for (int j = 0; j < 2; j++) {
+    EverCrypt_AEAD_encrypt(ref, ivs[j], 12, ad, ad_lens[j], plains[j], lens[j], expected,
+      expected_tag);
+    ok &= memcmp(ciphers[j], expected, lens[j]) == 0 && memcmp(tags[j], expected_tag, 16) == 0;
+  }
+
+  EverCrypt_AEAD_encrypt(s, iv, 12, ad, 13, plain, 1000, cipher, tag);
+  memset(decrypted, 0x5a, 1000);
+  tag[9] ^= 4;
+  ok &= EverCrypt_AEAD_decrypt(s, iv, 12, ad, 13, cipher, 1000, tag, decrypted) ==
+    EverCrypt_Error_AuthenticationFailure;
+  for (int i = 0; i < 1000; i++)
+    ok &= decrypted[i] == 0;
+  ok &= EverCrypt_AEAD_encrypt(s, iv, 0, ad, 13, plain, 1000, cipher, tag) ==
+    EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+  EverCrypt_AEAD_free(ref);
+
+  return aead_report(a, "", path, ok);
+}
+
+static void bench(Spec_Agile_AEAD_alg a, uint32_t len, const char *path) {
+  char label[64];
+  snprintf(label, sizeof label, "%" PRIu32 " bytes, %s", len, path);
+  aead_bench_encrypt(a, ad, len, ROUNDS * (16384 / len), label);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int j = 0; j < MAX_LEN; j++)
+    plain[j] = (uint8_t)(j * 11 + 3);
+  for (int j = 0; j < MAX_AD; j++)
+    ad[j] = (uint8_t)(j + 64);
+
+  bool vaes = EverCrypt_AutoConfig2_has_vaes() && EverCrypt_AutoConfig2_has_vpclmulqdq() &&
+    EverCrypt_AutoConfig2_has_avx512();
+  const char *path = vaes ? "VAES against Vale" : "no VAES on this CPU";
+  Spec_Agile_AEAD_alg algs[2] = { Spec_Agile_AEAD_AES128_GCM, Spec_Agile_AEAD_AES256_GCM };
+  for (int k = 0; k < 2; k++)
+    ok &= check(algs[k], path);
+
+  uint32_t lens[3] = { 16384, 1350, 256 };
+  for (int k = 0; k < 2; k++) {
+    for (int j = 0; j < 3; j++) {
+      bench(algs[k], lens[j], vaes ? "VAES" : "Vale");
+      EverCrypt_AutoConfig2_disable_vaes();
+      bench(algs[k], lens[j], "Vale");
+      EverCrypt_AutoConfig2_init();
+    }
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,174 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "Hacl_Argon2id.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "argon2id_vectors.h"
+
+#define ROUNDS      16
+#define BENCH_KIB   (1 << 16)
+#define BENCH_LANES 4
+
+static argon2id_test_vector *current;
+static bool current_vec256;
+static uint64_t *arena;
+
+typedef struct {
+  uint32_t pass;
+  uint32_t slice;
+  uint32_t lane;
+} segment;
+
+static void *fill(void *arg) {
+  segment *s = arg;
+  argon2id_test_vector *v = current;
+  Hacl_Argon2id_fill_segment(current_vec256, v->passes, v->memory_kib, v->lanes, arena, s->pass, s->slice,
+    s->lane);
+  return NULL;
+}
+
+// One thread per lane, joined at the end of every slice.
+static void argon2id_threaded(bool vec256, argon2id_test_vector *v, uint8_t *tag) {
+  pthread_t threads[BENCH_LANES];
+  segment segs[BENCH_LANES];
+  current = v;
+  current_vec256 = vec256;
+  Hacl_Argon2id_init(vec256, v->tag_len, v->pwd_len, v->pwd, v->salt_len, v->salt, v->secret_len,
+    v->secret, v->ad_len, v->ad, v->passes, v->memory_kib, v->lanes, arena);
+  for (uint32_t pass = 0; pass < v->passes; pass++)
+    for (uint32_t slice = 0; slice < 4; slice++) {
+      for (uint32_t lane = 0; lane < v->lanes; lane++) {
+        segs[lane] = (segment){ pass, slice, lane };
+        pthread_create(&threads[lane], NULL, fill, &segs[lane]);
+      }
+      for (uint32_t lane = 0; lane < v->lanes; lane++)
+        pthread_join(threads[lane], NULL);
+    }
+  Hacl_Argon2id_finish(vec256, v->tag_len, tag, v->memory_kib, v->lanes, arena);
+}
+
+// Every vector in the same arena, sized for the largest, on one thread and then
+// with a thread per lane.
+static bool run(bool vec256, const char *path) {
+  bool ok = true;
+  uint8_t tag[32];
+
+  for (size_t i = 0; i < sizeof(argon2id_vectors) / sizeof(argon2id_test_vector); i++) {
+    argon2id_test_vector *v = &argon2id_vectors[i];
+    printf("Argon2id (%s), t=%" PRIu32 ", m=%" PRIu32 ", p=%" PRIu32 ":\n", path,
+      v->passes, v->memory_kib, v->lanes);
+    ok &= Hacl_Argon2id_argon2id(vec256, v->tag_len, tag, v->pwd_len, v->pwd, v->salt_len, v->salt,
+      v->secret_len, v->secret, v->ad_len, v->ad, v->passes, v->memory_kib, v->lanes, arena);
+    ok &= compare_and_print(v->tag_len, tag, v->tag);
+    if (v->lanes > 1) {
+      argon2id_threaded(vec256, v, tag);
+      ok &= compare_and_print(v->tag_len, tag, v->tag);
+    }
+  }
+  return ok;
+}
+
+// Parameters outside of RFC 9106, or too large for the arena to be indexed, are
+// rejected before the memory or the tag is touched.
+static bool check_invalid() {
+  uint8_t pwd[8] = "password";
+  uint8_t salt[8] = "somesalt";
+  uint8_t tag[32];
+  uint32_t params[7][4] = {
+    // tag length, passes, memory (KiB), lanes
+    { 3, 1, 32, 4 },
+    { 32, 0, 32, 4 },
+    { 32, 1, 32, 0 },
+    { 32, 1, 31, 4 },
+    { 32, 1, 0xFFFFFFFF, 0x1000000 },
+    { 32, 1, 0x2000001, 1 },
+    { 32, 1, 0xFFFFFFFF, 1 },
+  };
+  bool ok = true;
+  memset(tag, 0x5a, 32);
+  arena[0] = 0x5a5a5a5a5a5a5a5aULL;
+  for (int i = 0; i < 7; i++)
+    ok &= !Hacl_Argon2id_argon2id(false, params[i][0], tag, 8, pwd, 8, salt, 0, NULL, 0, NULL,
+      params[i][1], params[i][2], params[i][3], arena);
+  ok &= !Hacl_Argon2id_argon2id(false, 32, tag, 8, pwd, 0xFFFFFFFF - 40, salt, 0, NULL, 0,
+    NULL, 1, 32, 4, arena);
+  for (int i = 0; i < 32; i++)
+    ok &= tag[i] == 0x5a;
+  ok &= arena[0] == 0x5a5a5a5a5a5a5a5aULL;
+  printf("Argon2id invalid parameters: ");
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+  arena = malloc((size_t)BENCH_KIB * 1024);
+
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  if (vec256)
+    ok &= run(true, "vec256");
+  ok &= run(false, "portable");
+  ok &= check_invalid();
+
+  uint8_t pwd[8] = "password";
+  uint8_t salt[8] = "somesalt";
+  uint8_t tag[32];
+  argon2id_test_vector bench = {
+    1, BENCH_KIB, BENCH_LANES, pwd, 8, salt, 8, NULL, 0, NULL, 0, NULL, 32
+  };
+  cycles a,b;
+  clock_t t1,t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Argon2id_argon2id(false, 32, tag, 8, pwd, 8, salt, 0, NULL, 0, NULL, 1, BENCH_KIB,
+      BENCH_LANES, arena);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Argon2id_argon2id(vec256, 32, tag, 8, pwd, 8, salt, 0, NULL, 0, NULL, 1, BENCH_KIB,
+      BENCH_LANES, arena);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  // clock() adds up the time of all threads; cycles are wall-clock.
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    argon2id_threaded(vec256, &bench, tag);
+  }
+  b = cpucycles_end();
+  uint64_t cdiff3 = b - a;
+  free(arena);
+
+  uint64_t count = (uint64_t)ROUNDS * BENCH_KIB * 1024;
+  printf("Argon2id, t=1, m=%d, p=%d, portable:\n", BENCH_KIB, BENCH_LANES);
+  print_time(count,tdiff1,cdiff1);
+  printf("Argon2id, t=1, m=%d, p=%d, vec256:\n", BENCH_KIB, BENCH_LANES);
+  print_time(count,tdiff2,cdiff2);
+  printf("Argon2id, t=1, m=%d, p=%d, vec256, %d threads: %" PRIu64 " cycles\n", BENCH_KIB,
+    BENCH_LANES, BENCH_LANES, cdiff3);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+// Argon2id version 0x13: the RFC 9106 test vector (section 5.3), then vectors
+// from the test suite of the reference implementation (phc-winner-argon2).
+
+typedef struct {
+  uint32_t passes;
+  uint32_t memory_kib;
+  uint32_t lanes;
+  uint8_t *pwd;
+  uint32_t pwd_len;
+  uint8_t *salt;
+  uint32_t salt_len;
+  uint8_t *secret;
+  uint32_t secret_len;
+  uint8_t *ad;
+  uint32_t ad_len;
+  uint8_t *tag;
+  uint32_t tag_len;
+} argon2id_test_vector;
+
+static uint8_t pwd0[32] = {
+  0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+  0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U
+};
+
+static uint8_t salt0[16] = {
+  0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U
+};
+
+static uint8_t secret0[8] = {
+  0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U
+};
+
+static uint8_t ad0[12] = {
+  0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U
+};
+
+static uint8_t tag0[32] = {
+  0x0dU, 0x64U, 0x0dU, 0xf5U, 0x8dU, 0x78U, 0x76U, 0x6cU, 0x08U, 0xc0U, 0x37U, 0xa3U, 0x4aU, 0x8bU, 0x53U, 0xc9U,
+  0xd0U, 0x1eU, 0xf0U, 0x45U, 0x2dU, 0x75U, 0xb6U, 0x5eU, 0xb5U, 0x25U, 0x20U, 0xe9U, 0x6bU, 0x01U, 0xe6U, 0x59U
+};
+
+static uint8_t pwd1[8] = {
+  0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U, 0x64U
+};
+
+static uint8_t salt1[8] = {
+  0x73U, 0x6fU, 0x6dU, 0x65U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag1[32] = {
+  0x09U, 0x31U, 0x61U, 0x15U, 0xd5U, 0xcfU, 0x24U, 0xedU, 0x5aU, 0x15U, 0xa3U, 0x1aU, 0x3bU, 0xa3U, 0x26U, 0xe5U,
+  0xcfU, 0x32U, 0xedU, 0xc2U, 0x47U, 0x02U, 0x98U, 0x7cU, 0x02U, 0xb6U, 0x56U, 0x6fU, 0x61U, 0x91U, 0x3cU, 0xf7U
+};
+
+static uint8_t pwd2[8] = {
+  0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U, 0x64U
+};
+
+static uint8_t salt2[8] = {
+  0x73U, 0x6fU, 0x6dU, 0x65U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag2[32] = {
+  0x9dU, 0xfeU, 0xb9U, 0x10U, 0xe8U, 0x0bU, 0xadU, 0x03U, 0x11U, 0xfeU, 0xe2U, 0x0fU, 0x9cU, 0x0eU, 0x2bU, 0x12U,
+  0xc1U, 0x79U, 0x87U, 0xb4U, 0xcaU, 0xc9U, 0x0cU, 0x2eU, 0xf5U, 0x4dU, 0x5bU, 0x30U, 0x21U, 0xc6U, 0x8bU, 0xfeU
+};
+
+static uint8_t pwd3[8] = {
+  0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U, 0x64U
+};
+
+static uint8_t salt3[8] = {
+  0x73U, 0x6fU, 0x6dU, 0x65U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag3[32] = {
+  0x6dU, 0x09U, 0x3cU, 0x50U, 0x1fU, 0xd5U, 0x99U, 0x96U, 0x45U, 0xe0U, 0xeaU, 0x3bU, 0xf6U, 0x20U, 0xd7U, 0xb8U,
+  0xbeU, 0x7fU, 0xd2U, 0xdbU, 0x59U, 0xc2U, 0x0dU, 0x9fU, 0xffU, 0x95U, 0x39U, 0xdaU, 0x2bU, 0xf5U, 0x70U, 0x37U
+};
+
+static uint8_t pwd4[8] = {
+  0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U, 0x64U
+};
+
+static uint8_t salt4[8] = {
+  0x73U, 0x6fU, 0x6dU, 0x65U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag4[32] = {
+  0xf6U, 0xa5U, 0xadU, 0xc1U, 0xbaU, 0x72U, 0x3dU, 0xddU, 0xefU, 0x9bU, 0x5aU, 0xc1U, 0xd4U, 0x64U, 0xe1U, 0x80U,
+  0xfcU, 0xd9U, 0xdfU, 0xfcU, 0x9dU, 0x1cU, 0xbfU, 0x76U, 0xccU, 0xa2U, 0xfeU, 0xd7U, 0x95U, 0xd9U, 0xcaU, 0x98U
+};
+
+static uint8_t pwd5[8] = {
+  0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U, 0x64U
+};
+
+static uint8_t salt5[8] = {
+  0x73U, 0x6fU, 0x6dU, 0x65U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag5[32] = {
+  0x90U, 0x25U, 0xd4U, 0x8eU, 0x68U, 0xefU, 0x73U, 0x95U, 0xccU, 0xa9U, 0x07U, 0x9dU, 0xa4U, 0xc4U, 0xecU, 0x3aU,
+  0xffU, 0xb3U, 0xc8U, 0x91U, 0x1fU, 0xe4U, 0xf8U, 0x6dU, 0x1aU, 0x25U, 0x20U, 0x85U, 0x6fU, 0x63U, 0x17U, 0x2cU
+};
+
+static uint8_t pwd6[17] = {
+  0x64U, 0x69U, 0x66U, 0x66U, 0x65U, 0x72U, 0x65U, 0x6eU, 0x74U, 0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U,
+  0x64U
+};
+
+static uint8_t salt6[8] = {
+  0x73U, 0x6fU, 0x6dU, 0x65U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag6[32] = {
+  0x0bU, 0x84U, 0xd6U, 0x52U, 0xcfU, 0x6bU, 0x0cU, 0x4bU, 0xeaU, 0xefU, 0x0dU, 0xfeU, 0x27U, 0x8bU, 0xa6U, 0xa8U,
+  0x0dU, 0xf6U, 0x69U, 0x62U, 0x81U, 0xd7U, 0xe0U, 0xd2U, 0x89U, 0x1bU, 0x81U, 0x7dU, 0x8cU, 0x45U, 0x8fU, 0xdeU
+};
+
+static uint8_t pwd7[8] = {
+  0x70U, 0x61U, 0x73U, 0x73U, 0x77U, 0x6fU, 0x72U, 0x64U
+};
+
+static uint8_t salt7[8] = {
+  0x64U, 0x69U, 0x66U, 0x66U, 0x73U, 0x61U, 0x6cU, 0x74U
+};
+
+static uint8_t tag7[32] = {
+  0xbdU, 0xf3U, 0x2bU, 0x05U, 0xccU, 0xc4U, 0x2eU, 0xb1U, 0x5dU, 0x58U, 0xfdU, 0x19U, 0xb1U, 0xf8U, 0x56U, 0xb1U,
+  0x13U, 0xdaU, 0x1eU, 0x9aU, 0x58U, 0x74U, 0xfdU, 0xccU, 0x54U, 0x43U, 0x08U, 0x56U, 0x5aU, 0xa8U, 0x14U, 0x1cU
+};
+
+static argon2id_test_vector argon2id_vectors[] = {
+  { 3, 32, 4, pwd0, 32, salt0, 16, secret0, 8, ad0, 12, tag0, 32 },
+  { 2, 65536, 1, pwd1, 8, salt1, 8, NULL, 0, NULL, 0, tag1, 32 },
+  { 2, 256, 1, pwd2, 8, salt2, 8, NULL, 0, NULL, 0, tag2, 32 },
+  { 2, 256, 2, pwd3, 8, salt3, 8, NULL, 0, NULL, 0, tag3, 32 },
+  { 1, 65536, 1, pwd4, 8, salt4, 8, NULL, 0, NULL, 0, tag4, 32 },
+  { 4, 65536, 1, pwd5, 8, salt5, 8, NULL, 0, NULL, 0, tag5, 32 },
+  { 2, 65536, 1, pwd6, 17, salt6, 8, NULL, 0, NULL, 0, tag6, 32 },
+  { 2, 65536, 1, pwd7, 8, salt7, 8, NULL, 0, NULL, 0, tag7, 32 }
+};
@@ -0,0 +1,148 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "Hacl_Hash_Blake2.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+
+#include "test_helpers.h"
+#include "blake2_vectors.h"
+
+#define MAX_LEN 1000
+
+static uint8_t msg[MAX_LEN];
+
+static bool check_alg(const char *path, Spec_Hash_Definitions_hash_alg a, uint32_t hash_len) {
+  bool ok = true;
+  uint8_t tag[64];
+  uint8_t expected[64];
+
+  // One-shot and streaming hashes of every length up to MAX_LEN, against the
+  // portable implementation.
+  for (uint32_t len = 0; len < MAX_LEN; len++) {
+    if (a == Spec_Hash_Definitions_Blake2S)
+      Hacl_Blake2s_32_blake2s(hash_len, expected, len, msg, 0, NULL);
+    else
+      Hacl_Blake2b_32_blake2b(hash_len, expected, len, msg, 0, NULL);
+    EverCrypt_Hash_hash(a, tag, msg, len);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+
+    Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s =
+      EverCrypt_Hash_Incremental_create_in(a);
+    uint32_t chunk = 1 + len % 150;
+    for (uint32_t off = 0; off < len; off += chunk)
+      EverCrypt_Hash_Incremental_update(s, msg + off, off + chunk > len ? len - off : chunk);
+    EverCrypt_Hash_Incremental_finish(s, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+
+    // finish must not consume the state
+    EverCrypt_Hash_Incremental_finish(s, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    EverCrypt_Hash_Incremental_free(s);
+  }
+  printf("%s (%s) all lengths: ", a == Spec_Hash_Definitions_Blake2S ? "BLAKE2s" : "BLAKE2b", path);
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+// EverCrypt_Hash_copy between a state created on the vectorized path and one
+// created on the portable path, in both directions.
+static bool check_copy_across(Spec_Hash_Definitions_hash_alg a, uint32_t block_len, uint32_t hash_len) {
+  bool ok = true;
+  uint8_t tag[64];
+  uint8_t expected[64];
+  uint32_t len = 3 * block_len + 17;
+  if (a == Spec_Hash_Definitions_Blake2S)
+    Hacl_Blake2s_32_blake2s(hash_len, expected, len, msg, 0, NULL);
+  else
+    Hacl_Blake2b_32_blake2b(hash_len, expected, len, msg, 0, NULL);
+
+  for (int src_vec = 0; src_vec < 2; src_vec++) {
+    EverCrypt_AutoConfig2_init();
+    if (!src_vec) {
+      EverCrypt_AutoConfig2_disable_avx2();
+      EverCrypt_AutoConfig2_disable_avx();
+    }
+    EverCrypt_Hash_state_s *src = EverCrypt_Hash_create_in(a);
+    EverCrypt_Hash_init(src);
+    EverCrypt_Hash_update_multi2(src, 0, msg, 3 * block_len);
+
+    EverCrypt_AutoConfig2_init();
+    if (src_vec) {
+      EverCrypt_AutoConfig2_disable_avx2();
+      EverCrypt_AutoConfig2_disable_avx();
+    }
+    EverCrypt_Hash_state_s *dst = EverCrypt_Hash_create_in(a);
+    EverCrypt_Hash_init(dst);
+    EverCrypt_Hash_copy(src, dst);
+    EverCrypt_Hash_update_last2(dst, 3 * block_len, msg + 3 * block_len, 17);
+    EverCrypt_Hash_finish(dst, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    EverCrypt_Hash_free(src);
+    EverCrypt_Hash_free(dst);
+  }
+  EverCrypt_AutoConfig2_init();
+  printf("%s copy between vectorized and portable states: ",
+    a == Spec_Hash_Definitions_Blake2S ? "BLAKE2s" : "BLAKE2b");
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+// Runs every check once on the vectorized cores (if the CPU has them) and
+// once on the portable path.
+static bool run(const char *path) {
+  bool ok = true;
+  uint8_t tag[64];
+
+  for (size_t i = 0; i < sizeof(vectors2s) / sizeof(blake2_test_vector); i++) {
+    if (vectors2s[i].key_len != 0 || vectors2s[i].expected_len != 32)
+      continue;
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_Blake2S, tag, vectors2s[i].input,
+      (uint32_t)vectors2s[i].input_len);
+    ok &= compare_and_print(32, tag, vectors2s[i].expected);
+  }
+  for (size_t i = 0; i < sizeof(vectors2b) / sizeof(blake2_test_vector); i++) {
+    if (vectors2b[i].key_len != 0 || vectors2b[i].expected_len != 64)
+      continue;
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_Blake2B, tag, vectors2b[i].input,
+      (uint32_t)vectors2b[i].input_len);
+    ok &= compare_and_print(64, tag, vectors2b[i].expected);
+  }
+
+  ok &= check_alg(path, Spec_Hash_Definitions_Blake2S, 32);
+  ok &= check_alg(path, Spec_Hash_Definitions_Blake2B, 64);
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  srand(0);
+  for (int i = 0; i < MAX_LEN; i++)
+    msg[i] = (uint8_t)rand();
+
+  ok &= check_copy_across(Spec_Hash_Definitions_Blake2S, 64, 32);
+  ok &= check_copy_across(Spec_Hash_Definitions_Blake2B, 128, 64);
+
+  if (EverCrypt_AutoConfig2_has_vec128() || EverCrypt_AutoConfig2_has_vec256())
+    ok &= run("vectorized");
+  EverCrypt_AutoConfig2_disable_avx2();
+  EverCrypt_AutoConfig2_disable_avx();
+  if (!EverCrypt_AutoConfig2_has_vec128() && !EverCrypt_AutoConfig2_has_vec256())
+    ok &= run("portable");
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,188 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+
+#include "Hacl_Hash_Blake2b_256.h"
+#include "Hacl_Hash_Blake2bp_256.h"
+#include "Hacl_Hash_Blake2sp_256.h"
+#include "Hacl_Streaming_Blake2bp_256.h"
+#include "Hacl_Streaming_Blake2sp_256.h"
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AutoConfig2.h"
+#include "blake2p_vectors.h"
+
+#define ROUNDS 16384
+#define SIZE   8196
+
+#define MAX_LEN 3000
+
+static uint8_t msg[MAX_LEN];
+static uint8_t key[64];
+
+// An update of close to UINT32_MAX bytes on top of a non-empty buffer, against
+// the same input fed in 1MiB chunks. The input is a read-only mapping of zero
+// pages, so that it costs no memory.
+static bool check_long_update() {
+  size_t map_len = (size_t)UINT32_MAX + 1;
+  uint8_t *zeros = mmap(NULL, map_len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+    -1, 0);
+  if (zeros == MAP_FAILED) {
+    printf("BLAKE2bp/BLAKE2sp long update: cannot map 4GiB, skipping\n");
+    return true;
+  }
+  uint32_t len = UINT32_MAX - 50;
+  uint8_t tag[64], expected[64];
+  bool ok = true;
+
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_state *sb =
+    Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_create_in();
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_update(sb, zeros, 100);
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_update(sb, zeros, len);
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_finish(sb, tag);
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_init(sb);
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_update(sb, zeros, 100);
+  for (uint64_t off = 0; off < len; off += 1 << 20)
+    Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_update(sb, zeros,
+      len - off < 1 << 20 ? (uint32_t)(len - off) : 1 << 20);
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_finish(sb, expected);
+  ok &= memcmp(tag, expected, 64) == 0;
+  Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_free(sb);
+
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_state *ss =
+    Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_create_in();
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_update(ss, zeros, 100);
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_update(ss, zeros, len);
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_finish(ss, tag);
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_init(ss);
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_update(ss, zeros, 100);
+  for (uint64_t off = 0; off < len; off += 1 << 20)
+    Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_update(ss, zeros,
+      len - off < 1 << 20 ? (uint32_t)(len - off) : 1 << 20);
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_finish(ss, expected);
+  ok &= memcmp(tag, expected, 32) == 0;
+  Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_free(ss);
+
+  munmap(zeros, map_len);
+  printf("BLAKE2bp/BLAKE2sp long update: ");
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_vec256()) {
+      printf("The current hardware doesn't support vec256: aborting\n");
+      return EXIT_SUCCESS;
+  }
+  else {
+      printf("The current hardware supports vec256: performing the tests\n");
+  }
+
+  bool ok = true;
+  for (int i = 0; i < MAX_LEN; i++)
+    msg[i] = (uint8_t)(i % 251);
+  for (int i = 0; i < 64; i++)
+    key[i] = (uint8_t)i;
+
+  for (size_t i = 0; i < sizeof(vectors2p)/sizeof(blake2p_test_vector); ++i) {
+    blake2p_test_vector *v = &vectors2p[i];
+    uint8_t comp[64] = { 0 };
+    printf("testing blake2bp vec-256 (len %" PRIu32 "%s):\n", v->input_len, v->keyed ? ", keyed" : "");
+    Hacl_Blake2bp_256_blake2bp(64, comp, v->input_len, msg, v->keyed ? 64 : 0, key);
+    ok &= compare_and_print(64, comp, v->expected_bp);
+    printf("testing blake2sp vec-256 (len %" PRIu32 "%s):\n", v->input_len, v->keyed ? ", keyed" : "");
+    Hacl_Blake2sp_256_blake2sp(32, comp, v->input_len, msg, v->keyed ? 32 : 0, key);
+    ok &= compare_and_print(32, comp, v->expected_sp);
+  }
+
+  // Streaming, with chunks of varying sizes, against the one-shot API.
+  bool ok_streaming = true;
+  for (uint32_t len = 0; len < MAX_LEN; len += 7) {
+    uint8_t expected[64];
+    uint8_t tag[64];
+    uint32_t chunk = 1 + len % 700;
+
+    Hacl_Blake2bp_256_blake2bp(64, expected, len, msg, 0, NULL);
+    Hacl_Streaming_Blake2bp_256_blake2bp_256_state *sb =
+      Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_create_in();
+    for (uint32_t off = 0; off < len; off += chunk)
+      Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_update(sb, msg + off,
+        off + chunk > len ? len - off : chunk);
+    Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_finish(sb, tag);
+    ok_streaming &= memcmp(tag, expected, 64) == 0;
+    Hacl_Streaming_Blake2bp_256_blake2bp_256_no_key_free(sb);
+
+    Hacl_Blake2sp_256_blake2sp(32, expected, len, msg, 0, NULL);
+    Hacl_Streaming_Blake2sp_256_blake2sp_256_state *ss =
+      Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_create_in();
+    for (uint32_t off = 0; off < len; off += chunk)
+      Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_update(ss, msg + off,
+        off + chunk > len ? len - off : chunk);
+    Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_finish(ss, tag);
+    ok_streaming &= memcmp(tag, expected, 32) == 0;
+    Hacl_Streaming_Blake2sp_256_blake2sp_256_no_key_free(ss);
+  }
+  printf("BLAKE2bp/BLAKE2sp streaming: ");
+  if (ok_streaming)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  ok &= ok_streaming;
+  ok &= check_long_update();
+
+  uint8_t plain[SIZE];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2b_256_blake2b(64,plain,SIZE,plain,0,NULL);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2b_256_blake2b(64,plain,SIZE,plain,0,NULL);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2bp_256_blake2bp(64,plain,SIZE,plain,0,NULL);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Blake2sp_256_blake2sp(32,plain,SIZE,plain,0,NULL);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("Blake2B (Vec 256-bit):\n"); print_time(count,tdiff1,cdiff1);
+  printf("Blake2BP (Vec 256-bit):\n"); print_time(count,tdiff2,cdiff2);
+  printf("Blake2SP (Vec 256-bit):\n"); print_time(count,tdiff3,cdiff3);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
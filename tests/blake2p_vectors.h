@@ -0,0 +1,456 @@
+#pragma once
+
+// Generated with a reference implementation of the BLAKE2 tree modes; the
+// message is the byte sequence i % 251 and the key, when present, is 0, 1, ...
+
+typedef struct {
+  uint32_t input_len;
+  bool keyed;
+  uint8_t expected_bp[64];
+  uint8_t expected_sp[32];
+} blake2p_test_vector;
+
+static blake2p_test_vector vectors2p[] = {
+  { 0U, false,
+    {
+      0xb5U, 0xefU, 0x81U, 0x1aU, 0x80U, 0x38U, 0xf7U, 0x0bU,
+      0x62U, 0x8fU, 0xa8U, 0xb2U, 0x94U, 0xdaU, 0xaeU, 0x74U,
+      0x92U, 0xb1U, 0xebU, 0xe3U, 0x43U, 0xa8U, 0x0eU, 0xaaU,
+      0xbbU, 0xf1U, 0xf6U, 0xaeU, 0x66U, 0x4dU, 0xd6U, 0x7bU,
+      0x9dU, 0x90U, 0xb0U, 0x12U, 0x07U, 0x91U, 0xeaU, 0xb8U,
+      0x1dU, 0xc9U, 0x69U, 0x85U, 0xf2U, 0x88U, 0x49U, 0xf6U,
+      0xa3U, 0x05U, 0x18U, 0x6aU, 0x85U, 0x50U, 0x1bU, 0x40U,
+      0x51U, 0x14U, 0xbfU, 0xa6U, 0x78U, 0xdfU, 0x93U, 0x80U
+    },
+    {
+      0xddU, 0x0eU, 0x89U, 0x17U, 0x76U, 0x93U, 0x3fU, 0x43U,
+      0xc7U, 0xd0U, 0x32U, 0xb0U, 0x8aU, 0x91U, 0x7eU, 0x25U,
+      0x74U, 0x1fU, 0x8aU, 0xa9U, 0xa1U, 0x2cU, 0x12U, 0xe1U,
+      0xcaU, 0xc8U, 0x80U, 0x15U, 0x00U, 0xf2U, 0xcaU, 0x4fU
+    } },
+  { 0U, true,
+    {
+      0x9dU, 0x94U, 0x61U, 0x07U, 0x3eU, 0x4eU, 0xb6U, 0x40U,
+      0xa2U, 0x55U, 0x35U, 0x7bU, 0x83U, 0x9fU, 0x39U, 0x4bU,
+      0x83U, 0x8cU, 0x6fU, 0xf5U, 0x7cU, 0x9bU, 0x68U, 0x6aU,
+      0x3fU, 0x76U, 0x10U, 0x7cU, 0x10U, 0x66U, 0x72U, 0x8fU,
+      0x3cU, 0x99U, 0x56U, 0xbdU, 0x78U, 0x5cU, 0xbcU, 0x3bU,
+      0xf7U, 0x9dU, 0xc2U, 0xabU, 0x57U, 0x8cU, 0x5aU, 0x0cU,
+      0x06U, 0x3bU, 0x9dU, 0x9cU, 0x40U, 0x58U, 0x48U, 0xdeU,
+      0x1dU, 0xbeU, 0x82U, 0x1cU, 0xd0U, 0x5cU, 0x94U, 0x0aU
+    },
+    {
+      0x71U, 0x5cU, 0xb1U, 0x38U, 0x95U, 0xaeU, 0xb6U, 0x78U,
+      0xf6U, 0x12U, 0x41U, 0x60U, 0xbfU, 0xf2U, 0x14U, 0x65U,
+      0xb3U, 0x0fU, 0x4fU, 0x68U, 0x74U, 0x19U, 0x3fU, 0xc8U,
+      0x51U, 0xb4U, 0x62U, 0x10U, 0x43U, 0xf0U, 0x9cU, 0xc6U
+    } },
+  { 1U, false,
+    {
+      0xa1U, 0x39U, 0x28U, 0x0eU, 0x72U, 0x75U, 0x7bU, 0x72U,
+      0x3eU, 0x64U, 0x73U, 0xd5U, 0xbeU, 0x59U, 0xf3U, 0x6eU,
+      0x9dU, 0x50U, 0xfcU, 0x5cU, 0xd7U, 0xd4U, 0x58U, 0x5cU,
+      0xbcU, 0x09U, 0x80U, 0x48U, 0x95U, 0xa3U, 0x6cU, 0x52U,
+      0x12U, 0x42U, 0xfbU, 0x27U, 0x89U, 0xf8U, 0x5cU, 0xb9U,
+      0xe3U, 0x54U, 0x91U, 0xf3U, 0x1dU, 0x4aU, 0x69U, 0x52U,
+      0xf9U, 0xd8U, 0xe0U, 0x97U, 0xaeU, 0xf9U, 0x4fU, 0xa1U,
+      0xcaU, 0x0bU, 0x12U, 0x52U, 0x57U, 0x21U, 0xf0U, 0x3dU
+    },
+    {
+      0xa6U, 0xb9U, 0xeeU, 0xccU, 0x25U, 0x22U, 0x7aU, 0xd7U,
+      0x88U, 0xc9U, 0x9dU, 0x3fU, 0x23U, 0x6dU, 0xebU, 0xc8U,
+      0xdaU, 0x40U, 0x88U, 0x49U, 0xe9U, 0xa5U, 0x17U, 0x89U,
+      0x78U, 0x72U, 0x7aU, 0x81U, 0x45U, 0x7fU, 0x72U, 0x39U
+    } },
+  { 1U, true,
+    {
+      0xffU, 0x8eU, 0x90U, 0xa3U, 0x7bU, 0x94U, 0x62U, 0x39U,
+      0x32U, 0xc5U, 0x9fU, 0x75U, 0x59U, 0xf2U, 0x60U, 0x35U,
+      0x02U, 0x9cU, 0x37U, 0x67U, 0x32U, 0xcbU, 0x14U, 0xd4U,
+      0x16U, 0x02U, 0x00U, 0x1cU, 0xbbU, 0x73U, 0xadU, 0xb7U,
+      0x92U, 0x93U, 0xa2U, 0xdbU, 0xdaU, 0x5fU, 0x60U, 0x70U,
+      0x30U, 0x25U, 0x14U, 0x4dU, 0x15U, 0x8eU, 0x27U, 0x35U,
+      0x52U, 0x95U, 0x96U, 0x25U, 0x1cU, 0x73U, 0xc0U, 0x34U,
+      0x5cU, 0xa6U, 0xfcU, 0xcbU, 0x1fU, 0xb1U, 0xe9U, 0x7eU
+    },
+    {
+      0x40U, 0x57U, 0x8fU, 0xfaU, 0x52U, 0xbfU, 0x51U, 0xaeU,
+      0x18U, 0x66U, 0xf4U, 0x28U, 0x4dU, 0x3aU, 0x15U, 0x7fU,
+      0xc1U, 0xbcU, 0xd3U, 0x6aU, 0xc1U, 0x3cU, 0xbdU, 0xcbU,
+      0x03U, 0x77U, 0xe4U, 0xd0U, 0xcdU, 0x0bU, 0x66U, 0x03U
+    } },
+  { 128U, false,
+    {
+      0x05U, 0xadU, 0x0fU, 0x27U, 0x1fU, 0xafU, 0x7eU, 0x36U,
+      0x13U, 0x20U, 0x51U, 0x84U, 0x52U, 0x81U, 0x3fU, 0xf9U,
+      0xfbU, 0x99U, 0x76U, 0xacU, 0x37U, 0x80U, 0x50U, 0xb6U,
+      0xeeU, 0xfbU, 0x05U, 0xf7U, 0x86U, 0x7bU, 0x57U, 0x7bU,
+      0x8fU, 0x14U, 0x47U, 0x57U, 0x94U, 0xcfU, 0xf6U, 0x1bU,
+      0x2bU, 0xc0U, 0x62U, 0xd3U, 0x46U, 0xa7U, 0xc6U, 0x5cU,
+      0x6eU, 0x00U, 0x67U, 0xc6U, 0x0aU, 0x37U, 0x4aU, 0xf7U,
+      0x94U, 0x0fU, 0x10U, 0xaaU, 0x44U, 0x9dU, 0x5fU, 0xb9U
+    },
+    {
+      0x05U, 0xcfU, 0x3aU, 0x90U, 0x04U, 0x91U, 0x16U, 0xdcU,
+      0x60U, 0xefU, 0xc3U, 0x15U, 0x36U, 0xaaU, 0xa3U, 0xd1U,
+      0x67U, 0x76U, 0x29U, 0x94U, 0x89U, 0x28U, 0x76U, 0xdcU,
+      0xb7U, 0xefU, 0x3fU, 0xbeU, 0xcdU, 0x74U, 0x49U, 0xc0U
+    } },
+  { 128U, true,
+    {
+      0x92U, 0x80U, 0xf4U, 0xd1U, 0x15U, 0x70U, 0x32U, 0xabU,
+      0x31U, 0x5cU, 0x10U, 0x0dU, 0x63U, 0x62U, 0x83U, 0xfbU,
+      0xf4U, 0xfbU, 0xa2U, 0xfbU, 0xadU, 0x0fU, 0x8bU, 0xc0U,
+      0x20U, 0x72U, 0x1dU, 0x76U, 0xbcU, 0x1cU, 0x89U, 0x73U,
+      0xceU, 0xd2U, 0x88U, 0x71U, 0xccU, 0x90U, 0x7dU, 0xabU,
+      0x60U, 0xe5U, 0x97U, 0x56U, 0x98U, 0x7bU, 0x0eU, 0x0fU,
+      0x86U, 0x7fU, 0xa2U, 0xfeU, 0x9dU, 0x90U, 0x41U, 0xf2U,
+      0xc9U, 0x61U, 0x80U, 0x74U, 0xe4U, 0x4fU, 0xe5U, 0xe9U
+    },
+    {
+      0x0cU, 0x6cU, 0xe3U, 0x2aU, 0x3eU, 0xa0U, 0x56U, 0x12U,
+      0xc5U, 0xf8U, 0x09U, 0x0fU, 0x6aU, 0x7eU, 0x87U, 0xf5U,
+      0xabU, 0x30U, 0xe4U, 0x1bU, 0x70U, 0x7dU, 0xcbU, 0xe5U,
+      0x41U, 0x55U, 0x62U, 0x0aU, 0xd7U, 0x70U, 0xa3U, 0x40U
+    } },
+  { 384U, false,
+    {
+      0x09U, 0xccU, 0x83U, 0x5dU, 0xfaU, 0xebU, 0xf7U, 0x12U,
+      0xdeU, 0xddU, 0xaaU, 0xc8U, 0xb8U, 0x2bU, 0x8fU, 0xfeU,
+      0xd3U, 0x62U, 0xdeU, 0xd9U, 0x79U, 0xdeU, 0x2aU, 0x76U,
+      0x3cU, 0xacU, 0x68U, 0x96U, 0x7fU, 0x9bU, 0x0eU, 0x19U,
+      0x95U, 0x8eU, 0x4fU, 0x67U, 0x70U, 0xbcU, 0x0aU, 0x80U,
+      0xb3U, 0x7aU, 0x01U, 0xfdU, 0xebU, 0x07U, 0xa3U, 0x49U,
+      0x02U, 0x51U, 0xc1U, 0x1bU, 0xd7U, 0xedU, 0x7bU, 0x54U,
+      0x64U, 0xbcU, 0x90U, 0x97U, 0xa6U, 0xa9U, 0x80U, 0x44U
+    },
+    {
+      0x20U, 0xc1U, 0x47U, 0x80U, 0x09U, 0x14U, 0xc7U, 0x56U,
+      0xf0U, 0x1dU, 0xfeU, 0x4aU, 0x59U, 0xc0U, 0x00U, 0x00U,
+      0x83U, 0x5fU, 0x22U, 0xb0U, 0x4dU, 0x24U, 0x16U, 0xf9U,
+      0xb8U, 0xe6U, 0xdaU, 0x6bU, 0xb0U, 0x42U, 0xf0U, 0x1eU
+    } },
+  { 384U, true,
+    {
+      0xd2U, 0x0fU, 0x73U, 0x7fU, 0x98U, 0x64U, 0xacU, 0xe9U,
+      0x80U, 0x0aU, 0x01U, 0x1aU, 0x0eU, 0x38U, 0x90U, 0x4cU,
+      0x1eU, 0x78U, 0xc1U, 0x14U, 0x61U, 0xeeU, 0x2aU, 0xffU,
+      0xecU, 0xb5U, 0xafU, 0x12U, 0x32U, 0xe3U, 0xa2U, 0x39U,
+      0xb3U, 0xfeU, 0x59U, 0xaeU, 0xe4U, 0x8fU, 0x92U, 0x96U,
+      0x50U, 0x02U, 0xa7U, 0x0bU, 0x7cU, 0xa5U, 0x5bU, 0x68U,
+      0xb4U, 0x5eU, 0xf1U, 0xbaU, 0x2fU, 0xb7U, 0xabU, 0x97U,
+      0x0dU, 0xd0U, 0xddU, 0x73U, 0x05U, 0xc7U, 0xb2U, 0x11U
+    },
+    {
+      0x9bU, 0x2cU, 0xfcU, 0xc6U, 0x7cU, 0xfdU, 0x88U, 0x60U,
+      0xd4U, 0xc3U, 0xb5U, 0xe9U, 0xb2U, 0xc6U, 0x4eU, 0x23U,
+      0xb9U, 0x8eU, 0x77U, 0x28U, 0x42U, 0xa0U, 0xa1U, 0xc9U,
+      0xa9U, 0x6bU, 0x44U, 0xfcU, 0x72U, 0x1dU, 0x02U, 0x03U
+    } },
+  { 385U, false,
+    {
+      0xa7U, 0x4bU, 0x67U, 0x3eU, 0xc1U, 0xfdU, 0x6bU, 0x9dU,
+      0x10U, 0x0fU, 0xd6U, 0xddU, 0x3dU, 0xbcU, 0xd4U, 0x6bU,
+      0x97U, 0x0dU, 0x0cU, 0x3fU, 0xb7U, 0xabU, 0x46U, 0xf2U,
+      0xa9U, 0x25U, 0x04U, 0x23U, 0x86U, 0xb9U, 0x00U, 0x2dU,
+      0x59U, 0x0cU, 0x41U, 0xeaU, 0x0eU, 0xfbU, 0xa8U, 0xb0U,
+      0x00U, 0x71U, 0x72U, 0xb6U, 0xeeU, 0x2eU, 0xa7U, 0xecU,
+      0xd8U, 0xd8U, 0x6eU, 0xdcU, 0x40U, 0x9fU, 0x61U, 0x22U,
+      0x72U, 0x84U, 0x2fU, 0x2aU, 0xaeU, 0x4fU, 0xf7U, 0x19U
+    },
+    {
+      0x9fU, 0x5bU, 0x52U, 0xc7U, 0x27U, 0xe4U, 0xadU, 0x0cU,
+      0x12U, 0x13U, 0x2dU, 0xa7U, 0xc0U, 0x27U, 0xa3U, 0xf4U,
+      0x31U, 0x44U, 0x0dU, 0xbfU, 0xf4U, 0x1cU, 0xe1U, 0x4cU,
+      0x99U, 0x6dU, 0xaeU, 0x60U, 0x17U, 0xe7U, 0x54U, 0xf5U
+    } },
+  { 385U, true,
+    {
+      0x70U, 0x24U, 0xe7U, 0x29U, 0x11U, 0xffU, 0xc1U, 0xdcU,
+      0x34U, 0xe6U, 0x64U, 0xc4U, 0xf5U, 0x0aU, 0x0bU, 0x05U,
+      0x96U, 0x71U, 0x2fU, 0xdfU, 0x71U, 0x4aU, 0x22U, 0xfdU,
+      0x7aU, 0x24U, 0xaaU, 0x59U, 0x87U, 0x7aU, 0x6dU, 0x36U,
+      0x9dU, 0xd6U, 0x25U, 0xeaU, 0xaeU, 0xaeU, 0xc0U, 0x57U,
+      0xbbU, 0xbeU, 0x2fU, 0x07U, 0x0dU, 0xfbU, 0xedU, 0xe7U,
+      0x0fU, 0x8fU, 0x98U, 0x77U, 0x47U, 0x2fU, 0xbdU, 0xdbU,
+      0xb5U, 0x89U, 0x1aU, 0x28U, 0x4bU, 0x98U, 0x8bU, 0xb9U
+    },
+    {
+      0xafU, 0xbcU, 0xcbU, 0x5fU, 0xdfU, 0xc5U, 0x93U, 0x9eU,
+      0xd4U, 0xc3U, 0x5cU, 0xbaU, 0x6cU, 0x84U, 0x0eU, 0xeeU,
+      0x76U, 0x33U, 0xa3U, 0x3fU, 0x1cU, 0xe1U, 0xd0U, 0x95U,
+      0x22U, 0xbdU, 0xf0U, 0xb4U, 0x2eU, 0xa1U, 0x0fU, 0x44U
+    } },
+  { 448U, false,
+    {
+      0xd3U, 0xecU, 0x24U, 0x83U, 0xa7U, 0x3eU, 0x28U, 0x8aU,
+      0x27U, 0x77U, 0x5cU, 0x08U, 0x9bU, 0x7cU, 0x18U, 0xa6U,
+      0x35U, 0xf6U, 0xddU, 0x0eU, 0x78U, 0x7dU, 0x0bU, 0x51U,
+      0x8cU, 0xadU, 0x04U, 0x58U, 0x64U, 0xa8U, 0xb2U, 0xeaU,
+      0xdbU, 0x81U, 0x78U, 0x41U, 0x97U, 0x2fU, 0x5eU, 0x79U,
+      0x3eU, 0xf9U, 0x6eU, 0x5dU, 0xfbU, 0x06U, 0x8cU, 0x96U,
+      0xfeU, 0xf4U, 0x99U, 0x47U, 0x8aU, 0x54U, 0xe9U, 0x3aU,
+      0x26U, 0x4eU, 0x0fU, 0xa7U, 0xc5U, 0x27U, 0x8fU, 0x74U
+    },
+    {
+      0x08U, 0x4fU, 0x72U, 0x2fU, 0xc8U, 0x14U, 0xf4U, 0xe5U,
+      0xdfU, 0x8eU, 0x34U, 0xbaU, 0x69U, 0x45U, 0xcaU, 0x94U,
+      0x89U, 0xfaU, 0x8eU, 0x12U, 0x16U, 0x20U, 0x1aU, 0x87U,
+      0x34U, 0x16U, 0x2cU, 0x8cU, 0x61U, 0x30U, 0x68U, 0x88U
+    } },
+  { 448U, true,
+    {
+      0x11U, 0x7cU, 0x4eU, 0x00U, 0xefU, 0x88U, 0x29U, 0xecU,
+      0xf4U, 0x18U, 0x8bU, 0x27U, 0xebU, 0xd5U, 0xfaU, 0xf6U,
+      0x3bU, 0xc6U, 0x0cU, 0xf6U, 0x28U, 0xd6U, 0xdbU, 0xdeU,
+      0x6cU, 0x24U, 0x0aU, 0xb7U, 0xf1U, 0x5dU, 0xf5U, 0x39U,
+      0xa1U, 0x08U, 0x75U, 0xf9U, 0xc2U, 0x1bU, 0x63U, 0xe4U,
+      0x3bU, 0x3bU, 0x02U, 0x10U, 0x2eU, 0x73U, 0x11U, 0x6cU,
+      0xcdU, 0x99U, 0xeaU, 0x60U, 0x56U, 0x64U, 0x7cU, 0xdbU,
+      0xa1U, 0xb1U, 0xa4U, 0x17U, 0x9dU, 0xdeU, 0xcfU, 0x81U
+    },
+    {
+      0xf5U, 0xcbU, 0xe8U, 0x4bU, 0x70U, 0x59U, 0x80U, 0xe4U,
+      0xb2U, 0x7aU, 0x54U, 0xb6U, 0x3cU, 0xc2U, 0xa5U, 0x0dU,
+      0x95U, 0x71U, 0xdaU, 0x76U, 0x31U, 0x2dU, 0x1dU, 0x56U,
+      0xf1U, 0x97U, 0xe5U, 0xb5U, 0x4eU, 0x64U, 0x91U, 0x4fU
+    } },
+  { 449U, false,
+    {
+      0x82U, 0x27U, 0xa2U, 0x05U, 0xf7U, 0x0eU, 0x33U, 0xdbU,
+      0xbdU, 0x0bU, 0xeaU, 0xafU, 0x89U, 0xceU, 0xafU, 0xedU,
+      0x10U, 0x2fU, 0x6eU, 0xf0U, 0x56U, 0x5aU, 0x49U, 0x43U,
+      0xd4U, 0x7cU, 0x45U, 0xafU, 0x15U, 0x28U, 0x9aU, 0xadU,
+      0xdaU, 0xfaU, 0x52U, 0xefU, 0x38U, 0x69U, 0xc3U, 0xacU,
+      0x3cU, 0x21U, 0x37U, 0xa6U, 0xc3U, 0xc4U, 0x42U, 0xebU,
+      0xc2U, 0x9fU, 0xc4U, 0x4bU, 0x18U, 0x05U, 0xefU, 0xebU,
+      0x9bU, 0x2fU, 0xcdU, 0x26U, 0xabU, 0xc0U, 0x1aU, 0xecU
+    },
+    {
+      0x51U, 0x0aU, 0x16U, 0xc5U, 0x67U, 0x2fU, 0x80U, 0xcaU,
+      0xc7U, 0x2bU, 0x0fU, 0xdcU, 0x1aU, 0xb0U, 0x7dU, 0x92U,
+      0x18U, 0x00U, 0x60U, 0xddU, 0x27U, 0xfeU, 0x46U, 0x70U,
+      0x73U, 0x8bU, 0x4eU, 0x5fU, 0x71U, 0xa3U, 0x4fU, 0x04U
+    } },
+  { 449U, true,
+    {
+      0xbcU, 0x29U, 0x11U, 0xa5U, 0xdfU, 0xfaU, 0xb9U, 0xf0U,
+      0x13U, 0xabU, 0x6cU, 0xedU, 0xc2U, 0x7aU, 0xd6U, 0xd3U,
+      0x7dU, 0xceU, 0x48U, 0xffU, 0x2eU, 0x9cU, 0x2fU, 0xaeU,
+      0xbcU, 0x05U, 0x63U, 0xacU, 0xcdU, 0x01U, 0x28U, 0x3fU,
+      0x15U, 0xa1U, 0x3eU, 0x91U, 0x1bU, 0x05U, 0xf0U, 0x49U,
+      0x2fU, 0xb5U, 0x33U, 0x7cU, 0x52U, 0x77U, 0xe1U, 0xfaU,
+      0xbcU, 0x2cU, 0x05U, 0x97U, 0x43U, 0x37U, 0xd0U, 0x03U,
+      0x78U, 0x10U, 0x66U, 0x19U, 0x94U, 0xc5U, 0x59U, 0xe7U
+    },
+    {
+      0xb3U, 0xbcU, 0x21U, 0x09U, 0x1fU, 0x1fU, 0xf2U, 0xe1U,
+      0xebU, 0x7fU, 0x07U, 0xc9U, 0xbeU, 0x32U, 0x00U, 0x1eU,
+      0xbaU, 0x8aU, 0x05U, 0x0fU, 0xa9U, 0x7aU, 0x56U, 0x7dU,
+      0x50U, 0x0dU, 0x27U, 0x36U, 0x69U, 0x34U, 0x1fU, 0xf4U
+    } },
+  { 512U, false,
+    {
+      0x61U, 0xc4U, 0xdaU, 0xbaU, 0xcdU, 0xfbU, 0x13U, 0x52U,
+      0x18U, 0x5aU, 0xaeU, 0x9dU, 0xbcU, 0x04U, 0xb3U, 0x48U,
+      0xafU, 0x68U, 0x14U, 0x78U, 0xb0U, 0xc4U, 0xaaU, 0x72U,
+      0x91U, 0xc7U, 0xbaU, 0xb1U, 0x17U, 0x83U, 0xe8U, 0xafU,
+      0xe0U, 0x58U, 0x30U, 0xd8U, 0x7bU, 0x6eU, 0x00U, 0x3bU,
+      0xbdU, 0x95U, 0xa0U, 0x8dU, 0x9dU, 0xb6U, 0xb0U, 0x53U,
+      0xf1U, 0x2eU, 0x75U, 0x60U, 0x2fU, 0xd5U, 0xf1U, 0xc1U,
+      0xf4U, 0x9dU, 0x39U, 0xcdU, 0x6cU, 0x12U, 0xb4U, 0x0bU
+    },
+    {
+      0x8dU, 0x9eU, 0x35U, 0x78U, 0x63U, 0x29U, 0x8dU, 0xd8U,
+      0x36U, 0x4bU, 0x7cU, 0xafU, 0x42U, 0x34U, 0x31U, 0x7fU,
+      0x8aU, 0x49U, 0xf1U, 0x80U, 0xd7U, 0x88U, 0xb7U, 0xabU,
+      0xffU, 0xb5U, 0x21U, 0x92U, 0x5fU, 0x1eU, 0x1fU, 0xf1U
+    } },
+  { 512U, true,
+    {
+      0x86U, 0xdfU, 0xbaU, 0x5bU, 0x50U, 0xdaU, 0x48U, 0xa6U,
+      0x02U, 0x44U, 0x62U, 0x46U, 0xacU, 0x0aU, 0x16U, 0xc2U,
+      0xa5U, 0xe2U, 0xf8U, 0xe3U, 0x96U, 0x07U, 0x20U, 0x65U,
+      0xb9U, 0xe7U, 0x99U, 0x1eU, 0xd9U, 0xc0U, 0xf4U, 0x36U,
+      0xaeU, 0x5bU, 0x3bU, 0x61U, 0x60U, 0x7cU, 0x15U, 0xc4U,
+      0xb2U, 0x51U, 0xd2U, 0x67U, 0x9eU, 0x3cU, 0x84U, 0x60U,
+      0x24U, 0xedU, 0x18U, 0x33U, 0xb4U, 0xd7U, 0x59U, 0x4aU,
+      0x34U, 0xa6U, 0x86U, 0x31U, 0xbbU, 0x5cU, 0x0bU, 0x49U
+    },
+    {
+      0xaeU, 0x31U, 0x3aU, 0x2aU, 0x90U, 0x2dU, 0x0eU, 0x8dU,
+      0x5dU, 0xbdU, 0x86U, 0xc7U, 0x74U, 0xa2U, 0x32U, 0x8dU,
+      0x93U, 0x9aU, 0xc9U, 0xd1U, 0x23U, 0x78U, 0x3fU, 0x86U,
+      0xa5U, 0x5bU, 0x23U, 0xf3U, 0xfdU, 0xbfU, 0x68U, 0xdaU
+    } },
+  { 896U, false,
+    {
+      0x02U, 0x23U, 0x42U, 0x55U, 0x2eU, 0xe3U, 0x28U, 0x0eU,
+      0x0bU, 0x7fU, 0x83U, 0xd2U, 0x4aU, 0xe0U, 0xfcU, 0xe3U,
+      0xbdU, 0xc8U, 0x44U, 0xf4U, 0xf1U, 0x2dU, 0x24U, 0x63U,
+      0xd3U, 0x59U, 0xe7U, 0xc1U, 0x4aU, 0x7cU, 0xc2U, 0x37U,
+      0x74U, 0xe1U, 0xccU, 0x6fU, 0x54U, 0x51U, 0x84U, 0x8dU,
+      0x48U, 0xa9U, 0xb7U, 0x10U, 0xa8U, 0xe4U, 0x64U, 0xbdU,
+      0xd5U, 0x1dU, 0x3eU, 0xd6U, 0x9bU, 0x53U, 0xfeU, 0x12U,
+      0x42U, 0xb4U, 0xdbU, 0x37U, 0xd5U, 0x5eU, 0x39U, 0x02U
+    },
+    {
+      0x3dU, 0xdbU, 0xabU, 0xb6U, 0x6cU, 0x65U, 0x21U, 0xf9U,
+      0xfbU, 0xe7U, 0x51U, 0x1bU, 0xf0U, 0xb7U, 0x1dU, 0xa3U,
+      0x9dU, 0x83U, 0x61U, 0x2dU, 0x12U, 0x62U, 0xbfU, 0xfaU,
+      0x01U, 0xbcU, 0xe9U, 0x4fU, 0xceU, 0x97U, 0x06U, 0x8fU
+    } },
+  { 896U, true,
+    {
+      0x94U, 0x42U, 0xd4U, 0x93U, 0xc1U, 0xfdU, 0x78U, 0xa8U,
+      0xfdU, 0x9cU, 0x93U, 0x76U, 0x53U, 0x73U, 0x12U, 0x54U,
+      0xacU, 0xffU, 0xd3U, 0xb0U, 0x5aU, 0xf7U, 0x7eU, 0x3cU,
+      0x1eU, 0x95U, 0xa7U, 0xd0U, 0x1eU, 0x17U, 0xcaU, 0x26U,
+      0x01U, 0xc6U, 0x1bU, 0x2bU, 0x20U, 0x39U, 0x90U, 0x35U,
+      0xa3U, 0x4bU, 0x92U, 0x85U, 0x19U, 0xbaU, 0x0fU, 0x00U,
+      0x8cU, 0x99U, 0x4eU, 0xb4U, 0xd0U, 0x66U, 0x11U, 0xf8U,
+      0xc9U, 0x34U, 0x69U, 0xaaU, 0x02U, 0xd4U, 0xdeU, 0x76U
+    },
+    {
+      0xebU, 0x0fU, 0x68U, 0xfeU, 0xc4U, 0xe5U, 0x91U, 0x4bU,
+      0x6eU, 0xa8U, 0xa7U, 0xf4U, 0xd5U, 0x3dU, 0x87U, 0xf7U,
+      0xfbU, 0x56U, 0xd1U, 0x6aU, 0xe3U, 0x72U, 0x60U, 0x0eU,
+      0xdbU, 0x51U, 0xc3U, 0x60U, 0xe2U, 0x57U, 0xa7U, 0xc4U
+    } },
+  { 897U, false,
+    {
+      0xd6U, 0xcbU, 0xaaU, 0x59U, 0x8fU, 0xdcU, 0x41U, 0xd5U,
+      0x17U, 0x4fU, 0x80U, 0x97U, 0x37U, 0xa3U, 0xe8U, 0x0dU,
+      0x80U, 0xb0U, 0xb8U, 0xc8U, 0x28U, 0x72U, 0x00U, 0x04U,
+      0xd3U, 0x9cU, 0x1bU, 0x49U, 0x4cU, 0x89U, 0xaaU, 0xe0U,
+      0xb5U, 0x2aU, 0x85U, 0xf9U, 0x3cU, 0x8eU, 0x39U, 0xf5U,
+      0xa9U, 0xeeU, 0x17U, 0xbbU, 0x60U, 0xa9U, 0x2aU, 0x38U,
+      0x73U, 0xc8U, 0xd5U, 0x8cU, 0xbcU, 0x33U, 0xa0U, 0x5cU,
+      0x34U, 0xcdU, 0x36U, 0xcfU, 0x13U, 0xe6U, 0x59U, 0x13U
+    },
+    {
+      0xd0U, 0x68U, 0xebU, 0xc0U, 0xdcU, 0x32U, 0xd8U, 0x60U,
+      0x43U, 0x4bU, 0x95U, 0x10U, 0x8fU, 0x78U, 0x36U, 0xa7U,
+      0xb8U, 0xbcU, 0x65U, 0x45U, 0xc9U, 0x5eU, 0x3eU, 0x0eU,
+      0x92U, 0xf6U, 0x55U, 0x46U, 0x33U, 0x03U, 0x9fU, 0xe4U
+    } },
+  { 897U, true,
+    {
+      0x39U, 0xa1U, 0x49U, 0xa1U, 0x51U, 0x1aU, 0x0cU, 0xdcU,
+      0x97U, 0x30U, 0xa9U, 0x0bU, 0x41U, 0x42U, 0x1aU, 0xcdU,
+      0x09U, 0x4bU, 0x89U, 0xc6U, 0xf5U, 0x77U, 0x5eU, 0x83U,
+      0x37U, 0xb4U, 0x6fU, 0xb9U, 0x1bU, 0x94U, 0xc9U, 0x57U,
+      0x4bU, 0x82U, 0x34U, 0xb7U, 0xa3U, 0xaaU, 0x83U, 0xadU,
+      0x4dU, 0x61U, 0x29U, 0xcbU, 0x99U, 0xaaU, 0xa0U, 0x95U,
+      0xb9U, 0x40U, 0xacU, 0x54U, 0xfbU, 0xe0U, 0x94U, 0x85U,
+      0xa7U, 0xe9U, 0x2fU, 0xb9U, 0x9fU, 0x2aU, 0x87U, 0x05U
+    },
+    {
+      0xa6U, 0x5dU, 0xdbU, 0x20U, 0x11U, 0xa5U, 0xcdU, 0x59U,
+      0x11U, 0x28U, 0xdeU, 0xf5U, 0x23U, 0xa2U, 0xe6U, 0x3dU,
+      0x6fU, 0x37U, 0x63U, 0xc4U, 0x24U, 0x9eU, 0x1fU, 0x28U,
+      0x54U, 0xb9U, 0x43U, 0xe8U, 0xb1U, 0x3dU, 0x03U, 0x45U
+    } },
+  { 960U, false,
+    {
+      0x33U, 0xf0U, 0xdbU, 0x73U, 0xaeU, 0xe8U, 0xe6U, 0xceU,
+      0x5bU, 0x6cU, 0x30U, 0x5eU, 0x6fU, 0xcdU, 0xf0U, 0x43U,
+      0x00U, 0xb9U, 0x5cU, 0x72U, 0xf4U, 0x44U, 0x1eU, 0xf8U,
+      0x72U, 0x57U, 0xb1U, 0xd2U, 0x67U, 0x41U, 0xf8U, 0x06U,
+      0x28U, 0x07U, 0xc7U, 0xa1U, 0x9cU, 0x68U, 0x1bU, 0x58U,
+      0xe1U, 0xd0U, 0xcfU, 0xc7U, 0x9fU, 0x63U, 0xf1U, 0xe9U,
+      0xf7U, 0x48U, 0x94U, 0x51U, 0x59U, 0xc3U, 0x8aU, 0x9dU,
+      0x72U, 0xf1U, 0xceU, 0x1eU, 0xe3U, 0x99U, 0xb7U, 0x00U
+    },
+    {
+      0x0fU, 0x2aU, 0x7bU, 0x69U, 0x18U, 0x71U, 0x7aU, 0x0dU,
+      0x67U, 0x77U, 0x7cU, 0xcaU, 0x3eU, 0xefU, 0xafU, 0x29U,
+      0x72U, 0x6eU, 0xbcU, 0x1aU, 0xc3U, 0x89U, 0xb0U, 0x8eU,
+      0x07U, 0x0dU, 0x63U, 0xd0U, 0x11U, 0x37U, 0xf6U, 0x39U
+    } },
+  { 960U, true,
+    {
+      0x65U, 0xe2U, 0xf0U, 0x91U, 0x05U, 0x78U, 0x1cU, 0x3dU,
+      0x50U, 0x6cU, 0xbeU, 0xa6U, 0x15U, 0x10U, 0x6cU, 0xa5U,
+      0x87U, 0x4bU, 0x91U, 0xf3U, 0xb3U, 0x06U, 0x02U, 0xa4U,
+      0xcfU, 0xcaU, 0xecU, 0x24U, 0xd7U, 0x47U, 0xa5U, 0x55U,
+      0x5bU, 0x34U, 0x35U, 0x3bU, 0x53U, 0x12U, 0x61U, 0x97U,
+      0xc9U, 0x12U, 0x13U, 0xf6U, 0x27U, 0xd4U, 0x97U, 0xc6U,
+      0x57U, 0xc8U, 0xd5U, 0x38U, 0xd3U, 0x3bU, 0xd4U, 0xf6U,
+      0x97U, 0xfcU, 0xebU, 0x7fU, 0xf6U, 0x73U, 0x8aU, 0x55U
+    },
+    {
+      0x00U, 0x7eU, 0x16U, 0xf6U, 0xe4U, 0x04U, 0xdaU, 0x53U,
+      0xc4U, 0x09U, 0x54U, 0x64U, 0xf2U, 0x0cU, 0x9fU, 0xd0U,
+      0xb4U, 0x04U, 0xb0U, 0x35U, 0xb1U, 0x6eU, 0x94U, 0x12U,
+      0xe0U, 0xdaU, 0x4cU, 0xb3U, 0xccU, 0xfcU, 0x39U, 0x19U
+    } },
+  { 961U, false,
+    {
+      0xf7U, 0xa6U, 0x71U, 0x67U, 0x66U, 0xcdU, 0x6cU, 0x69U,
+      0x23U, 0x00U, 0xe3U, 0x58U, 0xffU, 0x8bU, 0xd8U, 0x69U,
+      0xb0U, 0xecU, 0xa1U, 0xe3U, 0x7dU, 0xa6U, 0x40U, 0xd8U,
+      0x99U, 0x81U, 0xa9U, 0x97U, 0x2eU, 0xa9U, 0xa9U, 0xb8U,
+      0xddU, 0xb3U, 0xfdU, 0x8eU, 0x1bU, 0x0cU, 0xafU, 0x18U,
+      0xeeU, 0xd7U, 0x06U, 0x32U, 0x7eU, 0xc2U, 0xacU, 0xb6U,
+      0xf9U, 0x4eU, 0x9bU, 0x23U, 0x75U, 0xaeU, 0x1cU, 0xd3U,
+      0x9fU, 0xe1U, 0x0dU, 0x35U, 0xebU, 0xeaU, 0x86U, 0x19U
+    },
+    {
+      0xb5U, 0x03U, 0xbdU, 0xd1U, 0xb5U, 0x80U, 0x9cU, 0x87U,
+      0x59U, 0x85U, 0xeeU, 0xa1U, 0x64U, 0x77U, 0x89U, 0xfcU,
+      0x47U, 0x0cU, 0x7cU, 0x72U, 0x55U, 0x1fU, 0x1fU, 0x0fU,
+      0xacU, 0x9eU, 0x83U, 0x73U, 0xc8U, 0xb5U, 0x71U, 0x64U
+    } },
+  { 961U, true,
+    {
+      0x05U, 0xaeU, 0xe2U, 0xd0U, 0x14U, 0xc2U, 0xd2U, 0x0fU,
+      0x0aU, 0xf5U, 0xcdU, 0x7fU, 0x4fU, 0xc5U, 0x36U, 0x26U,
+      0xbcU, 0x37U, 0x53U, 0x3aU, 0x36U, 0x3bU, 0x96U, 0x8bU,
+      0xcfU, 0x7eU, 0x2cU, 0x8eU, 0x79U, 0x1fU, 0x81U, 0x67U,
+      0x70U, 0x9cU, 0x40U, 0x49U, 0x48U, 0xabU, 0xe4U, 0x71U,
+      0xecU, 0x9bU, 0xc1U, 0x88U, 0x0bU, 0xc5U, 0x08U, 0xd6U,
+      0x14U, 0x0aU, 0x48U, 0x88U, 0x9dU, 0xdaU, 0x7fU, 0x70U,
+      0xfcU, 0xd5U, 0x38U, 0xaeU, 0x82U, 0xefU, 0x38U, 0x3cU
+    },
+    {
+      0x03U, 0x93U, 0x03U, 0x00U, 0x6dU, 0x8aU, 0x10U, 0x14U,
+      0x06U, 0x8dU, 0x90U, 0xcfU, 0x77U, 0x08U, 0x8aU, 0xf4U,
+      0x3dU, 0x31U, 0x02U, 0x2fU, 0xe1U, 0x88U, 0xddU, 0x89U,
+      0x27U, 0xd1U, 0x5aU, 0x43U, 0xe0U, 0x7fU, 0x94U, 0x0eU
+    } },
+  { 2048U, false,
+    {
+      0xe8U, 0xabU, 0x96U, 0xecU, 0x6eU, 0x4eU, 0x2aU, 0xd6U,
+      0x37U, 0xb4U, 0xf7U, 0xc4U, 0x74U, 0x65U, 0xeaU, 0xdcU,
+      0x2cU, 0x24U, 0x44U, 0x5bU, 0xabU, 0x00U, 0xd5U, 0x23U,
+      0x3eU, 0xecU, 0x1bU, 0x5cU, 0xdbU, 0x14U, 0xedU, 0xa4U,
+      0x5fU, 0x3aU, 0x1bU, 0x4dU, 0x0eU, 0x98U, 0x9dU, 0x2cU,
+      0xa9U, 0x8dU, 0x25U, 0xa5U, 0x1dU, 0x03U, 0x89U, 0xd4U,
+      0xcaU, 0x9cU, 0x12U, 0x7fU, 0x25U, 0x33U, 0xddU, 0x3cU,
+      0x79U, 0x16U, 0x7aU, 0x32U, 0x78U, 0xe7U, 0xd0U, 0xddU
+    },
+    {
+      0x4cU, 0xf1U, 0x1fU, 0x34U, 0xf1U, 0x0bU, 0x09U, 0x28U,
+      0x63U, 0xf3U, 0xa0U, 0x1dU, 0xedU, 0x07U, 0x25U, 0x18U,
+      0xe7U, 0x3eU, 0xa5U, 0xd3U, 0x3fU, 0xe3U, 0xbdU, 0x5eU,
+      0x6bU, 0x1dU, 0x48U, 0x2cU, 0x25U, 0xbbU, 0xf5U, 0xd3U
+    } },
+  { 2048U, true,
+    {
+      0xa6U, 0x6fU, 0xe3U, 0x37U, 0x66U, 0x95U, 0xf5U, 0x19U,
+      0x2eU, 0xa2U, 0xc7U, 0x9eU, 0x14U, 0xcaU, 0x77U, 0x4dU,
+      0xfeU, 0xcbU, 0x10U, 0x71U, 0xc4U, 0x96U, 0x72U, 0x0cU,
+      0xafU, 0x94U, 0x34U, 0xd0U, 0x83U, 0x56U, 0x38U, 0x2eU,
+      0xfeU, 0xfdU, 0x82U, 0xf1U, 0xe7U, 0x7dU, 0xccU, 0xe7U,
+      0xa4U, 0x30U, 0xe0U, 0x16U, 0x90U, 0xbbU, 0x81U, 0xdfU,
+      0x19U, 0x11U, 0xfaU, 0xafU, 0x9bU, 0x17U, 0x1dU, 0x12U,
+      0xacU, 0x49U, 0xefU, 0x8bU, 0x17U, 0x14U, 0x93U, 0xf2U
+    },
+    {
+      0x00U, 0xc7U, 0xe4U, 0x28U, 0x06U, 0x49U, 0xe5U, 0x77U,
+      0xe3U, 0xa4U, 0xdfU, 0x15U, 0xa1U, 0x81U, 0x8fU, 0xbdU,
+      0x8cU, 0x0dU, 0x90U, 0xf1U, 0xd4U, 0x22U, 0x6fU, 0x45U,
+      0xceU, 0x74U, 0xe3U, 0xdeU, 0x2fU, 0x6dU, 0xbcU, 0x4fU
+    } }
+};
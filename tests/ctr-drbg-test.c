@@ -0,0 +1,92 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_CTR_DRBG.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "ctr_drbg_vectors.h"
+
+#define ROUNDS 4096
+#define SIZE   65536
+
+static uint8_t out[SIZE];
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  EverCrypt_CTR_DRBG_state_s *st = EverCrypt_CTR_DRBG_create();
+  if (st == NULL) {
+    printf("The current hardware doesn't support AES-NI: aborting\n");
+    return EXIT_SUCCESS;
+  }
+
+  for (size_t i = 0; i < sizeof(ctr_drbg_vectors) / sizeof(ctr_drbg_test_vector); i++) {
+    ctr_drbg_test_vector *v = &ctr_drbg_vectors[i];
+    printf("CTR_DRBG AES-256, %" PRIu32 " bytes:\n", v->output_len);
+    ok &= EverCrypt_CTR_DRBG_instantiate_with_entropy(st, v->entropy, v->pers, v->pers_len);
+    ok &= EverCrypt_CTR_DRBG_reseed_with_entropy(st, v->entropy_reseed, v->ai_reseed,
+      v->ai_reseed_len);
+    ok &= EverCrypt_CTR_DRBG_generate(out, st, v->output_len, v->ai1, v->ai_len);
+    ok &= EverCrypt_CTR_DRBG_generate(out, st, v->output_len, v->ai2, v->ai_len);
+    ok &= compare_and_print(v->output_len, out, v->expected);
+  }
+
+  printf("CTR_DRBG AES-256, counter crossing 2^32:\n");
+  ok &= EverCrypt_CTR_DRBG_instantiate_with_entropy(st, wrap_entropy, NULL, 0);
+  ok &= EverCrypt_CTR_DRBG_generate(out, st, sizeof wrap_expected, NULL, 0);
+  ok &= compare_and_print(sizeof wrap_expected, out, wrap_expected);
+
+  uint8_t ai[49] = { 0 };
+  bool ok_limits = EverCrypt_CTR_DRBG_instantiate(st, (uint8_t *)"ctr-drbg-test", 13);
+  ok_limits &= !EverCrypt_CTR_DRBG_generate(out, st, SIZE + 1, NULL, 0);
+  ok_limits &= !EverCrypt_CTR_DRBG_generate(out, st, 16, ai, 49);
+  ok_limits &= EverCrypt_CTR_DRBG_generate(out, st, SIZE, ai, 48);
+  printf("CTR_DRBG AES-256, limits: ");
+  if (ok_limits)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  ok &= ok_limits;
+
+  cycles a,b;
+  clock_t t1,t2;
+
+  EverCrypt_DRBG_state_s *hmac = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  EverCrypt_DRBG_instantiate(hmac, NULL, 0);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 16; j++) {
+    EverCrypt_DRBG_generate(out, hmac, SIZE, NULL, 0);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+  EverCrypt_DRBG_uninstantiate(hmac);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_CTR_DRBG_generate(out, st, SIZE, NULL, 0);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  EverCrypt_CTR_DRBG_uninstantiate(st);
+
+  printf("HMAC-DRBG-SHA2-256, %d-byte requests:\n", SIZE);
+  print_time((uint64_t)ROUNDS / 16 * SIZE,tdiff1,cdiff1);
+  printf("CTR_DRBG AES-256, %d-byte requests:\n", SIZE);
+  print_time((uint64_t)ROUNDS * SIZE,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
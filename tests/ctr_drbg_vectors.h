@@ -0,0 +1,728 @@
+#pragma once
+
+// CTR_DRBG with AES-256, no derivation function, in the order of the NIST CAVP
+// tests: instantiate, reseed, generate twice; the expected value is the output
+// of the second generate. Generated with PyCryptodome AES.
+
+typedef struct {
+  uint8_t *entropy;
+  uint8_t *pers;
+  uint32_t pers_len;
+  uint8_t *entropy_reseed;
+  uint8_t *ai_reseed;
+  uint32_t ai_reseed_len;
+  uint8_t *ai1;
+  uint8_t *ai2;
+  uint32_t ai_len;
+  uint32_t output_len;
+  uint8_t *expected;
+} ctr_drbg_test_vector;
+
+static uint8_t entropy0[48] = {
+  0x2eU, 0x1fU, 0xa9U, 0x72U, 0x55U, 0x3dU, 0x32U, 0xf3U, 0x7dU, 0xa0U, 0x7eU, 0x2eU, 0x7aU, 0x4bU, 0x75U, 0xe3U,
+  0x43U, 0x32U, 0x40U, 0xe6U, 0xb1U, 0x1eU, 0x53U, 0x85U, 0xacU, 0xc3U, 0xc9U, 0x2cU, 0xddU, 0xf7U, 0xf1U, 0xcfU,
+  0x3cU, 0x2bU, 0x3cU, 0x33U, 0xbcU, 0x5dU, 0x93U, 0x81U, 0x33U, 0xcfU, 0xadU, 0xe4U, 0xdfU, 0xc1U, 0xd5U, 0x7eU
+};
+
+static uint8_t entropy_reseed0[48] = {
+  0x37U, 0xb7U, 0x4cU, 0x43U, 0x01U, 0x57U, 0xf9U, 0x67U, 0x38U, 0xc5U, 0xbaU, 0x67U, 0x89U, 0x58U, 0x97U, 0x92U,
+  0x86U, 0x45U, 0xd3U, 0x45U, 0x99U, 0xb5U, 0x4dU, 0x8dU, 0x1dU, 0x48U, 0x7aU, 0x91U, 0xecU, 0x80U, 0x25U, 0x7eU,
+  0xafU, 0xcbU, 0xa1U, 0xcbU, 0x29U, 0x30U, 0x34U, 0xa5U, 0xafU, 0xceU, 0x6fU, 0x21U, 0x68U, 0x83U, 0x7aU, 0x92U
+};
+
+static uint8_t expected0[64] = {
+  0x9bU, 0x58U, 0xadU, 0x82U, 0x44U, 0x97U, 0xd1U, 0x0eU, 0x6eU, 0xdeU, 0xdfU, 0xa6U, 0x68U, 0x1aU, 0x57U, 0x9fU,
+  0x7eU, 0x30U, 0x8cU, 0x1cU, 0xd5U, 0x96U, 0x18U, 0x75U, 0xc5U, 0x5bU, 0x54U, 0x03U, 0x2cU, 0x06U, 0x30U, 0x30U,
+  0x63U, 0xb8U, 0xe7U, 0x23U, 0x99U, 0xf5U, 0x53U, 0x96U, 0xf3U, 0x92U, 0x1dU, 0x1aU, 0x2dU, 0x36U, 0xe3U, 0x34U,
+  0x12U, 0x12U, 0x8bU, 0x6eU, 0x31U, 0x7eU, 0x2eU, 0x7eU, 0xb5U, 0x2bU, 0xbaU, 0xa0U, 0xfaU, 0xebU, 0xbdU, 0xc5U
+};
+
+static uint8_t entropy1[48] = {
+  0x19U, 0xe9U, 0xb4U, 0x33U, 0x96U, 0x42U, 0x88U, 0xd8U, 0x56U, 0xcaU, 0xcfU, 0xd5U, 0xd2U, 0xa8U, 0x8bU, 0x78U,
+  0x16U, 0x7dU, 0x25U, 0x7aU, 0x26U, 0x7dU, 0x14U, 0x3fU, 0xa5U, 0x17U, 0x8bU, 0x5aU, 0x34U, 0xeeU, 0xe9U, 0xc8U,
+  0xa1U, 0x64U, 0xcaU, 0x94U, 0xd1U, 0x88U, 0xaeU, 0xc2U, 0x86U, 0x01U, 0xfcU, 0xfdU, 0x22U, 0xc5U, 0xb0U, 0xd8U
+};
+
+static uint8_t pers1[48] = {
+  0xe2U, 0x16U, 0x7aU, 0x66U, 0xd1U, 0x67U, 0x2eU, 0x62U, 0x6aU, 0x21U, 0x45U, 0xb5U, 0x65U, 0xaeU, 0xb3U, 0x5cU,
+  0x24U, 0x55U, 0x56U, 0xbaU, 0xd8U, 0x9cU, 0x4dU, 0xe9U, 0x20U, 0x6fU, 0xfeU, 0xb2U, 0x8aU, 0xddU, 0x04U, 0xe6U,
+  0x92U, 0x6cU, 0x25U, 0xc4U, 0x29U, 0x9dU, 0xbdU, 0xceU, 0xa6U, 0xe4U, 0x6dU, 0x01U, 0x83U, 0x8eU, 0x8fU, 0xd3U
+};
+
+static uint8_t entropy_reseed1[48] = {
+  0x75U, 0x8cU, 0x19U, 0x02U, 0xc4U, 0x9bU, 0xc5U, 0x41U, 0x6cU, 0xbeU, 0x67U, 0x7aU, 0x9cU, 0x8eU, 0x78U, 0xdeU,
+  0x6aU, 0xd6U, 0xe0U, 0xd6U, 0xe7U, 0xcaU, 0x26U, 0x39U, 0x2cU, 0xdaU, 0xc8U, 0x2dU, 0xf5U, 0x5eU, 0xbaU, 0xa0U,
+  0x4cU, 0x7eU, 0x0eU, 0xc7U, 0xd3U, 0x17U, 0xeeU, 0x5aU, 0xc2U, 0x8aU, 0xbcU, 0x2dU, 0xf9U, 0xdbU, 0x86U, 0x26U
+};
+
+static uint8_t expected1[64] = {
+  0xbbU, 0x03U, 0x59U, 0x89U, 0xe8U, 0x00U, 0xb7U, 0x8eU, 0x38U, 0x24U, 0xd7U, 0x58U, 0xb9U, 0x02U, 0xddU, 0xb5U,
+  0x41U, 0xc0U, 0x7fU, 0x1aU, 0x1cU, 0xd7U, 0x9cU, 0xf4U, 0x9bU, 0x6aU, 0x8fU, 0x94U, 0xadU, 0x34U, 0x17U, 0x0bU,
+  0xacU, 0xadU, 0xfcU, 0xcbU, 0xf2U, 0xb0U, 0xbaU, 0x3bU, 0x3bU, 0xcdU, 0xd1U, 0x0dU, 0x99U, 0x55U, 0xdbU, 0x5bU,
+  0xdeU, 0xa3U, 0x12U, 0xeaU, 0x6aU, 0xd9U, 0x2dU, 0x0fU, 0x65U, 0xa5U, 0xe2U, 0x47U, 0x11U, 0x47U, 0x01U, 0xf2U
+};
+
+static uint8_t entropy2[48] = {
+  0xeeU, 0x36U, 0x43U, 0xf2U, 0x13U, 0x29U, 0xd6U, 0x92U, 0xb2U, 0xfeU, 0xcbU, 0x3bU, 0x21U, 0xedU, 0x4cU, 0x1bU,
+  0x96U, 0x5fU, 0x10U, 0x5bU, 0x54U, 0x16U, 0x9aU, 0x44U, 0xefU, 0x58U, 0xb8U, 0x2bU, 0x65U, 0xb2U, 0x68U, 0xd4U,
+  0x83U, 0x68U, 0xbdU, 0x85U, 0xfeU, 0xb5U, 0x02U, 0x45U, 0xecU, 0x6fU, 0xcdU, 0xbfU, 0x0bU, 0x90U, 0x41U, 0x66U
+};
+
+static uint8_t entropy_reseed2[48] = {
+  0x46U, 0x16U, 0x37U, 0x48U, 0x29U, 0x5fU, 0x22U, 0xb1U, 0xadU, 0xa5U, 0x70U, 0x16U, 0x1bU, 0xc1U, 0xd7U, 0x53U,
+  0xd5U, 0xafU, 0x42U, 0xc7U, 0xd4U, 0x8eU, 0xc6U, 0x77U, 0x87U, 0x92U, 0x16U, 0x38U, 0xb5U, 0x13U, 0xdfU, 0x77U,
+  0xe3U, 0xc7U, 0xf3U, 0x50U, 0x29U, 0xc2U, 0xf9U, 0xb8U, 0x17U, 0x38U, 0x5dU, 0xdcU, 0x89U, 0xecU, 0xa3U, 0x7dU
+};
+
+static uint8_t ai_reseed2[48] = {
+  0x87U, 0xc5U, 0xe8U, 0x81U, 0xc6U, 0x61U, 0xdbU, 0x67U, 0xadU, 0x4eU, 0x74U, 0xc1U, 0x05U, 0x82U, 0xa5U, 0xecU,
+  0xefU, 0xd5U, 0x30U, 0xa8U, 0xffU, 0x34U, 0x04U, 0x15U, 0x65U, 0xa9U, 0xc0U, 0x5dU, 0xb6U, 0x10U, 0x93U, 0x03U,
+  0x47U, 0x36U, 0x3fU, 0x89U, 0x23U, 0xb6U, 0xa5U, 0x50U, 0x04U, 0xf1U, 0x21U, 0x3aU, 0xb7U, 0xb5U, 0x72U, 0x46U
+};
+
+static uint8_t ai1_2[48] = {
+  0x04U, 0x86U, 0x6cU, 0xacU, 0xecU, 0xbeU, 0x83U, 0x2aU, 0x44U, 0x6aU, 0x23U, 0xe4U, 0x7fU, 0x9cU, 0x3eU, 0x9dU,
+  0x46U, 0x79U, 0x0fU, 0x86U, 0x9bU, 0xb4U, 0xcbU, 0x59U, 0x81U, 0x0eU, 0x9cU, 0x74U, 0x4aU, 0xccU, 0xfeU, 0xb0U,
+  0x49U, 0xb5U, 0xeaU, 0x9eU, 0x03U, 0x30U, 0xa9U, 0xa2U, 0xdeU, 0x85U, 0x91U, 0xe3U, 0x37U, 0x05U, 0x2aU, 0xf8U
+};
+
+static uint8_t ai2_2[48] = {
+  0xfdU, 0x4cU, 0xfeU, 0xd6U, 0x3cU, 0x30U, 0x69U, 0x11U, 0xd4U, 0x8dU, 0xdeU, 0x2dU, 0x07U, 0x74U, 0x8bU, 0xa0U,
+  0x3fU, 0x75U, 0x15U, 0xbcU, 0xb1U, 0xd5U, 0x7cU, 0x7aU, 0x35U, 0x30U, 0xc2U, 0x71U, 0x52U, 0xa3U, 0x43U, 0x6eU,
+  0x4cU, 0x22U, 0x32U, 0x60U, 0xd7U, 0xa1U, 0x54U, 0xbcU, 0xeeU, 0xb2U, 0xafU, 0x8dU, 0x89U, 0x43U, 0xe5U, 0xfcU
+};
+
+static uint8_t expected2[64] = {
+  0xb8U, 0xfaU, 0xeaU, 0x28U, 0xbcU, 0x8cU, 0x77U, 0x45U, 0x8aU, 0x84U, 0x04U, 0xb6U, 0x1eU, 0x1eU, 0x2aU, 0x7fU,
+  0x44U, 0xfcU, 0xa4U, 0xc8U, 0xa4U, 0x45U, 0x43U, 0x64U, 0xc6U, 0xceU, 0x68U, 0x0dU, 0xdcU, 0xb9U, 0x00U, 0xa0U,
+  0x3eU, 0x04U, 0x5cU, 0xc7U, 0x42U, 0xd9U, 0x68U, 0x0eU, 0x29U, 0x44U, 0x68U, 0x3fU, 0x5fU, 0xa8U, 0x5dU, 0x8dU,
+  0x79U, 0x9aU, 0x41U, 0x39U, 0x14U, 0x97U, 0x84U, 0x4bU, 0x5fU, 0xf6U, 0x9aU, 0xdeU, 0x50U, 0x59U, 0xf8U, 0x15U
+};
+
+static uint8_t entropy3[48] = {
+  0x5fU, 0x36U, 0x09U, 0xa9U, 0xa7U, 0xbfU, 0x10U, 0x9eU, 0xedU, 0xe9U, 0xf9U, 0x25U, 0x64U, 0x11U, 0x17U, 0x7eU,
+  0xf5U, 0xf8U, 0x42U, 0x59U, 0xf7U, 0x36U, 0x7aU, 0x11U, 0xe2U, 0x12U, 0xdfU, 0x5cU, 0x26U, 0x57U, 0x55U, 0x03U,
+  0x6eU, 0x59U, 0x33U, 0x09U, 0xedU, 0x49U, 0x35U, 0xd0U, 0x3cU, 0xf1U, 0x2eU, 0x9dU, 0x26U, 0x58U, 0xd0U, 0xa1U
+};
+
+static uint8_t pers3[20] = {
+  0x33U, 0x05U, 0x96U, 0x09U, 0x20U, 0x8fU, 0xcfU, 0xf3U, 0xc8U, 0x52U, 0xf1U, 0x26U, 0x0eU, 0x3dU, 0xabU, 0xcaU,
+  0xbaU, 0x29U, 0x56U, 0x4dU
+};
+
+static uint8_t entropy_reseed3[48] = {
+  0xb0U, 0x8dU, 0x52U, 0xc7U, 0x95U, 0x52U, 0xdaU, 0x84U, 0xd3U, 0x95U, 0x55U, 0xdcU, 0x42U, 0x48U, 0xf3U, 0x5bU,
+  0x3bU, 0xfcU, 0x78U, 0x5eU, 0x6aU, 0x6aU, 0x5dU, 0xcfU, 0x88U, 0xc8U, 0x1dU, 0x46U, 0x77U, 0x27U, 0xacU, 0xecU,
+  0xd9U, 0x34U, 0x7dU, 0x5cU, 0x3bU, 0x77U, 0x48U, 0xcfU, 0x30U, 0x7aU, 0x25U, 0x42U, 0x4eU, 0xe3U, 0x62U, 0xb0U
+};
+
+static uint8_t ai_reseed3[33] = {
+  0xf1U, 0x58U, 0xc1U, 0x42U, 0xebU, 0xd7U, 0x7dU, 0x4fU, 0x31U, 0x4bU, 0x92U, 0x05U, 0xb2U, 0x63U, 0xfeU, 0xaeU,
+  0x3aU, 0xc1U, 0xc3U, 0xacU, 0xf5U, 0xb7U, 0x64U, 0x0bU, 0x85U, 0x98U, 0x1bU, 0xdaU, 0xabU, 0x5bU, 0x0eU, 0xc4U,
+  0xc7U
+};
+
+static uint8_t ai1_3[16] = {
+  0x64U, 0xc1U, 0x6cU, 0xd4U, 0xc2U, 0xd8U, 0xe4U, 0x11U, 0x6aU, 0xe0U, 0x9dU, 0xb4U, 0xacU, 0xf2U, 0xe8U, 0xe6U
+};
+
+static uint8_t ai2_3[16] = {
+  0x5bU, 0x7bU, 0x58U, 0xdbU, 0x8eU, 0x33U, 0xffU, 0xf8U, 0xeeU, 0xacU, 0x6dU, 0xcfU, 0x4dU, 0x8bU, 0x64U, 0x92U
+};
+
+static uint8_t expected3[1000] = {
+  0x7fU, 0x44U, 0x63U, 0xc8U, 0xbcU, 0x41U, 0xefU, 0x0dU, 0x3eU, 0x18U, 0x51U, 0xefU, 0x16U, 0x70U, 0x8aU, 0x79U,
+  0x45U, 0x6cU, 0x36U, 0x80U, 0xd6U, 0x89U, 0x78U, 0x55U, 0xc9U, 0x17U, 0x5aU, 0xa5U, 0x9aU, 0x83U, 0x85U, 0x36U,
+  0xefU, 0x16U, 0x63U, 0xa2U, 0x76U, 0xa7U, 0x2aU, 0x98U, 0xdbU, 0xb9U, 0xe5U, 0x5aU, 0xdeU, 0x4aU, 0x9dU, 0x4dU,
+  0x06U, 0x7bU, 0xe7U, 0x14U, 0x1fU, 0xd6U, 0xbaU, 0x76U, 0xf1U, 0x27U, 0xabU, 0x25U, 0x2bU, 0x97U, 0x20U, 0xb2U,
+  0xe5U, 0xfbU, 0x15U, 0xa4U, 0x2aU, 0xd1U, 0x0cU, 0x68U, 0xd3U, 0x9fU, 0xf3U, 0x91U, 0xd1U, 0x29U, 0x73U, 0x3bU,
+  0xd7U, 0xa9U, 0xb0U, 0xadU, 0xd2U, 0x94U, 0xa1U, 0x88U, 0x49U, 0xc7U, 0xcdU, 0xd5U, 0x17U, 0x58U, 0xa9U, 0x76U,
+  0x1cU, 0xedU, 0xd4U, 0xf8U, 0x16U, 0x63U, 0x95U, 0x03U, 0x0dU, 0x6aU, 0xc4U, 0x0eU, 0xf9U, 0x90U, 0x2dU, 0x70U,
+  0x63U, 0xbfU, 0x05U, 0x07U, 0x2fU, 0x47U, 0x3bU, 0x2dU, 0x60U, 0x9fU, 0xf0U, 0xbdU, 0x94U, 0x92U, 0x95U, 0xa4U,
+  0x94U, 0xceU, 0x8cU, 0x29U, 0x75U, 0x13U, 0xc5U, 0x10U, 0xdcU, 0xd0U, 0xe5U, 0x44U, 0x59U, 0xddU, 0xb8U, 0x8fU,
+  0x72U, 0x1dU, 0xb0U, 0xd0U, 0xefU, 0x92U, 0xc2U, 0xdfU, 0xd7U, 0xe7U, 0x3eU, 0x94U, 0xa5U, 0x3cU, 0xc3U, 0x51U,
+  0x05U, 0xb0U, 0x76U, 0xdcU, 0xcfU, 0x16U, 0xb0U, 0x5aU, 0x16U, 0xe5U, 0x88U, 0x7eU, 0x6cU, 0x20U, 0xaaU, 0x04U,
+  0x83U, 0x84U, 0xa6U, 0x74U, 0x71U, 0xb9U, 0xf5U, 0xedU, 0x70U, 0x02U, 0x77U, 0x87U, 0x9fU, 0x21U, 0xd6U, 0x17U,
+  0x12U, 0xbbU, 0x0eU, 0xd7U, 0xa3U, 0x2eU, 0x0cU, 0x08U, 0x6aU, 0xfeU, 0xebU, 0xadU, 0x95U, 0xb8U, 0x86U, 0x86U,
+  0x06U, 0x69U, 0x97U, 0x84U, 0x44U, 0x52U, 0xa2U, 0x22U, 0x9aU, 0x19U, 0x0cU, 0x9bU, 0x5fU, 0x3dU, 0x6aU, 0x45U,
+  0xc6U, 0xffU, 0xcbU, 0x00U, 0xbaU, 0x0bU, 0x18U, 0x73U, 0x43U, 0x08U, 0x1eU, 0xf1U, 0x19U, 0x46U, 0x96U, 0x5bU,
+  0x6aU, 0x98U, 0xd0U, 0x44U, 0x2aU, 0x4fU, 0xe0U, 0x6fU, 0x0dU, 0xcfU, 0x03U, 0x3dU, 0x6bU, 0xdeU, 0x72U, 0xf5U,
+  0xb9U, 0xcaU, 0x43U, 0x76U, 0x5bU, 0x4bU, 0x12U, 0xc5U, 0xe2U, 0x09U, 0xecU, 0xf0U, 0x71U, 0x65U, 0x4fU, 0x03U,
+  0x68U, 0x11U, 0x9fU, 0xc8U, 0xa3U, 0xbdU, 0x3dU, 0x78U, 0xb6U, 0xa0U, 0xf3U, 0x85U, 0xdcU, 0xe3U, 0x72U, 0xdbU,
+  0x47U, 0xd2U, 0x1aU, 0x19U, 0xd0U, 0x69U, 0x43U, 0x1cU, 0xefU, 0x28U, 0xccU, 0xc9U, 0x0aU, 0x2dU, 0x3cU, 0x5fU,
+  0x20U, 0x5fU, 0xd5U, 0x22U, 0x79U, 0x4bU, 0xe2U, 0xa1U, 0x6cU, 0xddU, 0x8bU, 0xf6U, 0x29U, 0xdeU, 0x38U, 0xa1U,
+  0xccU, 0xacU, 0x99U, 0xf7U, 0x1aU, 0x13U, 0xc7U, 0x6bU, 0x4eU, 0x16U, 0xedU, 0x9eU, 0xd1U, 0x40U, 0x4bU, 0x38U,
+  0xe8U, 0xbaU, 0x7fU, 0xe1U, 0x00U, 0x87U, 0xc1U, 0xa4U, 0x52U, 0x15U, 0xcaU, 0x16U, 0x82U, 0xd2U, 0x2dU, 0xeeU,
+  0xcfU, 0x36U, 0x6cU, 0x80U, 0x15U, 0xb6U, 0x1cU, 0x95U, 0xe7U, 0x0fU, 0x5cU, 0x1cU, 0x1aU, 0xe3U, 0x96U, 0x69U,
+  0xf3U, 0x7aU, 0xb1U, 0x3bU, 0x3aU, 0x20U, 0x22U, 0x2bU, 0xa3U, 0xa4U, 0xeaU, 0xd9U, 0x94U, 0xd6U, 0xf8U, 0xd9U,
+  0xa3U, 0xd8U, 0x50U, 0x9fU, 0x2cU, 0xcdU, 0x0fU, 0x67U, 0x90U, 0xd3U, 0xc6U, 0x52U, 0x6cU, 0x17U, 0x14U, 0xffU,
+  0x2fU, 0x93U, 0x5eU, 0x74U, 0x2aU, 0xc2U, 0x23U, 0x57U, 0x3fU, 0x24U, 0x85U, 0x90U, 0x17U, 0x8eU, 0x2aU, 0x8dU,
+  0x54U, 0xdeU, 0x08U, 0xf7U, 0x76U, 0xf0U, 0x5dU, 0x67U, 0xa1U, 0x26U, 0xf9U, 0xacU, 0x22U, 0x15U, 0x0eU, 0x56U,
+  0x0aU, 0xc6U, 0x9eU, 0xa2U, 0xf3U, 0xc7U, 0x7aU, 0x0bU, 0xc1U, 0x81U, 0xc3U, 0xfaU, 0x40U, 0x1dU, 0xf2U, 0xd4U,
+  0x7fU, 0xd7U, 0x38U, 0xaaU, 0x92U, 0x4fU, 0x8aU, 0xacU, 0xa1U, 0x4cU, 0xdcU, 0xc7U, 0xa7U, 0x5fU, 0x68U, 0x52U,
+  0xccU, 0xdbU, 0x96U, 0x6fU, 0xa9U, 0x06U, 0x6fU, 0xb2U, 0x16U, 0x1cU, 0xa9U, 0xb0U, 0x22U, 0x75U, 0x8cU, 0x42U,
+  0xccU, 0xe0U, 0x74U, 0xa3U, 0xd9U, 0x4bU, 0xc9U, 0x9cU, 0x67U, 0x0aU, 0xabU, 0xd8U, 0xf0U, 0x4cU, 0x1bU, 0x9dU,
+  0x1cU, 0x91U, 0x9dU, 0x08U, 0x23U, 0xdaU, 0x78U, 0xc8U, 0xdeU, 0x59U, 0x33U, 0x10U, 0x2eU, 0x6dU, 0x08U, 0x0fU,
+  0x63U, 0x50U, 0xfeU, 0xdcU, 0x7bU, 0x03U, 0x83U, 0x11U, 0x34U, 0xdfU, 0x66U, 0xe6U, 0x6aU, 0x5cU, 0x77U, 0xb5U,
+  0x84U, 0x8cU, 0x1bU, 0xaaU, 0x0dU, 0xfbU, 0x80U, 0xddU, 0x70U, 0x08U, 0x07U, 0x3fU, 0x6dU, 0x10U, 0x12U, 0x6eU,
+  0x51U, 0x8eU, 0x1fU, 0x01U, 0xc0U, 0x9dU, 0x9aU, 0x6bU, 0x08U, 0x75U, 0x00U, 0x33U, 0xe0U, 0x6aU, 0x32U, 0x95U,
+  0x54U, 0xe6U, 0x44U, 0x67U, 0x01U, 0xf4U, 0x2bU, 0x60U, 0xadU, 0xe0U, 0xa1U, 0x29U, 0x2eU, 0x95U, 0xccU, 0x3cU,
+  0x14U, 0x40U, 0x02U, 0x21U, 0x5dU, 0xaaU, 0xcaU, 0xe2U, 0xbfU, 0x66U, 0x7aU, 0xc2U, 0x67U, 0x36U, 0xccU, 0x28U,
+  0x50U, 0x0cU, 0xfeU, 0xecU, 0xfbU, 0x5dU, 0x42U, 0x86U, 0xc8U, 0xe2U, 0x61U, 0xfcU, 0x69U, 0xc8U, 0x44U, 0x27U,
+  0xf4U, 0x0aU, 0x69U, 0x05U, 0x02U, 0x14U, 0xcbU, 0x0fU, 0xa2U, 0x59U, 0xa2U, 0x82U, 0x19U, 0x6eU, 0x4bU, 0xa1U,
+  0x7fU, 0xf6U, 0x52U, 0xfeU, 0x57U, 0x7aU, 0x35U, 0x7dU, 0x11U, 0x1fU, 0x6fU, 0x90U, 0x18U, 0xf3U, 0xffU, 0x88U,
+  0x7cU, 0x99U, 0xdbU, 0xedU, 0x0bU, 0x0cU, 0x60U, 0x85U, 0xe1U, 0x59U, 0x7dU, 0x59U, 0xa6U, 0x6dU, 0xf8U, 0x9cU,
+  0x02U, 0xf4U, 0x3bU, 0x35U, 0x23U, 0x70U, 0xa9U, 0x8cU, 0xe0U, 0xe8U, 0x41U, 0x2eU, 0xc0U, 0x21U, 0xb1U, 0xd5U,
+  0xc0U, 0xf6U, 0xfbU, 0x94U, 0xfbU, 0x44U, 0xdfU, 0xefU, 0x63U, 0x68U, 0x51U, 0xf3U, 0xabU, 0xb3U, 0xc6U, 0x1dU,
+  0x13U, 0x47U, 0x77U, 0x98U, 0x5aU, 0x26U, 0x80U, 0x9bU, 0x0dU, 0x38U, 0x2dU, 0x99U, 0x2fU, 0xb5U, 0xa0U, 0xfcU,
+  0xb3U, 0x9bU, 0xfdU, 0xc6U, 0x38U, 0x58U, 0xd7U, 0xb6U, 0xe6U, 0x19U, 0x53U, 0xc3U, 0xa8U, 0x91U, 0xe7U, 0x47U,
+  0x50U, 0x36U, 0xc4U, 0xecU, 0x76U, 0x38U, 0x06U, 0xabU, 0xb2U, 0xf2U, 0x7aU, 0xfbU, 0x3bU, 0x5dU, 0x3fU, 0xedU,
+  0x71U, 0xbdU, 0x6fU, 0xabU, 0x1cU, 0x23U, 0x94U, 0x7eU, 0x78U, 0x41U, 0xbbU, 0x66U, 0x4cU, 0x7aU, 0xcbU, 0x75U,
+  0xc8U, 0x94U, 0x85U, 0x80U, 0xd3U, 0x1bU, 0x3dU, 0xa3U, 0x73U, 0x21U, 0x0eU, 0x19U, 0x49U, 0x3dU, 0x47U, 0x5dU,
+  0x38U, 0x32U, 0x12U, 0xd9U, 0x23U, 0x18U, 0xb9U, 0xafU, 0xbcU, 0x59U, 0xcfU, 0xa0U, 0x18U, 0x44U, 0xc7U, 0x2eU,
+  0x6aU, 0x6bU, 0xdaU, 0x12U, 0xc6U, 0xa2U, 0xd4U, 0xd3U, 0x7eU, 0xc7U, 0xd4U, 0xacU, 0x99U, 0x97U, 0x90U, 0xecU,
+  0x39U, 0x32U, 0x3cU, 0xe3U, 0x7fU, 0x9fU, 0xabU, 0x13U, 0xdcU, 0x00U, 0xeaU, 0x0eU, 0x3bU, 0x13U, 0xdfU, 0xc7U,
+  0x58U, 0x90U, 0x03U, 0x88U, 0x1eU, 0x6cU, 0xdbU, 0x55U, 0xceU, 0x81U, 0x8eU, 0x7aU, 0x8eU, 0x0eU, 0xc8U, 0x1fU,
+  0x4bU, 0x11U, 0x4cU, 0x92U, 0x80U, 0xa9U, 0x9aU, 0xd0U, 0x84U, 0x51U, 0xc3U, 0xc9U, 0x60U, 0x5fU, 0x86U, 0x45U,
+  0x72U, 0x80U, 0xceU, 0x80U, 0x9aU, 0x9cU, 0xd8U, 0xedU, 0x62U, 0x42U, 0xf3U, 0xf4U, 0xa8U, 0x3dU, 0xfaU, 0x08U,
+  0x6dU, 0x97U, 0x1aU, 0x13U, 0x99U, 0x81U, 0x8eU, 0x18U, 0x98U, 0xe1U, 0x2eU, 0xb0U, 0x13U, 0x23U, 0x35U, 0x38U,
+  0xc2U, 0x78U, 0xfbU, 0x04U, 0x26U, 0xf0U, 0x63U, 0xc7U, 0x1cU, 0x4bU, 0xecU, 0xcfU, 0xe1U, 0xb1U, 0x94U, 0xc6U,
+  0x97U, 0x6cU, 0x23U, 0x1bU, 0xebU, 0x17U, 0xa6U, 0xe7U, 0x44U, 0xceU, 0x64U, 0x07U, 0xd2U, 0xcfU, 0x8aU, 0x72U,
+  0xf5U, 0xe9U, 0x10U, 0xd8U, 0x6aU, 0x1cU, 0xf8U, 0x7aU, 0x58U, 0x3cU, 0x56U, 0xb3U, 0xf8U, 0x3cU, 0x2fU, 0xbeU,
+  0xf4U, 0xf3U, 0xc9U, 0xb2U, 0xb2U, 0x2fU, 0x0bU, 0x9fU, 0x56U, 0x26U, 0xacU, 0x03U, 0x5aU, 0x93U, 0x11U, 0x2aU,
+  0xa1U, 0x3eU, 0x64U, 0x2bU, 0xbfU, 0x97U, 0xafU, 0xb8U, 0x3aU, 0xafU, 0x6bU, 0x41U, 0x40U, 0x81U, 0xcaU, 0x27U,
+  0x3bU, 0x59U, 0xa4U, 0x44U, 0x74U, 0xb7U, 0x91U, 0x08U, 0x10U, 0x79U, 0x1dU, 0xf1U, 0xc3U, 0x17U, 0xc2U, 0x4bU,
+  0xf0U, 0x43U, 0x05U, 0xdaU, 0x48U, 0x13U, 0x56U, 0xf5U, 0xe6U, 0x8bU, 0xe9U, 0xfaU, 0xbcU, 0xa1U, 0x24U, 0x30U,
+  0xcdU, 0x68U, 0x93U, 0x8dU, 0xd5U, 0x82U, 0x55U, 0x8cU
+};
+
+static uint8_t entropy4[48] = {
+  0xe6U, 0x3eU, 0xb6U, 0xcdU, 0xc1U, 0x86U, 0x14U, 0x39U, 0x11U, 0xc1U, 0xc0U, 0x94U, 0x83U, 0x6dU, 0x57U, 0xceU,
+  0x42U, 0x6cU, 0x5bU, 0xadU, 0x50U, 0x8aU, 0xe1U, 0x5dU, 0x92U, 0x5aU, 0xb6U, 0x96U, 0xa8U, 0x2fU, 0x48U, 0x2cU,
+  0x09U, 0x50U, 0x05U, 0xb6U, 0xd8U, 0x30U, 0x62U, 0xc4U, 0x3eU, 0x53U, 0x8fU, 0xf1U, 0x7cU, 0x1bU, 0x78U, 0xdaU
+};
+
+static uint8_t pers4[48] = {
+  0x4cU, 0xd2U, 0x52U, 0xd4U, 0x24U, 0xa1U, 0x14U, 0x4cU, 0x39U, 0xf4U, 0x45U, 0x38U, 0xe1U, 0xb3U, 0x68U, 0x68U,
+  0x34U, 0x11U, 0x1fU, 0x6aU, 0x50U, 0x51U, 0x56U, 0xc9U, 0x9fU, 0x34U, 0xb9U, 0xd3U, 0xe1U, 0x07U, 0xe4U, 0x16U,
+  0xc9U, 0x9fU, 0xadU, 0xedU, 0x8eU, 0x9dU, 0x93U, 0x29U, 0x2aU, 0xe9U, 0xf2U, 0xacU, 0x02U, 0x01U, 0x8cU, 0x21U
+};
+
+static uint8_t entropy_reseed4[48] = {
+  0xfbU, 0x63U, 0xd7U, 0x87U, 0x1fU, 0x90U, 0x22U, 0xd6U, 0x82U, 0x9dU, 0x35U, 0xf5U, 0x68U, 0x67U, 0x38U, 0x56U,
+  0x23U, 0xa9U, 0x95U, 0xe6U, 0x63U, 0x6eU, 0xf9U, 0x0cU, 0x8bU, 0x61U, 0xdfU, 0x34U, 0x7eU, 0xe5U, 0xb3U, 0x53U,
+  0xe8U, 0x74U, 0xafU, 0x9eU, 0x76U, 0x0eU, 0x69U, 0x17U, 0x0aU, 0x84U, 0x98U, 0x40U, 0x28U, 0x0fU, 0xadU, 0xbeU
+};
+
+static uint8_t ai_reseed4[48] = {
+  0xeeU, 0xbcU, 0x45U, 0x9dU, 0xe1U, 0x21U, 0xa7U, 0xd0U, 0x56U, 0xfeU, 0xa2U, 0x1cU, 0x06U, 0xaeU, 0xd2U, 0x0dU,
+  0x07U, 0x1cU, 0x4dU, 0x55U, 0x44U, 0xf7U, 0x4cU, 0x74U, 0xf7U, 0x8aU, 0x25U, 0xe3U, 0x56U, 0x64U, 0xd3U, 0x4aU,
+  0xbeU, 0x14U, 0x10U, 0x3bU, 0x87U, 0x9cU, 0x6bU, 0xe2U, 0x11U, 0xfdU, 0x20U, 0x43U, 0xf4U, 0xabU, 0x86U, 0x51U
+};
+
+static uint8_t ai1_4[48] = {
+  0x3fU, 0x8fU, 0x0aU, 0x04U, 0x82U, 0xeeU, 0xdaU, 0xc7U, 0x99U, 0xc1U, 0x72U, 0xa3U, 0x1dU, 0x61U, 0x56U, 0xd7U,
+  0x13U, 0x81U, 0x6cU, 0xa9U, 0x1eU, 0x45U, 0xa1U, 0x2fU, 0xadU, 0xb7U, 0x0cU, 0x50U, 0xcbU, 0x0bU, 0x8bU, 0x4cU,
+  0x35U, 0x6bU, 0x2cU, 0x30U, 0xcdU, 0x23U, 0xf0U, 0xb6U, 0x79U, 0x76U, 0x9eU, 0x81U, 0x3dU, 0xb7U, 0xfeU, 0x0cU
+};
+
+static uint8_t ai2_4[48] = {
+  0x26U, 0x84U, 0x58U, 0xfcU, 0x5cU, 0x46U, 0xf7U, 0xb3U, 0x80U, 0x2dU, 0x9cU, 0x60U, 0xf4U, 0x72U, 0x86U, 0x37U,
+  0x5cU, 0x3dU, 0xa6U, 0x54U, 0x9aU, 0x79U, 0xb8U, 0x63U, 0x59U, 0x7eU, 0xd7U, 0x3fU, 0x6dU, 0x8bU, 0x63U, 0xc4U,
+  0x25U, 0x78U, 0x05U, 0x5cU, 0x28U, 0xd2U, 0x8dU, 0xa0U, 0x34U, 0x7fU, 0x77U, 0x4fU, 0x6dU, 0xf4U, 0x3cU, 0x1dU
+};
+
+static uint8_t expected4[4103] = {
+  0xe3U, 0x28U, 0x06U, 0x32U, 0xf3U, 0xc0U, 0x02U, 0xcaU, 0x27U, 0x5dU, 0x8cU, 0x44U, 0xc5U, 0x77U, 0xd1U, 0xf9U,
+  0xe6U, 0x60U, 0xbdU, 0x04U, 0xccU, 0xebU, 0x93U, 0x25U, 0xfeU, 0x76U, 0x0fU, 0x2dU, 0x47U, 0x2cU, 0xf9U, 0x16U,
+  0xd0U, 0xf6U, 0xf6U, 0x68U, 0xdeU, 0x44U, 0xc2U, 0xfbU, 0x32U, 0x2eU, 0x36U, 0x8cU, 0x23U, 0x6aU, 0x99U, 0xb2U,
+  0x61U, 0x23U, 0x4eU, 0xbfU, 0xb4U, 0xf5U, 0xa5U, 0x0eU, 0x91U, 0xc9U, 0x51U, 0x03U, 0x31U, 0x1bU, 0x5cU, 0x60U,
+  0x6fU, 0x5bU, 0x7fU, 0xf3U, 0xfaU, 0x90U, 0x0bU, 0xc6U, 0xebU, 0xb6U, 0x26U, 0x69U, 0x65U, 0xbdU, 0xa0U, 0x98U,
+  0x3cU, 0x48U, 0xd2U, 0x20U, 0x53U, 0xc6U, 0xa1U, 0xf3U, 0x18U, 0x52U, 0x6aU, 0x77U, 0x12U, 0xb2U, 0x61U, 0x6fU,
+  0x6bU, 0x62U, 0xaeU, 0x81U, 0xdbU, 0xcfU, 0xdaU, 0x52U, 0x74U, 0xa3U, 0xefU, 0x36U, 0x94U, 0x88U, 0x2aU, 0x4aU,
+  0xd5U, 0x90U, 0xc0U, 0x06U, 0xb0U, 0x3cU, 0x4dU, 0xd0U, 0x5dU, 0x22U, 0x05U, 0xc1U, 0x05U, 0x07U, 0x21U, 0xc9U,
+  0x7bU, 0x77U, 0xa2U, 0xcdU, 0x4aU, 0xf2U, 0x9aU, 0xcaU, 0x2bU, 0x5dU, 0xcfU, 0x63U, 0x0eU, 0x52U, 0x3dU, 0x67U,
+  0xd1U, 0x6fU, 0x7dU, 0x3eU, 0xcdU, 0x18U, 0xf2U, 0x80U, 0x44U, 0xa4U, 0x7bU, 0xb0U, 0x2aU, 0xc9U, 0x7bU, 0x26U,
+  0xfbU, 0xb0U, 0x0bU, 0x3aU, 0x2bU, 0x43U, 0x8aU, 0x8aU, 0x9bU, 0x43U, 0xf4U, 0x5aU, 0x72U, 0x90U, 0xfdU, 0xa2U,
+  0x7fU, 0x05U, 0xabU, 0xc5U, 0xa0U, 0xcfU, 0x97U, 0xdbU, 0x22U, 0x83U, 0xfeU, 0xf3U, 0x7fU, 0xbaU, 0xedU, 0x83U,
+  0xd5U, 0xd8U, 0xacU, 0x7bU, 0x79U, 0x34U, 0x74U, 0xefU, 0x41U, 0xaaU, 0x9aU, 0xa9U, 0x0dU, 0x59U, 0xaaU, 0x9dU,
+  0x73U, 0x0eU, 0xafU, 0xdaU, 0x79U, 0xa1U, 0x14U, 0xa8U, 0x0fU, 0x36U, 0xfdU, 0x95U, 0x6fU, 0xabU, 0x74U, 0x6eU,
+  0xfcU, 0xf8U, 0x1dU, 0x09U, 0x21U, 0x39U, 0x18U, 0x60U, 0xeeU, 0x2cU, 0x88U, 0x59U, 0xc6U, 0x83U, 0x57U, 0xbbU,
+  0xcdU, 0x3aU, 0x3aU, 0xc2U, 0xebU, 0xbdU, 0xc5U, 0x4cU, 0x40U, 0xffU, 0xa5U, 0x94U, 0xd7U, 0x4eU, 0x42U, 0xe1U,
+  0x6cU, 0x38U, 0x05U, 0x79U, 0x84U, 0x5dU, 0xefU, 0xe0U, 0x6eU, 0x3dU, 0x89U, 0x61U, 0xe5U, 0xb4U, 0x71U, 0x94U,
+  0x80U, 0x97U, 0x52U, 0x51U, 0x23U, 0x71U, 0x0fU, 0x5bU, 0xa8U, 0x2dU, 0x6eU, 0x8aU, 0x24U, 0x3dU, 0xb8U, 0x99U,
+  0x7aU, 0xf0U, 0xf4U, 0x42U, 0xd8U, 0xe2U, 0x07U, 0x24U, 0xdeU, 0xd1U, 0x6aU, 0xf8U, 0xefU, 0x66U, 0x59U, 0x80U,
+  0x7eU, 0xd4U, 0xe7U, 0x15U, 0xd8U, 0xe2U, 0x1bU, 0xa3U, 0xfaU, 0xa8U, 0xecU, 0x27U, 0x6eU, 0x0cU, 0xacU, 0xf8U,
+  0x8eU, 0x12U, 0x1eU, 0x3fU, 0xf0U, 0xc2U, 0x5cU, 0xc7U, 0x82U, 0x0cU, 0x5aU, 0x82U, 0x2eU, 0x82U, 0xb1U, 0xaeU,
+  0xc4U, 0x70U, 0x18U, 0x49U, 0x84U, 0x64U, 0x16U, 0x05U, 0x3cU, 0x79U, 0xccU, 0xdcU, 0x85U, 0x2cU, 0x3aU, 0xe8U,
+  0xe5U, 0xabU, 0x6cU, 0x9eU, 0x99U, 0x37U, 0x35U, 0x77U, 0x41U, 0xf1U, 0x1bU, 0xb7U, 0x8dU, 0x4fU, 0xefU, 0xdaU,
+  0xa4U, 0x7dU, 0xc2U, 0xafU, 0xc5U, 0xa3U, 0x52U, 0x3fU, 0xe2U, 0x3cU, 0xf5U, 0xd6U, 0x5dU, 0xe9U, 0xedU, 0xefU,
+  0xc5U, 0xa4U, 0xb5U, 0x1fU, 0xa3U, 0x9cU, 0x07U, 0x04U, 0x0fU, 0xfdU, 0x78U, 0xfbU, 0xa5U, 0x4bU, 0x60U, 0x87U,
+  0xc8U, 0xfdU, 0xe8U, 0x51U, 0x53U, 0xffU, 0xdaU, 0x6bU, 0xc6U, 0x58U, 0x21U, 0xadU, 0xc3U, 0x17U, 0xb5U, 0x00U,
+  0xbaU, 0xf4U, 0xecU, 0xebU, 0x0cU, 0xc7U, 0xe2U, 0x54U, 0x21U, 0xb6U, 0xd4U, 0x70U, 0x14U, 0xd5U, 0xabU, 0xe5U,
+  0xd3U, 0xfcU, 0xa6U, 0x5eU, 0x98U, 0xd0U, 0xfdU, 0x6bU, 0xc9U, 0x11U, 0x41U, 0xb6U, 0xdbU, 0x36U, 0xf7U, 0x61U,
+  0xceU, 0x90U, 0x76U, 0xf0U, 0xc0U, 0x9eU, 0xaeU, 0x09U, 0xafU, 0x05U, 0xf7U, 0x13U, 0x21U, 0x33U, 0x6cU, 0xdaU,
+  0x12U, 0xebU, 0x78U, 0xeaU, 0x38U, 0x92U, 0xd0U, 0x7eU, 0x25U, 0x2dU, 0x42U, 0x65U, 0xb2U, 0xd3U, 0x16U, 0x93U,
+  0x41U, 0x43U, 0x90U, 0x38U, 0x08U, 0x5fU, 0x0cU, 0xcbU, 0xb9U, 0x95U, 0x46U, 0xc6U, 0x16U, 0x59U, 0x63U, 0x72U,
+  0xa1U, 0x33U, 0x3bU, 0xd5U, 0x70U, 0xf0U, 0xeaU, 0xccU, 0xcdU, 0x39U, 0xf9U, 0x56U, 0x80U, 0x0aU, 0x79U, 0x3dU,
+  0x8aU, 0xc4U, 0x8dU, 0x5eU, 0xd8U, 0x95U, 0x93U, 0x70U, 0x90U, 0xadU, 0x9aU, 0xe9U, 0x8dU, 0xf2U, 0x46U, 0x88U,
+  0xf5U, 0x85U, 0x99U, 0x7eU, 0x40U, 0x5bU, 0x26U, 0xafU, 0xedU, 0x67U, 0xd1U, 0xbbU, 0x8eU, 0x88U, 0x86U, 0x8cU,
+  0xa7U, 0x4cU, 0xebU, 0xfcU, 0xf8U, 0x53U, 0xfeU, 0xcbU, 0x02U, 0xc7U, 0xdcU, 0x2dU, 0x11U, 0x0bU, 0xa1U, 0x1fU,
+  0xa2U, 0x54U, 0x22U, 0xf0U, 0x6bU, 0x9cU, 0xaaU, 0xe4U, 0xb4U, 0x7eU, 0x6bU, 0x3bU, 0xd0U, 0xa5U, 0x37U, 0x6eU,
+  0x07U, 0x96U, 0xf8U, 0xc6U, 0x75U, 0x52U, 0x56U, 0x89U, 0x92U, 0x94U, 0x16U, 0xaaU, 0x1eU, 0x03U, 0xf6U, 0xe7U,
+  0xe7U, 0x0aU, 0x57U, 0xd0U, 0xbfU, 0x9aU, 0xe4U, 0x64U, 0xa6U, 0xc1U, 0xd2U, 0x3cU, 0x53U, 0x76U, 0x48U, 0xa3U,
+  0xb4U, 0x90U, 0x37U, 0x91U, 0x34U, 0x3dU, 0xe6U, 0xe3U, 0x42U, 0xd9U, 0xe7U, 0x2bU, 0x50U, 0x9fU, 0x57U, 0x9cU,
+  0x1fU, 0x87U, 0x3aU, 0x38U, 0xb6U, 0xefU, 0x8dU, 0x91U, 0xe6U, 0x2eU, 0x85U, 0x21U, 0x1aU, 0xadU, 0x15U, 0xb3U,
+  0x56U, 0x2bU, 0xd8U, 0xe3U, 0x64U, 0x24U, 0x77U, 0x95U, 0xb8U, 0x96U, 0xf8U, 0xf9U, 0x06U, 0x07U, 0xe4U, 0xf9U,
+  0xf4U, 0xa7U, 0x0dU, 0x39U, 0xb2U, 0xfaU, 0x16U, 0xe2U, 0x3eU, 0xe8U, 0x67U, 0x99U, 0xf6U, 0x92U, 0x49U, 0xf0U,
+  0x67U, 0xc5U, 0xc7U, 0x8fU, 0xb0U, 0xf6U, 0xb2U, 0x77U, 0xbcU, 0x07U, 0x2dU, 0x7dU, 0x11U, 0xafU, 0x6bU, 0xd4U,
+  0x32U, 0x26U, 0x0dU, 0xb2U, 0x8fU, 0x9dU, 0x04U, 0xd6U, 0x8dU, 0xf0U, 0x48U, 0xfcU, 0xf9U, 0xb0U, 0xccU, 0x92U,
+  0xe2U, 0x66U, 0x08U, 0x5bU, 0x7fU, 0xbfU, 0x38U, 0x88U, 0xc4U, 0xefU, 0x84U, 0x70U, 0xe7U, 0x1fU, 0xb8U, 0x2fU,
+  0x06U, 0xe5U, 0x41U, 0x81U, 0x5eU, 0x91U, 0x17U, 0x3cU, 0xc1U, 0x82U, 0xf0U, 0x2bU, 0x4bU, 0xe5U, 0x4eU, 0xd9U,
+  0x5aU, 0xe2U, 0xf9U, 0x76U, 0xd7U, 0xe2U, 0xd8U, 0x5fU, 0xc8U, 0x36U, 0xa9U, 0x33U, 0xf1U, 0x3bU, 0x6eU, 0x9bU,
+  0x28U, 0x49U, 0x0cU, 0xceU, 0x09U, 0x63U, 0xd1U, 0x32U, 0x11U, 0x41U, 0xedU, 0xceU, 0x63U, 0xf0U, 0x89U, 0x74U,
+  0x6cU, 0xb8U, 0xc0U, 0x1bU, 0x29U, 0x34U, 0xccU, 0xf9U, 0xcbU, 0x59U, 0xf1U, 0x20U, 0x24U, 0xdaU, 0xc2U, 0xc9U,
+  0x74U, 0x5cU, 0x59U, 0x57U, 0xe1U, 0x0dU, 0xd7U, 0x1bU, 0x57U, 0x41U, 0x13U, 0xf1U, 0xdeU, 0xb4U, 0xd8U, 0xf9U,
+  0xbcU, 0xcdU, 0xc2U, 0xedU, 0x76U, 0x04U, 0x2cU, 0x00U, 0x51U, 0xf4U, 0xeaU, 0xc6U, 0x3fU, 0x66U, 0xdaU, 0x7bU,
+  0xacU, 0x9aU, 0xa5U, 0x5dU, 0x2fU, 0xa9U, 0xb0U, 0x44U, 0xe1U, 0xa8U, 0x26U, 0x7cU, 0x27U, 0x92U, 0x02U, 0xa2U,
+  0x93U, 0x23U, 0x09U, 0xddU, 0x9fU, 0x51U, 0x1bU, 0x38U, 0x50U, 0x54U, 0xd1U, 0x44U, 0xc9U, 0xfeU, 0x19U, 0x49U,
+  0x63U, 0x72U, 0xbcU, 0x16U, 0x53U, 0x1fU, 0x79U, 0x01U, 0xf3U, 0x5dU, 0xc5U, 0xeaU, 0x87U, 0x24U, 0x37U, 0x05U,
+  0x72U, 0x82U, 0x94U, 0x83U, 0x52U, 0x63U, 0x98U, 0x99U, 0xbeU, 0x9bU, 0xb6U, 0x9eU, 0xaeU, 0x5eU, 0x02U, 0xc3U,
+  0x84U, 0xaaU, 0xa8U, 0xfbU, 0x88U, 0xabU, 0xfaU, 0x1dU, 0xc7U, 0xe6U, 0xe9U, 0xf0U, 0xe9U, 0xa9U, 0x07U, 0x94U,
+  0x96U, 0xd2U, 0x75U, 0xfeU, 0xd3U, 0x1eU, 0xcbU, 0x58U, 0xaaU, 0x70U, 0xc3U, 0x92U, 0xf2U, 0x1aU, 0xd8U, 0x96U,
+  0x68U, 0xe2U, 0x34U, 0x9bU, 0xe1U, 0x8dU, 0x51U, 0x8bU, 0xccU, 0x60U, 0xc6U, 0x5aU, 0x15U, 0xaeU, 0xd0U, 0x10U,
+  0x36U, 0xa7U, 0x16U, 0xb7U, 0xcaU, 0xbcU, 0xafU, 0xa5U, 0x0bU, 0x32U, 0x85U, 0x34U, 0x83U, 0xb3U, 0x5fU, 0x46U,
+  0x87U, 0xbaU, 0xc5U, 0xb9U, 0xe8U, 0x98U, 0xf8U, 0x33U, 0x65U, 0x72U, 0x75U, 0x94U, 0x08U, 0x8aU, 0x1fU, 0xfeU,
+  0x98U, 0x0eU, 0x3dU, 0xb4U, 0x32U, 0x9bU, 0x82U, 0xd9U, 0x70U, 0x38U, 0x47U, 0x00U, 0x0aU, 0xb1U, 0xd1U, 0xf3U,
+  0x19U, 0xc6U, 0xc3U, 0x31U, 0x11U, 0xfaU, 0xa2U, 0xacU, 0xebU, 0xd1U, 0x17U, 0x19U, 0xbaU, 0x6fU, 0x89U, 0xa2U,
+  0x0eU, 0x72U, 0x96U, 0x4dU, 0xa4U, 0xa9U, 0x0dU, 0x10U, 0xf7U, 0xd4U, 0xf2U, 0x10U, 0xb8U, 0x17U, 0x35U, 0x98U,
+  0xbeU, 0x30U, 0x0cU, 0xccU, 0x57U, 0xc7U, 0x30U, 0x50U, 0xd0U, 0x2cU, 0x8cU, 0x04U, 0xa1U, 0xb0U, 0xe0U, 0xc1U,
+  0xaeU, 0xbfU, 0x77U, 0x5bU, 0x6fU, 0xbdU, 0x52U, 0xf8U, 0x7fU, 0x28U, 0x63U, 0xacU, 0x3bU, 0xf2U, 0xa9U, 0xfbU,
+  0xe0U, 0xe5U, 0x5dU, 0x80U, 0x53U, 0xa0U, 0x8eU, 0x4eU, 0xcaU, 0x8aU, 0x2bU, 0x65U, 0xe1U, 0xf1U, 0x12U, 0x3fU,
+  0x8dU, 0xd0U, 0x6dU, 0xf6U, 0x66U, 0x09U, 0xb2U, 0x02U, 0x3aU, 0x8dU, 0x56U, 0xdfU, 0x4aU, 0x9fU, 0x8dU, 0xf1U,
+  0x37U, 0xfcU, 0x0bU, 0x10U, 0x80U, 0xbfU, 0x5dU, 0xdeU, 0xbbU, 0x96U, 0x24U, 0xafU, 0x0fU, 0x7fU, 0xd1U, 0xfaU,
+  0x42U, 0x00U, 0xa6U, 0xd4U, 0x01U, 0x7eU, 0x17U, 0xf9U, 0x31U, 0x91U, 0x7eU, 0xd6U, 0xf6U, 0x14U, 0x4dU, 0x4dU,
+  0x66U, 0x82U, 0x83U, 0x41U, 0xfbU, 0x04U, 0xb8U, 0x59U, 0x4aU, 0x1aU, 0xf9U, 0x28U, 0x8eU, 0xdbU, 0xdaU, 0x7bU,
+  0xeeU, 0x68U, 0x62U, 0xa4U, 0xa9U, 0x9dU, 0xf7U, 0x85U, 0x6aU, 0xf2U, 0xf3U, 0x26U, 0x2fU, 0x25U, 0x2bU, 0x79U,
+  0xc7U, 0x2dU, 0x77U, 0xd8U, 0xdbU, 0x9cU, 0xa8U, 0xcbU, 0x5dU, 0x3eU, 0x65U, 0xa0U, 0x08U, 0x65U, 0x22U, 0x5bU,
+  0x25U, 0x8dU, 0x53U, 0xebU, 0x58U, 0x90U, 0x5aU, 0x4bU, 0xe2U, 0xfbU, 0xd4U, 0x0cU, 0x51U, 0x7aU, 0x4bU, 0x66U,
+  0xe4U, 0xa4U, 0xd9U, 0x2cU, 0x88U, 0x23U, 0xe4U, 0x32U, 0xc3U, 0x16U, 0x4aU, 0x65U, 0x72U, 0x0aU, 0x52U, 0x71U,
+  0xcdU, 0x01U, 0x7fU, 0x9bU, 0x08U, 0xaaU, 0x41U, 0xc2U, 0x23U, 0x5dU, 0x80U, 0x9fU, 0xf6U, 0x0bU, 0x15U, 0x11U,
+  0xd9U, 0xdaU, 0xe2U, 0x1bU, 0x29U, 0x35U, 0x85U, 0xe2U, 0xbeU, 0x79U, 0x83U, 0x76U, 0xbaU, 0xf5U, 0x1cU, 0xfcU,
+  0xb1U, 0x0aU, 0xe2U, 0x30U, 0x85U, 0x39U, 0x70U, 0x0fU, 0x7aU, 0xc2U, 0xa5U, 0x83U, 0xa0U, 0x77U, 0xd9U, 0x7dU,
+  0xa3U, 0x05U, 0x7fU, 0x6bU, 0x35U, 0xc0U, 0x85U, 0x54U, 0x77U, 0xf0U, 0x7fU, 0x42U, 0x2dU, 0xb6U, 0x89U, 0x67U,
+  0x4bU, 0xfdU, 0x1cU, 0xf3U, 0x6eU, 0xf7U, 0x59U, 0x62U, 0xbaU, 0x82U, 0x0fU, 0xc2U, 0xc7U, 0x4dU, 0xf6U, 0x33U,
+  0x2dU, 0x8eU, 0x10U, 0x63U, 0x3bU, 0xd2U, 0xfdU, 0x42U, 0x49U, 0x58U, 0x8fU, 0x86U, 0x5aU, 0xd8U, 0xedU, 0xfdU,
+  0x64U, 0x1eU, 0x97U, 0xfaU, 0xfaU, 0x8bU, 0x4bU, 0x2fU, 0x45U, 0x4bU, 0xb4U, 0x5eU, 0x09U, 0xe3U, 0x01U, 0x11U,
+  0x3bU, 0xa9U, 0xd5U, 0xd8U, 0x25U, 0x59U, 0xadU, 0x59U, 0x4dU, 0x98U, 0x19U, 0xcdU, 0x4bU, 0x33U, 0x68U, 0x91U,
+  0x58U, 0x35U, 0xa4U, 0xd7U, 0x05U, 0xdeU, 0x82U, 0xc4U, 0xb3U, 0x66U, 0xc2U, 0x88U, 0x6dU, 0xc0U, 0x89U, 0xd9U,
+  0x57U, 0x65U, 0x75U, 0xb1U, 0x14U, 0x59U, 0xc8U, 0x2cU, 0x19U, 0x06U, 0x79U, 0x57U, 0x02U, 0x44U, 0x3dU, 0x4dU,
+  0xc0U, 0xd8U, 0x19U, 0x63U, 0xefU, 0x19U, 0x13U, 0x50U, 0x93U, 0x02U, 0xd5U, 0xbdU, 0xbeU, 0x8cU, 0x8fU, 0x48U,
+  0x94U, 0x37U, 0x6eU, 0xc1U, 0xd9U, 0x70U, 0xc6U, 0xd4U, 0x76U, 0x28U, 0xf7U, 0xb5U, 0xf1U, 0xa0U, 0xedU, 0x09U,
+  0x6cU, 0xccU, 0xc9U, 0x97U, 0x33U, 0x0bU, 0xafU, 0xa4U, 0x74U, 0x9eU, 0x11U, 0x32U, 0x1eU, 0xe9U, 0xbcU, 0x9fU,
+  0x3aU, 0xe8U, 0xa7U, 0xb0U, 0x55U, 0x6fU, 0xe5U, 0xfcU, 0x3cU, 0xd1U, 0x3cU, 0x46U, 0x8fU, 0x53U, 0xa1U, 0x08U,
+  0xb6U, 0x4cU, 0xfeU, 0x77U, 0x9fU, 0x86U, 0x74U, 0xf4U, 0x48U, 0xd4U, 0x21U, 0xd8U, 0x03U, 0x40U, 0xc8U, 0xd9U,
+  0x1dU, 0x50U, 0x6eU, 0x8dU, 0x5fU, 0x79U, 0x9aU, 0x7eU, 0x29U, 0x0eU, 0xf7U, 0x88U, 0x3cU, 0xceU, 0x96U, 0x37U,
+  0x4bU, 0x02U, 0xd9U, 0x80U, 0x2dU, 0xe2U, 0xedU, 0x9eU, 0x7eU, 0x75U, 0x46U, 0x9cU, 0xe4U, 0xa1U, 0x3bU, 0xf8U,
+  0x28U, 0x25U, 0xd3U, 0x32U, 0x02U, 0x38U, 0x51U, 0xd7U, 0x35U, 0xd1U, 0xb8U, 0x88U, 0x4dU, 0xb2U, 0x3eU, 0x52U,
+  0xfaU, 0x83U, 0x2fU, 0x2eU, 0xdeU, 0xd0U, 0xccU, 0x96U, 0xacU, 0xb9U, 0xbeU, 0x11U, 0x6dU, 0xf3U, 0x8aU, 0x87U,
+  0xb9U, 0xd3U, 0xf5U, 0x97U, 0xb9U, 0x71U, 0x8dU, 0x23U, 0xc0U, 0x86U, 0xf0U, 0x77U, 0x8cU, 0x80U, 0xeaU, 0x33U,
+  0xc0U, 0xb7U, 0xa8U, 0x2cU, 0x47U, 0xd5U, 0x75U, 0x52U, 0x0cU, 0x0fU, 0x97U, 0x0eU, 0xaeU, 0x19U, 0x0cU, 0x0cU,
+  0xd3U, 0x15U, 0x94U, 0xb1U, 0x1aU, 0x2eU, 0x84U, 0x21U, 0xa7U, 0xfaU, 0x1fU, 0xf6U, 0x7bU, 0xc2U, 0x42U, 0x5eU,
+  0x7cU, 0x24U, 0x97U, 0xd1U, 0xfaU, 0x97U, 0x29U, 0xb0U, 0xe3U, 0x7eU, 0xe2U, 0xafU, 0x13U, 0x54U, 0xdaU, 0x6eU,
+  0x1dU, 0x00U, 0x2eU, 0xb7U, 0x8cU, 0xeaU, 0xa3U, 0x4eU, 0xd7U, 0xc9U, 0x8eU, 0x2dU, 0x1fU, 0x0dU, 0x37U, 0xadU,
+  0x8fU, 0x6eU, 0x81U, 0x91U, 0xa9U, 0x6eU, 0xcdU, 0x75U, 0xdeU, 0xb2U, 0x39U, 0xaeU, 0xedU, 0x56U, 0xf2U, 0xb2U,
+  0xddU, 0x78U, 0x3eU, 0xcbU, 0x67U, 0x5cU, 0xc0U, 0xe7U, 0x2eU, 0x00U, 0x21U, 0xddU, 0x8dU, 0x58U, 0x5bU, 0xd2U,
+  0x74U, 0xe2U, 0xdaU, 0x1eU, 0xe8U, 0xecU, 0x01U, 0x36U, 0x14U, 0x2cU, 0x56U, 0x23U, 0x05U, 0x2dU, 0x38U, 0x31U,
+  0x61U, 0x8cU, 0x2cU, 0x0bU, 0x4cU, 0x0cU, 0xcaU, 0x0cU, 0xbeU, 0xb5U, 0x8fU, 0x66U, 0x6bU, 0x19U, 0x9fU, 0x2bU,
+  0x3eU, 0x58U, 0xb8U, 0xa1U, 0x35U, 0x56U, 0x6cU, 0xa6U, 0x14U, 0xd6U, 0x5bU, 0x28U, 0xc4U, 0xb1U, 0xa0U, 0x45U,
+  0xc2U, 0x2bU, 0x4aU, 0x86U, 0x91U, 0x86U, 0xaeU, 0xbfU, 0x50U, 0x30U, 0x62U, 0xbeU, 0x39U, 0xafU, 0x29U, 0xffU,
+  0xe2U, 0xf6U, 0x03U, 0xa3U, 0x39U, 0xc8U, 0x17U, 0x3dU, 0x2dU, 0xfbU, 0x49U, 0xccU, 0x51U, 0xcaU, 0x59U, 0x5eU,
+  0x6dU, 0xcaU, 0x58U, 0xb8U, 0x3dU, 0x33U, 0x4eU, 0x7eU, 0x22U, 0xa4U, 0x42U, 0x61U, 0x40U, 0xbdU, 0x32U, 0x83U,
+  0x03U, 0x4dU, 0x69U, 0x62U, 0x8bU, 0x99U, 0x58U, 0xa3U, 0xf3U, 0xb7U, 0xd9U, 0xc4U, 0xe3U, 0xa1U, 0x9aU, 0x06U,
+  0x14U, 0x47U, 0x86U, 0x77U, 0x3fU, 0x04U, 0xcaU, 0x80U, 0x4eU, 0x9cU, 0x94U, 0xbaU, 0xb3U, 0x88U, 0xf3U, 0xc7U,
+  0x07U, 0xccU, 0x9eU, 0xcdU, 0x3dU, 0x2dU, 0x8bU, 0xedU, 0x61U, 0xf7U, 0xf6U, 0x71U, 0x8dU, 0x27U, 0x90U, 0xd7U,
+  0x04U, 0x85U, 0x29U, 0x5bU, 0xe6U, 0x14U, 0x4bU, 0x68U, 0xecU, 0x69U, 0x45U, 0x30U, 0xfbU, 0x25U, 0x12U, 0xe5U,
+  0xd5U, 0xd2U, 0x09U, 0x8bU, 0xdaU, 0x98U, 0x5cU, 0xe2U, 0xb4U, 0xe4U, 0x55U, 0x72U, 0x9fU, 0x77U, 0xfbU, 0xe4U,
+  0xc7U, 0x3eU, 0xbaU, 0xd8U, 0xaaU, 0xf3U, 0xe7U, 0xefU, 0x95U, 0xd3U, 0x08U, 0x5fU, 0x90U, 0x08U, 0xe5U, 0x88U,
+  0x02U, 0x68U, 0x8bU, 0x0eU, 0x6cU, 0x92U, 0x7dU, 0xd9U, 0x52U, 0x39U, 0x6bU, 0x3cU, 0x6dU, 0x38U, 0x8aU, 0x66U,
+  0x0dU, 0x87U, 0xe3U, 0x95U, 0x7cU, 0xfbU, 0xd6U, 0xf1U, 0xedU, 0xafU, 0x52U, 0x5aU, 0xb9U, 0x41U, 0x76U, 0x4bU,
+  0xa4U, 0x37U, 0x0bU, 0x67U, 0xfcU, 0x99U, 0x71U, 0x8cU, 0xdfU, 0xb6U, 0x87U, 0xf5U, 0xbdU, 0x50U, 0x08U, 0x56U,
+  0x32U, 0xeeU, 0xfbU, 0xcaU, 0x4cU, 0xedU, 0x9eU, 0x07U, 0x73U, 0xc7U, 0x9bU, 0x1aU, 0xa0U, 0x4bU, 0x60U, 0x25U,
+  0x18U, 0xf0U, 0xadU, 0x19U, 0xccU, 0x07U, 0xafU, 0x49U, 0xceU, 0xebU, 0xc7U, 0xb3U, 0x59U, 0xa9U, 0x6fU, 0x30U,
+  0xcbU, 0x73U, 0x5dU, 0x3eU, 0x95U, 0x39U, 0xe0U, 0x03U, 0x85U, 0xbeU, 0xf9U, 0x6cU, 0x81U, 0x91U, 0x04U, 0x26U,
+  0xd6U, 0x9cU, 0x00U, 0xbdU, 0x48U, 0xcdU, 0x9dU, 0x81U, 0xccU, 0xeeU, 0x27U, 0x40U, 0x2bU, 0x91U, 0x61U, 0x84U,
+  0xdfU, 0xfdU, 0x6cU, 0xf9U, 0xfdU, 0x8cU, 0x33U, 0xa3U, 0xb8U, 0xe1U, 0xe2U, 0x76U, 0xe6U, 0x14U, 0x52U, 0xfdU,
+  0x4eU, 0xc5U, 0x1aU, 0x56U, 0x4bU, 0xe1U, 0x2bU, 0xc9U, 0x3bU, 0x1fU, 0x3fU, 0xc2U, 0x54U, 0x98U, 0x76U, 0xbaU,
+  0xafU, 0x03U, 0xdbU, 0x1eU, 0xeeU, 0x9fU, 0x7dU, 0x9fU, 0xd7U, 0xeaU, 0xa7U, 0xeaU, 0xe1U, 0xdcU, 0xfbU, 0x49U,
+  0x65U, 0xcbU, 0x64U, 0x5aU, 0xbaU, 0xe7U, 0x96U, 0x48U, 0xb4U, 0x8aU, 0x25U, 0xcdU, 0x9bU, 0x10U, 0x9bU, 0xa0U,
+  0xe1U, 0xa4U, 0xfcU, 0x60U, 0xdaU, 0x8eU, 0x74U, 0xe2U, 0xd2U, 0x34U, 0x69U, 0x02U, 0x2fU, 0xfdU, 0x12U, 0x02U,
+  0x17U, 0x08U, 0x9bU, 0x86U, 0xf4U, 0xe4U, 0xbbU, 0x5eU, 0x0dU, 0xb4U, 0xeaU, 0xc6U, 0xc5U, 0x15U, 0x12U, 0x07U,
+  0xf3U, 0x95U, 0x92U, 0x70U, 0x6aU, 0xbdU, 0x1cU, 0x8aU, 0xe1U, 0x36U, 0x23U, 0x49U, 0x85U, 0xafU, 0x69U, 0xf6U,
+  0xcfU, 0xf9U, 0x10U, 0xc0U, 0x48U, 0xa4U, 0x17U, 0xf8U, 0x97U, 0xabU, 0xe5U, 0xbfU, 0xb3U, 0x95U, 0x80U, 0x86U,
+  0x67U, 0xfdU, 0x21U, 0xcbU, 0xe6U, 0x9bU, 0xcdU, 0x73U, 0x9bU, 0x64U, 0x75U, 0x38U, 0x47U, 0x50U, 0x3dU, 0x9bU,
+  0x17U, 0x5eU, 0x1dU, 0xb5U, 0x3dU, 0x90U, 0x5bU, 0x5cU, 0x3bU, 0x98U, 0x87U, 0x59U, 0x7dU, 0x48U, 0x80U, 0x29U,
+  0xadU, 0xf0U, 0xcbU, 0x58U, 0xe7U, 0xf2U, 0x3aU, 0xc9U, 0x3dU, 0xf2U, 0xc1U, 0x26U, 0x03U, 0x7bU, 0x16U, 0xd8U,
+  0x2cU, 0xc6U, 0xdbU, 0xe6U, 0x06U, 0xadU, 0x7bU, 0xfaU, 0xa9U, 0x9cU, 0x9eU, 0x19U, 0x44U, 0x26U, 0x7fU, 0xd2U,
+  0x8dU, 0xd3U, 0xdfU, 0xd5U, 0x34U, 0xe7U, 0x66U, 0x6eU, 0xe8U, 0x0cU, 0xbaU, 0xfbU, 0xe0U, 0xb8U, 0x30U, 0xd8U,
+  0x5dU, 0xceU, 0x57U, 0x79U, 0x7cU, 0x02U, 0xdbU, 0x93U, 0x28U, 0xedU, 0xc4U, 0x8aU, 0xefU, 0xf6U, 0xcdU, 0xc1U,
+  0xf3U, 0x87U, 0xd2U, 0xabU, 0xfbU, 0xaaU, 0xacU, 0x90U, 0x8cU, 0x5bU, 0xddU, 0x13U, 0xdcU, 0x98U, 0xdeU, 0x41U,
+  0x4cU, 0x07U, 0x87U, 0xf1U, 0xc2U, 0xb0U, 0x5eU, 0x42U, 0x02U, 0x0fU, 0x39U, 0x7fU, 0x03U, 0xb2U, 0x1eU, 0x40U,
+  0xfdU, 0x67U, 0x1aU, 0x4fU, 0x5aU, 0x81U, 0x9cU, 0xbbU, 0x13U, 0x17U, 0x87U, 0xc9U, 0xacU, 0x79U, 0x6fU, 0x32U,
+  0x38U, 0xb8U, 0x6fU, 0xb0U, 0x55U, 0xd0U, 0xd3U, 0x61U, 0xb8U, 0x3bU, 0xf1U, 0x93U, 0x39U, 0x2aU, 0x59U, 0x39U,
+  0x32U, 0xb3U, 0x84U, 0x44U, 0x68U, 0x23U, 0xc7U, 0xd3U, 0x3eU, 0xa7U, 0x79U, 0x40U, 0x74U, 0xabU, 0x6cU, 0xbbU,
+  0x45U, 0x26U, 0x61U, 0xe0U, 0x55U, 0x31U, 0xd8U, 0xf1U, 0x8eU, 0x38U, 0x18U, 0x67U, 0x8dU, 0x35U, 0xa4U, 0x5bU,
+  0x8bU, 0xb5U, 0x2cU, 0x01U, 0x90U, 0xb2U, 0x8fU, 0x0bU, 0x87U, 0x4bU, 0x87U, 0x1eU, 0x58U, 0xbbU, 0xffU, 0x21U,
+  0x42U, 0x93U, 0x62U, 0xdfU, 0x82U, 0x20U, 0xb3U, 0xfcU, 0x71U, 0xf3U, 0xd6U, 0xeaU, 0x00U, 0x31U, 0xd5U, 0x1fU,
+  0xceU, 0x18U, 0xf2U, 0x5eU, 0x3fU, 0xd0U, 0xe2U, 0x64U, 0xc3U, 0x71U, 0xd9U, 0x9bU, 0x6aU, 0x03U, 0x18U, 0x46U,
+  0x99U, 0x6dU, 0x2eU, 0x10U, 0xdeU, 0x1dU, 0x25U, 0x84U, 0x20U, 0xcfU, 0xb7U, 0x9eU, 0x39U, 0xeeU, 0x74U, 0x10U,
+  0x45U, 0xa9U, 0x1dU, 0x53U, 0x43U, 0x0dU, 0x59U, 0x57U, 0x52U, 0xc8U, 0xd5U, 0xe3U, 0xffU, 0x69U, 0x28U, 0x88U,
+  0x05U, 0xdcU, 0x74U, 0xf6U, 0x9dU, 0xe0U, 0x68U, 0x32U, 0xa5U, 0x99U, 0x5fU, 0x6dU, 0xcbU, 0x48U, 0x12U, 0x41U,
+  0xf9U, 0x58U, 0xa7U, 0x33U, 0x8dU, 0x37U, 0x5dU, 0x06U, 0x66U, 0x84U, 0x61U, 0xd7U, 0xbfU, 0xffU, 0xa4U, 0x95U,
+  0x10U, 0xe4U, 0xbbU, 0xd0U, 0x8aU, 0x4fU, 0xfeU, 0xdeU, 0x6dU, 0x30U, 0x8fU, 0x83U, 0x51U, 0x79U, 0x1fU, 0x78U,
+  0x1dU, 0x62U, 0xe0U, 0x62U, 0x99U, 0x84U, 0x5fU, 0x8fU, 0x04U, 0xcdU, 0x44U, 0x28U, 0x58U, 0xc7U, 0xdcU, 0xeeU,
+  0xe4U, 0xcbU, 0x60U, 0x69U, 0x31U, 0x98U, 0x11U, 0x2cU, 0xefU, 0x27U, 0xffU, 0x0fU, 0x85U, 0x7bU, 0x56U, 0xf5U,
+  0xcbU, 0xe6U, 0xd4U, 0xdbU, 0xadU, 0xa8U, 0x98U, 0x2eU, 0xcfU, 0x2dU, 0x86U, 0xd1U, 0x8dU, 0x6dU, 0x60U, 0x16U,
+  0xc1U, 0xd6U, 0x70U, 0x10U, 0x5bU, 0xa2U, 0xf4U, 0xfaU, 0xd1U, 0xa6U, 0x93U, 0x90U, 0x29U, 0xf6U, 0x92U, 0xbeU,
+  0x10U, 0x80U, 0x99U, 0x32U, 0xefU, 0x77U, 0x89U, 0x76U, 0x30U, 0xfaU, 0x74U, 0x58U, 0xb6U, 0xd8U, 0x16U, 0xe4U,
+  0xb4U, 0x21U, 0x31U, 0x56U, 0x29U, 0xefU, 0xaeU, 0x5dU, 0xd3U, 0xcaU, 0x5aU, 0x97U, 0xa0U, 0xc7U, 0x4cU, 0xcaU,
+  0xd5U, 0x55U, 0xf5U, 0x14U, 0xddU, 0x1aU, 0x23U, 0x80U, 0x87U, 0x79U, 0xfeU, 0x27U, 0xd1U, 0x1aU, 0xb0U, 0x0aU,
+  0x43U, 0x6fU, 0x19U, 0x5aU, 0x92U, 0xd2U, 0x02U, 0x1cU, 0xe1U, 0x8eU, 0x0bU, 0xa1U, 0xf2U, 0x0aU, 0x31U, 0x48U,
+  0x38U, 0x4eU, 0x9fU, 0x7eU, 0x65U, 0xc1U, 0x0dU, 0x02U, 0x31U, 0xdcU, 0x8fU, 0x4dU, 0xacU, 0xa7U, 0xaeU, 0x15U,
+  0x7aU, 0x94U, 0x9cU, 0x87U, 0x77U, 0x8eU, 0xcaU, 0x7bU, 0x73U, 0x14U, 0x11U, 0xadU, 0x77U, 0x2fU, 0xe1U, 0x2aU,
+  0x30U, 0x15U, 0xddU, 0xceU, 0x88U, 0xb7U, 0xf9U, 0xefU, 0xc0U, 0x21U, 0x9eU, 0xeeU, 0xdaU, 0x16U, 0xe0U, 0x68U,
+  0x33U, 0xecU, 0xb6U, 0x7eU, 0x17U, 0x23U, 0xa9U, 0x68U, 0xbaU, 0xb8U, 0x85U, 0x35U, 0xf3U, 0x27U, 0x58U, 0x10U,
+  0xf2U, 0x5dU, 0x67U, 0x25U, 0xe3U, 0xf6U, 0x53U, 0x5dU, 0x4eU, 0xd0U, 0xbbU, 0x8bU, 0xd0U, 0x87U, 0x14U, 0x99U,
+  0x67U, 0x44U, 0xa0U, 0xe8U, 0xa7U, 0x08U, 0x3eU, 0x1dU, 0x63U, 0x3dU, 0xeeU, 0x43U, 0x33U, 0xa1U, 0x0cU, 0x6fU,
+  0xa4U, 0x2bU, 0x37U, 0x6fU, 0x4eU, 0xd9U, 0x9fU, 0x8bU, 0x5dU, 0x48U, 0x17U, 0x83U, 0x94U, 0x5aU, 0xf2U, 0x18U,
+  0x41U, 0xc4U, 0x7bU, 0xbfU, 0x92U, 0x31U, 0x6fU, 0x28U, 0x41U, 0x60U, 0x27U, 0x8eU, 0xb7U, 0xe3U, 0xd0U, 0x31U,
+  0xb5U, 0x24U, 0xcbU, 0xb0U, 0x6dU, 0x7aU, 0xd1U, 0x00U, 0x33U, 0x27U, 0x6dU, 0x77U, 0xfaU, 0x52U, 0x36U, 0xc4U,
+  0x99U, 0x48U, 0x85U, 0x97U, 0x6cU, 0x28U, 0xc3U, 0xebU, 0x17U, 0x7cU, 0x2aU, 0x2bU, 0xe5U, 0xf3U, 0xe2U, 0x0dU,
+  0xe4U, 0x09U, 0x03U, 0xd7U, 0x1eU, 0x74U, 0x19U, 0x5bU, 0xc2U, 0x78U, 0x2bU, 0xa5U, 0xa6U, 0xfaU, 0xf2U, 0xb9U,
+  0xfaU, 0xdcU, 0xa6U, 0x82U, 0x8cU, 0x0cU, 0xddU, 0x20U, 0x47U, 0xdeU, 0x34U, 0x1cU, 0xcdU, 0xa0U, 0xdaU, 0xeaU,
+  0x89U, 0x9aU, 0xcbU, 0x77U, 0xb7U, 0x49U, 0x7cU, 0xcbU, 0x5eU, 0xdcU, 0xa9U, 0xdbU, 0x6eU, 0xe9U, 0xa5U, 0x3dU,
+  0x00U, 0xeaU, 0x2eU, 0x0bU, 0xeaU, 0x75U, 0x17U, 0x37U, 0x74U, 0xe2U, 0x8eU, 0xf1U, 0xe1U, 0xfdU, 0xd4U, 0xf3U,
+  0xdbU, 0x31U, 0x5dU, 0x3aU, 0x0dU, 0xccU, 0x54U, 0x85U, 0x79U, 0x9aU, 0x8aU, 0xf9U, 0x7aU, 0x5cU, 0xe9U, 0x04U,
+  0xf3U, 0xa1U, 0x02U, 0xa1U, 0xf9U, 0xcdU, 0x4aU, 0xbbU, 0x2bU, 0xceU, 0xa5U, 0x43U, 0x51U, 0x51U, 0xfaU, 0x88U,
+  0x07U, 0x28U, 0x88U, 0x43U, 0x42U, 0x8bU, 0xa8U, 0xd4U, 0x75U, 0xdcU, 0x5bU, 0x3aU, 0x95U, 0x27U, 0x86U, 0x2aU,
+  0x22U, 0xd3U, 0x95U, 0x90U, 0x0aU, 0x58U, 0x0fU, 0x9cU, 0xc9U, 0xb0U, 0xe5U, 0x3cU, 0x90U, 0x15U, 0x66U, 0x81U,
+  0x00U, 0x13U, 0x6bU, 0xf8U, 0xfbU, 0x28U, 0x56U, 0x93U, 0x56U, 0xe4U, 0xacU, 0x9cU, 0xb9U, 0xafU, 0x4cU, 0x3fU,
+  0x30U, 0xc6U, 0x77U, 0xa4U, 0x99U, 0x0bU, 0x03U, 0xd6U, 0xc3U, 0x78U, 0x15U, 0x8cU, 0x60U, 0x26U, 0x8eU, 0x30U,
+  0xadU, 0x8bU, 0x48U, 0xa7U, 0xd8U, 0x76U, 0xd8U, 0xc3U, 0xb9U, 0x17U, 0x83U, 0x91U, 0x8eU, 0x98U, 0xa1U, 0x8bU,
+  0xf6U, 0xe1U, 0x77U, 0x4dU, 0xa4U, 0x6fU, 0xdfU, 0xb4U, 0xe3U, 0x02U, 0x29U, 0xabU, 0x4cU, 0x9cU, 0x75U, 0x62U,
+  0x2aU, 0x02U, 0xfaU, 0x37U, 0x93U, 0xf1U, 0x30U, 0x3fU, 0x11U, 0xdcU, 0x3eU, 0xf9U, 0x51U, 0xb0U, 0x00U, 0x74U,
+  0x25U, 0x1dU, 0x12U, 0x2bU, 0x0cU, 0xe4U, 0x0aU, 0x47U, 0xa8U, 0xc3U, 0xcfU, 0xf4U, 0x5eU, 0x98U, 0xe7U, 0x79U,
+  0x33U, 0xdbU, 0xc2U, 0xc0U, 0x0aU, 0xb4U, 0x57U, 0xd1U, 0x85U, 0x2dU, 0x45U, 0xf1U, 0x97U, 0x9bU, 0xe0U, 0x62U,
+  0xa9U, 0x02U, 0xefU, 0x29U, 0xe9U, 0xedU, 0xc0U, 0x72U, 0x9bU, 0xdfU, 0xbfU, 0x23U, 0x8aU, 0x64U, 0xaeU, 0xe6U,
+  0xc7U, 0x17U, 0x48U, 0x08U, 0x5cU, 0x6fU, 0xcfU, 0xe4U, 0xcaU, 0x45U, 0xd6U, 0xbeU, 0x28U, 0x3fU, 0xbaU, 0x32U,
+  0x59U, 0x1dU, 0x07U, 0x23U, 0x7fU, 0xd6U, 0x43U, 0xb9U, 0x8bU, 0x4bU, 0x47U, 0xd4U, 0x85U, 0xc3U, 0x2dU, 0x4aU,
+  0xa2U, 0x93U, 0x43U, 0x72U, 0xf7U, 0xdbU, 0xfdU, 0xc0U, 0x01U, 0x7dU, 0x8aU, 0x18U, 0xd1U, 0xa7U, 0x21U, 0xaeU,
+  0x0dU, 0x73U, 0x1bU, 0x2cU, 0x74U, 0x54U, 0x35U, 0xe7U, 0x00U, 0x42U, 0x5dU, 0x45U, 0x4fU, 0xb1U, 0x9dU, 0x0fU,
+  0xdbU, 0xa4U, 0x51U, 0xefU, 0x8bU, 0xf5U, 0x26U, 0x08U, 0x0fU, 0xc0U, 0x98U, 0x47U, 0x52U, 0x73U, 0xa4U, 0xbbU,
+  0x51U, 0xd2U, 0xc8U, 0x5bU, 0xcbU, 0x64U, 0x9eU, 0xfdU, 0x70U, 0xe7U, 0x88U, 0x40U, 0x2aU, 0x19U, 0x5bU, 0xcbU,
+  0x39U, 0x28U, 0x28U, 0x88U, 0xa5U, 0x3dU, 0xfeU, 0x96U, 0xfcU, 0x64U, 0x17U, 0x63U, 0x76U, 0xabU, 0xeaU, 0x3cU,
+  0x7bU, 0x6fU, 0x21U, 0x57U, 0x05U, 0x35U, 0xdbU, 0x98U, 0x76U, 0xb1U, 0xa3U, 0x09U, 0xafU, 0x8eU, 0x6eU, 0x58U,
+  0xf1U, 0x4aU, 0xb8U, 0x64U, 0x52U, 0x44U, 0xc7U, 0x50U, 0xc9U, 0x60U, 0x11U, 0x6dU, 0x3aU, 0x8bU, 0x0aU, 0x9bU,
+  0x14U, 0x4cU, 0x4aU, 0x5cU, 0x95U, 0x9bU, 0xfaU, 0x64U, 0xe6U, 0x00U, 0xe3U, 0xbfU, 0xf0U, 0xc4U, 0x5fU, 0xdaU,
+  0x07U, 0xd0U, 0x49U, 0xceU, 0x68U, 0xc8U, 0x84U, 0x2eU, 0x50U, 0xd1U, 0xaaU, 0x5bU, 0x36U, 0x4eU, 0x56U, 0xa7U,
+  0xbaU, 0x4cU, 0x2eU, 0xb0U, 0x79U, 0x46U, 0xcbU, 0x70U, 0x9aU, 0xafU, 0xa5U, 0xa7U, 0x90U, 0x36U, 0xd5U, 0xccU,
+  0x67U, 0x16U, 0xdfU, 0xecU, 0x07U, 0x61U, 0x58U, 0x17U, 0x97U, 0x48U, 0xceU, 0xd0U, 0xa7U, 0xc9U, 0x68U, 0x34U,
+  0xf2U, 0x75U, 0xd6U, 0x05U, 0xbdU, 0xc5U, 0xb6U, 0xf1U, 0xf8U, 0xeeU, 0xcfU, 0xceU, 0xadU, 0x83U, 0x56U, 0x45U,
+  0x8bU, 0x1dU, 0x88U, 0x7cU, 0x2fU, 0xc4U, 0xc0U, 0x3fU, 0x56U, 0x0bU, 0xf3U, 0x44U, 0x47U, 0xe5U, 0xa6U, 0x49U,
+  0xf5U, 0x8bU, 0xa2U, 0x0cU, 0x5fU, 0x39U, 0x04U, 0x70U, 0x3fU, 0x14U, 0x5cU, 0x8dU, 0x5bU, 0x9aU, 0x9dU, 0x84U,
+  0xbcU, 0xf0U, 0xc7U, 0xffU, 0x29U, 0xdfU, 0xd7U, 0xafU, 0x7cU, 0x4dU, 0xefU, 0xb5U, 0x79U, 0x59U, 0x8aU, 0xebU,
+  0x2bU, 0x36U, 0x1dU, 0xadU, 0xddU, 0x44U, 0xdeU, 0x6eU, 0x1cU, 0x46U, 0x40U, 0xd6U, 0x25U, 0xa6U, 0x26U, 0xf8U,
+  0xaeU, 0x16U, 0x96U, 0x35U, 0x69U, 0xf2U, 0xf9U, 0xb0U, 0x27U, 0x63U, 0x2aU, 0xc5U, 0x73U, 0x33U, 0x39U, 0xb2U,
+  0xa0U, 0x11U, 0x3dU, 0x36U, 0x70U, 0x46U, 0xb5U, 0x9dU, 0x91U, 0x1fU, 0x2aU, 0xc1U, 0xf4U, 0x74U, 0xcfU, 0xb8U,
+  0xfeU, 0xa3U, 0xb0U, 0xcaU, 0xfcU, 0xc9U, 0x6bU, 0x8cU, 0x3aU, 0xa6U, 0x16U, 0x10U, 0xfbU, 0x86U, 0x24U, 0xddU,
+  0x57U, 0x79U, 0x09U, 0xeaU, 0xa9U, 0x47U, 0x79U, 0xc0U, 0xb5U, 0xbbU, 0xd5U, 0x96U, 0x41U, 0xfaU, 0x66U, 0x39U,
+  0xffU, 0x6aU, 0xb0U, 0x5eU, 0xe4U, 0x22U, 0xc3U, 0xcbU, 0xeaU, 0xb1U, 0x32U, 0x91U, 0xd9U, 0xc3U, 0x6fU, 0xc7U,
+  0x1fU, 0xe5U, 0x97U, 0xb8U, 0x5bU, 0x3cU, 0x70U, 0x45U, 0x35U, 0x8dU, 0x12U, 0xf6U, 0x97U, 0xb2U, 0x7fU, 0x2fU,
+  0x6eU, 0xd8U, 0xe6U, 0xeaU, 0x2bU, 0x9fU, 0x9fU, 0x01U, 0x73U, 0x7aU, 0x8fU, 0xa7U, 0xc5U, 0xf8U, 0x22U, 0x78U,
+  0xd9U, 0xaaU, 0x92U, 0x0bU, 0xb3U, 0x0dU, 0x17U, 0xd8U, 0xeaU, 0x89U, 0x22U, 0xe3U, 0x45U, 0x22U, 0xf5U, 0x76U,
+  0xbfU, 0xc1U, 0x71U, 0xdbU, 0x78U, 0xffU, 0x0aU, 0xecU, 0x28U, 0x0eU, 0xfaU, 0x9cU, 0x5bU, 0x78U, 0x8eU, 0xc6U,
+  0xefU, 0x6eU, 0xc4U, 0x10U, 0x43U, 0xe0U, 0x07U, 0xacU, 0xf3U, 0x8fU, 0x8aU, 0x76U, 0x9eU, 0xe5U, 0x5aU, 0xf5U,
+  0x24U, 0xe2U, 0x8fU, 0xf7U, 0x5eU, 0x95U, 0x5eU, 0x9aU, 0x30U, 0x60U, 0xe2U, 0x56U, 0x65U, 0x79U, 0x95U, 0x77U,
+  0xdbU, 0x96U, 0xbdU, 0xaaU, 0x64U, 0xc9U, 0x6fU, 0xcaU, 0x4cU, 0x67U, 0xe5U, 0x84U, 0x02U, 0x8eU, 0x5cU, 0x97U,
+  0xcfU, 0x70U, 0xe4U, 0x14U, 0xd2U, 0x95U, 0x51U, 0xeeU, 0x72U, 0x0eU, 0x77U, 0xf8U, 0x74U, 0xd0U, 0x55U, 0x62U,
+  0xbaU, 0x0cU, 0xc3U, 0xc4U, 0xc2U, 0x72U, 0x67U, 0x3bU, 0x26U, 0x45U, 0x90U, 0xdaU, 0xbbU, 0x59U, 0xa3U, 0x4cU,
+  0xa5U, 0xc7U, 0x4aU, 0x98U, 0xd3U, 0x3dU, 0xd8U, 0xb8U, 0xd9U, 0x67U, 0x3fU, 0xceU, 0x2eU, 0x21U, 0x3aU, 0x2cU,
+  0x54U, 0x78U, 0x41U, 0x8aU, 0x73U, 0xbaU, 0x72U, 0x58U, 0x5eU, 0x44U, 0x95U, 0x29U, 0x64U, 0xf1U, 0x75U, 0xecU,
+  0xc5U, 0x86U, 0x31U, 0xc3U, 0x0bU, 0x05U, 0x8dU, 0xb4U, 0x13U, 0xc5U, 0x5dU, 0xe5U, 0x60U, 0x2fU, 0x7dU, 0xb0U,
+  0x26U, 0x1dU, 0xf9U, 0xe5U, 0x85U, 0x4eU, 0xedU, 0x91U, 0xccU, 0x6bU, 0x5eU, 0xf2U, 0x1aU, 0x68U, 0xeaU, 0xecU,
+  0x08U, 0x1cU, 0x66U, 0x66U, 0xecU, 0x25U, 0x8fU, 0xe0U, 0xffU, 0xc3U, 0x5cU, 0x0fU, 0x1cU, 0xb1U, 0x6cU, 0xaeU,
+  0x30U, 0xbdU, 0x73U, 0x28U, 0x49U, 0x66U, 0x94U, 0x39U, 0x7aU, 0x30U, 0x7aU, 0x7fU, 0xd6U, 0x19U, 0x92U, 0xd8U,
+  0xeaU, 0x93U, 0x53U, 0x34U, 0x8aU, 0xfdU, 0xc7U, 0xb4U, 0x78U, 0x9aU, 0x73U, 0x77U, 0x4eU, 0x48U, 0xceU, 0x0cU,
+  0x5dU, 0x49U, 0x5bU, 0x01U, 0xbdU, 0xfcU, 0xc5U, 0x8aU, 0x91U, 0x52U, 0xc6U, 0x88U, 0xadU, 0xe1U, 0xadU, 0x5bU,
+  0x5fU, 0xa1U, 0x6fU, 0x0aU, 0x4cU, 0x1bU, 0xf8U, 0x3bU, 0x6fU, 0x76U, 0x07U, 0xa5U, 0x13U, 0x6cU, 0xc9U, 0xbcU,
+  0xbdU, 0xd8U, 0x91U, 0x89U, 0x7fU, 0x56U, 0x6eU, 0x03U, 0x02U, 0xa0U, 0xcbU, 0x0fU, 0x28U, 0x09U, 0x38U, 0xfbU,
+  0x3bU, 0x5fU, 0x85U, 0xeaU, 0x87U, 0xf8U, 0x7cU, 0xa4U, 0x92U, 0x4dU, 0xb8U, 0x61U, 0xf8U, 0xa7U, 0x91U, 0x0aU,
+  0xc3U, 0x28U, 0xf9U, 0xc8U, 0x6dU, 0x2fU, 0x95U, 0xa5U, 0xf6U, 0xf1U, 0xeeU, 0xf3U, 0x2bU, 0xe0U, 0x8eU, 0xc7U,
+  0x70U, 0x5fU, 0x6aU, 0x3bU, 0xb4U, 0xd5U, 0x7aU, 0xbcU, 0xd2U, 0x33U, 0x84U, 0x46U, 0xcbU, 0x17U, 0x85U, 0xfcU,
+  0xa1U, 0x94U, 0x46U, 0xcfU, 0xfcU, 0xd1U, 0x28U, 0xc5U, 0x12U, 0x2bU, 0x8cU, 0xf3U, 0x1bU, 0x79U, 0x28U, 0x05U,
+  0x75U, 0x9eU, 0xdeU, 0x05U, 0xbbU, 0x3bU, 0x5fU, 0xedU, 0xb6U, 0x69U, 0x7aU, 0x00U, 0x51U, 0x16U, 0x9bU, 0x99U,
+  0x4aU, 0x69U, 0x14U, 0x67U, 0xecU, 0x35U, 0xe8U, 0x6fU, 0x6fU, 0x11U, 0x12U, 0x5cU, 0x56U, 0x0dU, 0x81U, 0x0cU,
+  0x4fU, 0xccU, 0x5aU, 0x4dU, 0x35U, 0xb8U, 0xc5U, 0x15U, 0xb2U, 0x65U, 0x29U, 0x13U, 0x5aU, 0x41U, 0x62U, 0xc2U,
+  0xc4U, 0x58U, 0x1aU, 0xccU, 0x2bU, 0xf8U, 0x35U, 0x4eU, 0xd7U, 0x71U, 0xabU, 0xdcU, 0x90U, 0xfcU, 0x19U, 0x11U,
+  0xeaU, 0x4cU, 0x6cU, 0x7cU, 0x0cU, 0x7dU, 0x3dU, 0x75U, 0x25U, 0xbaU, 0x09U, 0x94U, 0x5cU, 0xcfU, 0xbbU, 0x62U,
+  0x9aU, 0xa2U, 0x03U, 0x6fU, 0x4dU, 0x38U, 0xd0U, 0x6bU, 0x99U, 0x00U, 0x5aU, 0x1bU, 0xd7U, 0xc1U, 0x45U, 0x03U,
+  0x72U, 0x45U, 0x07U, 0x27U, 0x34U, 0x48U, 0x2cU, 0x66U, 0x9aU, 0x57U, 0xd1U, 0xa9U, 0xf2U, 0xc9U, 0x54U, 0x26U,
+  0xc5U, 0x3fU, 0x4fU, 0x43U, 0xa8U, 0x53U, 0x64U, 0x5aU, 0xceU, 0x1dU, 0x8fU, 0x4fU, 0x55U, 0x82U, 0xc1U, 0xf5U,
+  0x13U, 0x4cU, 0xcaU, 0xafU, 0xabU, 0x7dU, 0x7fU, 0xe4U, 0x22U, 0xfbU, 0xe8U, 0x69U, 0xb3U, 0x1aU, 0x26U, 0x76U,
+  0xe9U, 0x14U, 0xd3U, 0x02U, 0xf3U, 0xf9U, 0xd7U, 0x5fU, 0x7aU, 0x95U, 0xd9U, 0x2aU, 0x31U, 0x78U, 0x8eU, 0x92U,
+  0xf4U, 0x26U, 0x2dU, 0xfdU, 0xfaU, 0xd1U, 0xc2U, 0xffU, 0x21U, 0x6dU, 0x35U, 0x6fU, 0x9fU, 0x1eU, 0x68U, 0x13U,
+  0x75U, 0x97U, 0x20U, 0xecU, 0x4fU, 0xf4U, 0x4eU, 0x81U, 0xc4U, 0xa8U, 0x1bU, 0xd2U, 0x88U, 0xccU, 0x1fU, 0xd8U,
+  0x8dU, 0x54U, 0x57U, 0xeeU, 0xdbU, 0xf5U, 0xd9U, 0x4dU, 0x48U, 0xd8U, 0x48U, 0x98U, 0x5dU, 0x28U, 0xa1U, 0x65U,
+  0x0eU, 0x2fU, 0xcbU, 0xeeU, 0x95U, 0x1aU, 0x19U, 0x98U, 0x7cU, 0x30U, 0xb8U, 0xb3U, 0xc3U, 0x2dU, 0x15U, 0x0cU,
+  0xa7U, 0x6aU, 0x91U, 0x04U, 0xf2U, 0x4bU, 0x22U, 0xd2U, 0x2aU, 0xb6U, 0x55U, 0xddU, 0xdbU, 0x11U, 0x34U, 0x6bU,
+  0x31U, 0x37U, 0xc0U, 0x89U, 0x70U, 0xe0U, 0x7eU, 0x86U, 0x41U, 0x3dU, 0x69U, 0x22U, 0x24U, 0x99U, 0xa2U, 0x23U,
+  0xe5U, 0xe3U, 0x52U, 0xddU, 0xadU, 0x86U, 0xacU, 0x5aU, 0x39U, 0x8bU, 0x16U, 0xf0U, 0x27U, 0x16U, 0x3dU, 0xfdU,
+  0x16U, 0x76U, 0x62U, 0x8fU, 0x3fU, 0x1fU, 0xefU, 0x37U, 0xcdU, 0x73U, 0x8aU, 0x2dU, 0xcfU, 0x64U, 0x40U, 0x27U,
+  0x85U, 0xbbU, 0xc1U, 0x02U, 0xaaU, 0x25U, 0x43U, 0xb0U, 0xfbU, 0xdfU, 0x6bU, 0x4cU, 0xdbU, 0xaeU, 0x56U, 0x36U,
+  0xa7U, 0x44U, 0x2cU, 0x07U, 0x06U, 0xa5U, 0x0bU, 0x4bU, 0x42U, 0x1cU, 0x9aU, 0x91U, 0x02U, 0xb8U, 0x32U, 0x13U,
+  0x84U, 0x26U, 0x56U, 0x99U, 0xdfU, 0xc5U, 0xa2U, 0x2aU, 0x79U, 0x84U, 0x60U, 0x1bU, 0xb7U, 0x45U, 0x45U, 0x8aU,
+  0x9fU, 0xdfU, 0x79U, 0x18U, 0x2bU, 0xb1U, 0xa5U, 0x09U, 0x9eU, 0x48U, 0xe1U, 0x60U, 0xebU, 0xffU, 0x8aU, 0x68U,
+  0x62U, 0xe3U, 0x0aU, 0x7bU, 0x18U, 0x44U, 0x81U, 0x0aU, 0x3bU, 0x30U, 0x64U, 0xf5U, 0xb9U, 0xdbU, 0xdfU, 0x3dU,
+  0x81U, 0x36U, 0xd8U, 0x4bU, 0x5aU, 0xb1U, 0xb3U, 0x4bU, 0xe8U, 0xbcU, 0xbeU, 0x5bU, 0xadU, 0x88U, 0xcaU, 0xeeU,
+  0xadU, 0x1dU, 0x87U, 0x8bU, 0x33U, 0xcaU, 0xafU, 0x0aU, 0x9cU, 0x58U, 0xc4U, 0xaaU, 0x37U, 0xa9U, 0xbbU, 0xecU,
+  0x0aU, 0x65U, 0x8fU, 0x32U, 0xb8U, 0x5cU, 0xb3U, 0x02U, 0x99U, 0x9bU, 0x5fU, 0x21U, 0x23U, 0x4cU, 0xe7U, 0xc1U,
+  0x94U, 0x84U, 0x09U, 0x2bU, 0x79U, 0x83U, 0xbfU, 0x38U, 0x8cU, 0x36U, 0xbcU, 0xbbU, 0x84U, 0x07U, 0x5eU, 0x35U,
+  0x27U, 0x0dU, 0xe5U, 0x50U, 0xceU, 0xc9U, 0x2fU, 0x38U, 0xf1U, 0x41U, 0xd3U, 0x3fU, 0xafU, 0x55U, 0x25U, 0x27U,
+  0x31U, 0x84U, 0x69U, 0xd1U, 0xffU, 0x18U, 0xd9U, 0x9aU, 0x04U, 0x37U, 0x36U, 0x75U, 0x72U, 0xfaU, 0xecU, 0xa3U,
+  0xd0U, 0x19U, 0xb8U, 0x8dU, 0x7fU, 0x6eU, 0xebU
+};
+
+static uint8_t entropy5[48] = {
+  0xcaU, 0xecU, 0xfaU, 0x4eU, 0xb4U, 0xeaU, 0x01U, 0x0bU, 0xc8U, 0xb1U, 0x16U, 0x7aU, 0x3eU, 0x9dU, 0x6eU, 0x16U,
+  0xadU, 0x60U, 0x83U, 0x5dU, 0x0aU, 0x8fU, 0xf0U, 0xb7U, 0xf5U, 0xf3U, 0xc2U, 0x4aU, 0xd8U, 0x0bU, 0x54U, 0x2eU,
+  0x58U, 0xeaU, 0x3cU, 0x8cU, 0x18U, 0xaaU, 0x20U, 0xffU, 0xabU, 0xcbU, 0x99U, 0x96U, 0x97U, 0xc6U, 0xe6U, 0x2aU
+};
+
+static uint8_t pers5[5] = {
+  0xe1U, 0xd2U, 0x3dU, 0x2cU, 0x57U
+};
+
+static uint8_t entropy_reseed5[48] = {
+  0xe1U, 0x0aU, 0xd9U, 0x6fU, 0x91U, 0xd4U, 0x47U, 0x64U, 0x20U, 0xeaU, 0x7cU, 0xf7U, 0x36U, 0xa6U, 0x5eU, 0x27U,
+  0x26U, 0xdbU, 0x15U, 0x41U, 0xcaU, 0xf0U, 0xc8U, 0x6cU, 0x97U, 0x2eU, 0x9fU, 0x5fU, 0xd1U, 0x41U, 0x98U, 0x62U,
+  0xa2U, 0x91U, 0x0eU, 0x33U, 0x13U, 0x41U, 0xb1U, 0x79U, 0x8aU, 0x85U, 0x48U, 0xe8U, 0xcfU, 0xc6U, 0x76U, 0x6aU
+};
+
+static uint8_t ai1_5[1] = {
+  0x94U
+};
+
+static uint8_t ai2_5[1] = {
+  0x75U
+};
+
+static uint8_t expected5[2000] = {
+  0x1eU, 0x30U, 0xe6U, 0x7dU, 0x9dU, 0x61U, 0xefU, 0x25U, 0xc0U, 0xb9U, 0x9dU, 0x1eU, 0x93U, 0x78U, 0x8fU, 0x0aU,
+  0x19U, 0x88U, 0x8fU, 0xbeU, 0xf5U, 0xfdU, 0x34U, 0xaaU, 0x49U, 0xcfU, 0x08U, 0x38U, 0x66U, 0x45U, 0x7eU, 0x55U,
+  0x65U, 0x71U, 0x3cU, 0x72U, 0x8eU, 0x13U, 0xd5U, 0x81U, 0x3eU, 0x74U, 0x94U, 0x64U, 0x18U, 0x68U, 0xe0U, 0x29U,
+  0xceU, 0xfbU, 0xe0U, 0x18U, 0x0dU, 0x6eU, 0x9dU, 0x4dU, 0x8aU, 0x24U, 0x5eU, 0x41U, 0x4cU, 0x66U, 0xa0U, 0xa3U,
+  0x2cU, 0x7aU, 0xbcU, 0xcfU, 0x9dU, 0x1dU, 0x1cU, 0x0eU, 0x2fU, 0xdcU, 0x39U, 0xfaU, 0x24U, 0x52U, 0xc2U, 0xcbU,
+  0xa9U, 0x7eU, 0x61U, 0x37U, 0xe2U, 0x92U, 0x5fU, 0x56U, 0x0cU, 0xd2U, 0xe5U, 0x87U, 0xbfU, 0xb2U, 0x9fU, 0x4dU,
+  0x9bU, 0x03U, 0x89U, 0x5dU, 0x95U, 0xaaU, 0x33U, 0x1cU, 0x5cU, 0xfaU, 0x62U, 0x5dU, 0x5dU, 0xbfU, 0x1fU, 0x80U,
+  0x6dU, 0x41U, 0x95U, 0x7dU, 0x72U, 0x5eU, 0x32U, 0xb4U, 0x31U, 0xc9U, 0x8fU, 0xe5U, 0x05U, 0x96U, 0x62U, 0x0dU,
+  0x8dU, 0x0fU, 0xeeU, 0x29U, 0xbeU, 0x85U, 0x29U, 0x3cU, 0x6cU, 0x6dU, 0xa4U, 0x49U, 0x23U, 0xaeU, 0x38U, 0x52U,
+  0x5dU, 0x5aU, 0xf9U, 0x05U, 0x24U, 0xd7U, 0x2dU, 0x91U, 0x99U, 0x66U, 0xf5U, 0x5aU, 0x62U, 0xc3U, 0x49U, 0x8aU,
+  0x91U, 0xbaU, 0xc9U, 0xa1U, 0xb3U, 0xfaU, 0x54U, 0x3eU, 0xcaU, 0x49U, 0x59U, 0x90U, 0x08U, 0x23U, 0x82U, 0x5cU,
+  0x1dU, 0xfcU, 0x11U, 0x8bU, 0xfbU, 0x37U, 0xd8U, 0x88U, 0x52U, 0xa6U, 0x85U, 0x9fU, 0x04U, 0x9aU, 0xebU, 0x35U,
+  0x1aU, 0xd1U, 0xe4U, 0xafU, 0xdbU, 0x51U, 0x27U, 0xdcU, 0xacU, 0xc8U, 0xfcU, 0xb3U, 0x26U, 0x42U, 0x1bU, 0x20U,
+  0xcaU, 0x84U, 0x0cU, 0xadU, 0x41U, 0xebU, 0x81U, 0x53U, 0x2fU, 0x5aU, 0x91U, 0xdcU, 0x3cU, 0x73U, 0xefU, 0xbeU,
+  0x24U, 0x88U, 0xceU, 0xf7U, 0x9aU, 0x51U, 0x30U, 0xdbU, 0x4dU, 0xc5U, 0x43U, 0xcfU, 0x4dU, 0xaeU, 0x49U, 0x05U,
+  0x67U, 0x61U, 0xcfU, 0xeeU, 0xbdU, 0xceU, 0xa5U, 0x46U, 0x9aU, 0xbfU, 0x10U, 0xc6U, 0x7aU, 0x16U, 0x0eU, 0x24U,
+  0x80U, 0x25U, 0x97U, 0xa8U, 0xf8U, 0xdfU, 0xb1U, 0x23U, 0xe9U, 0x44U, 0x1bU, 0x61U, 0x29U, 0x50U, 0xc1U, 0xa1U,
+  0x35U, 0xd7U, 0x3bU, 0x80U, 0x38U, 0xb8U, 0xbaU, 0x40U, 0x42U, 0x8eU, 0xb8U, 0x2cU, 0x24U, 0x44U, 0xfbU, 0xd6U,
+  0x5fU, 0x86U, 0x95U, 0xa0U, 0x31U, 0x6dU, 0x6dU, 0x2cU, 0x33U, 0xfdU, 0x2aU, 0xa4U, 0x6aU, 0x22U, 0x42U, 0xa6U,
+  0xd1U, 0x21U, 0x27U, 0x8dU, 0xc0U, 0x06U, 0x77U, 0x05U, 0xeeU, 0x53U, 0x40U, 0x3eU, 0x01U, 0x44U, 0x43U, 0xd0U,
+  0x12U, 0xd5U, 0x70U, 0xdcU, 0x19U, 0x1fU, 0xfdU, 0x63U, 0xb9U, 0x61U, 0x9fU, 0xb2U, 0x57U, 0x2cU, 0x57U, 0x69U,
+  0x98U, 0xc7U, 0x8fU, 0x73U, 0x1aU, 0x34U, 0x47U, 0x2eU, 0xc2U, 0x35U, 0x8fU, 0x4eU, 0x4aU, 0xc9U, 0x06U, 0x5dU,
+  0xb5U, 0xb4U, 0xe6U, 0x8fU, 0xa8U, 0x8dU, 0xb0U, 0x34U, 0x61U, 0x70U, 0x5eU, 0xc1U, 0xeeU, 0xa9U, 0xfbU, 0xecU,
+  0xbaU, 0xe1U, 0x59U, 0x4aU, 0x72U, 0x39U, 0x31U, 0x3bU, 0xc9U, 0x5dU, 0xa2U, 0x7bU, 0x21U, 0x21U, 0xa3U, 0x02U,
+  0x3fU, 0xe2U, 0x90U, 0xaaU, 0xb4U, 0x6cU, 0x2dU, 0x5fU, 0xa4U, 0x94U, 0xb4U, 0xc2U, 0x66U, 0x55U, 0x78U, 0x0eU,
+  0x96U, 0xc6U, 0x79U, 0xa3U, 0x34U, 0x4bU, 0xbaU, 0xb7U, 0x26U, 0xa4U, 0x80U, 0xa0U, 0x0dU, 0xa8U, 0x34U, 0x7dU,
+  0xfaU, 0xacU, 0x20U, 0xcbU, 0xd5U, 0xa7U, 0x1cU, 0x8cU, 0xadU, 0xe5U, 0xe9U, 0x8bU, 0x98U, 0xc9U, 0x9bU, 0xafU,
+  0x46U, 0xefU, 0x7cU, 0xc7U, 0xfcU, 0x6eU, 0x32U, 0x14U, 0x44U, 0xf5U, 0xcdU, 0x45U, 0x7cU, 0xd3U, 0xfbU, 0x72U,
+  0x6eU, 0xc5U, 0x2fU, 0x66U, 0xdfU, 0xcbU, 0x8dU, 0x32U, 0x72U, 0x45U, 0x39U, 0x08U, 0xb6U, 0xefU, 0xbdU, 0x6dU,
+  0xabU, 0x84U, 0xb0U, 0xc0U, 0x13U, 0x07U, 0xd0U, 0xf1U, 0xc3U, 0xb3U, 0xd6U, 0xf1U, 0xb3U, 0x25U, 0xe6U, 0x38U,
+  0x53U, 0x03U, 0x98U, 0xf3U, 0xf6U, 0x05U, 0x18U, 0xa3U, 0x2bU, 0x47U, 0x27U, 0x48U, 0x3aU, 0xb8U, 0x2dU, 0x05U,
+  0x1fU, 0x1dU, 0xd3U, 0x9aU, 0x68U, 0xd1U, 0xd6U, 0x8dU, 0xe7U, 0x46U, 0xb3U, 0x1dU, 0x7aU, 0x61U, 0x54U, 0x10U,
+  0xe8U, 0xcaU, 0x28U, 0x65U, 0x23U, 0x07U, 0x4eU, 0xc4U, 0x05U, 0x4cU, 0xf6U, 0xa8U, 0xabU, 0x2eU, 0x82U, 0x2bU,
+  0x47U, 0x60U, 0x84U, 0x1aU, 0x44U, 0x3dU, 0x43U, 0x80U, 0xfbU, 0xadU, 0x58U, 0x4aU, 0x84U, 0xa2U, 0x97U, 0x4bU,
+  0x74U, 0xa1U, 0xfcU, 0x3aU, 0x47U, 0x47U, 0xbbU, 0x43U, 0xd6U, 0x8dU, 0x5aU, 0x7dU, 0x59U, 0x13U, 0xccU, 0xa0U,
+  0x08U, 0x77U, 0xd3U, 0xd6U, 0x96U, 0xfbU, 0x04U, 0xd6U, 0x3eU, 0x4fU, 0x43U, 0xfcU, 0x6dU, 0xfbU, 0x86U, 0x2fU,
+  0xdeU, 0x53U, 0xbaU, 0x2bU, 0x07U, 0x11U, 0x75U, 0x03U, 0xeeU, 0x95U, 0x18U, 0x76U, 0x31U, 0xcdU, 0x8fU, 0xb3U,
+  0x89U, 0x15U, 0x7bU, 0x79U, 0xbcU, 0x9cU, 0x95U, 0x83U, 0x45U, 0xffU, 0xd8U, 0xb9U, 0xc8U, 0xddU, 0xdfU, 0xccU,
+  0x06U, 0x77U, 0xeaU, 0x88U, 0x98U, 0x32U, 0xb8U, 0xdfU, 0x00U, 0xe6U, 0xe0U, 0xe1U, 0x21U, 0x88U, 0xedU, 0x76U,
+  0xddU, 0xabU, 0xaeU, 0x58U, 0x63U, 0xa2U, 0x1dU, 0x29U, 0xa0U, 0x35U, 0x73U, 0xf5U, 0xb5U, 0x15U, 0x44U, 0x6fU,
+  0xf3U, 0xabU, 0x42U, 0x41U, 0xc5U, 0x6aU, 0x10U, 0x16U, 0xb0U, 0x5dU, 0xe8U, 0xb4U, 0x1cU, 0xb7U, 0xc3U, 0x85U,
+  0x06U, 0x55U, 0xe5U, 0x8eU, 0x98U, 0x90U, 0xaeU, 0x76U, 0x3cU, 0xd1U, 0xcaU, 0x36U, 0x13U, 0x34U, 0x22U, 0xedU,
+  0xc4U, 0x51U, 0x1fU, 0x15U, 0xd0U, 0x30U, 0x8aU, 0xe2U, 0x48U, 0x8eU, 0x9eU, 0x99U, 0xd9U, 0xa7U, 0x1aU, 0xafU,
+  0x71U, 0x0dU, 0xa0U, 0x9cU, 0x17U, 0x8cU, 0xa1U, 0xa1U, 0x8aU, 0x07U, 0xddU, 0xc8U, 0x09U, 0xd9U, 0xbaU, 0x56U,
+  0xc1U, 0xf6U, 0xaeU, 0x2cU, 0x16U, 0x62U, 0x77U, 0xd8U, 0xf8U, 0x1aU, 0x81U, 0xd4U, 0x20U, 0x14U, 0x2fU, 0xf8U,
+  0xc8U, 0x25U, 0x46U, 0x81U, 0x8cU, 0x61U, 0x55U, 0xa0U, 0x6eU, 0xa3U, 0x03U, 0x34U, 0x1bU, 0x8fU, 0x97U, 0x88U,
+  0x70U, 0x51U, 0x18U, 0xfeU, 0xc7U, 0xc0U, 0x30U, 0xc5U, 0xb0U, 0x76U, 0x46U, 0x2bU, 0x63U, 0x7eU, 0xe1U, 0x00U,
+  0xe5U, 0x28U, 0x5aU, 0x36U, 0xe6U, 0x16U, 0xc6U, 0xa2U, 0x6aU, 0x27U, 0x54U, 0x7aU, 0x79U, 0x1fU, 0x5bU, 0x6aU,
+  0x39U, 0xe9U, 0xb2U, 0xc4U, 0x66U, 0x56U, 0x3dU, 0xd6U, 0xfbU, 0xebU, 0xefU, 0xe4U, 0xebU, 0x3bU, 0xb1U, 0x4bU,
+  0xe3U, 0xa3U, 0x60U, 0xeeU, 0x11U, 0xfcU, 0x6aU, 0xb0U, 0x92U, 0x63U, 0x6cU, 0xa6U, 0x75U, 0xfeU, 0x45U, 0xf7U,
+  0x9fU, 0xffU, 0xa8U, 0x58U, 0x31U, 0xa8U, 0x7cU, 0x81U, 0x55U, 0x7eU, 0x1bU, 0x6cU, 0xc1U, 0x5bU, 0x38U, 0xd1U,
+  0xfaU, 0xa4U, 0xc9U, 0x06U, 0xf4U, 0x0aU, 0x60U, 0xf6U, 0x98U, 0xf9U, 0xb3U, 0xbeU, 0xbaU, 0x8eU, 0xa2U, 0x8eU,
+  0x92U, 0xa6U, 0x78U, 0x6dU, 0x84U, 0xb1U, 0x7aU, 0xacU, 0xb6U, 0x78U, 0x17U, 0x61U, 0xf8U, 0x58U, 0x60U, 0x5fU,
+  0x7bU, 0x5aU, 0x06U, 0xc2U, 0xd9U, 0x10U, 0x67U, 0xa4U, 0x9eU, 0x7dU, 0x0aU, 0x74U, 0x73U, 0x6eU, 0xb1U, 0x9bU,
+  0xe2U, 0x75U, 0x97U, 0x8cU, 0x40U, 0xf1U, 0x77U, 0x11U, 0x53U, 0x1cU, 0x86U, 0x93U, 0x5aU, 0x7cU, 0xc4U, 0xfdU,
+  0x2bU, 0x5fU, 0x95U, 0x77U, 0xceU, 0x99U, 0xf9U, 0x49U, 0x2fU, 0x8dU, 0xd9U, 0xa5U, 0xd6U, 0xbaU, 0x2bU, 0x4cU,
+  0x17U, 0xffU, 0x2fU, 0xc1U, 0xa3U, 0x52U, 0x94U, 0x60U, 0xc5U, 0xa6U, 0x4dU, 0x52U, 0x5bU, 0xd4U, 0x20U, 0xe8U,
+  0x0cU, 0x35U, 0x6dU, 0xb6U, 0xb2U, 0x4fU, 0x3cU, 0x99U, 0xadU, 0xb4U, 0xd4U, 0x73U, 0x4fU, 0x99U, 0x80U, 0xbaU,
+  0xd2U, 0x2aU, 0x67U, 0x15U, 0x8eU, 0xc1U, 0x82U, 0x7dU, 0x3fU, 0x56U, 0xc0U, 0x2cU, 0xe9U, 0xbeU, 0x49U, 0x77U,
+  0x39U, 0xfcU, 0x17U, 0x8bU, 0xd0U, 0xacU, 0x5dU, 0xf4U, 0xafU, 0x8cU, 0x77U, 0x1cU, 0xcfU, 0x65U, 0xb3U, 0xbaU,
+  0x8aU, 0x4fU, 0x19U, 0x04U, 0xa7U, 0x2bU, 0xbcU, 0xf4U, 0xe8U, 0xecU, 0xdcU, 0x7dU, 0x82U, 0xe9U, 0x2fU, 0xf7U,
+  0xffU, 0xc3U, 0x46U, 0x92U, 0x83U, 0xc2U, 0x03U, 0xabU, 0x14U, 0x4dU, 0x88U, 0xb7U, 0xaaU, 0x09U, 0x4aU, 0xe6U,
+  0x61U, 0x18U, 0x2bU, 0xaeU, 0x51U, 0x15U, 0x4cU, 0xf7U, 0x7aU, 0x4cU, 0x75U, 0xc2U, 0x01U, 0xd4U, 0xc7U, 0xe0U,
+  0xdfU, 0x50U, 0x39U, 0xd8U, 0xa7U, 0x9fU, 0x4aU, 0x29U, 0x25U, 0xffU, 0x8cU, 0xc4U, 0xf4U, 0xdfU, 0x40U, 0xf3U,
+  0x0fU, 0x95U, 0xd4U, 0xf7U, 0x80U, 0x20U, 0xb8U, 0x5dU, 0xf8U, 0x3bU, 0x37U, 0x53U, 0x6fU, 0x9fU, 0x54U, 0x1eU,
+  0xa1U, 0xa8U, 0x84U, 0x80U, 0x5eU, 0xaaU, 0x94U, 0x70U, 0x6aU, 0xe6U, 0x8eU, 0x20U, 0x38U, 0x96U, 0xe2U, 0x43U,
+  0xc5U, 0x05U, 0xd7U, 0x61U, 0x1aU, 0x35U, 0x0dU, 0xcbU, 0xd1U, 0x26U, 0xd1U, 0x48U, 0x8aU, 0x5fU, 0x25U, 0x21U,
+  0xcbU, 0x3aU, 0x0bU, 0x76U, 0x6aU, 0x2aU, 0xfdU, 0x11U, 0x78U, 0xaaU, 0x5cU, 0x3bU, 0xa8U, 0xbaU, 0x1cU, 0xd1U,
+  0x26U, 0x91U, 0xe5U, 0x4cU, 0x7cU, 0x48U, 0x0bU, 0xa8U, 0x93U, 0x1fU, 0x8cU, 0x1eU, 0x42U, 0x91U, 0x04U, 0x07U,
+  0x1dU, 0x73U, 0x3bU, 0xf9U, 0xffU, 0xb2U, 0x96U, 0x86U, 0x7bU, 0x27U, 0x88U, 0x45U, 0x6aU, 0x9bU, 0x36U, 0x3aU,
+  0xbaU, 0xfeU, 0x48U, 0x44U, 0x53U, 0x04U, 0x7fU, 0x63U, 0xb2U, 0xf9U, 0x66U, 0xe8U, 0x68U, 0xbbU, 0x72U, 0x05U,
+  0x85U, 0xb5U, 0x4aU, 0x82U, 0x28U, 0xedU, 0x1fU, 0x96U, 0x2dU, 0x57U, 0xc9U, 0x53U, 0x6eU, 0x62U, 0x6bU, 0xf2U,
+  0x5dU, 0xc5U, 0xddU, 0x84U, 0x49U, 0x61U, 0xdbU, 0xf3U, 0x3bU, 0x4eU, 0x3fU, 0xe9U, 0x38U, 0xf9U, 0xb6U, 0xa6U,
+  0x22U, 0xbfU, 0xdbU, 0x52U, 0xc3U, 0x4bU, 0xbdU, 0xeaU, 0x21U, 0xe6U, 0xe6U, 0x7bU, 0x55U, 0x32U, 0x54U, 0x64U,
+  0x18U, 0x5bU, 0x8bU, 0x16U, 0x91U, 0xc2U, 0xfcU, 0x21U, 0x24U, 0xc9U, 0x91U, 0x9aU, 0xedU, 0xa7U, 0xe9U, 0x2cU,
+  0x0eU, 0xb0U, 0xedU, 0x47U, 0x9cU, 0xd6U, 0x64U, 0xc9U, 0x79U, 0x8eU, 0x9cU, 0x5fU, 0xfeU, 0xa5U, 0x64U, 0xedU,
+  0x73U, 0xc9U, 0x6aU, 0x33U, 0xd9U, 0x1aU, 0x1cU, 0x23U, 0x41U, 0xc8U, 0x06U, 0xfaU, 0x55U, 0x22U, 0x07U, 0x94U,
+  0x1fU, 0x64U, 0xdfU, 0x3dU, 0x33U, 0xb0U, 0x99U, 0x0dU, 0x13U, 0x01U, 0xbdU, 0xbcU, 0x9cU, 0x31U, 0xf9U, 0x54U,
+  0xa5U, 0xc5U, 0x90U, 0xdcU, 0xf3U, 0x04U, 0x80U, 0x92U, 0x4cU, 0x9cU, 0xb0U, 0x0dU, 0xacU, 0x73U, 0xc1U, 0x61U,
+  0x97U, 0x57U, 0xf8U, 0xa0U, 0xedU, 0xd1U, 0xa1U, 0x94U, 0x4cU, 0x84U, 0xedU, 0xc9U, 0x2cU, 0xbcU, 0x8cU, 0x41U,
+  0xd6U, 0xe4U, 0xdeU, 0x75U, 0x67U, 0x66U, 0x55U, 0x88U, 0xd5U, 0xddU, 0x02U, 0x87U, 0xb1U, 0x98U, 0x0eU, 0x5bU,
+  0x4eU, 0x97U, 0xfdU, 0x74U, 0x89U, 0x01U, 0xbeU, 0xf3U, 0x70U, 0xf3U, 0xf1U, 0x37U, 0x3fU, 0xa2U, 0xffU, 0x76U,
+  0xecU, 0xb1U, 0xaaU, 0x93U, 0x80U, 0x24U, 0x03U, 0x5bU, 0x7eU, 0x60U, 0x45U, 0x11U, 0x28U, 0x02U, 0x44U, 0xfeU,
+  0x2bU, 0xb4U, 0x97U, 0xa3U, 0xebU, 0x78U, 0x68U, 0x55U, 0x44U, 0x21U, 0x52U, 0x4eU, 0x38U, 0xe4U, 0x99U, 0x76U,
+  0xd4U, 0xc7U, 0x3eU, 0x41U, 0xf1U, 0x88U, 0x1fU, 0x21U, 0xc7U, 0xfcU, 0x5eU, 0x2dU, 0xbfU, 0x1eU, 0x24U, 0x36U,
+  0x82U, 0x8bU, 0x66U, 0x33U, 0x11U, 0xb2U, 0xd4U, 0xe7U, 0x9cU, 0xc7U, 0x54U, 0xbdU, 0x50U, 0xefU, 0xacU, 0xb1U,
+  0x5dU, 0x8bU, 0xa2U, 0x1cU, 0xbaU, 0xcdU, 0xf8U, 0x04U, 0xb2U, 0x34U, 0xfbU, 0x51U, 0x6aU, 0xb6U, 0x18U, 0x2dU,
+  0x58U, 0x9bU, 0x2cU, 0xd3U, 0xb1U, 0x28U, 0x38U, 0xbbU, 0xf3U, 0x78U, 0x63U, 0x29U, 0x8aU, 0x5bU, 0x58U, 0xbeU,
+  0x97U, 0xa9U, 0x5bU, 0xe4U, 0x3eU, 0x2cU, 0x01U, 0x84U, 0x4bU, 0xf9U, 0x16U, 0xe2U, 0x1aU, 0x3bU, 0xdbU, 0xe3U,
+  0x09U, 0xf2U, 0x46U, 0x1fU, 0x99U, 0x60U, 0x82U, 0x86U, 0x51U, 0x2aU, 0xb7U, 0x73U, 0x00U, 0x04U, 0x9fU, 0x36U,
+  0x11U, 0x5fU, 0x30U, 0x5eU, 0xd0U, 0x7eU, 0xa6U, 0xe6U, 0x40U, 0x45U, 0x2cU, 0x8dU, 0x14U, 0xafU, 0x84U, 0x84U,
+  0x9fU, 0x18U, 0x68U, 0x2dU, 0x46U, 0x39U, 0xd4U, 0x43U, 0xc1U, 0xceU, 0x43U, 0x26U, 0x5cU, 0x23U, 0xc5U, 0x95U,
+  0xfbU, 0xf8U, 0xecU, 0x10U, 0x75U, 0x5fU, 0xb1U, 0x40U, 0xf8U, 0xd4U, 0x73U, 0x8aU, 0x10U, 0xc0U, 0xedU, 0x3aU,
+  0xc4U, 0x9cU, 0xd3U, 0xe4U, 0xecU, 0xcbU, 0x6cU, 0xf7U, 0xa7U, 0xb1U, 0x04U, 0x75U, 0x29U, 0xfeU, 0xc4U, 0x2eU,
+  0xc7U, 0x17U, 0x21U, 0x6eU, 0xf5U, 0x34U, 0x96U, 0x28U, 0x63U, 0x9fU, 0xceU, 0xa0U, 0xa3U, 0x02U, 0xe3U, 0x6eU,
+  0x83U, 0x97U, 0x82U, 0xe1U, 0x6eU, 0xe3U, 0x93U, 0xd8U, 0x97U, 0xc9U, 0xf2U, 0x15U, 0xa4U, 0xacU, 0x14U, 0x83U,
+  0xe9U, 0x1bU, 0x8bU, 0x8bU, 0x73U, 0x72U, 0xa6U, 0x67U, 0xa3U, 0xfbU, 0x12U, 0x2bU, 0x45U, 0xc7U, 0x83U, 0xa0U,
+  0x43U, 0xa2U, 0xf0U, 0x9dU, 0x43U, 0xa6U, 0xc7U, 0x72U, 0xb7U, 0xe3U, 0x9aU, 0x98U, 0x56U, 0xc2U, 0x5cU, 0x00U,
+  0x3eU, 0x10U, 0xb5U, 0xfdU, 0xa1U, 0x33U, 0xe7U, 0xc3U, 0x79U, 0x24U, 0x51U, 0xefU, 0x39U, 0x06U, 0x44U, 0x8bU,
+  0xa0U, 0x70U, 0x18U, 0xe8U, 0xc9U, 0x0cU, 0x40U, 0x6dU, 0xd4U, 0x45U, 0x3cU, 0x06U, 0x4bU, 0x49U, 0x54U, 0x27U,
+  0x7eU, 0x75U, 0x36U, 0xa0U, 0x30U, 0xe3U, 0xfcU, 0x1bU, 0xabU, 0x47U, 0xa0U, 0x1dU, 0x38U, 0x02U, 0x92U, 0xe6U,
+  0xfdU, 0xceU, 0xdfU, 0x5bU, 0x87U, 0x21U, 0x8eU, 0x07U, 0x92U, 0x65U, 0xe7U, 0x95U, 0x73U, 0x4dU, 0x6fU, 0x62U,
+  0x53U, 0xfbU, 0x0eU, 0x8eU, 0x92U, 0xcfU, 0xe4U, 0x3fU, 0xfeU, 0x30U, 0x5bU, 0x2bU, 0x0bU, 0x66U, 0x02U, 0x8eU,
+  0xe9U, 0x1bU, 0x6dU, 0x95U, 0x7dU, 0xdfU, 0xd1U, 0xa9U, 0xc0U, 0x5eU, 0xc5U, 0x7fU, 0xa2U, 0xefU, 0xd6U, 0xafU,
+  0x09U, 0x38U, 0x85U, 0xf5U, 0x5aU, 0x6cU, 0x6cU, 0x50U, 0xafU, 0x50U, 0x00U, 0x46U, 0x9eU, 0x94U, 0xb5U, 0x02U,
+  0x5cU, 0xd9U, 0xbaU, 0xe8U, 0x22U, 0x66U, 0x98U, 0x67U, 0xf3U, 0xd8U, 0x25U, 0xd4U, 0xf1U, 0xe2U, 0xb5U, 0x07U,
+  0x2eU, 0xe5U, 0x4aU, 0x51U, 0xcdU, 0xd7U, 0x8bU, 0x6aU, 0x53U, 0xecU, 0x9fU, 0x4eU, 0xeeU, 0x5cU, 0x46U, 0x08U,
+  0xaeU, 0xf1U, 0xdbU, 0x56U, 0x83U, 0x11U, 0xf9U, 0x22U, 0x98U, 0x0dU, 0xe6U, 0xc4U, 0x45U, 0xf8U, 0x3aU, 0x51U,
+  0x69U, 0x52U, 0x70U, 0x51U, 0xafU, 0x25U, 0xc2U, 0x40U, 0xc5U, 0x82U, 0x41U, 0x1dU, 0xa2U, 0xe4U, 0xadU, 0x85U,
+  0xd1U, 0x55U, 0x41U, 0x3aU, 0x23U, 0x92U, 0xecU, 0xe9U, 0xc8U, 0xb4U, 0x81U, 0xbbU, 0x77U, 0x80U, 0xbfU, 0x1aU,
+  0x7fU, 0xfdU, 0x3eU, 0xa7U, 0xcdU, 0x8fU, 0xf3U, 0x53U, 0xccU, 0xe5U, 0xe9U, 0x20U, 0x14U, 0x5eU, 0xd8U, 0x28U,
+  0x2eU, 0x14U, 0x50U, 0x3cU, 0xb5U, 0xf0U, 0xa0U, 0x85U, 0x7eU, 0xafU, 0x83U, 0x87U, 0x0cU, 0xd6U, 0xf3U, 0x09U,
+  0xedU, 0x90U, 0x37U, 0xf3U, 0x09U, 0xddU, 0x12U, 0x18U, 0x1cU, 0x7cU, 0xceU, 0xb6U, 0xedU, 0xf6U, 0x9cU, 0x5eU,
+  0xe7U, 0xe6U, 0xf8U, 0xecU, 0xc5U, 0xb6U, 0xe3U, 0xeeU, 0xa8U, 0x1bU, 0x99U, 0x9dU, 0x74U, 0x5cU, 0x66U, 0x17U,
+  0xaaU, 0x28U, 0x9dU, 0x61U, 0xd9U, 0x06U, 0xbbU, 0x9dU, 0xb5U, 0xefU, 0x7eU, 0x4cU, 0xe6U, 0x59U, 0x2bU, 0x4fU,
+  0x05U, 0x0cU, 0x5bU, 0xe1U, 0x51U, 0x97U, 0x4eU, 0x4fU, 0xbaU, 0xf3U, 0x3aU, 0x11U, 0x8eU, 0x8bU, 0xf7U, 0x1fU,
+  0x46U, 0xa0U, 0x57U, 0x0cU, 0x69U, 0xd9U, 0x5bU, 0x12U, 0xe6U, 0xedU, 0xa4U, 0x44U, 0xc9U, 0x3eU, 0x2fU, 0x63U,
+  0xa4U, 0x7bU, 0x36U, 0xd5U, 0x0fU, 0x8aU, 0xc9U, 0x3bU, 0x6eU, 0xc7U, 0xc6U, 0xdcU, 0x6dU, 0xa8U, 0x25U, 0x14U,
+  0x14U, 0x78U, 0x7dU, 0x47U, 0xabU, 0xebU, 0x30U, 0xf2U, 0x53U, 0x76U, 0x07U, 0x92U, 0x74U, 0xc6U, 0xe2U, 0x0cU,
+  0xcbU, 0x39U, 0x4bU, 0xbfU, 0x37U, 0x69U, 0xfaU, 0x78U, 0xb0U, 0x4eU, 0xf1U, 0x06U, 0x6aU, 0xf3U, 0x01U, 0xd7U,
+  0xdbU, 0x2eU, 0xfeU, 0xc3U, 0x4eU, 0xa6U, 0x6bU, 0x86U, 0xd9U, 0xf6U, 0x13U, 0xafU, 0xcaU, 0x3fU, 0xb4U, 0xf4U,
+  0x1aU, 0xc0U, 0x12U, 0x56U, 0x09U, 0x11U, 0x8fU, 0x24U, 0xabU, 0x7dU, 0x6bU, 0x26U, 0x69U, 0x72U, 0x3fU, 0x3cU,
+  0x11U, 0x7cU, 0xa5U, 0x54U, 0x63U, 0x5aU, 0xf3U, 0xe6U, 0xbaU, 0x25U, 0x08U, 0xb9U, 0xf5U, 0x66U, 0x56U, 0xf2U,
+  0x00U, 0x43U, 0x8bU, 0x25U, 0xa5U, 0x0cU, 0x98U, 0x9aU, 0xf0U, 0x73U, 0x40U, 0x20U, 0x44U, 0x06U, 0x8aU, 0x89U,
+  0x89U, 0xb0U, 0xe6U, 0x6cU, 0xf7U, 0x5bU, 0x19U, 0xc9U, 0x50U, 0x33U, 0xd0U, 0x35U, 0x1aU, 0xd7U, 0xe1U, 0xb2U
+};
+
+static ctr_drbg_test_vector ctr_drbg_vectors[] = {
+  { entropy0, NULL, 0, entropy_reseed0, NULL, 0, NULL, NULL, 0, 64, expected0 },
+  { entropy1, pers1, 48, entropy_reseed1, NULL, 0, NULL, NULL, 0, 64, expected1 },
+  { entropy2, NULL, 0, entropy_reseed2, ai_reseed2, 48, ai1_2, ai2_2, 48, 64, expected2 },
+  { entropy3, pers3, 20, entropy_reseed3, ai_reseed3, 33, ai1_3, ai2_3, 16, 1000, expected3 },
+  { entropy4, pers4, 48, entropy_reseed4, ai_reseed4, 48, ai1_4, ai2_4, 48, 4103, expected4 },
+  { entropy5, pers5, 5, entropy_reseed5, NULL, 0, ai1_5, ai2_5, 1, 2000, expected5 }
+};
+
+// Instantiated so that V = 0x0123456789abcdef00000007fffffff0: the first
+// generate crosses a 2^32 boundary of the counter.
+static uint8_t wrap_entropy[48] = {
+  0xf5U, 0x6dU, 0x72U, 0x2cU, 0xe4U, 0xafU, 0x7eU, 0x8aU, 0xaaU, 0x7eU, 0xbeU, 0xd8U, 0x82U, 0x59U, 0x88U, 0x0aU,
+  0xddU, 0x2cU, 0xc3U, 0x8fU, 0x9cU, 0x2fU, 0xb6U, 0x5fU, 0x42U, 0xb3U, 0x8eU, 0x0bU, 0xd6U, 0x79U, 0xb8U, 0x30U,
+  0x73U, 0x43U, 0x46U, 0xadU, 0xbeU, 0x0dU, 0xe7U, 0x9bU, 0xd1U, 0xa2U, 0xf5U, 0x89U, 0x8aU, 0xf9U, 0xcaU, 0x7eU
+};
+
+static uint8_t wrap_expected[1000] = {
+  0xd7U, 0x5eU, 0x94U, 0x26U, 0x7cU, 0xbdU, 0xe9U, 0x3bU, 0xdbU, 0x33U, 0x03U, 0xdcU, 0x86U, 0x6bU, 0x2fU, 0x71U,
+  0x05U, 0x40U, 0x6aU, 0x39U, 0x76U, 0xefU, 0x48U, 0x7fU, 0x7eU, 0x07U, 0xa4U, 0x98U, 0xb3U, 0x46U, 0xb8U, 0x05U,
+  0xfaU, 0x36U, 0x51U, 0xfeU, 0x7aU, 0xbfU, 0x20U, 0xbfU, 0x6aU, 0xa6U, 0x22U, 0xecU, 0xd9U, 0x8fU, 0xe7U, 0x27U,
+  0xbfU, 0x24U, 0x30U, 0xaeU, 0x17U, 0x97U, 0xbbU, 0x6aU, 0xedU, 0xf0U, 0xa8U, 0x29U, 0x99U, 0xaaU, 0x43U, 0x8aU,
+  0x5eU, 0x54U, 0x54U, 0xc3U, 0xeaU, 0x19U, 0x0dU, 0xb1U, 0xd6U, 0xf8U, 0xc1U, 0x30U, 0x93U, 0x6bU, 0x31U, 0x33U,
+  0xffU, 0x58U, 0x90U, 0x77U, 0x19U, 0xa1U, 0xffU, 0x8fU, 0x16U, 0x54U, 0x89U, 0x3eU, 0x78U, 0x39U, 0x89U, 0x95U,
+  0xd5U, 0xc9U, 0xc0U, 0xa0U, 0x13U, 0xaaU, 0xf4U, 0xfaU, 0x91U, 0xccU, 0x37U, 0x0fU, 0x5aU, 0x88U, 0xd1U, 0x2fU,
+  0x5cU, 0x49U, 0xf7U, 0xb7U, 0x6bU, 0x2aU, 0x9cU, 0xc6U, 0x3bU, 0xd9U, 0xc8U, 0x26U, 0x36U, 0xf8U, 0x4eU, 0x44U,
+  0xc6U, 0x39U, 0x36U, 0xddU, 0xf0U, 0xd3U, 0x0eU, 0xa6U, 0xedU, 0xfaU, 0xd2U, 0xdfU, 0x6cU, 0xc0U, 0x6aU, 0x33U,
+  0x00U, 0x9aU, 0x81U, 0x42U, 0x17U, 0x27U, 0x54U, 0xaaU, 0xb2U, 0x2aU, 0x10U, 0xc4U, 0xb9U, 0xecU, 0x2eU, 0xdcU,
+  0x5fU, 0xa3U, 0x68U, 0x22U, 0x8eU, 0x55U, 0x04U, 0xf7U, 0x5aU, 0x0fU, 0x21U, 0x48U, 0x0dU, 0x63U, 0x1bU, 0xcfU,
+  0x47U, 0xfaU, 0x65U, 0xb2U, 0x10U, 0x0cU, 0x7fU, 0x60U, 0x80U, 0xb4U, 0x02U, 0xe0U, 0xd1U, 0x7eU, 0x74U, 0xf0U,
+  0x9fU, 0xf6U, 0x7aU, 0xbbU, 0x26U, 0xe9U, 0xb6U, 0x5cU, 0xe1U, 0x84U, 0xfbU, 0xffU, 0x9eU, 0x94U, 0xceU, 0xf3U,
+  0xaeU, 0x34U, 0x7eU, 0xf1U, 0xdaU, 0xb2U, 0x5aU, 0xb8U, 0xe0U, 0x4dU, 0xe5U, 0x3fU, 0x2cU, 0xd6U, 0x07U, 0x73U,
+  0x5cU, 0x95U, 0xcfU, 0xa8U, 0xdfU, 0x86U, 0x73U, 0xe2U, 0xa8U, 0x5bU, 0x61U, 0x24U, 0xdbU, 0xb8U, 0x9cU, 0xd3U,
+  0x45U, 0xb2U, 0x38U, 0x56U, 0xcbU, 0x56U, 0xe8U, 0x7dU, 0xcdU, 0xa4U, 0x7cU, 0x9eU, 0x4fU, 0x2bU, 0x8bU, 0x13U,
+  0x3eU, 0x56U, 0x64U, 0x51U, 0x68U, 0x74U, 0x5dU, 0xd1U, 0x96U, 0x1dU, 0x88U, 0x47U, 0xeaU, 0x1aU, 0x26U, 0x43U,
+  0x63U, 0x97U, 0x6dU, 0x21U, 0x5cU, 0x98U, 0x0fU, 0x68U, 0x35U, 0x7bU, 0x67U, 0x71U, 0x50U, 0x07U, 0xfaU, 0x10U,
+  0x82U, 0x64U, 0xefU, 0x38U, 0x33U, 0x7cU, 0xe7U, 0x78U, 0x4eU, 0x49U, 0x39U, 0x98U, 0xb5U, 0x27U, 0x14U, 0x87U,
+  0x13U, 0xb4U, 0x35U, 0x69U, 0x99U, 0x1eU, 0xebU, 0x70U, 0xb9U, 0x25U, 0x79U, 0x96U, 0x6fU, 0x9aU, 0x2eU, 0x5cU,
+  0x62U, 0x5bU, 0x0dU, 0x3fU, 0xb1U, 0xacU, 0x79U, 0xbcU, 0xc2U, 0xbaU, 0xdcU, 0x7aU, 0x25U, 0x97U, 0x44U, 0x11U,
+  0x6dU, 0x08U, 0x6bU, 0x42U, 0xc5U, 0xceU, 0x91U, 0x3bU, 0x8aU, 0xadU, 0xedU, 0xecU, 0x4aU, 0x67U, 0x16U, 0xa1U,
+  0xa5U, 0x12U, 0x69U, 0xe4U, 0x5fU, 0x5cU, 0x44U, 0x18U, 0xc8U, 0x8aU, 0xc9U, 0xbfU, 0x10U, 0x03U, 0x0cU, 0x38U,
+  0x02U, 0x5fU, 0x6dU, 0x8cU, 0xa6U, 0xe0U, 0xccU, 0x50U, 0x57U, 0x48U, 0x00U, 0xabU, 0x47U, 0xe9U, 0xebU, 0x14U,
+  0x95U, 0x71U, 0x91U, 0xbcU, 0x8fU, 0x26U, 0xb0U, 0x5eU, 0x01U, 0x99U, 0xf7U, 0x0dU, 0x12U, 0x5cU, 0x1cU, 0x5dU,
+  0xb4U, 0xbaU, 0xf2U, 0x96U, 0xccU, 0x66U, 0xbfU, 0xfcU, 0x38U, 0x15U, 0xdcU, 0xd9U, 0x24U, 0xc1U, 0xc6U, 0x85U,
+  0xb7U, 0xcfU, 0x28U, 0x66U, 0xa7U, 0x08U, 0x33U, 0x13U, 0xc3U, 0xa8U, 0xfbU, 0x6fU, 0x12U, 0x57U, 0xe6U, 0x4fU,
+  0x95U, 0xa9U, 0xacU, 0x1eU, 0xb8U, 0x30U, 0x8fU, 0x65U, 0xc8U, 0xf2U, 0x9dU, 0xd7U, 0xcbU, 0xe0U, 0x41U, 0x69U,
+  0xaaU, 0x9dU, 0x85U, 0x02U, 0x83U, 0x16U, 0x8fU, 0xa9U, 0x4bU, 0xbaU, 0xd4U, 0xb1U, 0x48U, 0xf2U, 0xf2U, 0x5fU,
+  0xd5U, 0x6aU, 0xb7U, 0x8aU, 0x6fU, 0x39U, 0x1aU, 0x53U, 0xd6U, 0x38U, 0xaaU, 0x00U, 0x62U, 0x4aU, 0x23U, 0x40U,
+  0x32U, 0x63U, 0x97U, 0xc9U, 0x99U, 0x72U, 0x0cU, 0xa8U, 0x2eU, 0x65U, 0x9bU, 0x43U, 0x95U, 0x98U, 0xd6U, 0x5bU,
+  0x3aU, 0x1aU, 0x93U, 0x4fU, 0x7fU, 0x58U, 0x07U, 0xd6U, 0xb3U, 0x52U, 0x0dU, 0x2bU, 0x62U, 0xa2U, 0x65U, 0x0eU,
+  0xdaU, 0xfaU, 0xfcU, 0xd4U, 0x4eU, 0xaaU, 0x41U, 0x07U, 0xa1U, 0x68U, 0xa6U, 0xaeU, 0xc8U, 0x41U, 0xe6U, 0x0bU,
+  0xc6U, 0xefU, 0x59U, 0x92U, 0x48U, 0xccU, 0xc7U, 0xe4U, 0x42U, 0x8fU, 0xf9U, 0x8eU, 0xe6U, 0x27U, 0xa3U, 0x59U,
+  0xe0U, 0x3cU, 0x41U, 0xdeU, 0xd4U, 0x6dU, 0xd7U, 0x0fU, 0xd0U, 0x3bU, 0xbeU, 0x0eU, 0xdcU, 0x94U, 0xc4U, 0x63U,
+  0x1bU, 0xc3U, 0xe4U, 0x50U, 0xaaU, 0x74U, 0x59U, 0x45U, 0xd4U, 0xe6U, 0x56U, 0x05U, 0x5eU, 0xd0U, 0xe7U, 0xf8U,
+  0x14U, 0x1aU, 0xcdU, 0xeeU, 0x02U, 0x61U, 0x0cU, 0x0cU, 0xe1U, 0x94U, 0xffU, 0x1bU, 0xbfU, 0xfaU, 0x2bU, 0xf7U,
+  0x56U, 0x12U, 0x47U, 0x8cU, 0x3cU, 0x0dU, 0xb4U, 0x9eU, 0x29U, 0x90U, 0xd9U, 0x9bU, 0xf1U, 0x7eU, 0x37U, 0xe1U,
+  0xddU, 0xdfU, 0xebU, 0x37U, 0x11U, 0xe0U, 0x36U, 0xd0U, 0x7cU, 0xf9U, 0x8dU, 0x10U, 0x0cU, 0xb3U, 0xbcU, 0x7aU,
+  0x57U, 0x8bU, 0xc7U, 0x9cU, 0x42U, 0x5aU, 0xb5U, 0xeeU, 0x2eU, 0xeeU, 0x48U, 0x20U, 0x8cU, 0x3cU, 0x54U, 0xdeU,
+  0x70U, 0xabU, 0xbeU, 0x04U, 0x7cU, 0x16U, 0x3fU, 0x2eU, 0x73U, 0x9cU, 0x68U, 0x0cU, 0x8eU, 0xb7U, 0x8cU, 0xb7U,
+  0x0bU, 0x1cU, 0xbcU, 0x74U, 0xe7U, 0xbfU, 0xabU, 0xadU, 0x53U, 0x42U, 0x26U, 0x87U, 0x5dU, 0xf8U, 0x28U, 0x00U,
+  0xb7U, 0x39U, 0x41U, 0x44U, 0x12U, 0xeaU, 0x7aU, 0x86U, 0xe1U, 0x7cU, 0x90U, 0x93U, 0x6fU, 0x45U, 0xb7U, 0x2bU,
+  0xe9U, 0xe1U, 0x00U, 0x20U, 0x4fU, 0xd5U, 0xbaU, 0x36U, 0x3fU, 0x98U, 0x7bU, 0x7fU, 0x0cU, 0xf7U, 0x5aU, 0x59U,
+  0x88U, 0x5eU, 0x1dU, 0x05U, 0x6fU, 0x16U, 0x56U, 0x29U, 0x75U, 0x16U, 0xf9U, 0x6bU, 0xaeU, 0xf0U, 0x50U, 0xbbU,
+  0x88U, 0x8eU, 0x60U, 0x52U, 0xb7U, 0xacU, 0x88U, 0xdeU, 0xcaU, 0xabU, 0x44U, 0x10U, 0x09U, 0xe5U, 0x95U, 0x69U,
+  0x73U, 0x42U, 0x9fU, 0xf9U, 0xdeU, 0x20U, 0x91U, 0x14U, 0xccU, 0xb1U, 0x9aU, 0x4cU, 0xe8U, 0x6eU, 0x25U, 0x8aU,
+  0xbeU, 0x7bU, 0x4eU, 0xf0U, 0x5fU, 0x95U, 0x31U, 0x4bU, 0x79U, 0x03U, 0x64U, 0x97U, 0x45U, 0x20U, 0x96U, 0x48U,
+  0x4dU, 0x10U, 0x29U, 0x88U, 0xf4U, 0xb4U, 0xb7U, 0xd5U, 0xffU, 0x00U, 0x32U, 0x8eU, 0x15U, 0x60U, 0xd0U, 0x23U,
+  0x09U, 0x46U, 0x92U, 0xdfU, 0x13U, 0x4cU, 0xc7U, 0x2cU, 0x2dU, 0x35U, 0xe6U, 0x66U, 0xa8U, 0x4eU, 0x80U, 0x83U,
+  0xf1U, 0xecU, 0x37U, 0x27U, 0x8aU, 0xc8U, 0xd7U, 0x67U, 0xf7U, 0x20U, 0xb4U, 0xfeU, 0x78U, 0xc6U, 0x24U, 0x88U,
+  0xc2U, 0xfaU, 0x35U, 0xe2U, 0xd4U, 0xb0U, 0xecU, 0xbcU, 0x54U, 0xb5U, 0xb4U, 0x5eU, 0xa7U, 0xe0U, 0x26U, 0x9dU,
+  0x5bU, 0x61U, 0xa6U, 0x5dU, 0x25U, 0x62U, 0x09U, 0x97U, 0x49U, 0x3dU, 0xabU, 0xbcU, 0xfdU, 0x7eU, 0x03U, 0x81U,
+  0xb8U, 0x59U, 0xbdU, 0xb1U, 0xbbU, 0xcaU, 0x30U, 0x84U, 0x69U, 0xa6U, 0x42U, 0xf2U, 0x6aU, 0xe0U, 0xe3U, 0x50U,
+  0x55U, 0x5eU, 0xe2U, 0x46U, 0x10U, 0xd0U, 0x89U, 0x58U, 0xebU, 0x02U, 0xacU, 0x1fU, 0x69U, 0x4bU, 0xc0U, 0x16U,
+  0xf8U, 0xf6U, 0x0aU, 0xf5U, 0x8bU, 0xb5U, 0xe2U, 0x5aU, 0x30U, 0x5aU, 0xf4U, 0xf9U, 0xeeU, 0x16U, 0xabU, 0xacU,
+  0x80U, 0x7fU, 0x7eU, 0x28U, 0xeeU, 0xbbU, 0xa5U, 0xe8U, 0x89U, 0x75U, 0x19U, 0x13U, 0x82U, 0x7aU, 0x39U, 0xc9U,
+  0xd6U, 0xaeU, 0x91U, 0xc1U, 0xbfU, 0x50U, 0x21U, 0x21U, 0x26U, 0x1fU, 0xc4U, 0xc1U, 0x0eU, 0x91U, 0xdbU, 0x64U,
+  0xf2U, 0x0eU, 0x2dU, 0x64U, 0x51U, 0x58U, 0x83U, 0x48U, 0x1aU, 0xd3U, 0x34U, 0xa1U, 0xa7U, 0x66U, 0xc5U, 0xefU,
+  0x20U, 0xfeU, 0x15U, 0xe8U, 0x4aU, 0x50U, 0xd4U, 0xfbU, 0x6aU, 0x54U, 0x25U, 0xd7U, 0xe9U, 0x2aU, 0x73U, 0xd0U,
+  0xb3U, 0x63U, 0xa6U, 0x1dU, 0x14U, 0x9cU, 0xd3U, 0x37U, 0xe9U, 0xebU, 0xc1U, 0xa0U, 0x4eU, 0xd7U, 0x53U, 0x7bU,
+  0xa0U, 0x55U, 0xefU, 0x53U, 0x8bU, 0x83U, 0xc7U, 0x47U, 0x15U, 0x65U, 0xefU, 0x3dU, 0xb9U, 0x9eU, 0x33U, 0xf1U,
+  0x3eU, 0x8fU, 0x0fU, 0x47U, 0x21U, 0xfcU, 0x24U, 0xd3U
+};
@@ -0,0 +1,193 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "Hacl_HMAC_DRBG.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define N_REFILLS 5
+#define MAX_BUF   1024
+
+#define N_SHARDS 4
+#define ROUNDS   100000
+#define REQ_LEN  32
+
+static uint8_t expected[N_REFILLS * MAX_BUF];
+static uint8_t computed[N_REFILLS * MAX_BUF];
+
+// A shard hands out, in any split, the concatenation of buf_len-byte generate
+// requests of the reference HMAC-DRBG, across a reseed.
+static bool check(Spec_Hash_Definitions_hash_alg a, uint32_t buf_len) {
+  uint8_t entropy[48], nonce[16], pers[20], entropy2[32], ai[10];
+  for (int i = 0; i < 48; i++) entropy[i] = (uint8_t)i;
+  for (int i = 0; i < 16; i++) nonce[i] = (uint8_t)(0x80 + i);
+  for (int i = 0; i < 20; i++) pers[i] = (uint8_t)(0x40 + i);
+  for (int i = 0; i < 32; i++) entropy2[i] = (uint8_t)(0xC0 + i);
+  for (int i = 0; i < 10; i++) ai[i] = (uint8_t)(0x20 + i);
+  uint32_t total = N_REFILLS * buf_len;
+
+  Hacl_HMAC_DRBG_state ref = Hacl_HMAC_DRBG_create_in(a);
+  Hacl_HMAC_DRBG_instantiate(a, ref, 32, entropy, 16, nonce, 20, pers);
+  for (int i = 0; i < N_REFILLS; i++) {
+    if (i == 3)
+      Hacl_HMAC_DRBG_reseed(a, ref, 32, entropy2, 10, ai);
+    Hacl_HMAC_DRBG_generate(a, expected + i * buf_len, ref, buf_len, 0, NULL);
+  }
+
+  EverCrypt_DRBG_shard_s *st = EverCrypt_DRBG_shard_create_in(a, buf_len);
+  EverCrypt_DRBG_shard_instantiate(st, 32, entropy, 16, nonce, 20, pers);
+  bool ok = true;
+  uint32_t done = 0;
+  for (uint32_t len = 1; done < 3 * buf_len; len = len * 3 + 1) {
+    uint32_t n = len < 3 * buf_len - done ? len : 3 * buf_len - done;
+    ok &= EverCrypt_DRBG_shard_generate(computed + done, st, n);
+    done += n;
+  }
+  EverCrypt_DRBG_shard_reseed(st, 32, entropy2, 10, ai);
+  ok &= EverCrypt_DRBG_shard_generate(computed + done, st, total - done);
+  EverCrypt_DRBG_shard_free(st);
+
+  printf("%s shard, %" PRIu32 "-byte refills: ", EverCrypt_Hash_string_of_alg(a), buf_len);
+  ok &= memcmp(computed, expected, total) == 0;
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+static EverCrypt_DRBG_sharded_s *sharded;
+static uint8_t firsts[N_SHARDS][REQ_LEN];
+
+static void *draw(void *arg) {
+  uint32_t shard = (uint32_t)(uintptr_t)arg;
+  uint8_t out[REQ_LEN];
+  EverCrypt_DRBG_sharded_generate(firsts[shard], sharded, shard, REQ_LEN);
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_DRBG_sharded_generate(out, sharded, shard, REQ_LEN);
+  return NULL;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  Spec_Hash_Definitions_hash_alg algs[4] = {
+    Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512
+  };
+  for (int k = 0; k < 4; k++) {
+    ok &= check(algs[k], 100);
+    ok &= check(algs[k], MAX_BUF);
+  }
+
+  // One thread per shard; every shard starts from its own seed.
+  pthread_t threads[N_SHARDS];
+  uint8_t out[REQ_LEN];
+  sharded = EverCrypt_DRBG_sharded_create(Spec_Hash_Definitions_SHA2_256, N_SHARDS,
+    (uint8_t *)"drbg-test", 9);
+  ok &= sharded != NULL;
+  ok &= !EverCrypt_DRBG_sharded_generate(out, sharded, N_SHARDS, REQ_LEN);
+  for (uint32_t i = 0; i < N_SHARDS; i++)
+    pthread_create(&threads[i], NULL, draw, (void *)(uintptr_t)i);
+  for (uint32_t i = 0; i < N_SHARDS; i++)
+    pthread_join(threads[i], NULL);
+  bool distinct = true;
+  for (int i = 0; i < N_SHARDS; i++)
+    for (int j = i + 1; j < N_SHARDS; j++)
+      distinct &= memcmp(firsts[i], firsts[j], REQ_LEN) != 0;
+  printf("Sharded DRBG, %d threads: ", N_SHARDS);
+  if (distinct)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  ok &= distinct;
+
+  // The parent and the child of a fork continue from the same buffer and the same K
+  // and V unless the child reseeds.
+  uint8_t parent[REQ_LEN], child[REQ_LEN];
+  int fds[2];
+  bool forked = pipe(fds) == 0;
+  pid_t pid = forked ? fork() : -1;
+  if (pid == 0) {
+    bool r = EverCrypt_DRBG_sharded_generate(child, sharded, 0, REQ_LEN);
+    r &= write(fds[1], child, REQ_LEN) == REQ_LEN;
+    _exit(r ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+  forked &= pid > 0;
+  if (forked) {
+    forked &= EverCrypt_DRBG_sharded_generate(parent, sharded, 0, REQ_LEN);
+    forked &= read(fds[0], child, REQ_LEN) == REQ_LEN;
+    waitpid(pid, NULL, 0);
+  }
+  forked &= memcmp(parent, child, REQ_LEN) != 0;
+  printf("Sharded DRBG, fork: ");
+  if (forked)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  ok &= forked;
+
+  cycles a,b;
+  clock_t t1,t2;
+
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  EverCrypt_DRBG_instantiate(st, NULL, 0);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_DRBG_generate(out, st, REQ_LEN, NULL, 0);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+  EverCrypt_DRBG_uninstantiate(st);
+
+  uint8_t entropy[48] = { 0 };
+  Hacl_HMAC_DRBG_state ref = Hacl_HMAC_DRBG_create_in(Spec_Hash_Definitions_SHA2_256);
+  Hacl_HMAC_DRBG_instantiate(Spec_Hash_Definitions_SHA2_256, ref, 32, entropy, 16,
+    entropy + 32, 0, NULL);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_HMAC_DRBG_generate(Spec_Hash_Definitions_SHA2_256, out, ref, REQ_LEN, 0, NULL);
+    if (j % 1000 == 999)
+      Hacl_HMAC_DRBG_reseed(Spec_Hash_Definitions_SHA2_256, ref, 32, entropy, 0, NULL);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_DRBG_sharded_generate(out, sharded, 0, REQ_LEN);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+  EverCrypt_DRBG_sharded_free(sharded);
+
+  uint64_t count = ROUNDS * REQ_LEN;
+  printf("HMAC-DRBG-SHA2-256, %d-byte requests, EverCrypt_DRBG_generate:\n", REQ_LEN);
+  print_time(count,tdiff1,cdiff1);
+  printf("HMAC-DRBG-SHA2-256, %d-byte requests, Hacl_HMAC_DRBG_generate:\n", REQ_LEN);
+  print_time(count,tdiff2,cdiff2);
+  printf("HMAC-DRBG-SHA2-256, %d-byte requests, sharded:\n", REQ_LEN);
+  print_time(count,tdiff3,cdiff3);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
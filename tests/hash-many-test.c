@@ -0,0 +1,144 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Hash_SHA2.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_HashMany.h"
+#include "Hacl_Streaming_SHA3.h"
+
+#include "test_helpers.h"
+
+#define N_MSGS  1000
+#define MAX_LEN 600
+
+#define ROUNDS 64
+#define BENCH_MSGS 4096
+#define BENCH_LEN  200
+
+static uint8_t msgs[N_MSGS][MAX_LEN];
+static uint8_t digests[N_MSGS][64];
+
+static void reference(Spec_Hash_Definitions_hash_alg a, uint8_t *input, uint32_t len, uint8_t *dst) {
+  switch (a) {
+  case Spec_Hash_Definitions_SHA2_224: Hacl_Hash_SHA2_hash_224(input, len, dst); break;
+  case Spec_Hash_Definitions_SHA2_256: Hacl_Hash_SHA2_hash_256(input, len, dst); break;
+  case Spec_Hash_Definitions_SHA2_384: Hacl_Hash_SHA2_hash_384(input, len, dst); break;
+  default: Hacl_Hash_SHA2_hash_512(input, len, dst); break;
+  }
+}
+
+// Random lengths, plus runs of equal lengths so that the 128-bit path gets to
+// use its 4-lane kernel, against the portable one-shot hash.
+static bool check(const char *path) {
+  Spec_Hash_Definitions_hash_alg algs[6] = {
+    Spec_Hash_Definitions_SHA2_224, Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512,
+    Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA3_256
+  };
+  uint8_t *input[N_MSGS];
+  uint8_t *dst[N_MSGS];
+  uint32_t input_len[N_MSGS];
+  bool ok = true;
+
+  srand(0);
+  for (int i = 0; i < N_MSGS; i++) {
+    input[i] = msgs[i];
+    dst[i] = digests[i];
+    input_len[i] = i < N_MSGS / 2 ? (uint32_t)(rand() % MAX_LEN) : (uint32_t)((i / 4) % MAX_LEN);
+  }
+
+  for (int k = 0; k < 6; k++) {
+    Spec_Hash_Definitions_hash_alg a = algs[k];
+    uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+    uint8_t expected[64];
+    bool ok_alg = true;
+
+    memset(digests, 0, sizeof digests);
+    EverCrypt_HashMany_hash(a, N_MSGS, dst, input_len, input);
+    for (int i = 0; i < N_MSGS; i++) {
+      if (k < 4)
+        reference(a, input[i], input_len[i], expected);
+      else
+        EverCrypt_Hash_hash(a, expected, input[i], input_len[i]);
+      ok_alg &= memcmp(digests[i], expected, hash_len) == 0;
+    }
+    printf("%s hash_many (%s): ", EverCrypt_Hash_string_of_alg(a), path);
+    if (ok_alg)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_alg;
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int i = 0; i < N_MSGS; i++)
+    for (int j = 0; j < MAX_LEN; j++)
+      msgs[i][j] = (uint8_t)(i * 7 + j);
+
+  // Each step takes away the widest remaining kernel.
+  ok &= check("all features");
+  EverCrypt_AutoConfig2_disable_avx512();
+  ok &= check("no AVX-512");
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok &= check("no SHA-NI");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check("no AVX2");
+  EverCrypt_AutoConfig2_disable_avx();
+  EverCrypt_AutoConfig2_disable_sse();
+  ok &= check("portable");
+  EverCrypt_AutoConfig2_init();
+
+  uint8_t *input[BENCH_MSGS];
+  uint8_t *dst[BENCH_MSGS];
+  uint32_t input_len[BENCH_MSGS];
+  uint8_t *plain = malloc(BENCH_MSGS * BENCH_LEN);
+  uint8_t *tags = malloc(BENCH_MSGS * 32);
+  memset(plain,'P',BENCH_MSGS * BENCH_LEN);
+  for (int i = 0; i < BENCH_MSGS; i++) {
+    input[i] = plain + i * BENCH_LEN;
+    dst[i] = tags + i * 32;
+    input_len[i] = BENCH_LEN;
+  }
+  cycles a,b;
+  clock_t t1,t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < BENCH_MSGS; i++)
+      EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA2_256, dst[i], input[i], input_len[i]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HashMany_hash(Spec_Hash_Definitions_SHA2_256, BENCH_MSGS, dst, input_len, input);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  free(plain);
+  free(tags);
+
+  uint64_t count = ROUNDS * BENCH_MSGS * BENCH_LEN;
+  printf("SHA2-256, %d-byte messages, one at a time:\n", BENCH_LEN); print_time(count,tdiff1,cdiff1);
+  printf("SHA2-256, %d-byte messages, hash_many:\n", BENCH_LEN); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
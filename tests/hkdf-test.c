@@ -0,0 +1,199 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HKDF.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 100000
+#define N_LABELS 12
+
+// RFC 5869, test case 1.
+static uint8_t ikm1[22] = {
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b
+};
+static uint8_t salt1[13] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c
+};
+static uint8_t info1[10] = { 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9 };
+static uint8_t okm1[42] = {
+  0x3c, 0xb2, 0x5f, 0x25, 0xfa, 0xac, 0xd5, 0x7a, 0x90, 0x43, 0x4f, 0x64, 0xd0, 0x36,
+  0x2f, 0x2a, 0x2d, 0x2d, 0x0a, 0x90, 0xcf, 0x1a, 0x5a, 0x4c, 0x5d, 0xb0, 0x2d, 0x56,
+  0xec, 0xc4, 0xc5, 0xbf, 0x34, 0x00, 0x72, 0x08, 0xd5, 0xb8, 0x87, 0x18, 0x58, 0x65
+};
+
+// RFC 8448, section 3: Derive-Secret(Early Secret, "derived", "").
+static uint8_t empty_hash[32] = {
+  0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+  0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55
+};
+static uint8_t derived[32] = {
+  0x6f, 0x26, 0x15, 0xa1, 0x08, 0xc7, 0x02, 0xc5, 0x67, 0x8f, 0x54, 0xfc, 0x9d, 0xba, 0xb6, 0x97,
+  0x16, 0xc0, 0x76, 0x18, 0x9c, 0x48, 0x25, 0x0c, 0xeb, 0xea, 0xc3, 0x57, 0x6c, 0x36, 0x11, 0xba
+};
+
+static char *labels[N_LABELS] = {
+  "c e traffic", "e exp master", "derived", "c hs traffic", "s hs traffic", "c ap traffic",
+  "s ap traffic", "exp master", "res master", "key", "iv", "finished"
+};
+
+// HkdfLabel built by hand, expanded with the one-shot function.
+static void expand_label(Spec_Hash_Definitions_hash_alg a, uint8_t *okm, uint8_t *prk, uint32_t prklen,
+  char *label, uint8_t *context, uint32_t context_len, uint32_t len) {
+  uint8_t info[514];
+  uint32_t ll = (uint32_t)strlen(label);
+  info[0] = (uint8_t)(len >> 8);
+  info[1] = (uint8_t)len;
+  info[2] = (uint8_t)(6 + ll);
+  memcpy(info + 3, "tls13 ", 6);
+  memcpy(info + 9, label, ll);
+  info[9 + ll] = (uint8_t)context_len;
+  memcpy(info + 10 + ll, context, context_len);
+  EverCrypt_HKDF_expand(a, okm, prk, prklen, info, 10 + ll + context_len, len);
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  uint8_t okm[500];
+  uint8_t expected[500];
+
+  EverCrypt_HMAC_key_s *k = EverCrypt_HKDF_extract_to_key(Spec_Hash_Definitions_SHA2_256, salt1, 13, ikm1, 22);
+  ok &= EverCrypt_HKDF_expand_with_key(k, okm, info1, 10, 42) == EverCrypt_Error_Success;
+  ok &= compare_and_print(42, okm, okm1);
+  EverCrypt_HMAC_key_free(k);
+
+  uint8_t zeros[32] = { 0 };
+  uint8_t *out[N_LABELS], *label[N_LABELS], *context[N_LABELS];
+  uint32_t out_len[N_LABELS], label_len[N_LABELS], context_len[N_LABELS];
+  k = EverCrypt_HKDF_extract_to_key(Spec_Hash_Definitions_SHA2_256, zeros, 0, zeros, 32);
+  out[0] = okm;
+  out_len[0] = 32;
+  label[0] = (uint8_t *)"derived";
+  label_len[0] = 7;
+  context[0] = empty_hash;
+  context_len[0] = 32;
+  ok &= EverCrypt_HKDF_expand_label_many(k, 1, out, out_len, label, label_len, context, context_len)
+    == EverCrypt_Error_Success;
+  ok &= compare_and_print(32, okm, derived);
+
+  // Lengths HKDF or the HkdfLabel encoding cannot represent are rejected.
+  bool ok_len = true;
+  ok_len &= EverCrypt_HKDF_expand_with_key(k, okm, info1, 10, 255 * 32 + 1) == EverCrypt_Error_MaximumLengthExceeded;
+  ok_len &= EverCrypt_HKDF_expand_with_key(k, okm, info1, 0xffffffffU, 32) == EverCrypt_Error_MaximumLengthExceeded;
+  out_len[0] = 255 * 32 + 1;
+  ok_len &= EverCrypt_HKDF_expand_label_many(k, 1, out, out_len, label, label_len, context, context_len)
+    == EverCrypt_Error_MaximumLengthExceeded;
+  out_len[0] = 32;
+  label_len[0] = 250;
+  ok_len &= EverCrypt_HKDF_expand_label_many(k, 1, out, out_len, label, label_len, context, context_len)
+    == EverCrypt_Error_MaximumLengthExceeded;
+  label_len[0] = 7;
+  context_len[0] = 256;
+  ok_len &= EverCrypt_HKDF_expand_label_many(k, 1, out, out_len, label, label_len, context, context_len)
+    == EverCrypt_Error_MaximumLengthExceeded;
+  printf("HKDF lengths out of range: ");
+  if (ok_len)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  ok &= ok_len;
+  EverCrypt_HMAC_key_free(k);
+
+  Spec_Hash_Definitions_hash_alg algs[6] = {
+    Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512,
+    Spec_Hash_Definitions_Blake2S, Spec_Hash_Definitions_Blake2B
+  };
+  uint8_t prk[64], info[300];
+  for (int i = 0; i < 64; i++)
+    prk[i] = (uint8_t)(i * 5 + 3);
+  for (int i = 0; i < 300; i++)
+    info[i] = (uint8_t)(i * 9);
+  for (int i = 0; i < 6; i++) {
+    Spec_Hash_Definitions_hash_alg a = algs[i];
+    uint32_t prklen = EverCrypt_Hash_Incremental_hash_len(a);
+    bool ok_alg = true;
+
+    k = EverCrypt_HMAC_key_create_in(a, prk, prklen);
+    for (uint32_t infolen = 0; infolen < 300; infolen += 37)
+      for (uint32_t len = 1; len < 500; len += 1 + len / 4) {
+        EverCrypt_HKDF_expand_with_key(k, okm, info, infolen, len);
+        EverCrypt_HKDF_expand(a, expected, prk, prklen, info, infolen, len);
+        ok_alg &= memcmp(okm, expected, len) == 0;
+      }
+
+    uint8_t outs[N_LABELS][100];
+    for (int j = 0; j < N_LABELS; j++) {
+      out[j] = outs[j];
+      out_len[j] = 1 + (uint32_t)j * 8;
+      label[j] = (uint8_t *)labels[j];
+      label_len[j] = (uint32_t)strlen(labels[j]);
+      context[j] = info + j;
+      context_len[j] = j % 3 == 0 ? 0 : prklen;
+    }
+    EverCrypt_HKDF_expand_label_many(k, N_LABELS, out, out_len, label, label_len, context, context_len);
+    for (int j = 0; j < N_LABELS; j++) {
+      expand_label(a, expected, prk, prklen, labels[j], context[j], context_len[j], out_len[j]);
+      ok_alg &= memcmp(outs[j], expected, out_len[j]) == 0;
+    }
+    EverCrypt_HMAC_key_free(k);
+
+    printf("HKDF-%s from a precomputed PRK: ", EverCrypt_Hash_string_of_alg(a));
+    if (ok_alg)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_alg;
+  }
+
+  // A TLS 1.3 handshake's worth of secrets from the same PRK.
+  uint8_t outs[N_LABELS][32];
+  for (int j = 0; j < N_LABELS; j++) {
+    out[j] = outs[j];
+    out_len[j] = j == 10 ? 12 : j == 9 ? 16 : 32;
+    label[j] = (uint8_t *)labels[j];
+    label_len[j] = (uint32_t)strlen(labels[j]);
+    context[j] = empty_hash;
+    context_len[j] = j >= 9 ? 0 : 32;
+  }
+  cycles c1,c2;
+  clock_t t1,t2;
+
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int r = 0; r < ROUNDS; r++) {
+    for (int j = 0; j < N_LABELS; j++)
+      expand_label(Spec_Hash_Definitions_SHA2_256, outs[j], prk, 32, labels[j], context[j], context_len[j], out_len[j]);
+  }
+  c2 = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = c2 - c1;
+  double tdiff1 = t2 - t1;
+
+  k = EverCrypt_HMAC_key_create_in(Spec_Hash_Definitions_SHA2_256, prk, 32);
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int r = 0; r < ROUNDS; r++) {
+    EverCrypt_HKDF_expand_label_many(k, N_LABELS, out, out_len, label, label_len, context, context_len);
+  }
+  c2 = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = c2 - c1;
+  double tdiff2 = t2 - t1;
+  EverCrypt_HMAC_key_free(k);
+
+  uint64_t count = (uint64_t)ROUNDS * N_LABELS * 32;
+  printf("HKDF-Expand-Label x%d, SHA2-256, one-shot HKDF:\n", N_LABELS); print_time(count,tdiff1,cdiff1);
+  printf("HKDF-Expand-Label x%d, SHA2-256, expand_label_many:\n", N_LABELS); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
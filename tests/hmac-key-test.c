@@ -0,0 +1,110 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HMAC.h"
+
+#include "test_helpers.h"
+
+#define MAX_KEY  300
+#define MAX_DATA 700
+
+#define ROUNDS    (1 << 20)
+#define TOKEN_LEN 64
+
+static uint8_t key[MAX_KEY];
+static uint8_t data[MAX_DATA];
+
+// Every supported algorithm, for key lengths on both sides of the block size
+// and data lengths around block boundaries (including the empty message).
+static bool check(const char *path) {
+  Spec_Hash_Definitions_hash_alg algs[6] = {
+    Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512,
+    Spec_Hash_Definitions_Blake2S, Spec_Hash_Definitions_Blake2B
+  };
+  uint32_t key_lens[6] = { 0, 1, 32, 64, 128, 299 };
+  bool ok = true;
+
+  for (int i = 0; i < 6; i++) {
+    Spec_Hash_Definitions_hash_alg a = algs[i];
+    uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+    bool ok_alg = true;
+    for (int j = 0; j < 6; j++) {
+      EverCrypt_HMAC_key_s *k = EverCrypt_HMAC_key_create_in(a, key, key_lens[j]);
+      for (uint32_t len = 0; len < MAX_DATA; len += 1 + len / 32) {
+        uint8_t mac[64], expected[64];
+        EverCrypt_HMAC_compute_with_key(k, mac, data, len);
+        EverCrypt_HMAC_compute(a, expected, key, key_lens[j], data, len);
+        ok_alg &= memcmp(mac, expected, hash_len) == 0;
+      }
+      EverCrypt_HMAC_key_free(k);
+    }
+    printf("HMAC-%s with a precomputed key (%s): ", EverCrypt_Hash_string_of_alg(a), path);
+    if (ok_alg)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_alg;
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int i = 0; i < MAX_KEY; i++)
+    key[i] = (uint8_t)(i * 3 + 1);
+  for (int i = 0; i < MAX_DATA; i++)
+    data[i] = (uint8_t)(i * 7);
+
+  ok &= check("all features");
+  EverCrypt_AutoConfig2_disable_avx2();
+  EverCrypt_AutoConfig2_disable_avx();
+  EverCrypt_AutoConfig2_disable_shaext();
+  EverCrypt_AutoConfig2_disable_sse();
+  ok &= check("portable");
+  EverCrypt_AutoConfig2_init();
+
+  uint8_t token[TOKEN_LEN];
+  uint8_t mac[32];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(token,'T',TOKEN_LEN);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute(Spec_Hash_Definitions_SHA2_256,mac,key,32,token,TOKEN_LEN);
+    token[0] = mac[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  EverCrypt_HMAC_key_s *k = EverCrypt_HMAC_key_create_in(Spec_Hash_Definitions_SHA2_256,key,32);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute_with_key(k,mac,token,TOKEN_LEN);
+    token[0] = mac[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  EverCrypt_HMAC_key_free(k);
+
+  uint64_t count = (uint64_t)ROUNDS * TOKEN_LEN;
+  printf("HMAC-SHA2-256, %d-byte tokens:\n", TOKEN_LEN); print_time(count,tdiff1,cdiff1);
+  printf("HMAC-SHA2-256, %d-byte tokens, precomputed key:\n", TOKEN_LEN); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
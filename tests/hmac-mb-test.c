@@ -0,0 +1,180 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HMAC.h"
+#if defined(HACL_CAN_COMPILE_VEC256)
+#include "Hacl_HMAC_Vec256.h"
+#endif
+
+#include "test_helpers.h"
+
+#define N_MACS   203
+#define MAX_KEY  200
+#define MAX_DATA 400
+
+#define ROUNDS 200000
+#define COOKIE_LEN 96
+
+static uint8_t keys[N_MACS][MAX_KEY];
+static uint8_t msgs[N_MACS][MAX_DATA];
+static uint8_t macs[N_MACS][64];
+
+static uint8_t *dst[N_MACS], *key[N_MACS], *data[N_MACS];
+static uint32_t key_len[N_MACS], data_len[N_MACS];
+
+static bool check(const char *path) {
+  Spec_Hash_Definitions_hash_alg algs[3] = {
+    Spec_Hash_Definitions_SHA2_256, Spec_Hash_Definitions_SHA2_512, Spec_Hash_Definitions_SHA1
+  };
+  bool ok = true;
+  for (int k = 0; k < 3; k++) {
+    Spec_Hash_Definitions_hash_alg a = algs[k];
+    uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+    uint8_t expected[64];
+    bool ok_alg = true;
+    memset(macs, 0, sizeof macs);
+    EverCrypt_HMAC_compute_many(a, N_MACS, dst, key, key_len, data, data_len);
+    for (int i = 0; i < N_MACS; i++) {
+      EverCrypt_HMAC_compute(a, expected, key[i], key_len[i], data[i], data_len[i]);
+      ok_alg &= memcmp(macs[i], expected, hash_len) == 0;
+    }
+    printf("HMAC-%s compute_many (%s): ", EverCrypt_Hash_string_of_alg(a), path);
+    if (ok_alg)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_alg;
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  srand(0);
+  for (int i = 0; i < N_MACS; i++) {
+    for (int j = 0; j < MAX_KEY; j++)
+      keys[i][j] = (uint8_t)rand();
+    for (int j = 0; j < MAX_DATA; j++)
+      msgs[i][j] = (uint8_t)rand();
+    dst[i] = macs[i];
+    key[i] = keys[i];
+    data[i] = msgs[i];
+    key_len[i] = (uint32_t)(rand() % MAX_KEY);
+    data_len[i] = (uint32_t)(rand() % MAX_DATA);
+  }
+
+  // The kernels directly, when they are compiled in, then every path
+  // EverCrypt_HMAC_compute_many can take.
+#if defined(HACL_CAN_COMPILE_VEC256)
+  if (EverCrypt_AutoConfig2_has_vec256()) {
+    bool ok_k = true;
+    uint8_t expected[64];
+    for (int i = 0; i + 8 <= N_MACS; i += 8) {
+      Hacl_HMAC_Vec256_compute_sha2_256_8(dst + i, key + i, key_len + i, data + i, data_len + i);
+      for (int j = i; j < i + 8; j++) {
+        EverCrypt_HMAC_compute_sha2_256(expected, key[j], key_len[j], data[j], data_len[j]);
+        ok_k &= memcmp(macs[j], expected, 32) == 0;
+      }
+      Hacl_HMAC_Vec256_compute_sha2_512_4(dst + i, key + i, key_len + i, data + i, data_len + i);
+      for (int j = i; j < i + 4; j++) {
+        EverCrypt_HMAC_compute_sha2_512(expected, key[j], key_len[j], data[j], data_len[j]);
+        ok_k &= memcmp(macs[j], expected, 64) == 0;
+      }
+    }
+    // Every other lane unused, with NULL key and data.
+    uint8_t *dst_p[8], *key_p[8], *data_p[8];
+    for (int j = 0; j < 8; j++) {
+      dst_p[j] = j % 2 ? NULL : dst[j];
+      key_p[j] = j % 2 ? NULL : key[j];
+      data_p[j] = j % 2 ? NULL : data[j];
+    }
+    memset(macs, 0, sizeof macs);
+    Hacl_HMAC_Vec256_compute_sha2_256_8(dst_p, key_p, key_len, data_p, data_len);
+    for (int j = 0; j < 8; j += 2) {
+      EverCrypt_HMAC_compute_sha2_256(expected, key[j], key_len[j], data[j], data_len[j]);
+      ok_k &= memcmp(macs[j], expected, 32) == 0;
+    }
+    Hacl_HMAC_Vec256_compute_sha2_512_4(dst_p, key_p, key_len, data_p, data_len);
+    for (int j = 0; j < 4; j += 2) {
+      EverCrypt_HMAC_compute_sha2_512(expected, key[j], key_len[j], data[j], data_len[j]);
+      ok_k &= memcmp(macs[j], expected, 64) == 0;
+    }
+    for (int j = 1; j < 8; j += 2) {
+      for (int b = 0; b < 64; b++)
+        ok_k &= macs[j][b] == 0;
+    }
+    printf("HMAC-SHA2-256 x8 and HMAC-SHA2-512 x4 (Vec 256-bit): ");
+    if (ok_k)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_k;
+  }
+#endif
+  ok &= check("all features");
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok &= check("no SHA-NI");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check("portable");
+  EverCrypt_AutoConfig2_init();
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+  if (!EverCrypt_AutoConfig2_has_vec256()) {
+    if (ok) return EXIT_SUCCESS;
+    else return EXIT_FAILURE;
+  }
+
+  // Eight signed cookies under eight keys.
+  for (int i = 0; i < 8; i++) {
+    key_len[i] = 32;
+    data_len[i] = COOKIE_LEN;
+  }
+  cycles c1,c2;
+  clock_t t1,t2;
+  uint64_t cdiff[4];
+  double tdiff[4];
+  for (int v = 0; v < 4; v++) {
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int r = 0; r < ROUNDS; r++) {
+      switch (v) {
+      case 0:
+        for (int i = 0; i < 8; i++)
+          EverCrypt_HMAC_compute_sha2_256(dst[i], key[i], 32, data[i], COOKIE_LEN);
+        break;
+      case 1:
+        Hacl_HMAC_Vec256_compute_sha2_256_8(dst, key, key_len, data, data_len);
+        break;
+      case 2:
+        for (int i = 0; i < 8; i++)
+          EverCrypt_HMAC_compute_sha2_512(dst[i], key[i], 32, data[i], COOKIE_LEN);
+        break;
+      default:
+        Hacl_HMAC_Vec256_compute_sha2_512_4(dst, key, key_len, data, data_len);
+        Hacl_HMAC_Vec256_compute_sha2_512_4(dst + 4, key + 4, key_len + 4, data + 4, data_len + 4);
+        break;
+      }
+    }
+    c2 = cpucycles_end();
+    t2 = clock();
+    cdiff[v] = c2 - c1;
+    tdiff[v] = t2 - t1;
+  }
+
+  uint64_t count = (uint64_t)ROUNDS * 8 * COOKIE_LEN;
+  printf("HMAC-SHA2-256, 8 x %d bytes, one at a time:\n", COOKIE_LEN); print_time(count,tdiff[0],cdiff[0]);
+  printf("HMAC-SHA2-256, 8 x %d bytes, 8 lanes:\n", COOKIE_LEN); print_time(count,tdiff[1],cdiff[1]);
+  printf("HMAC-SHA2-512, 8 x %d bytes, one at a time:\n", COOKIE_LEN); print_time(count,tdiff[2],cdiff[2]);
+  printf("HMAC-SHA2-512, 8 x %d bytes, 4 lanes:\n", COOKIE_LEN); print_time(count,tdiff[3],cdiff[3]);
+#endif
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
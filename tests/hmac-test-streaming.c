@@ -0,0 +1,126 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HMAC.h"
+
+#include "test_helpers.h"
+
+#define MAX_DATA 2000
+
+#define ROUNDS 64
+#define SIZE   (1 << 20)
+#define CHUNK  4096
+
+static uint8_t key[200];
+static uint8_t data[MAX_DATA];
+
+// RFC 4231, test case 2.
+static uint8_t jefe_data[28] = "what do ya want for nothing?";
+static uint8_t jefe_256[32] = {
+  0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+  0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+};
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  uint8_t mac[64];
+  EverCrypt_HMAC_state_s *s = EverCrypt_HMAC_create_in(Spec_Hash_Definitions_SHA2_256, (uint8_t *)"Jefe", 4);
+  EverCrypt_HMAC_update(s, jefe_data, 10);
+  EverCrypt_HMAC_update(s, NULL, 0);
+  EverCrypt_HMAC_update(s, jefe_data + 10, 18);
+  EverCrypt_HMAC_finish(s, mac);
+  ok &= compare_and_print(32, mac, jefe_256);
+  EverCrypt_HMAC_free(s);
+
+  Spec_Hash_Definitions_hash_alg algs[6] = {
+    Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512,
+    Spec_Hash_Definitions_Blake2S, Spec_Hash_Definitions_Blake2B
+  };
+  for (int i = 0; i < 200; i++)
+    key[i] = (uint8_t)(i + 11);
+  for (int i = 0; i < MAX_DATA; i++)
+    data[i] = (uint8_t)(i * 13);
+
+  // Feed the data in chunks of varying sizes, taking a MAC at every chunk
+  // boundary, and compare each one against the one-shot function.
+  srand(0);
+  for (int i = 0; i < 6; i++) {
+    Spec_Hash_Definitions_hash_alg a = algs[i];
+    uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+    bool ok_alg = true;
+    for (uint32_t key_len = 0; key_len < 200; key_len += 67) {
+      s = EverCrypt_HMAC_create_in(a, key, key_len);
+      for (int pass = 0; pass < 2; pass++) {
+        uint8_t expected[64];
+        uint32_t len = 0;
+        EverCrypt_HMAC_finish(s, mac);
+        EverCrypt_HMAC_compute(a, expected, key, key_len, data, 0);
+        ok_alg &= memcmp(mac, expected, hash_len) == 0;
+        while (len < MAX_DATA) {
+          uint32_t chunk = (uint32_t)(rand() % 300);
+          if (chunk > MAX_DATA - len)
+            chunk = MAX_DATA - len;
+          EverCrypt_HMAC_update(s, data + len, chunk);
+          len += chunk;
+          EverCrypt_HMAC_finish(s, mac);
+          EverCrypt_HMAC_compute(a, expected, key, key_len, data, len);
+          ok_alg &= memcmp(mac, expected, hash_len) == 0;
+        }
+        EverCrypt_HMAC_init(s);
+      }
+      EverCrypt_HMAC_free(s);
+    }
+    printf("Streaming HMAC-%s: ", EverCrypt_Hash_string_of_alg(a));
+    if (ok_alg)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_alg;
+  }
+
+  uint8_t *plain = malloc(SIZE);
+  cycles c1,c2;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute(Spec_Hash_Definitions_SHA2_256,mac,key,32,plain,SIZE);
+  }
+  c2 = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = c2 - c1;
+  double tdiff1 = t2 - t1;
+
+  s = EverCrypt_HMAC_create_in(Spec_Hash_Definitions_SHA2_256,key,32);
+  t1 = clock();
+  c1 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_init(s);
+    for (int k = 0; k < SIZE; k += CHUNK)
+      EverCrypt_HMAC_update(s,plain + k,CHUNK);
+    EverCrypt_HMAC_finish(s,mac);
+  }
+  c2 = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = c2 - c1;
+  double tdiff2 = t2 - t1;
+  EverCrypt_HMAC_free(s);
+  free(plain);
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("HMAC-SHA2-256, one-shot:\n"); print_time(count,tdiff1,cdiff1);
+  printf("HMAC-SHA2-256, streaming in %d-byte chunks:\n", CHUNK); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,105 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_SHA3.h"
+#include "Hacl_K12.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "k12_vectors.h"
+
+#define ROUNDS 64
+#define SIZE   (1 << 20)
+
+#define MAX_LEN 250000
+
+static uint8_t msg[MAX_LEN];
+static uint8_t cvs[32 * (MAX_LEN / 8192)];
+
+// Runs every check once on the 4-way leaves (if the CPU has vec256) and once
+// on the portable path.
+static bool run(bool vec256, const char *path) {
+  bool ok = true;
+  uint8_t out[500];
+
+  for (size_t i = 0; i < sizeof(turboshake_vectors) / sizeof(turboshake_test_vector); i++) {
+    turboshake_test_vector *v = &turboshake_vectors[i];
+    Hacl_K12_turboshake128(v->input_len, msg, v->domain, v->output_len, out);
+    ok &= compare_and_print(v->output_len, out, v->expected128);
+    Hacl_K12_turboshake256(v->input_len, msg, v->domain, v->output_len, out);
+    ok &= compare_and_print(v->output_len, out, v->expected256);
+  }
+
+  for (size_t i = 0; i < sizeof(k12_vectors) / sizeof(k12_test_vector); i++) {
+    k12_test_vector *v = &k12_vectors[i];
+    printf("KangarooTwelve (%s), input %" PRIu32 ", custom %" PRIu32 ":\n", path,
+      v->input_len, v->custom_len);
+    Hacl_K12_kangarootwelve(vec256, v->input_len, msg, v->custom_len, msg, v->output_len, out);
+    ok &= compare_and_print(v->output_len, out, v->expected);
+
+    // Chaining values computed ahead of time, in two shards, as a caller
+    // spreading the leaves over threads would.
+    uint32_t full = v->input_len / 8192;
+    if (full > 1) {
+      uint32_t ncvs = full - 1;
+      uint32_t half = ncvs / 2;
+      Hacl_K12_leaf_cvs(vec256, half, msg + 8192, cvs);
+      Hacl_K12_leaf_cvs(vec256, ncvs - half, msg + 8192 * (1 + half), cvs + 32 * half);
+      Hacl_K12_kangarootwelve_with_cvs(vec256, v->input_len, msg, v->custom_len, msg, ncvs,
+        cvs, v->output_len, out);
+      ok &= compare_and_print(v->output_len, out, v->expected);
+    }
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  for (int i = 0; i < MAX_LEN; i++)
+    msg[i] = (uint8_t)(i % 251);
+
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  if (vec256)
+    ok &= run(true, "vec256");
+  ok &= run(false, "portable");
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t tag[32];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_sha3_256(SIZE,plain,tag);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_K12_kangarootwelve(vec256,SIZE,plain,0,NULL,32,tag);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  free(plain);
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("SHA3-256:\n"); print_time(count,tdiff1,cdiff1);
+  printf("KangarooTwelve:\n"); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
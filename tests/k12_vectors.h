@@ -0,0 +1,372 @@
+#pragma once
+
+// Generated with PyCryptodome; messages are ptn(n) from RFC 9861 (bytes
+// 0x00 .. 0xFA repeated), customization strings ptn(n) likewise.
+
+typedef struct {
+  uint32_t input_len;
+  uint32_t custom_len;
+  uint32_t output_len;
+  uint8_t *expected;
+} k12_test_vector;
+
+typedef struct {
+  uint32_t input_len;
+  uint8_t domain;
+  uint32_t output_len;
+  uint8_t *expected128;
+  uint8_t *expected256;
+} turboshake_test_vector;
+
+static uint8_t k12_expected0[32] = {
+  0x1aU, 0xc2U, 0xd4U, 0x50U, 0xfcU, 0x3bU, 0x42U, 0x05U, 0xd1U, 0x9dU, 0xa7U, 0xbfU, 0xcaU, 0x1bU, 0x37U, 0x51U,
+  0x3cU, 0x08U, 0x03U, 0x57U, 0x7aU, 0xc7U, 0x16U, 0x7fU, 0x06U, 0xfeU, 0x2cU, 0xe1U, 0xf0U, 0xefU, 0x39U, 0xe5U
+};
+
+static uint8_t k12_expected1[64] = {
+  0x1aU, 0xc2U, 0xd4U, 0x50U, 0xfcU, 0x3bU, 0x42U, 0x05U, 0xd1U, 0x9dU, 0xa7U, 0xbfU, 0xcaU, 0x1bU, 0x37U, 0x51U,
+  0x3cU, 0x08U, 0x03U, 0x57U, 0x7aU, 0xc7U, 0x16U, 0x7fU, 0x06U, 0xfeU, 0x2cU, 0xe1U, 0xf0U, 0xefU, 0x39U, 0xe5U,
+  0x42U, 0x69U, 0xc0U, 0x56U, 0xb8U, 0xc8U, 0x2eU, 0x48U, 0x27U, 0x60U, 0x38U, 0xb6U, 0xd2U, 0x92U, 0x96U, 0x6cU,
+  0xc0U, 0x7aU, 0x3dU, 0x46U, 0x45U, 0x27U, 0x2eU, 0x31U, 0xffU, 0x38U, 0x50U, 0x81U, 0x39U, 0xebU, 0x0aU, 0x71U
+};
+
+static uint8_t k12_expected2[32] = {
+  0x2bU, 0xdaU, 0x92U, 0x45U, 0x0eU, 0x8bU, 0x14U, 0x7fU, 0x8aU, 0x7cU, 0xb6U, 0x29U, 0xe7U, 0x84U, 0xa0U, 0x58U,
+  0xefU, 0xcaU, 0x7cU, 0xf7U, 0xd8U, 0x21U, 0x8eU, 0x02U, 0xd3U, 0x45U, 0xdfU, 0xaaU, 0x65U, 0x24U, 0x4aU, 0x1fU
+};
+
+static uint8_t k12_expected3[32] = {
+  0x6bU, 0xf7U, 0x5fU, 0xa2U, 0x23U, 0x91U, 0x98U, 0xdbU, 0x47U, 0x72U, 0xe3U, 0x64U, 0x78U, 0xf8U, 0xe1U, 0x9bU,
+  0x0fU, 0x37U, 0x12U, 0x05U, 0xf6U, 0xa9U, 0xa9U, 0x3aU, 0x27U, 0x3fU, 0x51U, 0xdfU, 0x37U, 0x12U, 0x28U, 0x88U
+};
+
+static uint8_t k12_expected4[32] = {
+  0x0cU, 0x31U, 0x5eU, 0xbcU, 0xdeU, 0xdbU, 0xf6U, 0x14U, 0x26U, 0xdeU, 0x7dU, 0xcfU, 0x8fU, 0xb7U, 0x25U, 0xd1U,
+  0xe7U, 0x46U, 0x75U, 0xd7U, 0xf5U, 0x32U, 0x7aU, 0x50U, 0x67U, 0xf3U, 0x67U, 0xb1U, 0x08U, 0xecU, 0xb6U, 0x7cU
+};
+
+static uint8_t k12_expected5[32] = {
+  0x1bU, 0x57U, 0x76U, 0x36U, 0xf7U, 0x23U, 0x64U, 0x3eU, 0x99U, 0x0cU, 0xc7U, 0xd6U, 0xa6U, 0x59U, 0x83U, 0x74U,
+  0x36U, 0xfdU, 0x6aU, 0x10U, 0x36U, 0x26U, 0x60U, 0x0eU, 0xb8U, 0x30U, 0x1cU, 0xd1U, 0xdbU, 0xe5U, 0x53U, 0xd6U
+};
+
+static uint8_t k12_expected6[32] = {
+  0x48U, 0xf2U, 0x56U, 0xf6U, 0x77U, 0x2fU, 0x9eU, 0xdfU, 0xb6U, 0xa8U, 0xb6U, 0x61U, 0xecU, 0x92U, 0xdcU, 0x93U,
+  0xb9U, 0x5eU, 0xbdU, 0x05U, 0xa0U, 0x8aU, 0x17U, 0xb3U, 0x9aU, 0xe3U, 0x49U, 0x08U, 0x70U, 0xc9U, 0x26U, 0xc3U
+};
+
+static uint8_t k12_expected7[32] = {
+  0xbbU, 0x66U, 0xfeU, 0x72U, 0xeaU, 0xeaU, 0x51U, 0x79U, 0x41U, 0x8dU, 0x52U, 0x95U, 0xeeU, 0x13U, 0x44U, 0x85U,
+  0x4dU, 0x8aU, 0xd7U, 0xf3U, 0xfaU, 0x17U, 0xefU, 0xcbU, 0x46U, 0x7eU, 0xc1U, 0x52U, 0x34U, 0x12U, 0x84U, 0xcfU
+};
+
+static uint8_t k12_expected8[32] = {
+  0xbcU, 0x1cU, 0x5eU, 0x05U, 0xfdU, 0xa3U, 0x95U, 0xbaU, 0xedU, 0x28U, 0x78U, 0x83U, 0x0aU, 0x03U, 0xfcU, 0xa7U,
+  0x7cU, 0x94U, 0xf1U, 0xb1U, 0x3cU, 0x0bU, 0x46U, 0x01U, 0xa6U, 0x10U, 0x22U, 0x1dU, 0xb8U, 0x50U, 0x4eU, 0x99U
+};
+
+static uint8_t k12_expected9[32] = {
+  0x6cU, 0xa7U, 0xa5U, 0x83U, 0xb4U, 0xbeU, 0xaaU, 0x0aU, 0xabU, 0x02U, 0x23U, 0x01U, 0x6aU, 0x10U, 0x2bU, 0x21U,
+  0x4fU, 0xe1U, 0xdbU, 0x7eU, 0xd3U, 0x25U, 0xb8U, 0xdfU, 0x37U, 0x22U, 0x9fU, 0x3eU, 0xeeU, 0x55U, 0xdaU, 0xa6U
+};
+
+static uint8_t k12_expected10[32] = {
+  0x82U, 0x77U, 0x8fU, 0x7fU, 0x72U, 0x34U, 0xc8U, 0x33U, 0x52U, 0xe7U, 0x68U, 0x37U, 0xb7U, 0x21U, 0xfbU, 0xdbU,
+  0xb5U, 0x27U, 0x0bU, 0x88U, 0x01U, 0x0dU, 0x84U, 0xfaU, 0x5aU, 0xb0U, 0xb6U, 0x1eU, 0xc8U, 0xceU, 0x09U, 0x56U
+};
+
+static uint8_t k12_expected11[100] = {
+  0x5bU, 0xa7U, 0x5bU, 0x4eU, 0x1bU, 0x51U, 0x9dU, 0x8fU, 0x8aU, 0xbcU, 0x39U, 0x57U, 0xf7U, 0xbaU, 0x34U, 0xfcU,
+  0x0cU, 0x0bU, 0x61U, 0x12U, 0xc3U, 0x8cU, 0x7aU, 0x2aU, 0x75U, 0x8dU, 0x89U, 0x7aU, 0x21U, 0x4bU, 0x1dU, 0x3eU,
+  0x0cU, 0x1dU, 0x3fU, 0x83U, 0x56U, 0x52U, 0x84U, 0x2aU, 0x0dU, 0x0eU, 0x81U, 0x1aU, 0xc4U, 0xb0U, 0x9dU, 0xa1U,
+  0x3cU, 0x10U, 0xfaU, 0x25U, 0x7bU, 0xf4U, 0xc1U, 0xb1U, 0x39U, 0x77U, 0xf2U, 0xf2U, 0xc8U, 0xb6U, 0xbcU, 0xf9U,
+  0x58U, 0xcdU, 0xd8U, 0x27U, 0x7bU, 0xaaU, 0x3dU, 0x8cU, 0x70U, 0x5cU, 0x2fU, 0x53U, 0xabU, 0x66U, 0xf2U, 0xc6U,
+  0x96U, 0xcbU, 0x26U, 0x6fU, 0xe9U, 0xefU, 0x71U, 0x59U, 0x34U, 0x29U, 0xbfU, 0x4aU, 0x45U, 0x4cU, 0x60U, 0x9aU,
+  0x8cU, 0x6fU, 0x5cU, 0x5eU
+};
+
+static uint8_t k12_expected12[32] = {
+  0x87U, 0x01U, 0x04U, 0x5eU, 0x22U, 0x20U, 0x53U, 0x45U, 0xffU, 0x4dU, 0xdaU, 0x05U, 0x55U, 0x5cU, 0xbbU, 0x5cU,
+  0x3aU, 0xf1U, 0xa7U, 0x71U, 0xc2U, 0xb8U, 0x9bU, 0xaeU, 0xf3U, 0x7dU, 0xb4U, 0x3dU, 0x99U, 0x98U, 0xb9U, 0xfeU
+};
+
+static uint8_t k12_expected13[32] = {
+  0x53U, 0x5aU, 0x38U, 0xf6U, 0xfeU, 0x5dU, 0xa7U, 0xc5U, 0xdaU, 0xa7U, 0x89U, 0x5dU, 0xf4U, 0xc7U, 0x10U, 0x20U,
+  0xb1U, 0x06U, 0x4aU, 0x66U, 0xceU, 0xf7U, 0xbcU, 0x3dU, 0xd3U, 0xabU, 0x7bU, 0xa6U, 0x87U, 0x2dU, 0xbcU, 0x10U
+};
+
+static uint8_t k12_expected14[32] = {
+  0xf5U, 0xb1U, 0x01U, 0x62U, 0xbcU, 0x70U, 0x68U, 0x69U, 0xb4U, 0x22U, 0xceU, 0xebU, 0x9bU, 0x65U, 0x11U, 0x43U,
+  0x2cU, 0x18U, 0x26U, 0xfdU, 0x0eU, 0xf1U, 0x25U, 0xe1U, 0x63U, 0x41U, 0x6aU, 0x04U, 0xfeU, 0xc6U, 0x41U, 0xeaU
+};
+
+static uint8_t k12_expected15[32] = {
+  0xabU, 0x57U, 0x6fU, 0x92U, 0x4dU, 0x54U, 0xeeU, 0xb6U, 0x37U, 0xf5U, 0xdcU, 0x7dU, 0x8fU, 0xc6U, 0xfdU, 0x05U,
+  0x07U, 0x0eU, 0x36U, 0x5dU, 0x3dU, 0x18U, 0x42U, 0x11U, 0xe9U, 0x3fU, 0xa3U, 0x9bU, 0xd0U, 0x1aU, 0xb3U, 0x10U
+};
+
+static uint8_t k12_expected16[48] = {
+  0xa7U, 0xa8U, 0x11U, 0x40U, 0xb6U, 0xcdU, 0x9eU, 0x27U, 0x9eU, 0x12U, 0x5dU, 0xa0U, 0x85U, 0x79U, 0x31U, 0xa4U,
+  0xfaU, 0x1dU, 0x5fU, 0xe6U, 0x19U, 0x41U, 0xe5U, 0x4cU, 0x4cU, 0x01U, 0x72U, 0xa0U, 0x55U, 0x23U, 0x54U, 0xa7U,
+  0x6eU, 0x33U, 0x37U, 0x70U, 0xf0U, 0x8bU, 0x35U, 0x22U, 0xb7U, 0x62U, 0x0fU, 0xd8U, 0xaeU, 0x96U, 0xabU, 0x09U
+};
+
+static uint8_t k12_expected17[32] = {
+  0xfaU, 0xb6U, 0x58U, 0xdbU, 0x63U, 0xe9U, 0x4aU, 0x24U, 0x61U, 0x88U, 0xbfU, 0x7aU, 0xf6U, 0x9aU, 0x13U, 0x30U,
+  0x45U, 0xf4U, 0x6eU, 0xe9U, 0x84U, 0xc5U, 0x6eU, 0x3cU, 0x33U, 0x28U, 0xcaU, 0xafU, 0x1aU, 0xa1U, 0xa5U, 0x83U
+};
+
+static uint8_t k12_expected18[32] = {
+  0x76U, 0xf0U, 0x6eU, 0x60U, 0xfbU, 0xa3U, 0x74U, 0x14U, 0xe0U, 0xdcU, 0x56U, 0xd9U, 0xd1U, 0xe5U, 0xd0U, 0x3bU,
+  0x2dU, 0x38U, 0xc6U, 0x72U, 0xb7U, 0x0cU, 0x8cU, 0x51U, 0xd2U, 0xe0U, 0x0aU, 0x4fU, 0xa9U, 0x59U, 0xf1U, 0xaaU
+};
+
+static uint8_t k12_expected19[32] = {
+  0x6dU, 0x25U, 0x9cU, 0xd1U, 0xe1U, 0x51U, 0x59U, 0xceU, 0x43U, 0x54U, 0xb3U, 0x2fU, 0xd0U, 0x31U, 0x14U, 0x8dU,
+  0x4eU, 0xf3U, 0x50U, 0xd6U, 0xabU, 0x63U, 0x68U, 0xdeU, 0x8aU, 0x77U, 0xa1U, 0x5dU, 0xa0U, 0x67U, 0x90U, 0xffU
+};
+
+static uint8_t ts128_expected0[32] = {
+  0x1eU, 0x41U, 0x5fU, 0x1cU, 0x59U, 0x83U, 0xafU, 0xf2U, 0x16U, 0x92U, 0x17U, 0x27U, 0x7dU, 0x17U, 0xbbU, 0x53U,
+  0x8cU, 0xd9U, 0x45U, 0xa3U, 0x97U, 0xddU, 0xecU, 0x54U, 0x1fU, 0x1cU, 0xe4U, 0x1aU, 0xf2U, 0xc1U, 0xb7U, 0x4cU
+};
+
+static uint8_t ts256_expected0[32] = {
+  0x36U, 0x7aU, 0x32U, 0x9dU, 0xafU, 0xeaU, 0x87U, 0x1cU, 0x78U, 0x02U, 0xecU, 0x67U, 0xf9U, 0x05U, 0xaeU, 0x13U,
+  0xc5U, 0x76U, 0x95U, 0xdcU, 0x2cU, 0x66U, 0x63U, 0xc6U, 0x10U, 0x35U, 0xf5U, 0x9aU, 0x18U, 0xf8U, 0xe7U, 0xdbU
+};
+
+static uint8_t ts128_expected1[200] = {
+  0x1eU, 0x41U, 0x5fU, 0x1cU, 0x59U, 0x83U, 0xafU, 0xf2U, 0x16U, 0x92U, 0x17U, 0x27U, 0x7dU, 0x17U, 0xbbU, 0x53U,
+  0x8cU, 0xd9U, 0x45U, 0xa3U, 0x97U, 0xddU, 0xecU, 0x54U, 0x1fU, 0x1cU, 0xe4U, 0x1aU, 0xf2U, 0xc1U, 0xb7U, 0x4cU,
+  0x3eU, 0x8cU, 0xcaU, 0xe2U, 0xa4U, 0xdaU, 0xe5U, 0x6cU, 0x84U, 0xa0U, 0x4cU, 0x23U, 0x85U, 0xc0U, 0x3cU, 0x15U,
+  0xe8U, 0x19U, 0x3bU, 0xdfU, 0x58U, 0x73U, 0x73U, 0x63U, 0x32U, 0x16U, 0x91U, 0xc0U, 0x54U, 0x62U, 0xc8U, 0xdfU,
+  0xdbU, 0xdfU, 0x13U, 0x7cU, 0xe3U, 0x85U, 0xdcU, 0x51U, 0x64U, 0x0aU, 0xc1U, 0x38U, 0x97U, 0xb9U, 0x07U, 0x8bU,
+  0x56U, 0xb7U, 0x52U, 0x34U, 0x5fU, 0x19U, 0xeeU, 0x63U, 0x01U, 0x1fU, 0xb0U, 0x16U, 0xabU, 0xd5U, 0x7cU, 0xf2U,
+  0xa5U, 0xcaU, 0x9bU, 0xf4U, 0x10U, 0xaeU, 0xe7U, 0x10U, 0x44U, 0x04U, 0x27U, 0x19U, 0xe1U, 0xc3U, 0xebU, 0xeaU,
+  0x94U, 0xc3U, 0x98U, 0x90U, 0x9bU, 0xd8U, 0xecU, 0x9bU, 0x44U, 0x3eU, 0x62U, 0xb0U, 0xccU, 0x0fU, 0xd7U, 0xc6U,
+  0xb7U, 0x95U, 0x19U, 0xf0U, 0xc4U, 0x70U, 0xebU, 0xd1U, 0x2aU, 0x0aU, 0x42U, 0x3eU, 0x74U, 0xe8U, 0x45U, 0xbaU,
+  0xf8U, 0x88U, 0xe5U, 0xd6U, 0x35U, 0xb5U, 0x34U, 0x04U, 0x9fU, 0xe8U, 0x7bU, 0x25U, 0x28U, 0x15U, 0x9aU, 0xc3U,
+  0xb5U, 0xb6U, 0x9aU, 0xd7U, 0x84U, 0x25U, 0xefU, 0xe1U, 0x37U, 0x28U, 0xa2U, 0x61U, 0xf2U, 0xa4U, 0xbeU, 0x2dU,
+  0x4eU, 0xa8U, 0x3aU, 0x3bU, 0x8cU, 0x3bU, 0xe1U, 0x2fU, 0xedU, 0x74U, 0x55U, 0x5fU, 0x24U, 0x10U, 0xf0U, 0xd0U,
+  0xaaU, 0x56U, 0xd0U, 0xd6U, 0x39U, 0x67U, 0xf8U, 0xe9U
+};
+
+static uint8_t ts256_expected1[200] = {
+  0x36U, 0x7aU, 0x32U, 0x9dU, 0xafU, 0xeaU, 0x87U, 0x1cU, 0x78U, 0x02U, 0xecU, 0x67U, 0xf9U, 0x05U, 0xaeU, 0x13U,
+  0xc5U, 0x76U, 0x95U, 0xdcU, 0x2cU, 0x66U, 0x63U, 0xc6U, 0x10U, 0x35U, 0xf5U, 0x9aU, 0x18U, 0xf8U, 0xe7U, 0xdbU,
+  0x11U, 0xedU, 0xc0U, 0xe1U, 0x2eU, 0x91U, 0xeaU, 0x60U, 0xebU, 0x6bU, 0x32U, 0xdfU, 0x06U, 0xddU, 0x7fU, 0x00U,
+  0x2fU, 0xbaU, 0xfaU, 0xbbU, 0x6eU, 0x13U, 0xecU, 0x1cU, 0xc2U, 0x0dU, 0x99U, 0x55U, 0x47U, 0x60U, 0x0dU, 0xb0U,
+  0x6cU, 0x06U, 0x18U, 0x04U, 0x3eU, 0x89U, 0xafU, 0xeeU, 0x80U, 0xf5U, 0x52U, 0x39U, 0x0fU, 0xddU, 0x09U, 0xf4U,
+  0x5cU, 0x51U, 0x95U, 0x3bU, 0xe5U, 0xf0U, 0x90U, 0x4aU, 0xc6U, 0x69U, 0xc6U, 0xabU, 0x50U, 0xb8U, 0x85U, 0xc9U,
+  0xf5U, 0x71U, 0x7cU, 0x74U, 0x3aU, 0x7aU, 0x78U, 0xbfU, 0x0bU, 0x72U, 0xedU, 0x4bU, 0x9aU, 0x7fU, 0x51U, 0xc7U,
+  0xa0U, 0xa0U, 0x68U, 0x76U, 0xf0U, 0xd0U, 0x52U, 0x6bU, 0x68U, 0xb8U, 0x36U, 0x8cU, 0xe5U, 0x63U, 0xc7U, 0x70U,
+  0x64U, 0x1bU, 0x1aU, 0x67U, 0xb2U, 0x8dU, 0x4fU, 0x59U, 0x42U, 0x48U, 0x3aU, 0x0aU, 0xe3U, 0xa9U, 0x96U, 0xa4U,
+  0x50U, 0x75U, 0x74U, 0x1bU, 0xd9U, 0xd4U, 0xefU, 0x0fU, 0x25U, 0x4fU, 0x13U, 0xccU, 0x0cU, 0x98U, 0x18U, 0xbdU,
+  0x82U, 0x05U, 0x75U, 0x8cU, 0x04U, 0xccU, 0xd6U, 0xccU, 0xefU, 0xcdU, 0x12U, 0xd0U, 0x7bU, 0xf2U, 0xcdU, 0xdfU,
+  0x38U, 0xe8U, 0xb5U, 0x75U, 0x09U, 0x6eU, 0x5dU, 0x5fU, 0x74U, 0x11U, 0x7fU, 0x29U, 0xdbU, 0x7cU, 0x70U, 0xd8U,
+  0x42U, 0xb4U, 0x9dU, 0x9dU, 0x81U, 0x2aU, 0x1bU, 0x7bU
+};
+
+static uint8_t ts128_expected2[32] = {
+  0x9cU, 0x97U, 0xd0U, 0x36U, 0xa3U, 0xbaU, 0xc8U, 0x19U, 0xdbU, 0x70U, 0xedU, 0xe0U, 0xcaU, 0x55U, 0x4eU, 0xc6U,
+  0xe4U, 0xc2U, 0xa1U, 0xa4U, 0xffU, 0xbfU, 0xd9U, 0xecU, 0x26U, 0x9cU, 0xa6U, 0xa1U, 0x11U, 0x16U, 0x12U, 0x33U
+};
+
+static uint8_t ts256_expected2[32] = {
+  0xb3U, 0xbaU, 0xb0U, 0x30U, 0x0eU, 0x6aU, 0x19U, 0x1fU, 0xbeU, 0x61U, 0x37U, 0x93U, 0x98U, 0x35U, 0x92U, 0x35U,
+  0x78U, 0x79U, 0x4eU, 0xa5U, 0x48U, 0x43U, 0xf5U, 0x01U, 0x10U, 0x90U, 0xfaU, 0x2fU, 0x37U, 0x80U, 0xa9U, 0xe5U
+};
+
+static uint8_t ts128_expected3[32] = {
+  0xf6U, 0x03U, 0x92U, 0xc7U, 0x29U, 0xdcU, 0x79U, 0x28U, 0xe8U, 0xb2U, 0xe3U, 0x6fU, 0xedU, 0x5bU, 0xffU, 0x8aU,
+  0x5aU, 0x42U, 0x75U, 0xcfU, 0x37U, 0x7cU, 0xa1U, 0x96U, 0x48U, 0x3aU, 0x8cU, 0xb6U, 0xecU, 0xaeU, 0x8aU, 0x13U
+};
+
+static uint8_t ts256_expected3[32] = {
+  0xf9U, 0x84U, 0xb1U, 0x41U, 0xdcU, 0xf8U, 0x91U, 0x04U, 0xebU, 0x82U, 0x7bU, 0x3fU, 0xcfU, 0x15U, 0xd8U, 0x73U,
+  0x28U, 0x7dU, 0x9bU, 0x01U, 0x41U, 0x44U, 0x4eU, 0x63U, 0x8bU, 0x9aU, 0xcaU, 0xc9U, 0x53U, 0x9eU, 0x1fU, 0x26U
+};
+
+static uint8_t ts128_expected4[64] = {
+  0x7bU, 0x0fU, 0xccU, 0x5dU, 0xccU, 0x6dU, 0x85U, 0x60U, 0x35U, 0xecU, 0xd2U, 0xa1U, 0x7eU, 0xc2U, 0xd9U, 0x99U,
+  0xc8U, 0xb9U, 0x05U, 0x74U, 0xbbU, 0xf2U, 0x09U, 0xfcU, 0x80U, 0x69U, 0xe3U, 0xcfU, 0x00U, 0xccU, 0xadU, 0x39U,
+  0x41U, 0x46U, 0x33U, 0x39U, 0xaeU, 0x8aU, 0xa9U, 0x1dU, 0xa4U, 0xbdU, 0x32U, 0xa7U, 0x1dU, 0x69U, 0x22U, 0x10U,
+  0xc3U, 0x44U, 0x12U, 0x2dU, 0x89U, 0x7aU, 0x4cU, 0x55U, 0xc4U, 0x50U, 0x68U, 0x74U, 0xf5U, 0x9cU, 0x83U, 0x78U
+};
+
+static uint8_t ts256_expected4[64] = {
+  0x44U, 0x6fU, 0x21U, 0x12U, 0xdcU, 0xfaU, 0xc2U, 0x11U, 0x22U, 0x44U, 0xdfU, 0xbeU, 0x15U, 0xcaU, 0x8dU, 0x84U,
+  0xe4U, 0x59U, 0xc1U, 0x68U, 0x74U, 0xe5U, 0xa8U, 0x16U, 0x91U, 0x38U, 0xccU, 0xbbU, 0x91U, 0x80U, 0x6eU, 0xafU,
+  0x96U, 0x0cU, 0x18U, 0x71U, 0x80U, 0xedU, 0xf9U, 0x44U, 0xe4U, 0xaeU, 0x11U, 0x41U, 0x1fU, 0x80U, 0x8bU, 0x93U,
+  0x5cU, 0xf1U, 0xc7U, 0x97U, 0x8eU, 0x88U, 0x37U, 0x48U, 0x4bU, 0x4dU, 0x2fU, 0x9bU, 0x0cU, 0x49U, 0x4eU, 0x3dU
+};
+
+static uint8_t ts128_expected5[32] = {
+  0x39U, 0xa8U, 0x4cU, 0x57U, 0xedU, 0xb4U, 0x55U, 0xe2U, 0x8eU, 0x80U, 0x80U, 0xaaU, 0x5cU, 0x13U, 0x71U, 0xf7U,
+  0x40U, 0xa2U, 0xfeU, 0xd3U, 0x08U, 0x27U, 0x29U, 0xb7U, 0xc9U, 0x35U, 0x8bU, 0x42U, 0x67U, 0x54U, 0x53U, 0xe8U
+};
+
+static uint8_t ts256_expected5[32] = {
+  0x5bU, 0x68U, 0x11U, 0x6fU, 0x1aU, 0x33U, 0x3eU, 0xf6U, 0x88U, 0xaeU, 0x23U, 0x35U, 0xefU, 0x97U, 0xccU, 0xc3U,
+  0xafU, 0x76U, 0x6cU, 0x89U, 0xa5U, 0xe8U, 0x91U, 0x28U, 0xb9U, 0xfcU, 0xa5U, 0x53U, 0x57U, 0xa0U, 0xd2U, 0xa6U
+};
+
+static uint8_t ts128_expected6[32] = {
+  0x06U, 0x61U, 0x37U, 0x64U, 0x65U, 0xc5U, 0xf8U, 0xccU, 0x2fU, 0xeeU, 0xbfU, 0xc8U, 0x07U, 0xabU, 0x86U, 0xb1U,
+  0x0bU, 0xe4U, 0x6dU, 0x74U, 0x0dU, 0x6dU, 0x8aU, 0x2bU, 0x2eU, 0xf3U, 0x84U, 0xa4U, 0xf8U, 0xaeU, 0xc5U, 0xaeU
+};
+
+static uint8_t ts256_expected6[32] = {
+  0x94U, 0xc3U, 0xcfU, 0x34U, 0xffU, 0x1fU, 0xb0U, 0xe4U, 0xdfU, 0x35U, 0x3cU, 0x7eU, 0x7bU, 0x82U, 0xa0U, 0xe1U,
+  0x68U, 0x8dU, 0xc7U, 0xb5U, 0x38U, 0x94U, 0xdeU, 0x37U, 0x23U, 0x52U, 0x36U, 0x74U, 0x56U, 0xcaU, 0xcfU, 0xb2U
+};
+
+static uint8_t ts128_expected7[300] = {
+  0x22U, 0x7bU, 0x79U, 0xedU, 0xdcU, 0xb0U, 0xf7U, 0x0eU, 0x40U, 0x20U, 0xb1U, 0xb1U, 0x69U, 0x97U, 0x58U, 0xf7U,
+  0x9bU, 0xa0U, 0x88U, 0x4bU, 0x9aU, 0x68U, 0x57U, 0xd6U, 0x8bU, 0xe9U, 0x94U, 0x93U, 0x2cU, 0xb2U, 0x43U, 0x4bU,
+  0xefU, 0xeaU, 0xd2U, 0x5aU, 0x41U, 0x26U, 0xd0U, 0x05U, 0xb5U, 0x6aU, 0x27U, 0xe6U, 0x44U, 0x16U, 0xa5U, 0x74U,
+  0x11U, 0xcfU, 0x45U, 0x90U, 0x11U, 0xf8U, 0x77U, 0x06U, 0x56U, 0x04U, 0x2fU, 0x51U, 0xa8U, 0xd4U, 0x58U, 0x32U,
+  0x9cU, 0x47U, 0x69U, 0xa8U, 0xe9U, 0x2aU, 0x52U, 0x7cU, 0xa7U, 0xd6U, 0xb3U, 0x10U, 0x1dU, 0xf1U, 0x85U, 0x90U,
+  0x74U, 0x7cU, 0x02U, 0x99U, 0x81U, 0xbeU, 0xa2U, 0xb7U, 0x0cU, 0x71U, 0x7dU, 0xb8U, 0xc9U, 0x62U, 0xb9U, 0xdaU,
+  0x80U, 0xa9U, 0x22U, 0xdfU, 0x5dU, 0xbfU, 0x2aU, 0xfbU, 0x30U, 0x0fU, 0xfdU, 0xe6U, 0x12U, 0xf1U, 0x4fU, 0x63U,
+  0x3bU, 0xfbU, 0x97U, 0x0fU, 0x7eU, 0x4bU, 0xc1U, 0x15U, 0xabU, 0x61U, 0x1aU, 0x8aU, 0x67U, 0x59U, 0x38U, 0xcaU,
+  0x28U, 0xf2U, 0x55U, 0xcbU, 0x1cU, 0xdaU, 0x7fU, 0x05U, 0x16U, 0xbfU, 0x31U, 0x01U, 0xa9U, 0x89U, 0xb4U, 0x98U,
+  0xfeU, 0x10U, 0x2cU, 0xa8U, 0x2dU, 0xd7U, 0x1dU, 0x21U, 0x5aU, 0x1cU, 0x2eU, 0xf7U, 0x98U, 0x4fU, 0x59U, 0x3aU,
+  0xa0U, 0xb3U, 0xbaU, 0xccU, 0xe3U, 0xa8U, 0x8fU, 0xadU, 0x3cU, 0x69U, 0xf4U, 0xb6U, 0xbdU, 0x5bU, 0xa1U, 0xaeU,
+  0x59U, 0x8bU, 0x39U, 0x84U, 0x49U, 0x95U, 0x75U, 0x20U, 0x09U, 0xdaU, 0x83U, 0x79U, 0x04U, 0xd4U, 0xc0U, 0x21U,
+  0x20U, 0xacU, 0x96U, 0x03U, 0x67U, 0xb5U, 0x76U, 0x06U, 0xbfU, 0x49U, 0xd4U, 0xaeU, 0x65U, 0x31U, 0x45U, 0x33U,
+  0x82U, 0xbbU, 0xf5U, 0x41U, 0x72U, 0xe4U, 0xbeU, 0xa9U, 0x52U, 0x90U, 0xa3U, 0xa6U, 0xcbU, 0xccU, 0x54U, 0x02U,
+  0xdcU, 0xc1U, 0x12U, 0x4aU, 0xf7U, 0xd0U, 0x6cU, 0x49U, 0x1fU, 0xc3U, 0x6bU, 0xbdU, 0x74U, 0x2aU, 0x37U, 0xdeU,
+  0xa2U, 0xcfU, 0x92U, 0xdfU, 0x15U, 0xa0U, 0xefU, 0xd8U, 0xddU, 0x12U, 0x0eU, 0x9cU, 0x7bU, 0xe1U, 0x06U, 0xb0U,
+  0xbfU, 0x94U, 0x62U, 0x9dU, 0xc9U, 0x1fU, 0x43U, 0x5eU, 0x1fU, 0x1dU, 0x20U, 0xa5U, 0x93U, 0xf9U, 0x7cU, 0xe1U,
+  0x23U, 0x50U, 0x16U, 0xdcU, 0x24U, 0xc7U, 0x30U, 0x6cU, 0x28U, 0x14U, 0x3cU, 0x9fU, 0xe3U, 0xf3U, 0x68U, 0x0fU,
+  0xecU, 0x92U, 0x18U, 0x44U, 0x26U, 0x96U, 0x4fU, 0x7bU, 0xe8U, 0xe9U, 0x7fU, 0xd2U
+};
+
+static uint8_t ts256_expected7[300] = {
+  0xaeU, 0x1fU, 0x42U, 0xe8U, 0x22U, 0xabU, 0xf0U, 0x1eU, 0x5fU, 0x30U, 0x30U, 0xebU, 0x60U, 0x2fU, 0x80U, 0x5fU,
+  0x9fU, 0xbdU, 0xd5U, 0x7cU, 0x39U, 0x7fU, 0x02U, 0x93U, 0xa3U, 0xd7U, 0x8aU, 0xdfU, 0xb7U, 0x38U, 0x52U, 0xe6U,
+  0xebU, 0xe5U, 0x58U, 0x71U, 0xb5U, 0xd8U, 0x8eU, 0x90U, 0xa9U, 0xf3U, 0x68U, 0x82U, 0xecU, 0xc6U, 0xb4U, 0xbbU,
+  0x28U, 0xdcU, 0xc2U, 0x45U, 0x4eU, 0x3aU, 0x59U, 0x65U, 0x73U, 0x28U, 0xfeU, 0xfcU, 0xc6U, 0xc9U, 0x67U, 0xe0U,
+  0x1aU, 0x27U, 0x5aU, 0xb4U, 0x06U, 0x25U, 0x65U, 0x84U, 0x4aU, 0xc1U, 0xdbU, 0x26U, 0xccU, 0xeeU, 0x37U, 0x7cU,
+  0x28U, 0xc5U, 0xdaU, 0x8bU, 0x12U, 0x02U, 0x5cU, 0xceU, 0xf9U, 0x64U, 0xadU, 0x5aU, 0xa5U, 0x8eU, 0xffU, 0x9eU,
+  0xf8U, 0x89U, 0x17U, 0xc9U, 0x94U, 0x86U, 0x1eU, 0x78U, 0x57U, 0x0aU, 0x61U, 0x0eU, 0xaaU, 0xe6U, 0x77U, 0xf1U,
+  0x26U, 0xc3U, 0xaaU, 0xcdU, 0xbcU, 0xdbU, 0x01U, 0x52U, 0x40U, 0x1dU, 0x3fU, 0x13U, 0xbcU, 0x73U, 0x9aU, 0x5bU,
+  0x4eU, 0x85U, 0xf5U, 0x42U, 0x93U, 0x4cU, 0x15U, 0xcdU, 0x05U, 0x26U, 0x9bU, 0x82U, 0xbdU, 0x93U, 0xc2U, 0x9aU,
+  0xb2U, 0xfdU, 0x03U, 0x29U, 0xc8U, 0x91U, 0x08U, 0x96U, 0xddU, 0x71U, 0xb9U, 0x29U, 0x94U, 0x1dU, 0x8dU, 0x57U,
+  0xdaU, 0x9dU, 0x96U, 0xffU, 0xc8U, 0x9fU, 0x71U, 0x2eU, 0x48U, 0x38U, 0xefU, 0x57U, 0x44U, 0xb6U, 0x2eU, 0x58U,
+  0xbcU, 0x1fU, 0xf0U, 0x7eU, 0x25U, 0xc5U, 0x31U, 0xdbU, 0x31U, 0x47U, 0x14U, 0xd4U, 0x04U, 0x40U, 0x81U, 0x88U,
+  0x00U, 0x0aU, 0x32U, 0x32U, 0x01U, 0xfdU, 0xd8U, 0x83U, 0x4cU, 0xb4U, 0x4aU, 0xe6U, 0x2fU, 0x43U, 0xb5U, 0x7bU,
+  0xa5U, 0x2eU, 0xeeU, 0x24U, 0xf9U, 0xa9U, 0x63U, 0x43U, 0x40U, 0xdbU, 0xd8U, 0x25U, 0x9cU, 0x4dU, 0xb7U, 0x54U,
+  0x62U, 0x04U, 0x61U, 0x90U, 0xa8U, 0x73U, 0xc0U, 0xd3U, 0x87U, 0x3dU, 0x4fU, 0xbdU, 0xcdU, 0xddU, 0x45U, 0xc9U,
+  0x8bU, 0x0eU, 0x2dU, 0xe2U, 0x47U, 0x80U, 0xbcU, 0xb7U, 0x89U, 0xbeU, 0x70U, 0xb6U, 0x67U, 0x3dU, 0x9aU, 0x95U,
+  0x0eU, 0x1bU, 0x38U, 0xd0U, 0x94U, 0x4dU, 0xbeU, 0xa4U, 0x10U, 0x36U, 0x3bU, 0xc1U, 0x49U, 0x0eU, 0x58U, 0x54U,
+  0xe8U, 0x18U, 0x5eU, 0x30U, 0xf4U, 0x04U, 0x7cU, 0x09U, 0xddU, 0x39U, 0x92U, 0x25U, 0x0cU, 0xd3U, 0xd0U, 0x16U,
+  0x33U, 0x71U, 0x27U, 0xdbU, 0x2fU, 0xa8U, 0xffU, 0x3aU, 0x7eU, 0xd6U, 0x43U, 0x6aU
+};
+
+static uint8_t ts128_expected8[500] = {
+  0xd0U, 0xadU, 0x46U, 0x21U, 0x36U, 0xc6U, 0x1fU, 0xb9U, 0x1aU, 0x76U, 0x2bU, 0x89U, 0xf1U, 0x00U, 0xdeU, 0x63U,
+  0x5aU, 0x60U, 0x7bU, 0x08U, 0xfaU, 0xb6U, 0xa7U, 0x05U, 0x49U, 0xa7U, 0x95U, 0xe9U, 0xbeU, 0x7eU, 0xdcU, 0xcaU,
+  0xc5U, 0x5cU, 0x34U, 0x10U, 0x3fU, 0xf4U, 0x39U, 0x49U, 0x22U, 0xfcU, 0xdcU, 0xd7U, 0x91U, 0x37U, 0x64U, 0x09U,
+  0x8bU, 0xbfU, 0x9bU, 0x5eU, 0xedU, 0x58U, 0x83U, 0x1bU, 0x2bU, 0x75U, 0xfaU, 0x14U, 0xecU, 0xc1U, 0x16U, 0x4aU,
+  0xeeU, 0xddU, 0x7bU, 0x5aU, 0xf5U, 0xdcU, 0xa7U, 0xc6U, 0x4aU, 0xb5U, 0xf8U, 0x61U, 0x61U, 0x57U, 0xc4U, 0x95U,
+  0x4fU, 0x69U, 0xedU, 0xbbU, 0xb7U, 0x1eU, 0x02U, 0x82U, 0x5cU, 0xebU, 0x5eU, 0xa0U, 0x3fU, 0xa3U, 0xcbU, 0xbdU,
+  0xbaU, 0x05U, 0x9dU, 0x07U, 0x9eU, 0xfdU, 0x68U, 0x00U, 0xceU, 0x06U, 0x11U, 0x5bU, 0xecU, 0x8eU, 0xd3U, 0x11U,
+  0xc0U, 0xc1U, 0x66U, 0xacU, 0x28U, 0x8aU, 0x18U, 0xdaU, 0x7aU, 0x2dU, 0x1eU, 0xcaU, 0x91U, 0x8aU, 0x4bU, 0x1bU,
+  0x92U, 0x50U, 0x25U, 0x9eU, 0x47U, 0x66U, 0x2fU, 0xc2U, 0xc9U, 0x95U, 0xcdU, 0xa3U, 0x85U, 0x19U, 0x6fU, 0x15U,
+  0x12U, 0x07U, 0xfaU, 0x7bU, 0x98U, 0x9bU, 0x9fU, 0x3dU, 0x40U, 0xb8U, 0x77U, 0xd4U, 0x2eU, 0x5eU, 0x3aU, 0x59U,
+  0xafU, 0xc5U, 0x0fU, 0x49U, 0x04U, 0x10U, 0xc8U, 0x72U, 0x24U, 0xb1U, 0xf7U, 0x17U, 0x58U, 0xa3U, 0x78U, 0x30U,
+  0x06U, 0x99U, 0x5cU, 0x8bU, 0xb6U, 0x30U, 0x04U, 0xa1U, 0x0bU, 0xf2U, 0x58U, 0x1cU, 0xfeU, 0x58U, 0x9dU, 0xb0U,
+  0x16U, 0xe6U, 0x72U, 0x99U, 0x02U, 0x28U, 0x37U, 0xa3U, 0x69U, 0xc9U, 0x8eU, 0x3cU, 0x27U, 0xc1U, 0x61U, 0x9bU,
+  0xb7U, 0xb6U, 0x2fU, 0xd2U, 0xc4U, 0x44U, 0xb5U, 0x90U, 0x75U, 0xdcU, 0x0dU, 0xf6U, 0xbfU, 0x7bU, 0x86U, 0xdcU,
+  0xb2U, 0xa1U, 0x56U, 0x48U, 0xc1U, 0x63U, 0x03U, 0x65U, 0x1cU, 0x0bU, 0xc3U, 0x3eU, 0x81U, 0x29U, 0x60U, 0xb8U,
+  0x44U, 0x90U, 0x26U, 0xcbU, 0xc8U, 0x53U, 0x09U, 0x90U, 0x5dU, 0x2dU, 0x6aU, 0x04U, 0x22U, 0x16U, 0x57U, 0xafU,
+  0x2eU, 0x58U, 0x99U, 0x5dU, 0x9aU, 0x56U, 0x1fU, 0x9eU, 0xa8U, 0x8dU, 0xd9U, 0xdbU, 0x7bU, 0x8dU, 0xb7U, 0x3eU,
+  0x91U, 0x08U, 0x27U, 0xc5U, 0x12U, 0xc0U, 0x9aU, 0xc4U, 0x71U, 0x39U, 0x40U, 0xd8U, 0x04U, 0x4cU, 0xb9U, 0xabU,
+  0x1cU, 0x49U, 0x76U, 0x8aU, 0x3cU, 0x54U, 0xcbU, 0x76U, 0x7fU, 0x25U, 0xebU, 0xcbU, 0xe7U, 0x89U, 0xb9U, 0xdfU,
+  0xe7U, 0x70U, 0xd3U, 0x2dU, 0x72U, 0xe5U, 0x4eU, 0xc0U, 0x16U, 0x06U, 0x53U, 0x2cU, 0x07U, 0xd9U, 0x23U, 0x89U,
+  0x01U, 0xdeU, 0x14U, 0x84U, 0xa7U, 0x57U, 0xf3U, 0x32U, 0xe9U, 0x09U, 0x90U, 0xe5U, 0x87U, 0xc8U, 0x39U, 0xa2U,
+  0xa7U, 0x65U, 0xceU, 0x33U, 0x18U, 0x93U, 0x33U, 0x29U, 0xb9U, 0xacU, 0x01U, 0x5fU, 0x34U, 0x9aU, 0x08U, 0xecU,
+  0xa1U, 0x7cU, 0x98U, 0x38U, 0x18U, 0x83U, 0x0aU, 0xa5U, 0x7bU, 0xa5U, 0xefU, 0xdbU, 0xc9U, 0xc6U, 0x06U, 0x54U,
+  0xdcU, 0x01U, 0xc3U, 0x27U, 0x87U, 0xb1U, 0xa6U, 0xf1U, 0x9aU, 0x33U, 0x17U, 0x84U, 0xa8U, 0xafU, 0xb1U, 0x8eU,
+  0xc4U, 0x52U, 0x5eU, 0xd3U, 0xceU, 0x2dU, 0x74U, 0x21U, 0x97U, 0xa6U, 0x61U, 0xaaU, 0x4eU, 0xc0U, 0x8aU, 0xf0U,
+  0x0dU, 0xcfU, 0x2aU, 0xb1U, 0x10U, 0x83U, 0xa0U, 0x23U, 0x54U, 0x5cU, 0x81U, 0x64U, 0x25U, 0xf0U, 0xafU, 0x73U,
+  0xf4U, 0xbcU, 0x3aU, 0x4fU, 0xa6U, 0xa1U, 0x61U, 0x67U, 0xaeU, 0xcdU, 0x62U, 0x01U, 0x17U, 0xbaU, 0x25U, 0xdcU,
+  0x65U, 0x61U, 0xeeU, 0x18U, 0xa6U, 0xdfU, 0x8fU, 0x0bU, 0x2cU, 0x2cU, 0x68U, 0xc4U, 0x6aU, 0x85U, 0xe7U, 0xb1U,
+  0x04U, 0x2bU, 0xbeU, 0x35U, 0xd8U, 0x16U, 0x51U, 0x99U, 0xabU, 0x7dU, 0x88U, 0x23U, 0x57U, 0xfeU, 0xcaU, 0xdfU,
+  0xcdU, 0xc8U, 0x32U, 0x0fU, 0xdaU, 0x4dU, 0x1fU, 0x70U, 0xdbU, 0xc2U, 0x8aU, 0xfeU, 0x61U, 0x14U, 0x72U, 0x96U,
+  0x72U, 0xbbU, 0xf0U, 0x8bU, 0x25U, 0xc5U, 0x64U, 0x47U, 0xd1U, 0x6aU, 0x46U, 0x89U, 0x80U, 0x91U, 0xfdU, 0x24U,
+  0x2eU, 0x7dU, 0xd4U, 0x2bU
+};
+
+static uint8_t ts256_expected8[500] = {
+  0xf9U, 0x51U, 0xc1U, 0x3eU, 0x87U, 0x76U, 0x66U, 0x30U, 0x26U, 0x56U, 0x92U, 0xdbU, 0xa8U, 0xcaU, 0x72U, 0x02U,
+  0x66U, 0x6bU, 0x0bU, 0x65U, 0x4bU, 0xdbU, 0xcfU, 0x03U, 0x6eU, 0x76U, 0x76U, 0xc7U, 0xf4U, 0x33U, 0x59U, 0xfcU,
+  0xb3U, 0xdfU, 0x05U, 0x7fU, 0x99U, 0x72U, 0x64U, 0x96U, 0x13U, 0x11U, 0xe8U, 0x83U, 0x11U, 0xafU, 0xadU, 0x57U,
+  0x41U, 0x1fU, 0x2dU, 0x50U, 0xc2U, 0x31U, 0x94U, 0xffU, 0x4bU, 0x73U, 0x9aU, 0xdfU, 0x6fU, 0x7fU, 0x94U, 0x31U,
+  0xadU, 0xb4U, 0x15U, 0x76U, 0xa4U, 0x26U, 0x6dU, 0x99U, 0xe9U, 0x59U, 0x3eU, 0xc8U, 0xfbU, 0xd2U, 0xc7U, 0x40U,
+  0x0dU, 0x14U, 0x93U, 0xeaU, 0x8dU, 0xcaU, 0x4fU, 0x9dU, 0x47U, 0xfeU, 0xcaU, 0x0dU, 0x89U, 0x99U, 0xe7U, 0xa0U,
+  0x9bU, 0x15U, 0x15U, 0xeaU, 0x8bU, 0x63U, 0xf6U, 0x5bU, 0x21U, 0x03U, 0x68U, 0x93U, 0xbdU, 0x78U, 0xb2U, 0x35U,
+  0x98U, 0xefU, 0xdfU, 0xedU, 0x56U, 0xf3U, 0x16U, 0x5eU, 0x11U, 0x54U, 0x5aU, 0xdcU, 0x31U, 0x28U, 0xa4U, 0x5eU,
+  0x93U, 0x7dU, 0xdeU, 0x87U, 0x1cU, 0xc0U, 0x77U, 0x22U, 0x8fU, 0x4aU, 0xceU, 0xbbU, 0x2fU, 0x57U, 0x8cU, 0x62U,
+  0x9cU, 0x5dU, 0x0eU, 0x1bU, 0xbdU, 0x04U, 0xb5U, 0x2dU, 0xb8U, 0x06U, 0xd3U, 0xa3U, 0xffU, 0x21U, 0xf3U, 0x1cU,
+  0x4cU, 0x7dU, 0x9fU, 0x73U, 0x16U, 0x14U, 0xadU, 0x88U, 0xb5U, 0x6bU, 0x79U, 0x11U, 0x39U, 0xa2U, 0xfaU, 0x72U,
+  0x25U, 0x00U, 0xd5U, 0x6bU, 0xdfU, 0x7aU, 0x42U, 0x05U, 0x7dU, 0x4cU, 0x06U, 0x0cU, 0xf0U, 0xa0U, 0x19U, 0xeeU,
+  0xf3U, 0x36U, 0xa0U, 0xebU, 0x73U, 0x5bU, 0xbaU, 0xafU, 0x15U, 0xc2U, 0x24U, 0xa2U, 0x8eU, 0xd8U, 0xf1U, 0x6aU,
+  0x0eU, 0x6fU, 0xcdU, 0xaaU, 0xdaU, 0x67U, 0xbdU, 0xe3U, 0xddU, 0x48U, 0x64U, 0x84U, 0xa0U, 0x3cU, 0xb3U, 0x63U,
+  0x4fU, 0x1eU, 0xc4U, 0x59U, 0xbfU, 0x57U, 0x92U, 0x9bU, 0x0aU, 0xc9U, 0x7aU, 0x94U, 0xb3U, 0x8dU, 0x1cU, 0x51U,
+  0x0eU, 0x25U, 0xf0U, 0xcfU, 0x14U, 0xe6U, 0x22U, 0xc6U, 0xafU, 0x61U, 0xccU, 0xa7U, 0x85U, 0xcdU, 0x83U, 0x7bU,
+  0x97U, 0xaaU, 0x15U, 0xf1U, 0xbcU, 0x79U, 0x72U, 0x50U, 0x26U, 0x95U, 0xf3U, 0x35U, 0x20U, 0xcaU, 0xc4U, 0xddU,
+  0xc5U, 0x52U, 0xf5U, 0xbdU, 0x2cU, 0x0fU, 0xcfU, 0x62U, 0x9aU, 0xa3U, 0x2fU, 0xcdU, 0x15U, 0x12U, 0x50U, 0x28U,
+  0x82U, 0x06U, 0x00U, 0x83U, 0xf3U, 0xcaU, 0x89U, 0x6fU, 0x58U, 0x98U, 0x1dU, 0xceU, 0x6aU, 0x85U, 0x58U, 0x44U,
+  0xdcU, 0xd8U, 0x02U, 0x17U, 0x4eU, 0x15U, 0xd9U, 0x31U, 0x4fU, 0x24U, 0x6fU, 0x8aU, 0x5aU, 0x8bU, 0x3aU, 0x0cU,
+  0xdaU, 0x49U, 0x97U, 0xc2U, 0x3cU, 0x4eU, 0x27U, 0x66U, 0xa2U, 0x85U, 0x85U, 0x90U, 0x66U, 0x17U, 0x01U, 0x3fU,
+  0x47U, 0x07U, 0x4cU, 0x34U, 0x89U, 0xa9U, 0xc5U, 0xcbU, 0x80U, 0x26U, 0x56U, 0x54U, 0x86U, 0xd8U, 0x28U, 0xc5U,
+  0x89U, 0x33U, 0xacU, 0x3aU, 0xe4U, 0x40U, 0xe9U, 0x9cU, 0x5eU, 0x47U, 0xbdU, 0xc2U, 0xeeU, 0x9aU, 0xd6U, 0x03U,
+  0x90U, 0x24U, 0x7fU, 0xcbU, 0x9eU, 0xd1U, 0x36U, 0x4fU, 0x47U, 0x03U, 0x66U, 0x07U, 0x56U, 0x51U, 0x72U, 0xc1U,
+  0xdcU, 0xd7U, 0xd0U, 0x1fU, 0x51U, 0xd5U, 0xe3U, 0xb8U, 0x5fU, 0x6aU, 0x55U, 0xedU, 0x43U, 0x8fU, 0x49U, 0x3bU,
+  0x0dU, 0x8aU, 0xcfU, 0x9fU, 0xa4U, 0x82U, 0x35U, 0x57U, 0x76U, 0x71U, 0x96U, 0x3aU, 0xcfU, 0x7fU, 0xbfU, 0x4fU,
+  0xddU, 0x9bU, 0x87U, 0xe6U, 0x4bU, 0x27U, 0xe0U, 0xdcU, 0x34U, 0x4fU, 0x7eU, 0x40U, 0xe4U, 0x01U, 0x1dU, 0x5eU,
+  0xdeU, 0xbaU, 0xbdU, 0x8eU, 0x2aU, 0x45U, 0x02U, 0x71U, 0x96U, 0x7aU, 0x0dU, 0xb2U, 0xd1U, 0x1fU, 0xe4U, 0xefU,
+  0x39U, 0x25U, 0x01U, 0xbbU, 0x4aU, 0x59U, 0x52U, 0xf5U, 0x39U, 0x86U, 0xcdU, 0x37U, 0x8fU, 0xb9U, 0x76U, 0xa9U,
+  0x03U, 0xb7U, 0x61U, 0xc2U, 0xbcU, 0x66U, 0xf7U, 0xf6U, 0xf4U, 0x2dU, 0x86U, 0xd6U, 0xc0U, 0xb3U, 0x57U, 0xf2U,
+  0xb0U, 0xc7U, 0xc9U, 0x89U, 0x56U, 0x33U, 0x70U, 0x9fU, 0x02U, 0x10U, 0xbbU, 0x34U, 0xabU, 0xbeU, 0x55U, 0xfaU,
+  0x5cU, 0x72U, 0x31U, 0xc4U
+};
+
+static k12_test_vector k12_vectors[] = {
+  { .input_len = 0, .custom_len = 0, .output_len = 32, .expected = k12_expected0 },
+  { .input_len = 0, .custom_len = 0, .output_len = 64, .expected = k12_expected1 },
+  { .input_len = 1, .custom_len = 0, .output_len = 32, .expected = k12_expected2 },
+  { .input_len = 17, .custom_len = 0, .output_len = 32, .expected = k12_expected3 },
+  { .input_len = 289, .custom_len = 0, .output_len = 32, .expected = k12_expected4 },
+  { .input_len = 8191, .custom_len = 0, .output_len = 32, .expected = k12_expected5 },
+  { .input_len = 8192, .custom_len = 0, .output_len = 32, .expected = k12_expected6 },
+  { .input_len = 8193, .custom_len = 0, .output_len = 32, .expected = k12_expected7 },
+  { .input_len = 8189, .custom_len = 1, .output_len = 32, .expected = k12_expected8 },
+  { .input_len = 8190, .custom_len = 3, .output_len = 32, .expected = k12_expected9 },
+  { .input_len = 16384, .custom_len = 0, .output_len = 32, .expected = k12_expected10 },
+  { .input_len = 16385, .custom_len = 41, .output_len = 100, .expected = k12_expected11 },
+  { .input_len = 83521, .custom_len = 0, .output_len = 32, .expected = k12_expected12 },
+  { .input_len = 40000, .custom_len = 0, .output_len = 32, .expected = k12_expected13 },
+  { .input_len = 100000, .custom_len = 300, .output_len = 32, .expected = k12_expected14 },
+  { .input_len = 106501, .custom_len = 0, .output_len = 32, .expected = k12_expected15 },
+  { .input_len = 73728, .custom_len = 8191, .output_len = 48, .expected = k12_expected16 },
+  { .input_len = 0, .custom_len = 1, .output_len = 32, .expected = k12_expected17 },
+  { .input_len = 0, .custom_len = 41, .output_len = 32, .expected = k12_expected18 },
+  { .input_len = 3, .custom_len = 1681, .output_len = 32, .expected = k12_expected19 }
+};
+
+static turboshake_test_vector turboshake_vectors[] = {
+  { .input_len = 0, .domain = 0x1fU, .output_len = 32, .expected128 = ts128_expected0, .expected256 = ts256_expected0 },
+  { .input_len = 0, .domain = 0x1fU, .output_len = 200, .expected128 = ts128_expected1, .expected256 = ts256_expected1 },
+  { .input_len = 17, .domain = 0x1fU, .output_len = 32, .expected128 = ts128_expected2, .expected256 = ts256_expected2 },
+  { .input_len = 289, .domain = 0x06U, .output_len = 32, .expected128 = ts128_expected3, .expected256 = ts256_expected3 },
+  { .input_len = 4913, .domain = 0x0bU, .output_len = 64, .expected128 = ts128_expected4, .expected256 = ts256_expected4 },
+  { .input_len = 168, .domain = 0x07U, .output_len = 32, .expected128 = ts128_expected5, .expected256 = ts256_expected5 },
+  { .input_len = 167, .domain = 0x01U, .output_len = 32, .expected128 = ts128_expected6, .expected256 = ts256_expected6 },
+  { .input_len = 136, .domain = 0x7fU, .output_len = 300, .expected128 = ts128_expected7, .expected256 = ts256_expected7 },
+  { .input_len = 1000, .domain = 0x1fU, .output_len = 500, .expected128 = ts128_expected8, .expected256 = ts256_expected8 }
+};
@@ -0,0 +1,123 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_PBKDF2.h"
+
+#include "test_helpers.h"
+#include "pbkdf2_vectors.h"
+
+#define N_PASSWORDS 11
+#define ITERATIONS  10000
+
+static bool run(const char *path) {
+  bool ok = true;
+  uint8_t dk[200];
+
+  printf("PBKDF2 (%s):\n", path);
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(pbkdf2_test_vector); i++) {
+    pbkdf2_test_vector *v = &vectors[i];
+    EverCrypt_PBKDF2_compute(v->alg, dk, v->password, v->password_len, v->salt, v->salt_len,
+      v->c, v->dk_len);
+    ok &= compare_and_print(v->dk_len, dk, v->expected);
+  }
+
+  // A batch mixing all the vectors of one algorithm, each padded out to the
+  // same iteration count and output length, against single derivations.
+  Spec_Hash_Definitions_hash_alg algs[2] = { Spec_Hash_Definitions_SHA2_256, Spec_Hash_Definitions_SHA2_512 };
+  for (int k = 0; k < 2; k++) {
+    uint8_t out[N_PASSWORDS][100], expected[100];
+    uint8_t *dks[N_PASSWORDS], *passwords[N_PASSWORDS], *salts[N_PASSWORDS];
+    uint32_t password_lens[N_PASSWORDS], salt_lens[N_PASSWORDS];
+    bool ok_batch = true;
+    for (int i = 0; i < N_PASSWORDS; i++) {
+      pbkdf2_test_vector *v = &vectors[i];
+      dks[i] = out[i];
+      passwords[i] = v->password;
+      password_lens[i] = v->password_len;
+      salts[i] = v->salt;
+      salt_lens[i] = v->salt_len;
+    }
+    EverCrypt_PBKDF2_compute_many(algs[k], N_PASSWORDS, dks, passwords, password_lens, salts,
+      salt_lens, 7, 100);
+    for (int i = 0; i < N_PASSWORDS; i++) {
+      EverCrypt_PBKDF2_compute(algs[k], expected, passwords[i], password_lens[i], salts[i],
+        salt_lens[i], 7, 100);
+      ok_batch &= memcmp(out[i], expected, 100) == 0;
+    }
+    printf("PBKDF2-%s batch (%s): ", EverCrypt_Hash_string_of_alg(algs[k]), path);
+    if (ok_batch)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_batch;
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  // Each step takes away the widest remaining kernel.
+  ok &= run("all features");
+  EverCrypt_AutoConfig2_disable_avx512();
+  ok &= run("no AVX-512");
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok &= run("no SHA-NI");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= run("scalar");
+  EverCrypt_AutoConfig2_init();
+
+  // A login burst: sixteen passwords, one 32-byte (resp. 64-byte) key each.
+  uint8_t out[16][64];
+  uint8_t *dks[16], *passwords[16], *salts[16];
+  uint32_t password_lens[16], salt_lens[16];
+  for (int i = 0; i < 16; i++) {
+    dks[i] = out[i];
+    passwords[i] = vectors[i % N_PASSWORDS].password;
+    password_lens[i] = vectors[i % N_PASSWORDS].password_len;
+    salts[i] = vectors[i % N_PASSWORDS].salt;
+    salt_lens[i] = vectors[i % N_PASSWORDS].salt_len;
+  }
+  Spec_Hash_Definitions_hash_alg algs[2] = { Spec_Hash_Definitions_SHA2_256, Spec_Hash_Definitions_SHA2_512 };
+  cycles c1,c2;
+  clock_t t1,t2;
+  for (int k = 0; k < 2; k++) {
+    uint32_t hlen = EverCrypt_Hash_Incremental_hash_len(algs[k]);
+
+    EverCrypt_AutoConfig2_disable_avx512();
+    EverCrypt_AutoConfig2_disable_avx2();
+    t1 = clock();
+    c1 = cpucycles_begin();
+    for (int i = 0; i < 16; i++)
+      EverCrypt_PBKDF2_compute(algs[k], dks[i], passwords[i], password_lens[i], salts[i], salt_lens[i], ITERATIONS, hlen);
+    c2 = cpucycles_end();
+    t2 = clock();
+    uint64_t cdiff1 = c2 - c1;
+    double tdiff1 = t2 - t1;
+    EverCrypt_AutoConfig2_init();
+
+    t1 = clock();
+    c1 = cpucycles_begin();
+    EverCrypt_PBKDF2_compute_many(algs[k], 16, dks, passwords, password_lens, salts, salt_lens, ITERATIONS, hlen);
+    c2 = cpucycles_end();
+    t2 = clock();
+    uint64_t cdiff2 = c2 - c1;
+    double tdiff2 = t2 - t1;
+
+    // "bytes" below are iterations of one password.
+    uint64_t count = 16 * ITERATIONS;
+    printf("PBKDF2-%s, 16 passwords, one at a time (no AVX2):\n", EverCrypt_Hash_string_of_alg(algs[k]));
+    print_time(count,tdiff1,cdiff1);
+    printf("PBKDF2-%s, 16 passwords, compute_many:\n", EverCrypt_Hash_string_of_alg(algs[k]));
+    print_time(count,tdiff2,cdiff2);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+// Generated with Python's hashlib.pbkdf2_hmac; the first two SHA2-256 vectors
+// are those of RFC 7914, section 11.
+
+typedef struct {
+  Spec_Hash_Definitions_hash_alg alg;
+  uint8_t *password;
+  uint32_t password_len;
+  uint8_t *salt;
+  uint32_t salt_len;
+  uint32_t c;
+  uint32_t dk_len;
+  uint8_t *expected;
+} pbkdf2_test_vector;
+
+static uint8_t password0[6] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x64 };
+static uint8_t salt0[4] = { 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected0[64] = { 0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91, 0xc2, 0x25, 0x44, 0xb6, 0x05, 0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde, 0x04, 0x65, 0xe6, 0x8b, 0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc, 0x49, 0xca, 0x9c, 0xcc, 0xf1, 0x79, 0xb6, 0x45, 0x99, 0x16, 0x64, 0xb3, 0x9d, 0x77, 0xef, 0x31, 0x7c, 0x71, 0xb8, 0x45, 0xb1, 0xe3, 0x0b, 0xd5, 0x09, 0x11, 0x20, 0x41, 0xd3, 0xa1, 0x97, 0x83 };
+static uint8_t password1[8] = { 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt1[4] = { 0x4e, 0x61, 0x43, 0x6c };
+static uint8_t expected1[64] = { 0x4d, 0xdc, 0xd8, 0xf6, 0x0b, 0x98, 0xbe, 0x21, 0x83, 0x0c, 0xee, 0x5e, 0xf2, 0x27, 0x01, 0xf9, 0x64, 0x1a, 0x44, 0x18, 0xd0, 0x4c, 0x04, 0x14, 0xae, 0xff, 0x08, 0x87, 0x6b, 0x34, 0xab, 0x56, 0xa1, 0xd4, 0x25, 0xa1, 0x22, 0x58, 0x33, 0x54, 0x9a, 0xdb, 0x84, 0x1b, 0x51, 0xc9, 0xb3, 0x17, 0x6a, 0x27, 0x2b, 0xde, 0xbb, 0xa1, 0xd0, 0x78, 0x47, 0x8f, 0x62, 0xb3, 0x97, 0xf3, 0x3c, 0x8d };
+static uint8_t password2[8] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt2[4] = { 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected2[32] = { 0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41, 0xaa, 0x53, 0x0d, 0xb6, 0x84, 0x5c, 0x4c, 0x8d, 0x96, 0x28, 0x93, 0xa0, 0x01, 0xce, 0x4e, 0x11, 0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a };
+static uint8_t password3[24] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52, 0x44, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt3[36] = { 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected3[40] = { 0x34, 0x8c, 0x89, 0xdb, 0xcb, 0xd3, 0x2b, 0x2f, 0x32, 0xd8, 0x14, 0xb8, 0x11, 0x6e, 0x84, 0xcf, 0x2b, 0x17, 0x34, 0x7e, 0xbc, 0x18, 0x00, 0x18, 0x1c, 0x4e, 0x2a, 0x1f, 0xb8, 0xdd, 0x53, 0xe1, 0xc6, 0x35, 0x51, 0x8c, 0x7d, 0xac, 0x47, 0xe9 };
+static uint8_t password4[100] = { 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b };
+static uint8_t salt4[1] = { 0 };
+static uint8_t expected4[100] = { 0x08, 0x7a, 0x5e, 0xbd, 0x36, 0x38, 0x64, 0x41, 0x6d, 0x2c, 0x92, 0xfc, 0x00, 0x32, 0x09, 0x81, 0x37, 0x00, 0x86, 0x75, 0xa0, 0x9c, 0x95, 0x82, 0xdc, 0xd1, 0x00, 0xc5, 0x07, 0x7e, 0xb5, 0x7f, 0xe7, 0xc7, 0x8e, 0x94, 0x11, 0x52, 0xea, 0x0b, 0xd1, 0x03, 0x84, 0x01, 0x9f, 0xba, 0x96, 0x0b, 0xdf, 0x42, 0xc9, 0xa1, 0x90, 0x00, 0xfc, 0x0f, 0xe4, 0xa0, 0x47, 0xdc, 0x00, 0x38, 0xb7, 0xe9, 0xb6, 0xd6, 0x13, 0x54, 0xdb, 0xdd, 0xf2, 0xb2, 0x16, 0x2b, 0x8a, 0x92, 0x23, 0x57, 0x65, 0x07, 0xe0, 0xfb, 0x0b, 0x21, 0xd8, 0x20, 0xb9, 0x3f, 0x93, 0xa6, 0x59, 0xd4, 0x42, 0x27, 0x99, 0x11, 0xb8, 0x08, 0xb4, 0xdb };
+static uint8_t password5[8] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt5[4] = { 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected5[64] = { 0x86, 0x7f, 0x70, 0xcf, 0x1a, 0xde, 0x02, 0xcf, 0xf3, 0x75, 0x25, 0x99, 0xa3, 0xa5, 0x3d, 0xc4, 0xaf, 0x34, 0xc7, 0xa6, 0x69, 0x81, 0x5a, 0xe5, 0xd5, 0x13, 0x55, 0x4e, 0x1c, 0x8c, 0xf2, 0x52, 0xc0, 0x2d, 0x47, 0x0a, 0x28, 0x5a, 0x05, 0x01, 0xba, 0xd9, 0x99, 0xbf, 0xe9, 0x43, 0xc0, 0x8f, 0x05, 0x02, 0x35, 0xd7, 0xd6, 0x8b, 0x1d, 0xa5, 0x5e, 0x63, 0xf7, 0x3b, 0x60, 0xa5, 0x7f, 0xce };
+static uint8_t password6[8] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt6[4] = { 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected6[64] = { 0xd1, 0x97, 0xb1, 0xb3, 0x3d, 0xb0, 0x14, 0x3e, 0x01, 0x8b, 0x12, 0xf3, 0xd1, 0xd1, 0x47, 0x9e, 0x6c, 0xde, 0xbd, 0xcc, 0x97, 0xc5, 0xc0, 0xf8, 0x7f, 0x69, 0x02, 0xe0, 0x72, 0xf4, 0x57, 0xb5, 0x14, 0x3f, 0x30, 0x60, 0x26, 0x41, 0xb3, 0xd5, 0x5c, 0xd3, 0x35, 0x98, 0x8c, 0xb3, 0x6b, 0x84, 0x37, 0x60, 0x60, 0xec, 0xd5, 0x32, 0xe0, 0x39, 0xb7, 0x42, 0xa2, 0x39, 0x43, 0x4a, 0xf2, 0xd5 };
+static uint8_t password7[24] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x50, 0x41, 0x53, 0x53, 0x57, 0x4f, 0x52, 0x44, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt7[36] = { 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74, 0x53, 0x41, 0x4c, 0x54, 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected7[150] = { 0x8c, 0x05, 0x11, 0xf4, 0xc6, 0xe5, 0x97, 0xc6, 0xac, 0x63, 0x15, 0xd8, 0xf0, 0x36, 0x2e, 0x22, 0x5f, 0x3c, 0x50, 0x14, 0x95, 0xba, 0x23, 0xb8, 0x68, 0xc0, 0x05, 0x17, 0x4d, 0xc4, 0xee, 0x71, 0x11, 0x5b, 0x59, 0xf9, 0xe6, 0x0c, 0xd9, 0x53, 0x2f, 0xa3, 0x3e, 0x0f, 0x75, 0xae, 0xfe, 0x30, 0x22, 0x5c, 0x58, 0x3a, 0x18, 0x6c, 0xd8, 0x2b, 0xd4, 0xda, 0xea, 0x97, 0x24, 0xa3, 0xd3, 0xb8, 0x04, 0xf7, 0x5b, 0xdd, 0x41, 0x49, 0x4f, 0xa3, 0x24, 0xca, 0xb2, 0x4b, 0xcc, 0x68, 0x0f, 0xb3, 0xb9, 0x6a, 0x30, 0xcf, 0x5d, 0x21, 0xfa, 0xc3, 0xc2, 0x87, 0x59, 0x13, 0x91, 0x9f, 0x33, 0x99, 0xb1, 0xd9, 0xce, 0x7e, 0xb5, 0x4c, 0x95, 0xba, 0x49, 0x11, 0x85, 0x96, 0xcf, 0x74, 0x65, 0x71, 0x9b, 0xbe, 0x02, 0xc4, 0xec, 0xab, 0x1b, 0x15, 0x41, 0x29, 0x8c, 0x32, 0x1d, 0x13, 0xc6, 0xf6, 0xd4, 0x14, 0xc2, 0x81, 0x63, 0xb0, 0x51, 0xa1, 0xd3, 0x13, 0xce, 0xc1, 0x3a, 0x76, 0xeb, 0xdb, 0xba, 0x62, 0x4e, 0xb2, 0xc7, 0x42 };
+static uint8_t password8[200] = { 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50 };
+static uint8_t salt8[1] = { 0x73 };
+static uint8_t expected8[17] = { 0x7f, 0x79, 0x7b, 0x24, 0x21, 0x5f, 0xdc, 0xd6, 0x9e, 0x04, 0xaa, 0x6e, 0xf1, 0x25, 0x22, 0x0f, 0xdf };
+static uint8_t password9[8] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt9[4] = { 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected9[20] = { 0x4b, 0x00, 0x79, 0x01, 0xb7, 0x65, 0x48, 0x9a, 0xbe, 0xad, 0x49, 0xd9, 0x26, 0xf7, 0x21, 0xd0, 0x65, 0xa4, 0x29, 0xc1 };
+static uint8_t password10[8] = { 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64 };
+static uint8_t salt10[4] = { 0x73, 0x61, 0x6c, 0x74 };
+static uint8_t expected10[48] = { 0x3b, 0xd3, 0x7e, 0x22, 0x36, 0x94, 0x1d, 0x4a, 0x77, 0xb1, 0xb5, 0xb7, 0x14, 0xc6, 0xf9, 0x13, 0xfa, 0xbb, 0x6b, 0x08, 0x41, 0xa6, 0xd7, 0xd8, 0x65, 0x6b, 0x99, 0xd6, 0x11, 0xe9, 0x00, 0xfe, 0x06, 0xed, 0xb9, 0x3b, 0x5b, 0x80, 0x9e, 0xfa, 0xa9, 0x67, 0x8b, 0x63, 0x5c, 0xe5, 0x13, 0xe0 };
+
+static pbkdf2_test_vector vectors[] = {
+  { Spec_Hash_Definitions_SHA2_256, password0, 6, salt0, 4, 1, 64, expected0 },
+  { Spec_Hash_Definitions_SHA2_256, password1, 8, salt1, 4, 80000, 64, expected1 },
+  { Spec_Hash_Definitions_SHA2_256, password2, 8, salt2, 4, 4096, 32, expected2 },
+  { Spec_Hash_Definitions_SHA2_256, password3, 24, salt3, 36, 4096, 40, expected3 },
+  { Spec_Hash_Definitions_SHA2_256, password4, 100, salt4, 0, 2, 100, expected4 },
+  { Spec_Hash_Definitions_SHA2_512, password5, 8, salt5, 4, 1, 64, expected5 },
+  { Spec_Hash_Definitions_SHA2_512, password6, 8, salt6, 4, 4096, 64, expected6 },
+  { Spec_Hash_Definitions_SHA2_512, password7, 24, salt7, 36, 4096, 150, expected7 },
+  { Spec_Hash_Definitions_SHA2_512, password8, 200, salt8, 1, 3, 17, expected8 },
+  { Spec_Hash_Definitions_SHA1, password9, 8, salt9, 4, 4096, 20, expected9 },
+  { Spec_Hash_Definitions_SHA2_384, password10, 8, salt10, 4, 1000, 48, expected10 },
+};
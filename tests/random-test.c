@@ -0,0 +1,143 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "Lib_RandomBuffer_System.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define N_THREADS 4
+#define REQ_LEN   16
+#define ROUNDS    100000
+
+#define STREAM_LEN (1 << 20)
+
+static uint8_t stream[STREAM_LEN];
+static uint8_t firsts[N_THREADS][REQ_LEN];
+
+static void print_result(bool ok) {
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+}
+
+// Requests of every size up to past a refill, and a few that bypass the
+// buffer: no two 16-byte windows may coincide and every byte value must show up
+// about as often as the others.
+static bool check(const char *path) {
+  uint32_t done = 0;
+  for (uint32_t len = 1; done < STREAM_LEN; len = len < 1500 ? len + 1 : len * 2) {
+    uint32_t n = len < STREAM_LEN - done ? len : STREAM_LEN - done;
+    EverCrypt_DRBG_buffered_random(stream + done, n);
+    done += n;
+  }
+  uint32_t counts[256] = { 0 };
+  for (uint32_t i = 0; i < STREAM_LEN; i++)
+    counts[stream[i]]++;
+  bool ok = true;
+  for (int i = 0; i < 256; i++)
+    ok &= counts[i] > STREAM_LEN / 256 * 9 / 10 && counts[i] < STREAM_LEN / 256 * 11 / 10;
+  for (uint32_t i = 0; i + REQ_LEN <= STREAM_LEN; i += 4093)
+    for (uint32_t j = i + REQ_LEN; j + REQ_LEN <= STREAM_LEN; j += 65537)
+      ok &= memcmp(stream + i, stream + j, REQ_LEN) != 0;
+  printf("Buffered random (%s): ", path);
+  print_result(ok);
+  return ok;
+}
+
+static void *draw(void *arg) {
+  uint8_t *out = arg;
+  EverCrypt_DRBG_buffered_random(out, REQ_LEN);
+  return NULL;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  ok &= check("all features");
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= check("no AVX2");
+  EverCrypt_AutoConfig2_disable_avx();
+  EverCrypt_AutoConfig2_disable_sse();
+  ok &= check("portable");
+  EverCrypt_AutoConfig2_init();
+
+  // Every thread seeds its own generator.
+  pthread_t threads[N_THREADS];
+  for (int i = 0; i < N_THREADS; i++)
+    pthread_create(&threads[i], NULL, draw, firsts[i]);
+  for (int i = 0; i < N_THREADS; i++)
+    pthread_join(threads[i], NULL);
+  bool distinct = true;
+  for (int i = 0; i < N_THREADS; i++)
+    for (int j = i + 1; j < N_THREADS; j++)
+      distinct &= memcmp(firsts[i], firsts[j], REQ_LEN) != 0;
+  printf("Buffered random, %d threads: ", N_THREADS);
+  print_result(distinct);
+  ok &= distinct;
+
+  // The parent and the child of a fork continue from the same buffer unless the
+  // child reseeds.
+  uint8_t parent[REQ_LEN], child[REQ_LEN];
+  int fds[2];
+  bool forked = pipe(fds) == 0;
+  pid_t pid = forked ? fork() : -1;
+  if (pid == 0) {
+    EverCrypt_DRBG_buffered_random(child, REQ_LEN);
+    ssize_t r = write(fds[1], child, REQ_LEN);
+    _exit(r == REQ_LEN ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+  forked &= pid > 0;
+  if (forked) {
+    EverCrypt_DRBG_buffered_random(parent, REQ_LEN);
+    forked &= read(fds[0], child, REQ_LEN) == REQ_LEN;
+    waitpid(pid, NULL, 0);
+  }
+  forked &= memcmp(parent, child, REQ_LEN) != 0;
+  printf("Buffered random, fork: ");
+  print_result(forked);
+  ok &= forked;
+
+  uint8_t out[REQ_LEN];
+  cycles a,b;
+  clock_t t1,t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Lib_RandomBuffer_System_crypto_random(out, REQ_LEN);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_DRBG_buffered_random(out, REQ_LEN);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint64_t count = ROUNDS * REQ_LEN;
+  printf("%d-byte requests, crypto_random:\n", REQ_LEN);
+  print_time(count,tdiff1,cdiff1);
+  printf("%d-byte requests, buffered_random:\n", REQ_LEN);
+  print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
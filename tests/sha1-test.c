@@ -0,0 +1,95 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "Hacl_Hash_SHA1.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+
+#include "test_helpers.h"
+
+typedef struct {
+  char *input;
+  uint8_t tag[20];
+} sha1_test_vector;
+
+static sha1_test_vector vectors[] = {
+  { "",
+    { 0xda, 0x39, 0xa3, 0xee, 0x5e, 0x6b, 0x4b, 0x0d, 0x32, 0x55,
+      0xbf, 0xef, 0x95, 0x60, 0x18, 0x90, 0xaf, 0xd8, 0x07, 0x09 } },
+  { "abc",
+    { 0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e,
+      0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d } },
+  { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+    { 0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae,
+      0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5, 0xe5, 0x46, 0x70, 0xf1 } },
+  { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+    "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+    { 0xa4, 0x9b, 0x24, 0x46, 0xa0, 0x2c, 0x64, 0x5b, 0xf4, 0x19,
+      0xf9, 0x95, 0xb6, 0x70, 0x91, 0x25, 0x3a, 0x04, 0xa2, 0x59 } },
+};
+
+#define MAX_LEN 1000
+
+static uint8_t msg[MAX_LEN];
+
+// Runs every check once with the SHA extensions (if the CPU has them) and
+// once on the portable path.
+static bool run(const char *path) {
+  bool ok = true;
+  uint8_t tag[20];
+  uint8_t expected[20];
+
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(sha1_test_vector); i++) {
+    uint8_t *in = (uint8_t *)vectors[i].input;
+    uint32_t len = (uint32_t)strlen(vectors[i].input);
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA1, tag, in, len);
+    ok &= compare_and_print(20, tag, vectors[i].tag);
+  }
+
+  // One-shot and streaming hashes of every length up to MAX_LEN, against the
+  // portable implementation.
+  bool ok_lens = true;
+  for (uint32_t len = 0; len < MAX_LEN; len++) {
+    Hacl_Hash_SHA1_legacy_hash(msg, len, expected);
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA1, tag, msg, len);
+    ok_lens &= memcmp(tag, expected, 20) == 0;
+
+    Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s =
+      EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_SHA1);
+    uint32_t chunk = 1 + len % 150;
+    for (uint32_t off = 0; off < len; off += chunk)
+      EverCrypt_Hash_Incremental_update(s, msg + off, off + chunk > len ? len - off : chunk);
+    EverCrypt_Hash_Incremental_finish(s, tag);
+    EverCrypt_Hash_Incremental_free(s);
+    ok_lens &= memcmp(tag, expected, 20) == 0;
+  }
+  printf("SHA1 (%s) all lengths: ", path);
+  if (ok_lens)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+
+  return ok && ok_lens;
+}
+
+int main() {
+  bool ok = true;
+  EverCrypt_AutoConfig2_init();
+
+  srand(0);
+  for (int i = 0; i < MAX_LEN; i++)
+    msg[i] = (uint8_t)rand();
+
+  if (EverCrypt_AutoConfig2_has_shaext() && EverCrypt_AutoConfig2_has_sse())
+    ok &= run("SHA-NI");
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok &= run("portable");
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,166 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Hash_SHA2.h"
+#include "Hacl_Streaming_SHA2_Vec256.h"
+
+#include "test_helpers.h"
+#include "sha2_vectors.h"
+
+#define N_MSGS 37
+#define MAX_LEN 1000
+
+static uint8_t msgs[N_MSGS][MAX_LEN];
+static uint32_t lens[N_MSGS];
+
+int main() {
+  bool ok = true;
+  size_t n_vectors = sizeof(vectors) / sizeof(sha2_test_vector);
+
+  // Known-answer tests: lane i hashes vector i % n_vectors, fed in chunks of
+  // different sizes in each lane.
+  {
+    Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s = Hacl_Streaming_SHA2_Vec256_create_in_256();
+    uint8_t tags[8][32] = { 0 };
+    uint8_t *dst[8];
+    size_t off[8] = { 0 };
+    bool more = true;
+    while (more) {
+      uint8_t *data[8];
+      uint32_t len[8];
+      more = false;
+      for (int i = 0; i < 8; i++) {
+        sha2_test_vector *v = &vectors[i % n_vectors];
+        size_t chunk = 1 + 7 * i;
+        if (off[i] + chunk > v->input_len)
+          chunk = v->input_len - off[i];
+        data[i] = v->input + off[i];
+        len[i] = chunk;
+        off[i] += chunk;
+        more |= off[i] < v->input_len;
+      }
+      Hacl_Streaming_SHA2_Vec256_update_256(s, data, len);
+    }
+    for (int i = 0; i < 8; i++)
+      dst[i] = tags[i];
+    Hacl_Streaming_SHA2_Vec256_finish_256(s, dst);
+    for (int i = 0; i < 8; i++)
+      ok &= compare_and_print(32, tags[i], vectors[i % n_vectors].tag_256);
+    Hacl_Streaming_SHA2_Vec256_free_256(s);
+  }
+
+  {
+    Hacl_Streaming_SHA2_Vec256_state_sha2_512 *s = Hacl_Streaming_SHA2_Vec256_create_in_512();
+    uint8_t tag[64] = { 0 };
+    for (uint32_t i = 0; i < 4; i++) {
+      sha2_test_vector *v = &vectors[i % n_vectors];
+      Hacl_Streaming_SHA2_Vec256_update_lane_512(s, i, v->input, 3 < v->input_len ? 3 : v->input_len);
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      sha2_test_vector *v = &vectors[i % n_vectors];
+      if (v->input_len > 3)
+        Hacl_Streaming_SHA2_Vec256_update_lane_512(s, i, v->input + 3, v->input_len - 3);
+      Hacl_Streaming_SHA2_Vec256_finish_lane_512(s, i, tag);
+      ok &= compare_and_print(64, tag, v->tag_512);
+    }
+    Hacl_Streaming_SHA2_Vec256_free_512(s);
+  }
+
+  // Messages of distinct lengths, hashed through the lane scheduler, are
+  // checked against the scalar implementation.
+  srand(0);
+  for (int i = 0; i < N_MSGS; i++) {
+    lens[i] = (uint32_t)(rand() % MAX_LEN);
+    if (i < 4)
+      lens[i] = (uint32_t)(55 + i); // around the padding boundary
+    for (uint32_t j = 0; j < lens[i]; j++)
+      msgs[i][j] = (uint8_t)rand();
+  }
+  {
+    uint8_t tags[N_MSGS][64];
+    uint8_t expected[64];
+    uint8_t *dst[N_MSGS];
+    uint8_t *input[N_MSGS];
+    bool ok_many = true;
+    for (int i = 0; i < N_MSGS; i++) {
+      dst[i] = tags[i];
+      input[i] = msgs[i];
+    }
+
+    Hacl_Streaming_SHA2_Vec256_hash_many_256(N_MSGS, dst, lens, input);
+    for (int i = 0; i < N_MSGS; i++) {
+      Hacl_Hash_SHA2_hash_256(msgs[i], lens[i], expected);
+      ok_many &= memcmp(tags[i], expected, 32) == 0;
+    }
+
+    Hacl_Streaming_SHA2_Vec256_hash_many_512(N_MSGS, dst, lens, input);
+    for (int i = 0; i < N_MSGS; i++) {
+      Hacl_Hash_SHA2_hash_512(msgs[i], lens[i], expected);
+      ok_many &= memcmp(tags[i], expected, 64) == 0;
+    }
+    printf("SHA2 multi-lane hash_many: ");
+    if (ok_many)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_many;
+  }
+
+  // Lanes that finish early are refilled while the others are in flight.
+  {
+    Hacl_Streaming_SHA2_Vec256_state_sha2_256 *s = Hacl_Streaming_SHA2_Vec256_create_in_256();
+    uint8_t tag[32];
+    uint8_t expected[32];
+    uint32_t job[8], off[8];
+    int next = 0, done = 0;
+    bool ok_refill = true;
+    for (int i = 0; i < 8; i++) {
+      job[i] = next++;
+      off[i] = 0;
+    }
+    while (done < N_MSGS) {
+      uint8_t *data[8];
+      uint32_t len[8];
+      for (int i = 0; i < 8; i++) {
+        uint32_t chunk = 0;
+        if (job[i] < N_MSGS) {
+          chunk = 100 + 13 * i;
+          if (off[i] + chunk > lens[job[i]])
+            chunk = lens[job[i]] - off[i];
+          data[i] = msgs[job[i]] + off[i];
+        } else
+          data[i] = NULL;
+        len[i] = chunk;
+        off[i] += chunk;
+      }
+      Hacl_Streaming_SHA2_Vec256_update_256(s, data, len);
+      for (uint32_t i = 0; i < 8; i++) {
+        if (job[i] < N_MSGS && off[i] == lens[job[i]]) {
+          Hacl_Streaming_SHA2_Vec256_finish_lane_256(s, i, tag);
+          Hacl_Hash_SHA2_hash_256(msgs[job[i]], lens[job[i]], expected);
+          ok_refill &= memcmp(tag, expected, 32) == 0;
+          done++;
+          Hacl_Streaming_SHA2_Vec256_init_lane_256(s, i);
+          job[i] = next < N_MSGS ? next++ : N_MSGS;
+          off[i] = 0;
+        }
+      }
+    }
+    printf("SHA2-256 multi-lane refill: ");
+    if (ok_refill)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_refill;
+    Hacl_Streaming_SHA2_Vec256_free_256(s);
+  }
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,109 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "Hacl_Hash_SHA2.h"
+#include "Hacl_SHA2_Vec512.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "sha2_vectors.h"
+
+#define MAX_LEN 300
+
+static uint8_t msgs[16][MAX_LEN];
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_vec512()) {
+    printf("Skipping SHA2 Vec512 tests: no AVX-512 support\n");
+    return EXIT_SUCCESS;
+  }
+
+  bool ok = true;
+  size_t n_vectors = sizeof(vectors) / sizeof(sha2_test_vector);
+
+  // Known-answer tests: every lane hashes the same vector.
+  for (size_t i = 0; i < n_vectors; i++) {
+    sha2_test_vector *v = &vectors[i];
+    uint8_t tags[16][64] = { 0 };
+    uint8_t *t[16];
+    for (int j = 0; j < 16; j++)
+      t[j] = tags[j];
+    uint8_t *in = v->input;
+    uint32_t len = v->input_len;
+
+    Hacl_SHA2_Vec512_sha224_16(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+      t[8], t[9], t[10], t[11], t[12], t[13], t[14], t[15], len,
+      in, in, in, in, in, in, in, in, in, in, in, in, in, in, in, in);
+    for (int j = 0; j < 16; j++)
+      ok &= compare_and_print(28, tags[j], v->tag_224);
+
+    Hacl_SHA2_Vec512_sha256_16(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+      t[8], t[9], t[10], t[11], t[12], t[13], t[14], t[15], len,
+      in, in, in, in, in, in, in, in, in, in, in, in, in, in, in, in);
+    for (int j = 0; j < 16; j++)
+      ok &= compare_and_print(32, tags[j], v->tag_256);
+
+    Hacl_SHA2_Vec512_sha384_8(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+      len, in, in, in, in, in, in, in, in);
+    for (int j = 0; j < 8; j++)
+      ok &= compare_and_print(48, tags[j], v->tag_384);
+
+    Hacl_SHA2_Vec512_sha512_8(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+      len, in, in, in, in, in, in, in, in);
+    for (int j = 0; j < 8; j++)
+      ok &= compare_and_print(64, tags[j], v->tag_512);
+  }
+
+  // Distinct messages in every lane, at lengths around the padding
+  // boundaries, against the scalar implementation.
+  srand(0);
+  for (int i = 0; i < 16; i++)
+    for (int j = 0; j < MAX_LEN; j++)
+      msgs[i][j] = (uint8_t)rand();
+  {
+    uint32_t lens[] = { 0, 1, 55, 56, 63, 64, 111, 112, 127, 128, 200, MAX_LEN };
+    bool ok_lanes = true;
+    for (size_t k = 0; k < sizeof(lens) / sizeof(lens[0]); k++) {
+      uint8_t tags[16][64];
+      uint8_t expected[64];
+      uint8_t *t[16];
+      uint8_t *m[16];
+      uint32_t len = lens[k];
+      for (int j = 0; j < 16; j++) {
+        t[j] = tags[j];
+        m[j] = msgs[j];
+      }
+
+      Hacl_SHA2_Vec512_sha256_16(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+        t[8], t[9], t[10], t[11], t[12], t[13], t[14], t[15], len,
+        m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7],
+        m[8], m[9], m[10], m[11], m[12], m[13], m[14], m[15]);
+      for (int j = 0; j < 16; j++) {
+        Hacl_Hash_SHA2_hash_256(msgs[j], len, expected);
+        ok_lanes &= memcmp(tags[j], expected, 32) == 0;
+      }
+
+      Hacl_SHA2_Vec512_sha512_8(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+        len, m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7]);
+      for (int j = 0; j < 8; j++) {
+        Hacl_Hash_SHA2_hash_512(msgs[j], len, expected);
+        ok_lanes &= memcmp(tags[j], expected, 64) == 0;
+      }
+    }
+    printf("SHA2 Vec512 distinct lanes: ");
+    if (ok_lanes)
+      printf("Success!\n");
+    else
+      printf("**FAILED**\n");
+    ok &= ok_lanes;
+  }
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
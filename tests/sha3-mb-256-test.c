@@ -0,0 +1,107 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AutoConfig2.h"
+
+#define ROUNDS 4096
+#define SIZE   8192
+
+#define MAX_LEN 700
+#define OUT_LEN 500
+
+static uint8_t msg[4][MAX_LEN];
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_vec256()) {
+      printf("The current hardware doesn't support vec256: aborting\n");
+      return EXIT_SUCCESS;
+  }
+  else {
+      printf("The current hardware supports vec256: performing the tests\n");
+  }
+
+  bool ok = true;
+  srand(0);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < MAX_LEN; j++)
+      msg[i][j] = (uint8_t)rand();
+
+  // Every lane against the scalar implementation, for lengths around the
+  // SHAKE128 (168), SHA3-256/SHAKE256 (136) rates and their multiples.
+  for (uint32_t len = 0; len < MAX_LEN; len += 1 + len / 64) {
+    uint8_t out[4][OUT_LEN];
+    uint8_t expected[OUT_LEN];
+    uint32_t out_len = 1 + (len * 7) % OUT_LEN;
+
+    Hacl_SHA3_Vec256_shake128_4x(len, msg[0], msg[1], msg[2], msg[3],
+      out_len, out[0], out[1], out[2], out[3]);
+    for (int i = 0; i < 4; i++) {
+      Hacl_SHA3_shake128_hacl(len, msg[i], out_len, expected);
+      ok &= memcmp(out[i], expected, out_len) == 0;
+    }
+
+    Hacl_SHA3_Vec256_shake256_4x(len, msg[0], msg[1], msg[2], msg[3],
+      out_len, out[0], out[1], out[2], out[3]);
+    for (int i = 0; i < 4; i++) {
+      Hacl_SHA3_shake256_hacl(len, msg[i], out_len, expected);
+      ok &= memcmp(out[i], expected, out_len) == 0;
+    }
+
+    Hacl_SHA3_Vec256_sha3_256_4x(len, msg[0], msg[1], msg[2], msg[3],
+      out[0], out[1], out[2], out[3]);
+    for (int i = 0; i < 4; i++) {
+      Hacl_SHA3_sha3_256(len, msg[i], expected);
+      ok &= memcmp(out[i], expected, 32) == 0;
+    }
+  }
+  printf("SHA3/SHAKE 4-way (Vec 256-bit) against scalar: ");
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+
+  uint8_t plain[4][SIZE];
+  uint8_t tag[4][32];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',sizeof plain);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < 4; i++)
+      Hacl_SHA3_sha3_256(SIZE,plain[i],tag[i]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_Vec256_sha3_256_4x(SIZE,plain[0],plain[1],plain[2],plain[3],tag[0],tag[1],tag[2],tag[3]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint64_t count = ROUNDS * SIZE * 4;
+  printf("SHA3-256 (4x scalar):\n"); print_time(count,tdiff1,cdiff1);
+  printf("SHA3-256 (4-way Vec 256-bit):\n"); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,153 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "Hacl_SHA3.h"
+#include "Hacl_Streaming_SHA3.h"
+#include "EverCrypt_Hash.h"
+
+#include "test_helpers.h"
+#include "sha3_vectors.h"
+
+#define MAX_LEN 1000
+
+static uint8_t msg[MAX_LEN];
+
+static void sha3(Spec_Hash_Definitions_hash_alg a, uint32_t len, uint8_t *input, uint8_t *dst) {
+  switch (a) {
+  case Spec_Hash_Definitions_SHA3_224: Hacl_SHA3_sha3_224(len, input, dst); break;
+  case Spec_Hash_Definitions_SHA3_256: Hacl_SHA3_sha3_256(len, input, dst); break;
+  case Spec_Hash_Definitions_SHA3_384: Hacl_SHA3_sha3_384(len, input, dst); break;
+  default: Hacl_SHA3_sha3_512(len, input, dst); break;
+  }
+}
+
+// Streaming and EverCrypt incremental hashes of every length up to MAX_LEN, in
+// chunks of varying sizes, against the one-shot implementation.
+static bool check_sha3(Spec_Hash_Definitions_hash_alg a) {
+  bool ok = true;
+  uint32_t hash_len = Hacl_Streaming_SHA3_hash_len(a);
+  uint8_t tag[64];
+  uint8_t expected[64];
+
+  for (uint32_t len = 0; len < MAX_LEN; len++) {
+    uint32_t chunk = 1 + len % 173;
+    sha3(a, len, msg, expected);
+
+    Hacl_Streaming_SHA3_state *s = Hacl_Streaming_SHA3_create_in(a);
+    for (uint32_t off = 0; off < len; off += chunk)
+      Hacl_Streaming_SHA3_update(s, msg + off, off + chunk > len ? len - off : chunk);
+    Hacl_Streaming_SHA3_finish(s, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    // finish must not consume the state
+    Hacl_Streaming_SHA3_finish(s, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    Hacl_Streaming_SHA3_free(s);
+
+    Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *e =
+      EverCrypt_Hash_Incremental_create_in(a);
+    for (uint32_t off = 0; off < len; off += chunk)
+      EverCrypt_Hash_Incremental_update(e, msg + off, off + chunk > len ? len - off : chunk);
+    EverCrypt_Hash_Incremental_finish(e, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    EverCrypt_Hash_Incremental_free(e);
+
+    EverCrypt_Hash_hash(a, tag, msg, len);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+  }
+  printf("%s streaming, all lengths: ", EverCrypt_Hash_string_of_alg(a));
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+// Squeezing in pieces must produce the same stream as a single squeeze.
+static bool check_shake(Spec_Hash_Definitions_hash_alg a) {
+  bool ok = true;
+  uint8_t out[MAX_LEN];
+  uint8_t expected[MAX_LEN];
+
+  for (uint32_t len = 0; len < MAX_LEN; len += 13) {
+    uint32_t chunk = 1 + len % 211;
+    uint32_t out_chunk = 1 + len % 97;
+    if (a == Spec_Hash_Definitions_Shake128)
+      Hacl_SHA3_shake128_hacl(len, msg, MAX_LEN, expected);
+    else
+      Hacl_SHA3_shake256_hacl(len, msg, MAX_LEN, expected);
+
+    Hacl_Streaming_SHA3_state *s = Hacl_Streaming_SHA3_create_in(a);
+    for (uint32_t off = 0; off < len; off += chunk)
+      Hacl_Streaming_SHA3_update(s, msg + off, off + chunk > len ? len - off : chunk);
+    for (uint32_t off = 0; off < MAX_LEN; off += out_chunk)
+      Hacl_Streaming_SHA3_squeeze(s, out + off, off + out_chunk > MAX_LEN ? MAX_LEN - off : out_chunk);
+    ok &= memcmp(out, expected, MAX_LEN) == 0;
+
+    // init brings the state back to absorbing
+    Hacl_Streaming_SHA3_init(s);
+    Hacl_Streaming_SHA3_update(s, msg, len);
+    Hacl_Streaming_SHA3_squeeze(s, out, 0);
+    Hacl_Streaming_SHA3_squeeze(s, out, MAX_LEN);
+    ok &= memcmp(out, expected, MAX_LEN) == 0;
+    Hacl_Streaming_SHA3_free(s);
+  }
+  printf("%s incremental squeeze: ", a == Spec_Hash_Definitions_Shake128 ? "SHAKE128" : "SHAKE256");
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(sha3_test_vector); i++) {
+    sha3_test_vector *v = &vectors[i];
+    uint8_t tag[300];
+    Spec_Hash_Definitions_hash_alg algs[4] = {
+      Spec_Hash_Definitions_SHA3_224, Spec_Hash_Definitions_SHA3_256,
+      Spec_Hash_Definitions_SHA3_384, Spec_Hash_Definitions_SHA3_512
+    };
+    uint8_t *expected[4] = { v->tag_224, v->tag_256, v->tag_384, v->tag_512 };
+
+    for (int j = 0; j < 4; j++) {
+      Hacl_Streaming_SHA3_state *s = Hacl_Streaming_SHA3_create_in(algs[j]);
+      Hacl_Streaming_SHA3_update(s, v->input, v->input_len);
+      Hacl_Streaming_SHA3_finish(s, tag);
+      ok &= compare_and_print(Hacl_Streaming_SHA3_hash_len(algs[j]), tag, expected[j]);
+      Hacl_Streaming_SHA3_free(s);
+    }
+
+    Hacl_Streaming_SHA3_state *s = Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_Shake128);
+    Hacl_Streaming_SHA3_update(s, v->input, v->input_len);
+    Hacl_Streaming_SHA3_squeeze(s, tag, 300);
+    ok &= compare_and_print(300, tag, v->shake128);
+    Hacl_Streaming_SHA3_free(s);
+
+    s = Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_Shake256);
+    Hacl_Streaming_SHA3_update(s, v->input, v->input_len);
+    Hacl_Streaming_SHA3_squeeze(s, tag, 300);
+    ok &= compare_and_print(300, tag, v->shake256);
+    Hacl_Streaming_SHA3_free(s);
+  }
+
+  srand(0);
+  for (int i = 0; i < MAX_LEN; i++)
+    msg[i] = (uint8_t)rand();
+
+  ok &= check_sha3(Spec_Hash_Definitions_SHA3_224);
+  ok &= check_sha3(Spec_Hash_Definitions_SHA3_256);
+  ok &= check_sha3(Spec_Hash_Definitions_SHA3_384);
+  ok &= check_sha3(Spec_Hash_Definitions_SHA3_512);
+  ok &= check_shake(Spec_Hash_Definitions_Shake128);
+  ok &= check_shake(Spec_Hash_Definitions_Shake256);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}
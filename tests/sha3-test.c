@@ -0,0 +1,133 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_SHA3.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 16384
+#define SIZE   16384
+
+static uint64_t rotl(uint64_t a, uint32_t b) {
+  return b == 0 ? a : a << b | a >> (64 - b);
+}
+
+// Keccak-f[1600] written directly from the FIPS 202 step mappings, lane
+// (x, y) at index x + 5y.
+static void keccak_f_ref(uint64_t *a) {
+  static const uint32_t r[5][5] = {
+    { 0, 36, 3, 41, 18 }, { 1, 44, 10, 45, 2 }, { 62, 6, 43, 15, 61 },
+    { 28, 55, 25, 21, 56 }, { 27, 20, 39, 8, 14 }
+  };
+  for (int round = 0; round < 24; round++) {
+    uint64_t c[5], b[25];
+    for (int x = 0; x < 5; x++)
+      c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+    for (int x = 0; x < 5; x++)
+      for (int y = 0; y < 5; y++)
+        a[x + 5 * y] ^= c[(x + 4) % 5] ^ rotl(c[(x + 1) % 5], 1);
+    for (int x = 0; x < 5; x++)
+      for (int y = 0; y < 5; y++)
+        b[y + 5 * ((2 * x + 3 * y) % 5)] = rotl(a[x + 5 * y], r[x][y]);
+    for (int x = 0; x < 5; x++)
+      for (int y = 0; y < 5; y++)
+        a[x + 5 * y] = b[x + 5 * y] ^ (~b[(x + 1) % 5 + 5 * y] & b[(x + 2) % 5 + 5 * y]);
+    a[0] ^= Hacl_Impl_SHA3_keccak_rndc[round];
+  }
+}
+
+// First lanes of Keccak-f[1600] applied once and twice to the all-zero state.
+static uint64_t zero_1[2] = { 0xF1258F7940E1DDE7ULL, 0x84D5CCF933C0478AULL };
+static uint64_t zero_2[2] = { 0x2D5C954DF96ECB3CULL, 0x6A332CD07057B56DULL };
+
+static void permute_unrolled(uint64_t *s) {
+  Hacl_Impl_SHA3_state_permute_rounds(24, s);
+}
+
+static bool check_permute(const char *name, void (*permute)(uint64_t *)) {
+  bool ok = true;
+  uint64_t s[25] = { 0 };
+  uint64_t t[25];
+
+  permute(s);
+  ok &= s[0] == zero_1[0] && s[1] == zero_1[1];
+  permute(s);
+  ok &= s[0] == zero_2[0] && s[1] == zero_2[1];
+
+  srand(0);
+  for (int i = 0; i < 25; i++)
+    s[i] = (uint64_t)rand() << 32 ^ (uint64_t)rand();
+  memcpy(t, s, sizeof s);
+  for (int i = 0; i < 10000; i++) {
+    permute(s);
+    keccak_f_ref(t);
+    ok &= memcmp(s, t, sizeof s) == 0;
+  }
+  printf("Keccak-f[1600] (%s) against the reference permutation: ", name);
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+static void bench_permute(const char *name, void (*permute)(uint64_t *)) {
+  uint64_t s[25] = { 0 };
+  cycles a,b;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS * 16; j++)
+    permute(s);
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Keccak-f[1600] (%s):\n", name);
+  print_time((uint64_t)ROUNDS * 16 * 200, t2 - t1, b - a);
+}
+
+int main() {
+  bool ok = true;
+  ok &= check_permute("verified", Hacl_Impl_SHA3_state_permute);
+  ok &= check_permute("unrolled", permute_unrolled);
+
+  uint8_t plain[SIZE];
+  cycles a,b;
+  clock_t t1,t2;
+  memset(plain,'P',SIZE);
+
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_sha3_256(SIZE,plain,plain);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_sha3_256(SIZE,plain,plain);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA3_shake128_hacl(SIZE,plain,32,plain);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  uint64_t cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("SHA3-256 (64-bit):\n"); print_time(count,tdiff1,cdiff1);
+  printf("SHAKE128 (64-bit):\n"); print_time(count,tdiff2,cdiff2);
+  bench_permute("verified", Hacl_Impl_SHA3_state_permute);
+  bench_permute("unrolled", permute_unrolled);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,392 @@
+#pragma once
+
+typedef struct {
+  uint8_t *input;
+  size_t input_len;
+  uint8_t tag_224[28];
+  uint8_t tag_256[32];
+  uint8_t tag_384[48];
+  uint8_t tag_512[64];
+  uint8_t shake128[300];
+  uint8_t shake256[300];
+} sha3_test_vector;
+
+static uint8_t input1[] = {
+  0x61U, 0x62U, 0x63U
+};
+
+static uint8_t input2[] = {
+};
+
+static uint8_t input3[] = {
+  0x03U, 0x0aU, 0x11U, 0x18U, 0x1fU, 0x26U, 0x2dU, 0x34U,
+  0x3bU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5eU, 0x65U, 0x6cU,
+  0x73U, 0x7aU, 0x81U, 0x88U, 0x8fU, 0x96U, 0x9dU, 0xa4U,
+  0xabU, 0xb2U, 0xb9U, 0xc0U, 0xc7U, 0xceU, 0xd5U, 0xdcU,
+  0xe3U, 0xeaU, 0xf1U, 0xf8U, 0xffU, 0x06U, 0x0dU, 0x14U,
+  0x1bU, 0x22U, 0x29U, 0x30U, 0x37U, 0x3eU, 0x45U, 0x4cU,
+  0x53U, 0x5aU, 0x61U, 0x68U, 0x6fU, 0x76U, 0x7dU, 0x84U,
+  0x8bU, 0x92U, 0x99U, 0xa0U, 0xa7U, 0xaeU, 0xb5U, 0xbcU,
+  0xc3U, 0xcaU, 0xd1U, 0xd8U, 0xdfU, 0xe6U, 0xedU, 0xf4U,
+  0xfbU, 0x02U, 0x09U, 0x10U, 0x17U, 0x1eU, 0x25U, 0x2cU,
+  0x33U, 0x3aU, 0x41U, 0x48U, 0x4fU, 0x56U, 0x5dU, 0x64U,
+  0x6bU, 0x72U, 0x79U, 0x80U, 0x87U, 0x8eU, 0x95U, 0x9cU,
+  0xa3U, 0xaaU, 0xb1U, 0xb8U, 0xbfU, 0xc6U, 0xcdU, 0xd4U,
+  0xdbU, 0xe2U, 0xe9U, 0xf0U, 0xf7U, 0xfeU, 0x05U, 0x0cU,
+  0x13U, 0x1aU, 0x21U, 0x28U, 0x2fU, 0x36U, 0x3dU, 0x44U,
+  0x4bU, 0x52U, 0x59U, 0x60U, 0x67U, 0x6eU, 0x75U, 0x7cU,
+  0x83U, 0x8aU, 0x91U, 0x98U, 0x9fU, 0xa6U, 0xadU, 0xb4U,
+  0xbbU, 0xc2U, 0xc9U, 0xd0U, 0xd7U, 0xdeU, 0xe5U, 0xecU,
+  0xf3U, 0xfaU, 0x01U, 0x08U, 0x0fU, 0x16U, 0x1dU, 0x24U,
+  0x2bU, 0x32U, 0x39U, 0x40U, 0x47U, 0x4eU, 0x55U, 0x5cU,
+  0x63U, 0x6aU, 0x71U, 0x78U, 0x7fU, 0x86U, 0x8dU, 0x94U,
+  0x9bU, 0xa2U, 0xa9U, 0xb0U, 0xb7U, 0xbeU, 0xc5U, 0xccU,
+  0xd3U, 0xdaU, 0xe1U, 0xe8U, 0xefU, 0xf6U, 0xfdU, 0x04U,
+  0x0bU, 0x12U, 0x19U, 0x20U, 0x27U, 0x2eU, 0x35U, 0x3cU,
+  0x43U, 0x4aU, 0x51U, 0x58U, 0x5fU, 0x66U, 0x6dU, 0x74U
+};
+
+static sha3_test_vector vectors[] = {
+  {
+    .input = input1,
+    .input_len = sizeof(input1),
+    .tag_224 = {
+      0xe6U, 0x42U, 0x82U, 0x4cU, 0x3fU, 0x8cU, 0xf2U, 0x4aU,
+      0xd0U, 0x92U, 0x34U, 0xeeU, 0x7dU, 0x3cU, 0x76U, 0x6fU,
+      0xc9U, 0xa3U, 0xa5U, 0x16U, 0x8dU, 0x0cU, 0x94U, 0xadU,
+      0x73U, 0xb4U, 0x6fU, 0xdfU
+    },
+    .tag_256 = {
+      0x3aU, 0x98U, 0x5dU, 0xa7U, 0x4fU, 0xe2U, 0x25U, 0xb2U,
+      0x04U, 0x5cU, 0x17U, 0x2dU, 0x6bU, 0xd3U, 0x90U, 0xbdU,
+      0x85U, 0x5fU, 0x08U, 0x6eU, 0x3eU, 0x9dU, 0x52U, 0x5bU,
+      0x46U, 0xbfU, 0xe2U, 0x45U, 0x11U, 0x43U, 0x15U, 0x32U
+    },
+    .tag_384 = {
+      0xecU, 0x01U, 0x49U, 0x82U, 0x88U, 0x51U, 0x6fU, 0xc9U,
+      0x26U, 0x45U, 0x9fU, 0x58U, 0xe2U, 0xc6U, 0xadU, 0x8dU,
+      0xf9U, 0xb4U, 0x73U, 0xcbU, 0x0fU, 0xc0U, 0x8cU, 0x25U,
+      0x96U, 0xdaU, 0x7cU, 0xf0U, 0xe4U, 0x9bU, 0xe4U, 0xb2U,
+      0x98U, 0xd8U, 0x8cU, 0xeaU, 0x92U, 0x7aU, 0xc7U, 0xf5U,
+      0x39U, 0xf1U, 0xedU, 0xf2U, 0x28U, 0x37U, 0x6dU, 0x25U
+    },
+    .tag_512 = {
+      0xb7U, 0x51U, 0x85U, 0x0bU, 0x1aU, 0x57U, 0x16U, 0x8aU,
+      0x56U, 0x93U, 0xcdU, 0x92U, 0x4bU, 0x6bU, 0x09U, 0x6eU,
+      0x08U, 0xf6U, 0x21U, 0x82U, 0x74U, 0x44U, 0xf7U, 0x0dU,
+      0x88U, 0x4fU, 0x5dU, 0x02U, 0x40U, 0xd2U, 0x71U, 0x2eU,
+      0x10U, 0xe1U, 0x16U, 0xe9U, 0x19U, 0x2aU, 0xf3U, 0xc9U,
+      0x1aU, 0x7eU, 0xc5U, 0x76U, 0x47U, 0xe3U, 0x93U, 0x40U,
+      0x57U, 0x34U, 0x0bU, 0x4cU, 0xf4U, 0x08U, 0xd5U, 0xa5U,
+      0x65U, 0x92U, 0xf8U, 0x27U, 0x4eU, 0xecU, 0x53U, 0xf0U
+    },
+    .shake128 = {
+      0x58U, 0x81U, 0x09U, 0x2dU, 0xd8U, 0x18U, 0xbfU, 0x5cU,
+      0xf8U, 0xa3U, 0xddU, 0xb7U, 0x93U, 0xfbU, 0xcbU, 0xa7U,
+      0x40U, 0x97U, 0xd5U, 0xc5U, 0x26U, 0xa6U, 0xd3U, 0x5fU,
+      0x97U, 0xb8U, 0x33U, 0x51U, 0x94U, 0x0fU, 0x2cU, 0xc8U,
+      0x44U, 0xc5U, 0x0aU, 0xf3U, 0x2aU, 0xcdU, 0x3fU, 0x2cU,
+      0xddU, 0x06U, 0x65U, 0x68U, 0x70U, 0x6fU, 0x50U, 0x9bU,
+      0xc1U, 0xbdU, 0xdeU, 0x58U, 0x29U, 0x5dU, 0xaeU, 0x3fU,
+      0x89U, 0x1aU, 0x9aU, 0x0fU, 0xcaU, 0x57U, 0x83U, 0x78U,
+      0x9aU, 0x41U, 0xf8U, 0x61U, 0x12U, 0x14U, 0xceU, 0x61U,
+      0x23U, 0x94U, 0xdfU, 0x28U, 0x6aU, 0x62U, 0xd1U, 0xa2U,
+      0x25U, 0x2aU, 0xa9U, 0x4dU, 0xb9U, 0xc5U, 0x38U, 0x95U,
+      0x6cU, 0x71U, 0x7dU, 0xc2U, 0xbeU, 0xd4U, 0xf2U, 0x32U,
+      0xa0U, 0x29U, 0x4cU, 0x85U, 0x7cU, 0x73U, 0x0aU, 0xa1U,
+      0x60U, 0x67U, 0xacU, 0x10U, 0x62U, 0xf1U, 0x20U, 0x1fU,
+      0xb0U, 0xd3U, 0x77U, 0xcfU, 0xb9U, 0xcdU, 0xe4U, 0xc6U,
+      0x35U, 0x99U, 0xb2U, 0x7fU, 0x34U, 0x62U, 0xbbU, 0xa4U,
+      0xa0U, 0xedU, 0x29U, 0x6cU, 0x80U, 0x1fU, 0x9fU, 0xf7U,
+      0xf5U, 0x73U, 0x02U, 0xbbU, 0x30U, 0x76U, 0xeeU, 0x14U,
+      0x5fU, 0x97U, 0xa3U, 0x2aU, 0xe6U, 0x8eU, 0x76U, 0xabU,
+      0x66U, 0xc4U, 0x8dU, 0x51U, 0x67U, 0x5bU, 0xd4U, 0x9aU,
+      0xccU, 0x29U, 0x08U, 0x2fU, 0x56U, 0x47U, 0x58U, 0x4eU,
+      0x6aU, 0xa0U, 0x1bU, 0x3fU, 0x5aU, 0xf0U, 0x57U, 0x80U,
+      0x5fU, 0x97U, 0x3fU, 0xf8U, 0xecU, 0xb8U, 0xb2U, 0x26U,
+      0xacU, 0x32U, 0xadU, 0xa6U, 0xf0U, 0x1cU, 0x1fU, 0xcdU,
+      0x48U, 0x18U, 0xcbU, 0x00U, 0x6aU, 0xa5U, 0xb4U, 0xcdU,
+      0xb3U, 0x61U, 0x1eU, 0xb1U, 0xe5U, 0x33U, 0xc8U, 0x96U,
+      0x4cU, 0xacU, 0xfdU, 0xf3U, 0x10U, 0x12U, 0xcdU, 0x3fU,
+      0xb7U, 0x44U, 0xd0U, 0x22U, 0x25U, 0xb9U, 0x88U, 0xb4U,
+      0x75U, 0x37U, 0x5fU, 0xaaU, 0xd9U, 0x96U, 0xebU, 0x1bU,
+      0x91U, 0x76U, 0xecU, 0xb0U, 0xf8U, 0xb2U, 0x87U, 0x17U,
+      0x23U, 0xd6U, 0xdbU, 0xb8U, 0x04U, 0xe2U, 0x33U, 0x57U,
+      0xe5U, 0x07U, 0x32U, 0xf5U, 0xcfU, 0xc9U, 0x04U, 0xb1U,
+      0x31U, 0x97U, 0x95U, 0x00U, 0x0dU, 0x73U, 0x61U, 0xd9U,
+      0xe5U, 0xe1U, 0xb7U, 0x7bU, 0x4bU, 0x8fU, 0x57U, 0x74U,
+      0xaaU, 0x14U, 0x82U, 0xcfU, 0xa5U, 0x8fU, 0x83U, 0x09U,
+      0x6bU, 0xdbU, 0x2eU, 0x06U, 0xa3U, 0xeeU, 0xd5U, 0x43U,
+      0xa3U, 0x89U, 0x19U, 0xb5U, 0x7eU, 0xcbU, 0xecU, 0x73U,
+      0x7fU, 0x40U, 0x86U, 0xbeU
+    },
+    .shake256 = {
+      0x48U, 0x33U, 0x66U, 0x60U, 0x13U, 0x60U, 0xa8U, 0x77U,
+      0x1cU, 0x68U, 0x63U, 0x08U, 0x0cU, 0xc4U, 0x11U, 0x4dU,
+      0x8dU, 0xb4U, 0x45U, 0x30U, 0xf8U, 0xf1U, 0xe1U, 0xeeU,
+      0x4fU, 0x94U, 0xeaU, 0x37U, 0xe7U, 0x8bU, 0x57U, 0x39U,
+      0xd5U, 0xa1U, 0x5bU, 0xefU, 0x18U, 0x6aU, 0x53U, 0x86U,
+      0xc7U, 0x57U, 0x44U, 0xc0U, 0x52U, 0x7eU, 0x1fU, 0xaaU,
+      0x9fU, 0x87U, 0x26U, 0xe4U, 0x62U, 0xa1U, 0x2aU, 0x4fU,
+      0xebU, 0x06U, 0xbdU, 0x88U, 0x01U, 0xe7U, 0x51U, 0xe4U,
+      0x13U, 0x85U, 0x14U, 0x12U, 0x04U, 0xf3U, 0x29U, 0x97U,
+      0x9fU, 0xd3U, 0x04U, 0x7aU, 0x13U, 0xc5U, 0x65U, 0x77U,
+      0x24U, 0xadU, 0xa6U, 0x4dU, 0x24U, 0x70U, 0x15U, 0x7bU,
+      0x3cU, 0xdcU, 0x28U, 0x86U, 0x20U, 0x94U, 0x4dU, 0x78U,
+      0xdbU, 0xcdU, 0xdbU, 0xd9U, 0x12U, 0x99U, 0x3fU, 0x09U,
+      0x13U, 0xf1U, 0x64U, 0xfbU, 0x2cU, 0xe9U, 0x51U, 0x31U,
+      0xa2U, 0xd0U, 0x9aU, 0x3eU, 0x6dU, 0x51U, 0xcbU, 0xfcU,
+      0x62U, 0x27U, 0x20U, 0xd7U, 0xa7U, 0x5cU, 0x63U, 0x34U,
+      0xe8U, 0xa2U, 0xd7U, 0xecU, 0x71U, 0xa7U, 0xccU, 0x29U,
+      0xcfU, 0x0eU, 0xa6U, 0x10U, 0xeeU, 0xffU, 0x1aU, 0x58U,
+      0x82U, 0x90U, 0xa5U, 0x30U, 0x00U, 0xfaU, 0xa7U, 0x99U,
+      0x32U, 0xbeU, 0xceU, 0xc0U, 0xbdU, 0x3cU, 0xd0U, 0xb3U,
+      0x3aU, 0x7eU, 0x5dU, 0x39U, 0x7fU, 0xedU, 0x1aU, 0xdaU,
+      0x94U, 0x42U, 0xb9U, 0x99U, 0x03U, 0xf4U, 0xdcU, 0xfdU,
+      0x85U, 0x59U, 0xedU, 0x39U, 0x50U, 0xfaU, 0xf4U, 0x0fU,
+      0xe6U, 0xf3U, 0xb5U, 0xd7U, 0x10U, 0xedU, 0x3bU, 0x67U,
+      0x75U, 0x13U, 0x77U, 0x1aU, 0xf6U, 0xbfU, 0xe1U, 0x19U,
+      0x34U, 0x81U, 0x7eU, 0x87U, 0x62U, 0xd9U, 0x89U, 0x6bU,
+      0xa5U, 0x79U, 0xd8U, 0x8dU, 0x84U, 0xbaU, 0x7aU, 0xa3U,
+      0xcdU, 0xc7U, 0x05U, 0x5fU, 0x67U, 0x96U, 0xf1U, 0x95U,
+      0xbdU, 0x9aU, 0xe7U, 0x88U, 0xf2U, 0xf5U, 0xbbU, 0x96U,
+      0x10U, 0x0dU, 0x6bU, 0xbaU, 0xffU, 0x7fU, 0xbcU, 0x6eU,
+      0xeaU, 0x24U, 0xd4U, 0x44U, 0x9aU, 0x24U, 0x77U, 0xd1U,
+      0x72U, 0xa5U, 0x50U, 0x7dU, 0xccU, 0x93U, 0x14U, 0x12U,
+      0xfcU, 0x34U, 0x6bU, 0x1bU, 0xb3U, 0x9bU, 0x87U, 0x83U,
+      0x30U, 0xe0U, 0x26U, 0xb1U, 0x2dU, 0xdfU, 0x38U, 0x4aU,
+      0xf3U, 0x33U, 0x45U, 0x60U, 0xeaU, 0x1dU, 0x36U, 0x39U,
+      0x66U, 0xcaU, 0xa7U, 0xd8U, 0xddU, 0xcbU, 0xecU, 0x7dU,
+      0xa5U, 0x2bU, 0x42U, 0x21U, 0x5cU, 0x11U, 0xd5U, 0xf8U,
+      0xeeU, 0x57U, 0xf3U, 0x41U
+    }
+  },
+  {
+    .input = input2,
+    .input_len = sizeof(input2),
+    .tag_224 = {
+      0x6bU, 0x4eU, 0x03U, 0x42U, 0x36U, 0x67U, 0xdbU, 0xb7U,
+      0x3bU, 0x6eU, 0x15U, 0x45U, 0x4fU, 0x0eU, 0xb1U, 0xabU,
+      0xd4U, 0x59U, 0x7fU, 0x9aU, 0x1bU, 0x07U, 0x8eU, 0x3fU,
+      0x5bU, 0x5aU, 0x6bU, 0xc7U
+    },
+    .tag_256 = {
+      0xa7U, 0xffU, 0xc6U, 0xf8U, 0xbfU, 0x1eU, 0xd7U, 0x66U,
+      0x51U, 0xc1U, 0x47U, 0x56U, 0xa0U, 0x61U, 0xd6U, 0x62U,
+      0xf5U, 0x80U, 0xffU, 0x4dU, 0xe4U, 0x3bU, 0x49U, 0xfaU,
+      0x82U, 0xd8U, 0x0aU, 0x4bU, 0x80U, 0xf8U, 0x43U, 0x4aU
+    },
+    .tag_384 = {
+      0x0cU, 0x63U, 0xa7U, 0x5bU, 0x84U, 0x5eU, 0x4fU, 0x7dU,
+      0x01U, 0x10U, 0x7dU, 0x85U, 0x2eU, 0x4cU, 0x24U, 0x85U,
+      0xc5U, 0x1aU, 0x50U, 0xaaU, 0xaaU, 0x94U, 0xfcU, 0x61U,
+      0x99U, 0x5eU, 0x71U, 0xbbU, 0xeeU, 0x98U, 0x3aU, 0x2aU,
+      0xc3U, 0x71U, 0x38U, 0x31U, 0x26U, 0x4aU, 0xdbU, 0x47U,
+      0xfbU, 0x6bU, 0xd1U, 0xe0U, 0x58U, 0xd5U, 0xf0U, 0x04U
+    },
+    .tag_512 = {
+      0xa6U, 0x9fU, 0x73U, 0xccU, 0xa2U, 0x3aU, 0x9aU, 0xc5U,
+      0xc8U, 0xb5U, 0x67U, 0xdcU, 0x18U, 0x5aU, 0x75U, 0x6eU,
+      0x97U, 0xc9U, 0x82U, 0x16U, 0x4fU, 0xe2U, 0x58U, 0x59U,
+      0xe0U, 0xd1U, 0xdcU, 0xc1U, 0x47U, 0x5cU, 0x80U, 0xa6U,
+      0x15U, 0xb2U, 0x12U, 0x3aU, 0xf1U, 0xf5U, 0xf9U, 0x4cU,
+      0x11U, 0xe3U, 0xe9U, 0x40U, 0x2cU, 0x3aU, 0xc5U, 0x58U,
+      0xf5U, 0x00U, 0x19U, 0x9dU, 0x95U, 0xb6U, 0xd3U, 0xe3U,
+      0x01U, 0x75U, 0x85U, 0x86U, 0x28U, 0x1dU, 0xcdU, 0x26U
+    },
+    .shake128 = {
+      0x7fU, 0x9cU, 0x2bU, 0xa4U, 0xe8U, 0x8fU, 0x82U, 0x7dU,
+      0x61U, 0x60U, 0x45U, 0x50U, 0x76U, 0x05U, 0x85U, 0x3eU,
+      0xd7U, 0x3bU, 0x80U, 0x93U, 0xf6U, 0xefU, 0xbcU, 0x88U,
+      0xebU, 0x1aU, 0x6eU, 0xacU, 0xfaU, 0x66U, 0xefU, 0x26U,
+      0x3cU, 0xb1U, 0xeeU, 0xa9U, 0x88U, 0x00U, 0x4bU, 0x93U,
+      0x10U, 0x3cU, 0xfbU, 0x0aU, 0xeeU, 0xfdU, 0x2aU, 0x68U,
+      0x6eU, 0x01U, 0xfaU, 0x4aU, 0x58U, 0xe8U, 0xa3U, 0x63U,
+      0x9cU, 0xa8U, 0xa1U, 0xe3U, 0xf9U, 0xaeU, 0x57U, 0xe2U,
+      0x35U, 0xb8U, 0xccU, 0x87U, 0x3cU, 0x23U, 0xdcU, 0x62U,
+      0xb8U, 0xd2U, 0x60U, 0x16U, 0x9aU, 0xfaU, 0x2fU, 0x75U,
+      0xabU, 0x91U, 0x6aU, 0x58U, 0xd9U, 0x74U, 0x91U, 0x88U,
+      0x35U, 0xd2U, 0x5eU, 0x6aU, 0x43U, 0x50U, 0x85U, 0xb2U,
+      0xbaU, 0xdfU, 0xd6U, 0xdfU, 0xaaU, 0xc3U, 0x59U, 0xa5U,
+      0xefU, 0xbbU, 0x7bU, 0xccU, 0x4bU, 0x59U, 0xd5U, 0x38U,
+      0xdfU, 0x9aU, 0x04U, 0x30U, 0x2eU, 0x10U, 0xc8U, 0xbcU,
+      0x1cU, 0xbfU, 0x1aU, 0x0bU, 0x3aU, 0x51U, 0x20U, 0xeaU,
+      0x17U, 0xcdU, 0xa7U, 0xcfU, 0xadU, 0x76U, 0x5fU, 0x56U,
+      0x23U, 0x47U, 0x4dU, 0x36U, 0x8cU, 0xccU, 0xa8U, 0xafU,
+      0x00U, 0x07U, 0xcdU, 0x9fU, 0x5eU, 0x4cU, 0x84U, 0x9fU,
+      0x16U, 0x7aU, 0x58U, 0x0bU, 0x14U, 0xaaU, 0xbdU, 0xefU,
+      0xaeU, 0xe7U, 0xeeU, 0xf4U, 0x7cU, 0xb0U, 0xfcU, 0xa9U,
+      0x76U, 0x7bU, 0xe1U, 0xfdU, 0xa6U, 0x94U, 0x19U, 0xdfU,
+      0xb9U, 0x27U, 0xe9U, 0xdfU, 0x07U, 0x34U, 0x8bU, 0x19U,
+      0x66U, 0x91U, 0xabU, 0xaeU, 0xb5U, 0x80U, 0xb3U, 0x2dU,
+      0xefU, 0x58U, 0x53U, 0x8bU, 0x8dU, 0x23U, 0xf8U, 0x77U,
+      0x32U, 0xeaU, 0x63U, 0xb0U, 0x2bU, 0x4fU, 0xa0U, 0xf4U,
+      0x87U, 0x33U, 0x60U, 0xe2U, 0x84U, 0x19U, 0x28U, 0xcdU,
+      0x60U, 0xddU, 0x4cU, 0xeeU, 0x8cU, 0xc0U, 0xd4U, 0xc9U,
+      0x22U, 0xa9U, 0x61U, 0x88U, 0xd0U, 0x32U, 0x67U, 0x5cU,
+      0x8aU, 0xc8U, 0x50U, 0x93U, 0x3cU, 0x7aU, 0xffU, 0x15U,
+      0x33U, 0xb9U, 0x4cU, 0x83U, 0x4aU, 0xdbU, 0xb6U, 0x9cU,
+      0x61U, 0x15U, 0xbaU, 0xd4U, 0x69U, 0x2dU, 0x86U, 0x19U,
+      0xf9U, 0x0bU, 0x0cU, 0xdfU, 0x8aU, 0x7bU, 0x9cU, 0x26U,
+      0x40U, 0x29U, 0xacU, 0x18U, 0x5bU, 0x70U, 0xb8U, 0x3fU,
+      0x28U, 0x01U, 0xf2U, 0xf4U, 0xb3U, 0xf7U, 0x0cU, 0x59U,
+      0x3eU, 0xa3U, 0xaeU, 0xebU, 0x61U, 0x3aU, 0x7fU, 0x1bU,
+      0x1dU, 0xe3U, 0x3fU, 0xd7U, 0x50U, 0x81U, 0xf5U, 0x92U,
+      0x30U, 0x5fU, 0x2eU, 0x45U
+    },
+    .shake256 = {
+      0x46U, 0xb9U, 0xddU, 0x2bU, 0x0bU, 0xa8U, 0x8dU, 0x13U,
+      0x23U, 0x3bU, 0x3fU, 0xebU, 0x74U, 0x3eU, 0xebU, 0x24U,
+      0x3fU, 0xcdU, 0x52U, 0xeaU, 0x62U, 0xb8U, 0x1bU, 0x82U,
+      0xb5U, 0x0cU, 0x27U, 0x64U, 0x6eU, 0xd5U, 0x76U, 0x2fU,
+      0xd7U, 0x5dU, 0xc4U, 0xddU, 0xd8U, 0xc0U, 0xf2U, 0x00U,
+      0xcbU, 0x05U, 0x01U, 0x9dU, 0x67U, 0xb5U, 0x92U, 0xf6U,
+      0xfcU, 0x82U, 0x1cU, 0x49U, 0x47U, 0x9aU, 0xb4U, 0x86U,
+      0x40U, 0x29U, 0x2eU, 0xacU, 0xb3U, 0xb7U, 0xc4U, 0xbeU,
+      0x14U, 0x1eU, 0x96U, 0x61U, 0x6fU, 0xb1U, 0x39U, 0x57U,
+      0x69U, 0x2cU, 0xc7U, 0xedU, 0xd0U, 0xb4U, 0x5aU, 0xe3U,
+      0xdcU, 0x07U, 0x22U, 0x3cU, 0x8eU, 0x92U, 0x93U, 0x7bU,
+      0xefU, 0x84U, 0xbcU, 0x0eU, 0xabU, 0x86U, 0x28U, 0x53U,
+      0x34U, 0x9eU, 0xc7U, 0x55U, 0x46U, 0xf5U, 0x8fU, 0xb7U,
+      0xc2U, 0x77U, 0x5cU, 0x38U, 0x46U, 0x2cU, 0x50U, 0x10U,
+      0xd8U, 0x46U, 0xc1U, 0x85U, 0xc1U, 0x51U, 0x11U, 0xe5U,
+      0x95U, 0x52U, 0x2aU, 0x6bU, 0xcdU, 0x16U, 0xcfU, 0x86U,
+      0xf3U, 0xd1U, 0x22U, 0x10U, 0x9eU, 0x3bU, 0x1fU, 0xddU,
+      0x94U, 0x3bU, 0x6aU, 0xecU, 0x46U, 0x8aU, 0x2dU, 0x62U,
+      0x1aU, 0x7cU, 0x06U, 0xc6U, 0xa9U, 0x57U, 0xc6U, 0x2bU,
+      0x54U, 0xdaU, 0xfcU, 0x3bU, 0xe8U, 0x75U, 0x67U, 0xd6U,
+      0x77U, 0x23U, 0x13U, 0x95U, 0xf6U, 0x14U, 0x72U, 0x93U,
+      0xb6U, 0x8cU, 0xeaU, 0xb7U, 0xa9U, 0xe0U, 0xc5U, 0x8dU,
+      0x86U, 0x4eU, 0x8eU, 0xfdU, 0xe4U, 0xe1U, 0xb9U, 0xa4U,
+      0x6cU, 0xbeU, 0x85U, 0x47U, 0x13U, 0x67U, 0x2fU, 0x5cU,
+      0xaaU, 0xaeU, 0x31U, 0x4eU, 0xd9U, 0x08U, 0x3dU, 0xabU,
+      0x4bU, 0x09U, 0x9fU, 0x8eU, 0x30U, 0x0fU, 0x01U, 0xb8U,
+      0x65U, 0x0fU, 0x1fU, 0x4bU, 0x1dU, 0x8fU, 0xcfU, 0x3fU,
+      0x3cU, 0xb5U, 0x3fU, 0xb8U, 0xe9U, 0xebU, 0x2eU, 0xa2U,
+      0x03U, 0xbdU, 0xc9U, 0x70U, 0xf5U, 0x0aU, 0xe5U, 0x54U,
+      0x28U, 0xa9U, 0x1fU, 0x7fU, 0x53U, 0xacU, 0x26U, 0x6bU,
+      0x28U, 0x41U, 0x9cU, 0x37U, 0x78U, 0xa1U, 0x5fU, 0xd2U,
+      0x48U, 0xd3U, 0x39U, 0xedU, 0xe7U, 0x85U, 0xfbU, 0x7fU,
+      0x5aU, 0x1aU, 0xaaU, 0x96U, 0xd3U, 0x13U, 0xeaU, 0xccU,
+      0x89U, 0x09U, 0x36U, 0xc1U, 0x73U, 0xcdU, 0xcdU, 0x0fU,
+      0xabU, 0x88U, 0x2cU, 0x45U, 0x75U, 0x5fU, 0xebU, 0x3aU,
+      0xedU, 0x96U, 0xd4U, 0x77U, 0xffU, 0x96U, 0x39U, 0x0bU,
+      0xf9U, 0xa6U, 0x6dU, 0x13U, 0x68U, 0xb2U, 0x08U, 0xe2U,
+      0x1fU, 0x7cU, 0x10U, 0xd0U
+    }
+  },
+  {
+    .input = input3,
+    .input_len = sizeof(input3),
+    .tag_224 = {
+      0x37U, 0xeeU, 0xedU, 0x4cU, 0xfbU, 0x71U, 0xdaU, 0xf1U,
+      0x36U, 0xe5U, 0xaaU, 0x95U, 0xaeU, 0xe6U, 0x16U, 0x50U,
+      0xe8U, 0x84U, 0xe2U, 0x97U, 0x56U, 0xbbU, 0xf8U, 0x4cU,
+      0x4bU, 0x3dU, 0x5dU, 0xcbU
+    },
+    .tag_256 = {
+      0x9dU, 0xa3U, 0x7eU, 0xa2U, 0xfbU, 0x33U, 0xacU, 0xd5U,
+      0x63U, 0xa0U, 0x14U, 0xf5U, 0x0dU, 0x6fU, 0x7cU, 0xc2U,
+      0x25U, 0xf2U, 0x55U, 0x77U, 0xa8U, 0x1dU, 0x90U, 0x04U,
+      0x52U, 0xb7U, 0x2bU, 0x5dU, 0xe9U, 0x8fU, 0x23U, 0x9dU
+    },
+    .tag_384 = {
+      0x5eU, 0x20U, 0x84U, 0x96U, 0xa4U, 0xbcU, 0x98U, 0xb6U,
+      0x08U, 0x36U, 0xa5U, 0xc0U, 0x4dU, 0x9aU, 0xe8U, 0x97U,
+      0x68U, 0x42U, 0x3aU, 0x5eU, 0xb5U, 0x88U, 0x1cU, 0x54U,
+      0x3eU, 0x94U, 0x78U, 0x21U, 0x06U, 0x22U, 0xefU, 0x46U,
+      0x15U, 0xb8U, 0xb5U, 0xfcU, 0xd0U, 0xb0U, 0xdcU, 0x2bU,
+      0x7dU, 0xc2U, 0xa0U, 0x98U, 0x83U, 0xf9U, 0x87U, 0xb4U
+    },
+    .tag_512 = {
+      0x14U, 0xfbU, 0x36U, 0xd3U, 0x33U, 0xd3U, 0x4fU, 0xccU,
+      0xb3U, 0x8cU, 0x88U, 0x01U, 0xd7U, 0x69U, 0x2cU, 0x93U,
+      0x50U, 0xa3U, 0x24U, 0xcbU, 0xc4U, 0x44U, 0x48U, 0xb6U,
+      0x3aU, 0xcaU, 0x9dU, 0x3cU, 0xfdU, 0xb1U, 0x2fU, 0xb5U,
+      0x2aU, 0x08U, 0x93U, 0x4fU, 0xefU, 0xdaU, 0x15U, 0x77U,
+      0x96U, 0x73U, 0x58U, 0x71U, 0xf1U, 0x54U, 0x1dU, 0x1eU,
+      0x5bU, 0xcbU, 0x70U, 0xcbU, 0x03U, 0xcaU, 0x13U, 0x18U,
+      0x6cU, 0x94U, 0xc5U, 0xc4U, 0x5eU, 0x1fU, 0x1cU, 0xadU
+    },
+    .shake128 = {
+      0x24U, 0x3aU, 0x1dU, 0xe2U, 0x43U, 0xbdU, 0x9dU, 0xceU,
+      0x31U, 0x8aU, 0x21U, 0x7dU, 0x75U, 0xb1U, 0xb0U, 0x26U,
+      0x98U, 0x5cU, 0x06U, 0xb5U, 0xdeU, 0x48U, 0x0fU, 0xc6U,
+      0x23U, 0x61U, 0x43U, 0xb6U, 0x63U, 0xf7U, 0xfeU, 0x2cU,
+      0xe7U, 0xe2U, 0xf2U, 0x63U, 0xc0U, 0xb4U, 0x8aU, 0x55U,
+      0x9eU, 0x25U, 0x00U, 0xfbU, 0xa0U, 0xfdU, 0xc1U, 0xedU,
+      0xe9U, 0x67U, 0x2bU, 0xccU, 0x20U, 0xa5U, 0x97U, 0x71U,
+      0x14U, 0x2bU, 0xabU, 0x36U, 0x04U, 0x20U, 0xc3U, 0xa9U,
+      0x8bU, 0xdfU, 0xc1U, 0x16U, 0x1aU, 0x7dU, 0x3aU, 0x68U,
+      0xb1U, 0x8cU, 0x80U, 0x02U, 0x51U, 0x80U, 0xc5U, 0xc8U,
+      0x0cU, 0x35U, 0x79U, 0x77U, 0xcdU, 0x0bU, 0x0dU, 0xa6U,
+      0x56U, 0xa0U, 0x4dU, 0x3eU, 0x12U, 0xefU, 0x4eU, 0x5cU,
+      0xa8U, 0xb0U, 0xc6U, 0xa3U, 0x73U, 0x1eU, 0xecU, 0xfaU,
+      0xdbU, 0xf3U, 0x8eU, 0x41U, 0xdeU, 0x58U, 0x8eU, 0x52U,
+      0xb0U, 0xf9U, 0x56U, 0x14U, 0x0bU, 0x15U, 0x93U, 0x45U,
+      0xa1U, 0x1aU, 0x71U, 0x1aU, 0xb0U, 0x41U, 0x01U, 0xfaU,
+      0x31U, 0x42U, 0x88U, 0x25U, 0xd9U, 0x5bU, 0x30U, 0x26U,
+      0xa9U, 0x49U, 0x46U, 0x29U, 0x53U, 0xefU, 0x8bU, 0xd8U,
+      0x04U, 0x15U, 0xe4U, 0xefU, 0x6bU, 0xc8U, 0x73U, 0x72U,
+      0xb9U, 0x00U, 0x88U, 0x65U, 0xa2U, 0x09U, 0xb4U, 0xe6U,
+      0xa3U, 0x77U, 0x0cU, 0xaeU, 0x7dU, 0x47U, 0x5eU, 0xb8U,
+      0xcaU, 0x31U, 0x97U, 0xb2U, 0x92U, 0xf4U, 0x7cU, 0xadU,
+      0x2cU, 0x37U, 0x8aU, 0xf9U, 0xb2U, 0x09U, 0xdfU, 0x0eU,
+      0xc4U, 0xb3U, 0x04U, 0x04U, 0x4eU, 0x23U, 0xb0U, 0x28U,
+      0xb5U, 0x8cU, 0xb4U, 0x3fU, 0xc0U, 0x2bU, 0xdfU, 0xaaU,
+      0x8aU, 0x9bU, 0x21U, 0x33U, 0xbfU, 0x27U, 0xf1U, 0xa0U,
+      0xffU, 0x5fU, 0x9dU, 0x52U, 0x38U, 0x66U, 0x3eU, 0xbaU,
+      0x2bU, 0xe0U, 0xe9U, 0x22U, 0x28U, 0x0cU, 0xafU, 0x63U,
+      0xeeU, 0xb2U, 0x2cU, 0xeaU, 0xcbU, 0x65U, 0xd9U, 0x13U,
+      0x0aU, 0x82U, 0x48U, 0x10U, 0x17U, 0xf2U, 0x48U, 0x65U,
+      0xb5U, 0x9eU, 0xa9U, 0xdbU, 0xa8U, 0xe7U, 0xcdU, 0xdcU,
+      0x00U, 0x9cU, 0xe0U, 0x7eU, 0x33U, 0xefU, 0xf6U, 0x89U,
+      0xb9U, 0x63U, 0x08U, 0x4aU, 0x62U, 0xbfU, 0x2eU, 0xacU,
+      0x8aU, 0xbfU, 0xacU, 0xc4U, 0xe8U, 0x53U, 0x58U, 0xa7U,
+      0x4eU, 0x75U, 0xdeU, 0x0bU, 0xd9U, 0x6dU, 0x80U, 0xcfU,
+      0x45U, 0x13U, 0xb1U, 0x5bU, 0xeeU, 0xd3U, 0x98U, 0x1bU,
+      0x7bU, 0x8eU, 0x3fU, 0x6aU, 0xbaU, 0x1dU, 0x6bU, 0xc3U,
+      0x01U, 0x88U, 0x6cU, 0x73U
+    },
+    .shake256 = {
+      0xcdU, 0x24U, 0x48U, 0x2eU, 0x6eU, 0x8eU, 0xcaU, 0x55U,
+      0x6bU, 0xceU, 0x1cU, 0xadU, 0x6dU, 0xfeU, 0xc6U, 0xf4U,
+      0xb5U, 0x3bU, 0xacU, 0x32U, 0xf6U, 0xa0U, 0xebU, 0x0aU,
+      0x99U, 0xaaU, 0xafU, 0x25U, 0x01U, 0x8dU, 0xb3U, 0xc1U,
+      0x59U, 0x3cU, 0xc1U, 0x30U, 0x4bU, 0x2eU, 0x7bU, 0x90U,
+      0x75U, 0xf1U, 0x8aU, 0x93U, 0x63U, 0x85U, 0x30U, 0xf3U,
+      0xdfU, 0xd5U, 0x24U, 0x24U, 0xa9U, 0x82U, 0xcfU, 0xa0U,
+      0x81U, 0xbfU, 0x49U, 0x58U, 0x0bU, 0xdaU, 0x2bU, 0xd0U,
+      0xc6U, 0x05U, 0x58U, 0x7fU, 0xe9U, 0x05U, 0xceU, 0x7cU,
+      0x58U, 0x81U, 0xf4U, 0xc8U, 0xa9U, 0x63U, 0xb5U, 0xa8U,
+      0xceU, 0xbfU, 0x47U, 0x01U, 0x9bU, 0xbbU, 0x11U, 0x05U,
+      0x0aU, 0x2aU, 0x93U, 0x33U, 0x62U, 0xecU, 0xf8U, 0x9eU,
+      0xacU, 0xceU, 0xb5U, 0x85U, 0x58U, 0x60U, 0x9cU, 0xceU,
+      0xddU, 0x4fU, 0xddU, 0xa7U, 0x78U, 0x35U, 0xe8U, 0x2dU,
+      0x6fU, 0x61U, 0x90U, 0xdeU, 0x41U, 0x1eU, 0x5aU, 0xc9U,
+      0xf2U, 0x46U, 0xa1U, 0xcaU, 0x4dU, 0x3fU, 0x68U, 0xd1U,
+      0x65U, 0x44U, 0x73U, 0xc2U, 0xf8U, 0x6aU, 0x38U, 0x23U,
+      0x73U, 0xfcU, 0xf6U, 0x2aU, 0xd7U, 0xf5U, 0xa6U, 0xd9U,
+      0xdfU, 0x28U, 0x4cU, 0x99U, 0x76U, 0xcdU, 0xffU, 0xefU,
+      0xfdU, 0xcfU, 0x87U, 0x5eU, 0x9cU, 0x39U, 0xeaU, 0x79U,
+      0x90U, 0x54U, 0xc6U, 0xaeU, 0x4cU, 0x6eU, 0x82U, 0xd0U,
+      0x95U, 0x02U, 0xe1U, 0x5aU, 0xd2U, 0x06U, 0xc6U, 0xc5U,
+      0x68U, 0xbcU, 0x09U, 0xf8U, 0x12U, 0xe1U, 0x17U, 0x51U,
+      0x4aU, 0x7cU, 0x2fU, 0xdaU, 0xa7U, 0x30U, 0x63U, 0xebU,
+      0xf1U, 0x2eU, 0xc6U, 0x2eU, 0xfbU, 0x2fU, 0xdbU, 0x3eU,
+      0xf5U, 0xb5U, 0xfeU, 0xc1U, 0x58U, 0x98U, 0xfeU, 0x29U,
+      0x0fU, 0x8eU, 0x31U, 0x91U, 0x86U, 0xbcU, 0x22U, 0xc9U,
+      0x0fU, 0x4bU, 0x83U, 0xb0U, 0xbaU, 0x61U, 0x99U, 0x72U,
+      0xc3U, 0x5fU, 0xc6U, 0x68U, 0x4cU, 0xf0U, 0xe3U, 0xd4U,
+      0x5cU, 0x52U, 0x20U, 0x2eU, 0xb9U, 0x04U, 0xdaU, 0xe6U,
+      0xf0U, 0x1dU, 0x1eU, 0x1bU, 0xd0U, 0xfcU, 0x0bU, 0xfeU,
+      0x17U, 0x66U, 0x6dU, 0x8bU, 0x06U, 0x32U, 0xc5U, 0x6dU,
+      0xc6U, 0x94U, 0xbbU, 0xeeU, 0xa6U, 0x33U, 0x09U, 0x9aU,
+      0x37U, 0x0cU, 0x6fU, 0x33U, 0xb2U, 0x98U, 0xc9U, 0xf8U,
+      0x08U, 0x89U, 0x8bU, 0x55U, 0xa8U, 0x62U, 0xfbU, 0x3aU,
+      0x5bU, 0xdaU, 0x79U, 0x43U, 0xc7U, 0xd2U, 0xcaU, 0xc0U,
+      0x99U, 0xa2U, 0x4cU, 0xedU, 0xbaU, 0x3dU, 0xd3U, 0x9bU,
+      0x36U, 0x09U, 0x32U, 0x5cU
+    }
+  }
+};
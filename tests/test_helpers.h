@@ -107,3 +107,24 @@ static inline void print_time(uint64_t count, clock_t tdiff, uint64_t cdiff){
   printf("time for %" PRIu64 " bytes: %" PRIu64 " (%.2fus/byte)\n",count,(uint64_t)tdiff,(double)tdiff/count);
   printf("bw %8.2f MB/s\n",(double)count/(((double)tdiff / CLOCKS_PER_SEC) * 1000000.0));
 }
+
+// The skeleton shared by the benchmarks: print what is measured, then run the
+// loop between bench_start and bench_stop, which prints the timings for count
+// bytes.
+typedef struct {
+  cycles c;
+  clock_t t;
+} bench_timer;
+
+static inline bench_timer bench_start(void) {
+  bench_timer b;
+  b.t = clock();
+  b.c = cpucycles_begin();
+  return b;
+}
+
+static inline void bench_stop(bench_timer b, uint64_t count) {
+  cycles c = cpucycles_end();
+  clock_t t = clock();
+  print_time(count, t - b.t, c - b.c);
+}